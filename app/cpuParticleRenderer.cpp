@@ -0,0 +1,144 @@
+#include "cpuParticleRenderer.h"
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "helpers/helpers.h"
+#include "pipelineState.h"
+#include "shaderProgram.h"
+#include "uniforms.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief The binding point of the buffer, from which particles are read by the vertex shader.
+     */
+    constexpr auto particlesBinding = GLuint{0};
+    /**
+     * \brief A number of vertices of the billboard (two triangles).
+     */
+    constexpr auto verticesPerQuad  = GLsizei{6};
+
+}  // namespace
+
+class CpuParticleRenderer::Impl
+{
+    public:
+        explicit Impl(uint32_t maxParticlesCount) : capacity{maxParticlesCount}
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore;
+            using namespace ogls::oglCore::vertex;
+
+
+            if (capacity == 0)
+            {
+                throw std::invalid_argument{"The capacity of the particle renderer must be greater than 0."};
+            }
+
+            particlesBuffer = std::make_unique<Buffer>(
+              BufferTarget::ShaderStorageBuffer,
+              ArrayData{nullptr, size_t{capacity} * sizeof(particles::ParticleVertex)}, BufferDataUsage::StreamDraw);
+
+            auto program = std::shared_ptr<shader::ShaderProgram>{shader::makeShaderProgram(
+              "resources/shaders/vs/gpuParticle.vert", "resources/shaders/fs/gpuParticle.frag")};
+            projection   = &program->getMatrixUniform<4, 4>("uProjection");
+            view         = &program->getMatrixUniform<4, 4>("uView");
+
+            // Particles are additive, so they needn't be sorted, and they don't write the depth
+            auto blend      = pipeline::BlendState{};
+            blend.dstAlpha  = pipeline::BlendFactor::One;
+            blend.dstRgb    = pipeline::BlendFactor::One;
+            blend.isEnabled = true;
+            blend.srcAlpha  = pipeline::BlendFactor::Zero;
+            blend.srcRgb    = pipeline::BlendFactor::SrcAlpha;
+
+            auto depth             = pipeline::DepthState{};
+            depth.function         = pipeline::CompareFunction::Lequal;
+            depth.isTestEnabled    = true;
+            depth.isWritingEnabled = false;
+
+            pipelineState = pipeline::pipelineStateManager::create({.blend{blend},
+                                                                    .depth{depth},
+                                                                    .raster{},
+                                                                    .shaderProgram{std::move(program)},
+                                                                    .vertexArray{std::make_shared<VertexArray>()}});
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        const uint32_t                                                capacity;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>                particlesBuffer;
+        std::shared_ptr<const ogls::oglCore::pipeline::PipelineState> pipelineState    = nullptr;
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   projection       = nullptr;
+        ogls::mathCore::Mat4                                          projectionMatrix;
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   view             = nullptr;
+        ogls::mathCore::Mat4                                          viewMatrix;
+
+};  // class CpuParticleRenderer::Impl
+
+CpuParticleRenderer::CpuParticleRenderer(uint32_t capacity) : m_impl{std::make_unique<Impl>(capacity)}
+{
+}
+
+CpuParticleRenderer::CpuParticleRenderer(CpuParticleRenderer&& obj) noexcept = default;
+
+CpuParticleRenderer::~CpuParticleRenderer() noexcept = default;
+
+CpuParticleRenderer& CpuParticleRenderer::operator=(CpuParticleRenderer&& obj) noexcept = default;
+
+void CpuParticleRenderer::render(const ogls::particles::CpuParticleSystem& particles)
+{
+    using namespace ogls;
+    using namespace ogls::oglCore;
+    using namespace ogls::oglCore::vertex;
+
+
+    auto&      impl  = *m_impl;
+    const auto count = std::min(particles.getAliveCount(), size_t{impl.capacity});
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // The invalidated range needn't be synchronized with draws of the previous frame, which still read the old one
+    const auto mapped = impl.particlesBuffer->mapRange(
+      0, static_cast<GLsizeiptr>(count * sizeof(particles::ParticleVertex)),
+      helpers::toUType(BufferMapAccessBit::MapWriteBit) | helpers::toUType(BufferMapAccessBit::MapInvalidateBufferBit));
+    const auto written =
+      particles.writeVertices(std::span{static_cast<particles::ParticleVertex*>(mapped), count});
+    if (!impl.particlesBuffer->unmap())
+    {
+        // The data store has been lost, the next frame writes particles again
+        return;
+    }
+
+    pipeline::pipelineStateManager::apply(*impl.pipelineState);
+    impl.projection->setData(impl.projectionMatrix);
+    impl.view->setData(impl.viewMatrix);
+
+    impl.particlesBuffer->bindBase(BufferTarget::ShaderStorageBuffer, particlesBinding);
+
+    OGLS_GLCall(glDrawArraysInstanced(GL_TRIANGLES, 0, verticesPerQuad, static_cast<GLsizei>(written)));
+}
+
+void CpuParticleRenderer::setCamera(const ogls::mathCore::TransformMatrix& view,
+                                    const ogls::mathCore::TransformMatrix& projection)
+{
+    m_impl->projectionMatrix = projection.getResultMatrix();
+    m_impl->viewMatrix       = view.getResultMatrix();
+}
+
+}  // namespace app::renderer
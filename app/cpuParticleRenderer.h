@@ -0,0 +1,78 @@
+#ifndef APP_RENDERER_CPU_PARTICLE_RENDERER_H
+#define APP_RENDERER_CPU_PARTICLE_RENDERER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "cpuParticleSystem.h"
+#include "helpers/macros.h"
+#include "mathCore/transformMatrix.h"
+
+namespace app::renderer
+{
+/**
+ * \brief CpuParticleRenderer draws particles of ogls::particles::CpuParticleSystem.
+ *
+ * Every frame alive particles are written by worker threads straight into the mapped shader storage buffer, which
+ * is invalidated on mapping, so the driver gives new memory instead of waiting for the GPU to finish the previous
+ * frame. Particles are drawn by the same billboard shaders as GpuParticleSystem, so both systems look the same.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * particles.update(deltaTime);
+ * particlesRenderer.setCamera(view, projection);
+ * particlesRenderer.render(particles);
+ * \endcode
+ */
+class CpuParticleRenderer final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of CpuParticleRenderer.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new CpuParticleRenderer, creates the buffer, the shader program and the pipeline state.
+         *
+         * \param capacity - the maximal number of particles, which are drawn. It is usually the capacity of
+         *                   the particle system.
+         * \throw std::invalid_argument, if the capacity is 0,
+         * ogls::exceptions::GLRecAcquisitionException(), if OpenGL objects can't be created,
+         * exceptions, which can be thrown by makeShaderProgram().
+         */
+        explicit CpuParticleRenderer(uint32_t capacity);
+        OGLS_NOT_COPYABLE(CpuParticleRenderer)
+        CpuParticleRenderer(CpuParticleRenderer&& obj) noexcept;
+        ~CpuParticleRenderer() noexcept;
+
+        CpuParticleRenderer& operator=(CpuParticleRenderer&& obj) noexcept;
+
+        /**
+         * \brief Uploads alive particles and draws them as billboards, which face the camera, with the additive
+         * blending.
+         *
+         * \param particles - the particle system. Particles above the capacity of the renderer aren't drawn.
+         * \throw exceptions, which can be thrown by ogls::oglCore::vertex::Buffer::mapRange().
+         */
+        void render(const ogls::particles::CpuParticleSystem& particles);
+        /**
+         * \brief Sets the camera, to which billboards are turned.
+         *
+         * \param view       - the view transformation.
+         * \param projection - the perspective or orthographic projection.
+         */
+        void setCamera(const ogls::mathCore::TransformMatrix& view, const ogls::mathCore::TransformMatrix& projection);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class CpuParticleRenderer
+
+}  // namespace app::renderer
+
+#endif
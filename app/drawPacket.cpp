@@ -0,0 +1,78 @@
+#include "drawPacket.h"
+
+#include <algorithm>
+
+#include <glad/glad.h>
+
+#include "helpers/debugHelpers.h"
+#include "pipelineState.h"
+#include "query.h"
+#include "textureUnit.h"
+
+namespace app::renderer
+{
+size_t submitDrawPackets(std::span<DrawPacket> packets, RenderResources& resources)
+{
+    using namespace ogls::oglCore;
+
+
+    std::sort(packets.begin(), packets.end(),
+              [](const DrawPacket& a, const DrawPacket& b) { return a.sortKey < b.sortKey; });
+
+    auto currentMaterialHandle = MaterialHandle{};
+    auto currentMeshHandle     = MeshHandle{};
+    auto material              = static_cast<const Material*>(nullptr);
+    auto mesh                  = static_cast<const Mesh*>(nullptr);
+    auto drawCallsCount        = size_t{0};
+
+    for (const auto& packet : packets)
+    {
+        const auto isMaterialChanged = packet.material != currentMaterialHandle;
+        const auto isMeshChanged     = packet.mesh != currentMeshHandle;
+
+        if (isMaterialChanged || isMeshChanged)
+        {
+            const auto newMaterial = isMaterialChanged ? resources.getMaterial(packet.material) : material;
+            const auto newMesh     = isMeshChanged ? resources.getMesh(packet.mesh) : mesh;
+            if (!newMaterial || !newMesh)
+            {
+                continue;
+            }
+
+            pipeline::pipelineStateManager::apply(resources.getPipelineState(packet.mesh, packet.material));
+            if (isMaterialChanged)
+            {
+                texture::applyTexturesConfiguration(newMaterial->textures);
+            }
+
+            currentMaterialHandle = packet.material;
+            currentMeshHandle     = packet.mesh;
+            material              = newMaterial;
+            mesh                  = newMesh;
+        }
+
+        if (material->modelMatrix && packet.worldMatrix)
+        {
+            material->modelMatrix->setData(*packet.worldMatrix);
+        }
+
+        if (packet.occlusionQuery)
+        {
+            packet.occlusionQuery->beginConditionalRender(query::ConditionalRenderMode::NoWait);
+        }
+
+        const auto& lod = mesh->lods[std::min<size_t>(packet.lod, mesh->lods.size() - 1)];
+        OGLS_GLCall(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lod.indicesCount), GL_UNSIGNED_INT,
+                                   reinterpret_cast<const void*>(size_t{lod.indicesOffset} * sizeof(GLuint))));
+
+        if (packet.occlusionQuery)
+        {
+            query::Query::endConditionalRender();
+        }
+        ++drawCallsCount;
+    }
+
+    return drawCallsCount;
+}
+
+}  // namespace app::renderer
@@ -0,0 +1,73 @@
+#ifndef APP_RENDERER_DRAW_PACKET_H
+#define APP_RENDERER_DRAW_PACKET_H
+
+#include <cstdint>
+#include <span>
+
+#include "mathCore/matrix.h"
+#include "query.h"
+#include "renderResources.h"
+
+namespace app::renderer
+{
+/**
+ * \brief DrawPacket is everything, what is needed to issue one draw call of the entity.
+ *
+ * Packets don't own anything and are supposed to be rebuilt every frame into the vector, which is allocated from
+ * the arena of the frame.
+ */
+struct DrawPacket final
+{
+        /**
+         * \brief The level of detail of the mesh (see Mesh::lods). It is clamped to the coarsest level of the mesh.
+         */
+        uint32_t                           lod            = {0};
+        /**
+         * \brief The material of the entity.
+         */
+        MaterialHandle                     material;
+        /**
+         * \brief The mesh of the entity.
+         */
+        MeshHandle                         mesh;
+        /**
+         * \brief The occlusion query of the hidden entity. If it is set, the entity is drawn with the conditional
+         * rendering, so the GPU discards it if its box has passed no samples.
+         */
+        const ogls::oglCore::query::Query* occlusionQuery = nullptr;
+        /**
+         * \brief The key, by which packets are sorted to minimize state changes (see makeDrawPacketSortKey()).
+         */
+        uint64_t                           sortKey        = {0};
+        /**
+         * \brief The world matrix of the entity, which is stored in EntityStore.
+         */
+        const ogls::mathCore::Mat4*        worldMatrix    = nullptr;
+
+};  // struct DrawPacket
+
+/**
+ * \brief Makes the sort key, which groups packets by the material at first and by the mesh after that.
+ */
+constexpr uint64_t makeDrawPacketSortKey(MeshHandle mesh, MaterialHandle material) noexcept
+{
+    return (uint64_t{material.index} << 32) | mesh.index;
+}
+
+/**
+ * \brief Sorts packets by the sort key and issues draw calls.
+ *
+ * The pipeline state is applied only when the mesh or the material differs from the previous packet, textures are
+ * applied only when the material changes. Levels of detail of the mesh share its vertex array object, so switching
+ * them changes only the range of indices. Packets with occlusion queries are drawn with the conditional rendering,
+ * which doesn't wait for results of queries. Packets with stale handles are skipped.
+ *
+ * \param packets   - packets to draw. They are sorted in place.
+ * \param resources - resources, to which handles of packets refer.
+ * \return a number of issued draw calls.
+ */
+size_t submitDrawPackets(std::span<DrawPacket> packets, RenderResources& resources);
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,405 @@
+#include "entityStore.h"
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief EntityIndex is the position of the entity in the dense arrays. It is stored in the SlotMap.
+     */
+    using EntityIndex = uint32_t;
+
+    /**
+     * \brief The index, which ends the list of entities of the scene node.
+     */
+    constexpr auto noEntityIndex = std::numeric_limits<EntityIndex>::max();
+
+}  // namespace
+
+class EntityStore::Impl
+{
+    public:
+        /**
+         * \brief Returns the reference to the index of the entity in the list of entities of its scene node,
+         * i.e. the first index of the node or the next index of the previous entity of the node.
+         */
+        EntityIndex& findNodeLink(size_t index)
+        {
+            auto link = &nodeFirstEntities[sceneNodes[index]];
+            while (*link != index)
+            {
+                link = &nodeNextEntities[*link];
+            }
+            return *link;
+        }
+
+        /**
+         * \brief Returns an index of the entity in the arrays or throws std::out_of_range if it doesn't exist.
+         */
+        size_t getIndex(Entity entity) const
+        {
+            const auto index = indices.get(entity);
+            if (!index)
+            {
+                throw std::out_of_range{"The entity doesn't exist."};
+            }
+            return *index;
+        }
+
+        /**
+         * \brief Makes the packet of the entity.
+         */
+        DrawPacket makeDrawPacket(size_t index, const ogls::oglCore::query::Query* occlusionQuery) const noexcept
+        {
+            return DrawPacket{.lod{lods[index]},
+                              .material{materials[index]},
+                              .mesh{meshes[index]},
+                              .occlusionQuery{occlusionQuery},
+                              .sortKey{makeDrawPacketSortKey(meshes[index], materials[index])},
+                              .worldMatrix{&worldMatrices[index]}};
+        }
+
+        /**
+         * \brief Adds the entity into the list of entities of its scene node.
+         */
+        void linkToNode(size_t index)
+        {
+            const auto node = sceneNodes[index];
+            if (node >= nodeFirstEntities.size())
+            {
+                nodeFirstEntities.resize(node + 1, noEntityIndex);
+            }
+
+            nodeNextEntities[index] = nodeFirstEntities[node];
+            nodeFirstEntities[node] = static_cast<EntityIndex>(index);
+        }
+
+        /**
+         * \brief Copies the world matrix of the entity from the scene graph and recalculates its world bounds.
+         */
+        void syncTransform(size_t index, const SceneGraph& sceneGraph)
+        {
+            if (sceneGraph.isNodeExist(sceneNodes[index]))
+            {
+                worldMatrices[index] = sceneGraph.getWorldMatrix(sceneNodes[index]);
+                worldBounds[index]   = ogls::mathCore::transformBoundingBox(localBounds[index], worldMatrices[index]);
+            }
+        }
+
+        /**
+         * \brief Moves the entity from one position of the arrays into another one.
+         */
+        void moveEntity(size_t from, size_t to)
+        {
+            findNodeLink(from) = static_cast<EntityIndex>(to);
+
+            entities[to]         = entities[from];
+            localBounds[to]      = localBounds[from];
+            lods[to]             = lods[from];
+            materials[to]        = materials[from];
+            meshes[to]           = meshes[from];
+            nodeNextEntities[to] = nodeNextEntities[from];
+            occlusion[to]        = std::move(occlusion[from]);
+            sceneNodes[to]       = sceneNodes[from];
+            worldBounds[to]      = worldBounds[from];
+            worldMatrices[to]    = worldMatrices[from];
+
+            *indices.get(entities[to]) = static_cast<EntityIndex>(to);
+        }
+
+    public:
+        /**
+         * \brief Handles of entities (to find the slot of the moved entity).
+         */
+        std::vector<Entity>                                  entities;
+        /**
+         * \brief Positions of entities in the arrays.
+         */
+        ogls::helpers::SlotMap<EntityTag, EntityIndex>       indices;
+        /**
+         * \brief Specification whether entities have been changed since the last clearChanges().
+         */
+        bool                                                 isChanged = {true};
+        /**
+         * \brief Bounding boxes of entities in the local coordinate system.
+         */
+        std::vector<ogls::mathCore::BoundingBox>             localBounds;
+        /**
+         * \brief Levels of detail of meshes of entities selected by the last selectLods().
+         */
+        std::vector<uint32_t>                                lods;
+        /**
+         * \brief Materials of entities.
+         */
+        std::vector<MaterialHandle>                          materials;
+        /**
+         * \brief Meshes of entities.
+         */
+        std::vector<MeshHandle>                              meshes;
+        /**
+         * \brief Indices of first entities of scene nodes or noEntityIndex. syncTransforms() finds by them entities
+         * of changed nodes.
+         */
+        std::vector<EntityIndex>                             nodeFirstEntities;
+        /**
+         * \brief Indices of next entities of the same scene node or noEntityIndex.
+         */
+        std::vector<EntityIndex>                             nodeNextEntities;
+        /**
+         * \brief Visibility of entities by occlusion queries.
+         */
+        std::vector<OcclusionState>                          occlusion;
+        /**
+         * \brief Scene nodes of entities.
+         */
+        std::vector<SceneGraph::NodeId>                      sceneNodes;
+        /**
+         * \brief Entities, which have been created since the last syncTransforms(). Their nodes may be unchanged.
+         */
+        std::vector<Entity>                                  unsyncedEntities;
+        /**
+         * \brief Bounding boxes of entities in the world coordinate system.
+         */
+        std::vector<ogls::mathCore::BoundingBox>             worldBounds;
+        /**
+         * \brief World matrices of entities.
+         */
+        std::vector<ogls::mathCore::Mat4>                    worldMatrices;
+
+};  // class EntityStore::Impl
+
+EntityStore::EntityStore() : m_impl{std::make_unique<Impl>()}
+{
+}
+
+EntityStore::EntityStore(EntityStore&& obj) noexcept = default;
+
+EntityStore::~EntityStore() noexcept = default;
+
+EntityStore& EntityStore::operator=(EntityStore&& obj) noexcept = default;
+
+void EntityStore::clearChanges() noexcept
+{
+    m_impl->isChanged = false;
+}
+
+void EntityStore::collectDrawPackets(std::pmr::vector<DrawPacket>& packets) const
+{
+    const auto& impl = *m_impl;
+
+    packets.reserve(packets.size() + impl.entities.size());
+    for (auto i = size_t{0}; i < impl.entities.size(); ++i)
+    {
+        if (impl.occlusion[i].isVisible)
+        {
+            packets.push_back(impl.makeDrawPacket(i, nullptr));
+        }
+    }
+}
+
+void EntityStore::collectOccludedDrawPackets(std::pmr::vector<DrawPacket>& packets) const
+{
+    const auto& impl = *m_impl;
+
+    for (auto i = size_t{0}; i < impl.entities.size(); ++i)
+    {
+        if (const auto& state = impl.occlusion[i]; !state.isVisible && state.query)
+        {
+            packets.push_back(impl.makeDrawPacket(i, state.query.get()));
+        }
+    }
+}
+
+Entity EntityStore::createEntity(SceneGraph::NodeId sceneNode, MeshHandle mesh, MaterialHandle material,
+                                 const ogls::mathCore::BoundingBox& localBounds)
+{
+    auto& impl = *m_impl;
+
+    if (sceneNode == SceneGraph::invalidNodeId)
+    {
+        throw std::invalid_argument{"The entity must have the scene node."};
+    }
+
+    const auto entity = impl.indices.insert(static_cast<EntityIndex>(impl.entities.size()));
+
+    impl.entities.push_back(entity);
+    impl.localBounds.push_back(localBounds);
+    impl.lods.push_back(0);
+    impl.materials.push_back(material);
+    impl.meshes.push_back(mesh);
+    impl.nodeNextEntities.push_back(noEntityIndex);
+    impl.occlusion.emplace_back();
+    impl.sceneNodes.push_back(sceneNode);
+    impl.unsyncedEntities.push_back(entity);
+    impl.worldBounds.push_back(localBounds);
+    impl.worldMatrices.push_back(ogls::mathCore::Mat4{});
+    impl.isChanged = true;
+
+    impl.linkToNode(impl.entities.size() - 1);
+
+    return entity;
+}
+
+void EntityStore::destroyEntity(Entity entity)
+{
+    auto& impl = *m_impl;
+
+    if (!isEntityExist(entity))
+    {
+        return;
+    }
+
+    const auto index = impl.getIndex(entity);
+    const auto last  = impl.entities.size() - 1;
+
+    impl.findNodeLink(index) = impl.nodeNextEntities[index];
+    if (index != last)
+    {
+        impl.moveEntity(last, index);
+    }
+    impl.indices.erase(entity);
+
+    impl.entities.pop_back();
+    impl.localBounds.pop_back();
+    impl.lods.pop_back();
+    impl.materials.pop_back();
+    impl.meshes.pop_back();
+    impl.nodeNextEntities.pop_back();
+    impl.occlusion.pop_back();
+    impl.sceneNodes.pop_back();
+    impl.worldBounds.pop_back();
+    impl.worldMatrices.pop_back();
+    impl.isChanged = true;
+}
+
+size_t EntityStore::getEntitiesCount() const noexcept
+{
+    return m_impl->entities.size();
+}
+
+MaterialHandle EntityStore::getMaterial(Entity entity) const
+{
+    return m_impl->materials[m_impl->getIndex(entity)];
+}
+
+MeshHandle EntityStore::getMesh(Entity entity) const
+{
+    return m_impl->meshes[m_impl->getIndex(entity)];
+}
+
+SceneGraph::NodeId EntityStore::getSceneNode(Entity entity) const
+{
+    return m_impl->sceneNodes[m_impl->getIndex(entity)];
+}
+
+const ogls::mathCore::BoundingBox& EntityStore::getWorldBounds(Entity entity) const
+{
+    return m_impl->worldBounds[m_impl->getIndex(entity)];
+}
+
+bool EntityStore::hasChanges() const noexcept
+{
+    return m_impl->isChanged;
+}
+
+bool EntityStore::isEntityExist(Entity entity) const noexcept
+{
+    return m_impl->indices.contains(entity);
+}
+
+void EntityStore::issueOcclusionQueries(OcclusionCuller& culler)
+{
+    auto& impl = *m_impl;
+
+    auto isPipelineApplied = false;
+    for (auto i = size_t{0}; i < impl.entities.size(); ++i)
+    {
+        if (impl.occlusion[i].isQueryNeeded)
+        {
+            if (!isPipelineApplied)
+            {
+                culler.beginQueries();
+                isPipelineApplied = true;
+            }
+            culler.issueQuery(impl.occlusion[i], impl.worldBounds[i]);
+        }
+    }
+}
+
+void EntityStore::markChanged() noexcept
+{
+    m_impl->isChanged = true;
+}
+
+void EntityStore::selectLods(const LodProjection& projection, const LodSettings& settings,
+                             const RenderResources& resources)
+{
+    auto& impl = *m_impl;
+
+    for (auto i = size_t{0}; i < impl.entities.size(); ++i)
+    {
+        if (const auto mesh = resources.getMesh(impl.meshes[i]))
+        {
+            const auto pixelsPerUnit = calculatePixelsPerUnit(projection, impl.worldBounds[i], impl.worldMatrices[i]);
+            impl.lods[i] = static_cast<uint32_t>(selectLod(mesh->lods, pixelsPerUnit, impl.lods[i], settings));
+        }
+    }
+}
+
+void EntityStore::setMaterial(Entity entity, MaterialHandle material)
+{
+    m_impl->materials[m_impl->getIndex(entity)] = material;
+    m_impl->isChanged                           = true;
+}
+
+void EntityStore::setMesh(Entity entity, MeshHandle mesh)
+{
+    const auto index = m_impl->getIndex(entity);
+
+    m_impl->isChanged     = true;
+    m_impl->lods[index]   = 0;
+    m_impl->meshes[index] = mesh;
+}
+
+void EntityStore::syncTransforms(const SceneGraph& sceneGraph)
+{
+    auto& impl = *m_impl;
+
+    for (const auto node : sceneGraph.getChangedNodes())
+    {
+        if (node >= impl.nodeFirstEntities.size())
+        {
+            continue;
+        }
+
+        for (auto index = impl.nodeFirstEntities[node]; index != noEntityIndex; index = impl.nodeNextEntities[index])
+        {
+            impl.syncTransform(index, sceneGraph);
+        }
+    }
+
+    for (const auto entity : impl.unsyncedEntities)
+    {
+        if (isEntityExist(entity))
+        {
+            impl.syncTransform(impl.getIndex(entity), sceneGraph);
+        }
+    }
+    impl.unsyncedEntities.clear();
+}
+
+void EntityStore::updateOcclusion(OcclusionCuller& culler)
+{
+    auto& impl = *m_impl;
+
+    for (auto i = size_t{0}; i < impl.entities.size(); ++i)
+    {
+        culler.updateState(impl.occlusion[i], impl.worldBounds[i]);
+    }
+}
+
+}  // namespace app::renderer
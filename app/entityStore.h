@@ -0,0 +1,195 @@
+#ifndef APP_RENDERER_ENTITY_STORE_H
+#define APP_RENDERER_ENTITY_STORE_H
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "drawPacket.h"
+#include "helpers/handle.h"
+#include "helpers/macros.h"
+#include "lodSelection.h"
+#include "mathCore/boundingBox.h"
+#include "occlusionCuller.h"
+#include "renderResources.h"
+#include "sceneGraph.h"
+
+namespace app::renderer
+{
+/**
+ * \brief EntityTag is a tag of Entity.
+ */
+struct EntityTag;
+
+/**
+ * \brief Entity is a handle of the renderable object stored in EntityStore.
+ */
+using Entity = ogls::helpers::Handle<EntityTag>;
+
+/**
+ * \brief EntityStore keeps components of renderable objects in dense contiguous arrays.
+ *
+ * Every component (scene node, world matrix, mesh, level of detail, material, bounds, occlusion state) is stored in
+ * its own array, and the same index in all arrays belongs to the same entity. Removal moves the last entity into
+ * the freed place, so arrays never have holes. The rendering iterates these arrays and emits DrawPacket -s without
+ * virtual calls and without touching reference counters.
+ */
+class EntityStore final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of EntityStore.
+         */
+        class Impl;
+
+    public:
+        EntityStore();
+        OGLS_NOT_COPYABLE(EntityStore)
+        EntityStore(EntityStore&& obj) noexcept;
+        ~EntityStore() noexcept;
+
+        EntityStore& operator=(EntityStore&& obj) noexcept;
+
+        /**
+         * \brief Resets changes, so hasChanges() returns false till the next change.
+         */
+        void                               clearChanges() noexcept;
+        /**
+         * \brief Appends packets of all visible entities to the vector. Packets refer to levels of detail selected by
+         * the last selectLods(). Entities, which are hidden by the last updateOcclusion(), are skipped.
+         *
+         * \param packets - the vector, which is usually allocated from the arena of the frame.
+         */
+        void                               collectDrawPackets(std::pmr::vector<DrawPacket>& packets) const;
+        /**
+         * \brief Appends packets of entities, which are hidden by the last updateOcclusion(), to the vector.
+         * Packets refer to occlusion queries of entities, so they must be collected after issueOcclusionQueries().
+         *
+         * \param packets - the vector, which is usually allocated from the arena of the frame.
+         */
+        void                               collectOccludedDrawPackets(std::pmr::vector<DrawPacket>& packets) const;
+        /**
+         * \brief Creates new entity.
+         *
+         * \param sceneNode   - the node of the scene graph, which holds the transformation of the entity.
+         * \param mesh        - the mesh of the entity.
+         * \param material    - the material of the entity.
+         * \param localBounds - the bounding box of the entity in the local coordinate system.
+         * \return the handle of created entity.
+         * \throw std::invalid_argument, if sceneNode is SceneGraph::invalidNodeId.
+         */
+        Entity                             createEntity(SceneGraph::NodeId                 sceneNode,
+                                                        MeshHandle                         mesh,
+                                                        MaterialHandle                     material,
+                                                        const ogls::mathCore::BoundingBox& localBounds);
+        /**
+         * \brief Destroys the entity. Nothing happens if the entity doesn't exist.
+         */
+        void                               destroyEntity(Entity entity);
+        /**
+         * \brief Returns a number of entities.
+         */
+        size_t                             getEntitiesCount() const noexcept;
+        /**
+         * \brief Returns the material of the entity.
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        MaterialHandle                     getMaterial(Entity entity) const;
+        /**
+         * \brief Returns the mesh of the entity.
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        MeshHandle                         getMesh(Entity entity) const;
+        /**
+         * \brief Returns the scene node of the entity.
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        SceneGraph::NodeId                 getSceneNode(Entity entity) const;
+        /**
+         * \brief Returns the bounding box of the entity in the world coordinate system,
+         * which was calculated by the last syncTransforms().
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        const ogls::mathCore::BoundingBox& getWorldBounds(Entity entity) const;
+        /**
+         * \brief Checks whether entities have been created, destroyed or changed since the last clearChanges().
+         */
+        bool                               hasChanges() const noexcept;
+        /**
+         * \brief Checks if the entity exists.
+         */
+        bool                               isEntityExist(Entity entity) const noexcept;
+        /**
+         * \brief Issues occlusion queries of entities, which need them in this frame.
+         *
+         * It must be called after updateOcclusion() and after visible entities are drawn.
+         *
+         * \param culler - the culler, which has updated states of entities.
+         */
+        void                               issueOcclusionQueries(OcclusionCuller& culler);
+        /**
+         * \brief Marks the store as changed, so the frame is redrawn in the render-on-demand mode.
+         *
+         * Changes of entities made through the store mark it automatically. SceneObject -s call it after changes,
+         * which the store doesn't see (values of uniforms, contents of materials).
+         */
+        void                               markChanged() noexcept;
+        /**
+         * \brief Selects levels of detail of meshes of entities by their projected errors (see selectLod()).
+         *
+         * It must be called after syncTransforms().
+         *
+         * \param projection - the projection of the camera.
+         * \param settings   - settings of the selection.
+         * \param resources  - resources, to which mesh handles of entities refer.
+         */
+        void                               selectLods(const LodProjection&   projection,
+                                                      const LodSettings&     settings,
+                                                      const RenderResources& resources);
+        /**
+         * \brief Sets new material of the entity.
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        void                               setMaterial(Entity entity, MaterialHandle material);
+        /**
+         * \brief Sets new mesh of the entity. The full-detail level is used till the next selectLods().
+         *
+         * \throw std::out_of_range, if the entity doesn't exist.
+         */
+        void                               setMesh(Entity entity, MeshHandle mesh);
+        /**
+         * \brief Copies world matrices from the scene graph and recalculates world bounding boxes.
+         *
+         * Only entities of nodes from SceneGraph::getChangedNodes() and entities created since the previous call are
+         * processed, so static entities cost nothing. It must be called after every
+         * SceneGraph::updateWorldTransforms().
+         *
+         * \param sceneGraph - the scene graph, to which scene nodes of entities belong.
+         */
+        void                               syncTransforms(const SceneGraph& sceneGraph);
+        /**
+         * \brief Reads available results of occlusion queries and updates the visibility of entities
+         * (see OcclusionCuller::updateState()).
+         *
+         * It must be called after syncTransforms() and OcclusionCuller::beginFrame().
+         *
+         * \param culler - the culler, which issues queries of entities.
+         */
+        void                               updateOcclusion(OcclusionCuller& culler);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class EntityStore
+
+}  // namespace app::renderer
+
+#endif
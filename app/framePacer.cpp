@@ -0,0 +1,272 @@
+#include "framePacer.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "fence.h"
+#include "query.h"
+
+namespace app
+{
+namespace
+{
+    /**
+     * \brief The weight of the new value in exponential moving averages of timings.
+     */
+    constexpr auto averageWeight      = float{0.1f};
+    /**
+     * \brief The refresh rate, which is used, if the refresh rate of the monitor is unknown.
+     */
+    constexpr auto defaultRefreshRate = int{60};
+    /**
+     * \brief The safety margin between the predicted end of the frame and the vertical blank as a part of the frame
+     * period.
+     */
+    constexpr auto latencyMargin      = float{0.1f};
+    /**
+     * \brief The maximal time of waiting for the fence. It protects the loop from the lost GPU.
+     */
+    constexpr auto maxFenceWait       = std::chrono::nanoseconds{std::chrono::seconds{1}};
+    /**
+     * \brief The minimal safety margin between the predicted end of the frame and the vertical blank.
+     */
+    constexpr auto minLatencyMargin   = FrameTimings::Milliseconds{1.0f};
+    /**
+     * \brief The decay of the predicted work time per frame. The prediction grows at once, but decreases slowly,
+     * so the single fast frame doesn't make the next one miss the vertical blank.
+     */
+    constexpr auto workDecay          = float{0.95f};
+
+    /**
+     * \brief QueuedFrame is the frame, which has been or is being submitted to the GPU.
+     */
+    struct QueuedFrame final
+    {
+            ogls::oglCore::sync::Fence    fence;
+            FramePacer::Clock::time_point inputTime;
+            bool                          isPending  = {false};
+            ogls::oglCore::query::Query   timerQuery = ogls::oglCore::query::Query{
+              ogls::oglCore::query::QueryTarget::TimeElapsed};
+            FrameTimings                  timings;
+
+    };  // struct QueuedFrame
+
+    void   accumulate(FrameTimings& average, const FrameTimings& timings) noexcept;
+    /**
+     * \throw std::invalid_argument, if the maximal number of queued frames is 0.
+     */
+    size_t toQueuedFramesCount(const FramePacerSettings& settings);
+
+}  // namespace
+
+class FramePacer::Impl
+{
+    public:
+        Impl(ogls::Window& w, const FramePacerSettings& s) : frames(toQueuedFramesCount(s)), settings{s}, window{w}
+        {
+            if (settings.swapInterval < 0)
+            {
+                throw std::invalid_argument{"The swap interval mustn't be negative."};
+            }
+
+            window.setSwapInterval(settings.swapInterval);
+
+            const auto refreshRate = window.getRefreshRate() > 0 ? window.getRefreshRate() : defaultRefreshRate;
+            framePeriod = FrameTimings::Milliseconds{1000.0f * settings.swapInterval / refreshRate};
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Completes frames, which fences are signaled, from the oldest one.
+         */
+        void collectCompletedFrames()
+        {
+            for (auto i = size_t{0}; i < frames.size(); ++i)
+            {
+                auto& frame = getFrame(framesCount + i);
+                if (frame.isPending && frame.fence.isSignaled())
+                {
+                    completeFrame(frame, Clock::now());
+                }
+            }
+        }
+
+        /**
+         * \brief Finishes timings of the frame, which the GPU has completed, and updates statistics.
+         *
+         * \param frame - the completed frame.
+         * \param time  - the moment, when the completion has been observed.
+         */
+        void completeFrame(QueuedFrame& frame, Clock::time_point time)
+        {
+            auto& timings        = frame.timings;
+            const auto gpuTime   = std::chrono::nanoseconds{frame.timerQuery.tryGetResult().value_or(0)};
+            timings.gpuTime      = gpuTime;
+            timings.inputLatency = time - frame.inputTime;
+            frame.isPending      = false;
+
+            if (completedFramesCount++ == 0)
+            {
+                averageTimings = timings;
+            }
+            else
+            {
+                accumulate(averageTimings, timings);
+            }
+            lastTimings = timings;
+
+            const auto work = timings.cpuTime + timings.swapTime + timings.gpuTime;
+            predictedWork   = std::max(work, predictedWork * workDecay);
+        }
+
+        QueuedFrame& getFrame(uint64_t frameIndex) noexcept
+        {
+            return frames[frameIndex % frames.size()];
+        }
+
+    public:
+        FrameTimings               averageTimings;
+        uint64_t                   completedFramesCount = {0};
+        /**
+         * \brief The time between two vertical blanks, on which frames are shown.
+         */
+        FrameTimings::Milliseconds framePeriod;
+        /**
+         * \brief Frames in the GPU queue. The frame is stored in the slot of the frame, which is maxQueuedFrames older.
+         */
+        std::vector<QueuedFrame>   frames;
+        uint64_t                   framesCount = {0};
+        FrameTimings               lastTimings;
+        /**
+         * \brief The expected duration of the frame from the sampling of inputs to its completion by the GPU.
+         */
+        FrameTimings::Milliseconds predictedWork;
+        const FramePacerSettings   settings;
+        ogls::Window&              window;
+
+};  // class FramePacer::Impl
+
+FramePacer::FramePacer(ogls::Window& window, const FramePacerSettings& settings) :
+    m_impl{std::make_unique<Impl>(window, settings)}
+{
+}
+
+FramePacer::FramePacer(FramePacer&& obj) noexcept = default;
+
+FramePacer::~FramePacer() noexcept = default;
+
+FramePacer& FramePacer::operator=(FramePacer&& obj) noexcept = default;
+
+void FramePacer::beginFrame()
+{
+    auto& impl = *m_impl;
+
+    using namespace std::chrono;
+
+
+    const auto waitStart = Clock::now();
+    auto&      frame     = impl.getFrame(impl.framesCount);
+
+    // The slot is still occupied by the frame, which was presented maxQueuedFrames frames ago
+    auto isWaited = false;
+    auto waitEnd  = waitStart;
+    if (frame.isPending)
+    {
+        isWaited = !frame.fence.isSignaled();
+        frame.fence.wait(maxFenceWait);
+        waitEnd = Clock::now();
+        impl.completeFrame(frame, waitEnd);
+    }
+    impl.collectCompletedFrames();
+
+    // The previous frame has just been completed, so the next vertical blank is expected one period later.
+    // If the GPU was already idle, the phase of vertical blanks is unknown and the frame starts at once.
+    if (impl.settings.mode == PacingMode::LowLatency && isWaited && impl.framePeriod.count() > 0.0f)
+    {
+        const auto margin = std::max(minLatencyMargin, impl.framePeriod * latencyMargin);
+        const auto delay  = impl.framePeriod - impl.predictedWork - margin;
+        if (delay.count() > 0.0f)
+        {
+            std::this_thread::sleep_until(waitEnd + duration_cast<Clock::duration>(delay));
+        }
+    }
+
+    frame.inputTime        = Clock::now();
+    frame.timings.waitTime = frame.inputTime - waitStart;
+    frame.timerQuery.begin();
+}
+
+const FrameTimings& FramePacer::getAverageTimings() const noexcept
+{
+    return m_impl->averageTimings;
+}
+
+const FrameTimings& FramePacer::getLastTimings() const noexcept
+{
+    return m_impl->lastTimings;
+}
+
+size_t FramePacer::getQueuedFramesCount() const noexcept
+{
+    return m_impl->frames.size();
+}
+
+const FramePacerSettings& FramePacer::getSettings() const noexcept
+{
+    return m_impl->settings;
+}
+
+void FramePacer::present()
+{
+    auto& impl = *m_impl;
+
+
+    auto& frame = impl.getFrame(impl.framesCount);
+    frame.timerQuery.end();
+
+    const auto swapStart = Clock::now();
+    impl.window.swapBuffers();
+    const auto swapEnd = Clock::now();
+
+    // The fence after the swap is signaled, when the GPU has finished the frame together with its presentation
+    frame.fence.insert();
+    frame.timings.cpuTime  = swapStart - frame.inputTime;
+    frame.timings.swapTime = swapEnd - swapStart;
+    frame.isPending        = true;
+    ++impl.framesCount;
+}
+
+namespace
+{
+    void accumulate(FrameTimings& average, const FrameTimings& timings) noexcept
+    {
+        const auto mix = [](FrameTimings::Milliseconds& averageValue, FrameTimings::Milliseconds value)
+        { averageValue += (value - averageValue) * averageWeight; };
+
+        mix(average.cpuTime, timings.cpuTime);
+        mix(average.gpuTime, timings.gpuTime);
+        mix(average.inputLatency, timings.inputLatency);
+        mix(average.swapTime, timings.swapTime);
+        mix(average.waitTime, timings.waitTime);
+    }
+
+    size_t toQueuedFramesCount(const FramePacerSettings& settings)
+    {
+        if (settings.mode == PacingMode::LowLatency)
+        {
+            return 1;
+        }
+        if (settings.maxQueuedFrames == 0)
+        {
+            throw std::invalid_argument{"At least one frame must be allowed in the GPU queue."};
+        }
+        return settings.maxQueuedFrames;
+    }
+
+}  // namespace
+
+}  // namespace app
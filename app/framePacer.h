@@ -0,0 +1,174 @@
+#ifndef APP_FRAME_PACER_H
+#define APP_FRAME_PACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "helpers/macros.h"
+#include "window.h"
+
+namespace app
+{
+/**
+ * \brief PacingMode defines what FramePacer prefers: the throughput or the latency.
+ */
+enum class PacingMode : uint8_t
+{
+    /**
+     * \brief Only one frame is queued to the GPU and the start of the frame is delayed, so inputs are sampled as
+     * late as possible, but the frame is still ready before the vertical blank.
+     */
+    LowLatency,
+    /**
+     * \brief Frames start as soon as the queue of frames allows it.
+     */
+    Throughput
+};
+
+/**
+ * \brief FramePacerSettings are parameters of FramePacer.
+ */
+struct FramePacerSettings final
+{
+        /**
+         * \brief The maximal number of frames, which can be not completed by the GPU, when the CPU starts
+         * the next frame. It is ignored in the PacingMode::LowLatency mode.
+         */
+        uint8_t    maxQueuedFrames = {2};
+        PacingMode mode            = PacingMode::Throughput;
+        /**
+         * \brief A number of screen updates to wait for before buffers are swapped. 0 disables the vertical
+         * synchronization.
+         */
+        int        swapInterval    = {1};
+
+};  // struct FramePacerSettings
+
+/**
+ * \brief FrameTimings are measured durations of one frame or their averages.
+ */
+struct FrameTimings final
+{
+        using Milliseconds = std::chrono::duration<float, std::milli>;
+
+        /**
+         * \brief The time of the CPU from the sampling of inputs to the swap of buffers.
+         */
+        Milliseconds cpuTime;
+        /**
+         * \brief The time, which the GPU has spent on commands of the frame.
+         */
+        Milliseconds gpuTime;
+        /**
+         * \brief The time from the sampling of inputs to the moment, when the CPU has found out that the GPU has
+         * completed the frame. It is the input-to-photon latency without the scan-out of the display.
+         */
+        Milliseconds inputLatency;
+        /**
+         * \brief The time of the swap of buffers.
+         */
+        Milliseconds swapTime;
+        /**
+         * \brief The time, which the CPU has waited for the GPU queue and for the latency target before the frame.
+         */
+        Milliseconds waitTime;
+
+};  // struct FrameTimings
+
+/**
+ * \brief FramePacer limits the number of frames queued to the GPU and measures timings of frames.
+ *
+ * After the swap of buffers the fence is inserted. beginFrame() waits by glClientWaitSync() for the fence of
+ * the frame, which was presented maxQueuedFrames frames ago, so the CPU never runs far ahead of the GPU and inputs
+ * aren't several frames old, when they are shown. The GPU time of the frame is measured by the timer query.
+ *
+ * In the PacingMode::LowLatency mode the pacer waits for the previous frame and after that sleeps, so the next frame
+ * starts the predicted work time (with the safety margin) before the next vertical blank. Inputs must be sampled
+ * right after beginFrame(), so they are as fresh as possible.
+ *
+ * The GPU completion is observed by the CPU, so it is precise for the frame, which beginFrame() waits for, and is
+ * rounded up to the next beginFrame() for other frames.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * auto pacer = FramePacer{window, {.mode{PacingMode::LowLatency}}};
+ * while (!window.shouldClose())
+ * {
+ *     pacer.beginFrame();
+ *     window.pollEvents();
+ *     renderer.render(simulation.getInterpolatedState(Simulation::Clock::now()));
+ *     pacer.present();
+ * }
+ * std::cout << pacer.getAverageTimings().inputLatency << std::endl;
+ * \endcode
+ */
+class FramePacer final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of FramePacer.
+         */
+        class Impl;
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * \brief Constructs new FramePacer and sets the swap interval of the window. The window must outlive
+         * the pacer.
+         *
+         * \param window   - the window, which buffers are swapped by present().
+         * \param settings - the mode and limits of the pacer.
+         * \throw std::invalid_argument, if the maximal number of queued frames is 0 or the swap interval is
+         * negative.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if timer queries can't be created.
+         */
+        explicit FramePacer(ogls::Window& window, const FramePacerSettings& settings = {});
+        OGLS_NOT_COPYABLE(FramePacer)
+        FramePacer(FramePacer&& obj) noexcept;
+        ~FramePacer() noexcept;
+
+        FramePacer& operator=(FramePacer&& obj) noexcept;
+
+        /**
+         * \brief Waits for the GPU queue and for the latency target and starts the measurement of the frame.
+         *
+         * It must be called before the sampling of inputs.
+         */
+        void                      beginFrame();
+        /**
+         * \brief Returns exponential moving averages of timings of completed frames.
+         */
+        const FrameTimings&       getAverageTimings() const noexcept;
+        /**
+         * \brief Returns timings of the last frame, which has been completed by the GPU.
+         */
+        const FrameTimings&       getLastTimings() const noexcept;
+        /**
+         * \brief Returns a number of frames, which can be in the GPU queue at the same time.
+         */
+        size_t                    getQueuedFramesCount() const noexcept;
+        /**
+         * \brief Returns the settings of the pacer.
+         */
+        const FramePacerSettings& getSettings() const noexcept;
+        /**
+         * \brief Swaps buffers of the window and inserts the fence, which is signaled, when the GPU completes
+         * the frame.
+         *
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if the fence can't be created.
+         */
+        void                      present();
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class FramePacer
+
+}  // namespace app
+
+#endif
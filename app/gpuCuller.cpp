@@ -0,0 +1,266 @@
+#include "gpuCuller.h"
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <stdexcept>
+#include <vector>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "mathCore/transform.h"
+#include "shaderProgram.h"
+#include "uniforms.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief The binding point of the shader storage buffer with draw commands in the compute shader.
+     */
+    constexpr auto commandsBinding = GLuint{1};
+    /**
+     * \brief The binding point of the atomic counter of visible objects in the compute shader.
+     */
+    constexpr auto counterBinding  = GLuint{0};
+    /**
+     * \brief local_size_x of the compute shader.
+     */
+    constexpr auto workGroupSize   = size_t{64};
+
+    /**
+     * \brief DrawElementsIndirectCommand is the command, which is read by
+     * [glMultiDrawElementsIndirectCount()](https://docs.gl/gl4/glMultiDrawElementsIndirectCount).
+     */
+    struct DrawElementsIndirectCommand final
+    {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint firstIndex;
+            GLint  baseVertex;
+            GLuint baseInstance;
+
+    };  // struct DrawElementsIndirectCommand
+
+    /**
+     * \brief GpuObject is GpuCulledObject in the std430 layout of Object in the compute and vertex shaders.
+     */
+    struct GpuObject final
+    {
+            std::array<float, 16> worldMatrix;
+            std::array<float, 4>  boundsCenter;
+            std::array<float, 4>  boundsHalfExtents;
+            GLuint                firstIndex;
+            GLuint                indicesCount;
+            GLint                 baseVertex;
+            GLuint                padding;
+
+    };  // struct GpuObject
+
+    static_assert(sizeof(DrawElementsIndirectCommand) == 5 * sizeof(GLuint));
+    static_assert(sizeof(GpuObject) == 112);
+
+    using FrustumPlanes = std::array<std::array<float, 4>, 6>;
+
+    /**
+     * \brief Extracts planes of the frustum, which normals look inside it, from the view-projection transformation.
+     */
+    FrustumPlanes makeFrustumPlanes(const ogls::mathCore::Mat4& view, const ogls::mathCore::Mat4& projection) noexcept;
+    GpuObject     toGpuObject(const GpuCulledObject& object) noexcept;
+
+}  // namespace
+
+class GpuCuller::Impl
+{
+    public:
+        explicit Impl(std::span<const GpuCulledObject> culledObjects)
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore::vertex;
+
+
+            objects.reserve(culledObjects.size());
+            for (const auto& object : culledObjects)
+            {
+                objects.push_back(toGpuObject(object));
+            }
+
+            // Buffers refer to the data, so objects mustn't be reallocated after that
+            objectsBuffer  = std::make_unique<Buffer>(BufferTarget::ShaderStorageBuffer,
+                                                      ArrayData{objects.data(), objects.size() * sizeof(GpuObject)},
+                                                      BufferDataUsage::DynamicDraw);
+            commandsBuffer = std::make_unique<Buffer>(
+              BufferTarget::DrawIndirectBuffer,
+              ArrayData{nullptr, objects.size() * sizeof(DrawElementsIndirectCommand)}, BufferDataUsage::DynamicCopy);
+            counterBuffer  = std::make_unique<Buffer>(BufferTarget::AtomicCounterBuffer,
+                                                      ArrayData{&zeroCounter, sizeof(zeroCounter)},
+                                                      BufferDataUsage::DynamicCopy);
+
+            computeProgram = oglCore::shader::makeComputeShaderProgram("resources/shaders/cs/gpuCulling.comp");
+            for (auto i = size_t{0}; i < frustumPlanes.size(); ++i)
+            {
+                frustumPlanes[i] = &computeProgram->getVectorUniform<float, 4>(std::format("uFrustumPlanes[{}]", i));
+            }
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>                 commandsBuffer;
+        std::unique_ptr<ogls::oglCore::shader::ShaderProgram>          computeProgram;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>                 counterBuffer;
+        std::array<ogls::oglCore::shader::VectorUniform<float, 4>*, 6> frustumPlanes = {};
+        std::vector<GpuObject>                                         objects;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>                 objectsBuffer;
+        FrustumPlanes                                                  planes        = {};
+        const GLuint                                                   zeroCounter   = {0};
+
+};  // class GpuCuller::Impl
+
+GpuCuller::GpuCuller(std::span<const GpuCulledObject> objects) : m_impl{std::make_unique<Impl>(objects)}
+{
+}
+
+GpuCuller::GpuCuller(GpuCuller&& obj) noexcept = default;
+
+GpuCuller::~GpuCuller() noexcept = default;
+
+GpuCuller& GpuCuller::operator=(GpuCuller&& obj) noexcept = default;
+
+void GpuCuller::cull()
+{
+    using namespace ogls;
+    using namespace ogls::oglCore::vertex;
+
+
+    auto& impl = *m_impl;
+    if (impl.objects.empty())
+    {
+        return;
+    }
+
+    impl.counterBuffer->setSubData(0, ArrayData{&impl.zeroCounter, sizeof(impl.zeroCounter)});
+
+    impl.computeProgram->use();
+    for (auto i = size_t{0}; i < impl.planes.size(); ++i)
+    {
+        impl.frustumPlanes[i]->setData(impl.planes[i]);
+    }
+
+    impl.objectsBuffer->bindBase(BufferTarget::ShaderStorageBuffer, objectsBinding);
+    impl.commandsBuffer->bindBase(BufferTarget::ShaderStorageBuffer, commandsBinding);
+    impl.counterBuffer->bindBase(BufferTarget::AtomicCounterBuffer, counterBinding);
+
+    const auto groupsCount = (impl.objects.size() + workGroupSize - 1) / workGroupSize;
+    OGLS_GLCall(glDispatchCompute(static_cast<GLuint>(groupsCount), 1, 1));
+    // Commands and their count are read by the draw call as the indirect and the parameter buffers
+    OGLS_GLCall(glMemoryBarrier(GL_COMMAND_BARRIER_BIT));
+}
+
+void GpuCuller::draw() const
+{
+    using namespace ogls::oglCore::vertex;
+
+
+    const auto& impl = *m_impl;
+    if (impl.objects.empty())
+    {
+        return;
+    }
+
+    impl.objectsBuffer->bindBase(BufferTarget::ShaderStorageBuffer, objectsBinding);
+    impl.commandsBuffer->bindToTarget(BufferTarget::DrawIndirectBuffer);
+    impl.counterBuffer->bindToTarget(BufferTarget::ParameterBuffer);
+
+    OGLS_GLCall(glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, 0,
+                                                 static_cast<GLsizei>(impl.objects.size()), 0));
+}
+
+size_t GpuCuller::getObjectsCount() const noexcept
+{
+    return m_impl->objects.size();
+}
+
+void GpuCuller::setCamera(const ogls::mathCore::TransformMatrix& view,
+                          const ogls::mathCore::TransformMatrix& projection)
+{
+    m_impl->planes = makeFrustumPlanes(view.getResultMatrix(), projection.getResultMatrix());
+}
+
+void GpuCuller::setWorldMatrix(size_t index, const ogls::mathCore::Mat4& worldMatrix)
+{
+    auto& impl = *m_impl;
+    if (index >= impl.objects.size())
+    {
+        throw std::out_of_range{"There is no object with the index."};
+    }
+
+    auto& object       = impl.objects[index];
+    object.worldMatrix = ogls::mathCore::toGpuMatrix(worldMatrix);
+    impl.objectsBuffer->setSubData(
+      static_cast<GLintptr>(index * sizeof(GpuObject) + offsetof(GpuObject, worldMatrix)),
+      ogls::ArrayData{object.worldMatrix.data(), sizeof(object.worldMatrix)});
+}
+
+namespace
+{
+    FrustumPlanes makeFrustumPlanes(const ogls::mathCore::Mat4& view, const ogls::mathCore::Mat4& projection) noexcept
+    {
+        using namespace ogls::mathCore;
+
+
+        const auto v = view.getPointerToData();
+        const auto p = projection.getPointerToData();
+
+        // Returns the element of the transformation in the notation of column vectors
+        const auto at = [](const float* m, size_t row, size_t column)
+        {
+            return OGLS_VECTOR_IS_COLUMN ? m[row * 4 + column] : m[column * 4 + row];
+        };
+
+        auto viewProjection = std::array<std::array<float, 4>, 4>{};
+        for (auto row = size_t{0}; row < 4; ++row)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                for (auto k = size_t{0}; k < 4; ++k)
+                {
+                    viewProjection[row][column] += at(p, row, k) * at(v, k, column);
+                }
+            }
+        }
+
+        // The point is inside, if -w <= x, y, z <= w in the clip space, so every plane is the row w plus or minus
+        // the row of the coordinate (Gribb-Hartmann). Tests of boxes don't need normalized planes.
+        auto planes = FrustumPlanes{};
+        for (auto i = size_t{0}; i < 3; ++i)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                planes[i * 2][column]     = viewProjection[3][column] + viewProjection[i][column];
+                planes[i * 2 + 1][column] = viewProjection[3][column] - viewProjection[i][column];
+            }
+        }
+        return planes;
+    }
+
+    GpuObject toGpuObject(const GpuCulledObject& object) noexcept
+    {
+        const auto& c = object.localBounds.center;
+        const auto& e = object.localBounds.halfExtents;
+
+        return GpuObject{.worldMatrix{ogls::mathCore::toGpuMatrix(object.worldMatrix)},
+                         .boundsCenter{c.x(), c.y(), c.z(), 1.0f},
+                         .boundsHalfExtents{e.x(), e.y(), e.z(), 0.0f},
+                         .firstIndex{object.firstIndex},
+                         .indicesCount{object.indicesCount},
+                         .baseVertex{object.baseVertex},
+                         .padding{0}};
+    }
+
+}  // namespace
+
+}  // namespace app::renderer
@@ -0,0 +1,143 @@
+#ifndef APP_RENDERER_GPU_CULLER_H
+#define APP_RENDERER_GPU_CULLER_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <glad/glad.h>
+
+#include "helpers/macros.h"
+#include "mathCore/boundingBox.h"
+#include "mathCore/transformMatrix.h"
+
+namespace app::renderer
+{
+/**
+ * \brief GpuCulledObject is the object, which is culled and drawn by GpuCuller.
+ *
+ * All objects share the vertex array object, which is current during GpuCuller::draw(), so their meshes are
+ * ranges of its vertex and index buffers.
+ */
+struct GpuCulledObject final
+{
+        /**
+         * \brief The vertex, which is added to every index of the mesh.
+         */
+        int32_t                     baseVertex   = {0};
+        /**
+         * \brief The first index of the mesh in the index buffer.
+         */
+        uint32_t                    firstIndex   = {0};
+        /**
+         * \brief A number of indices of the mesh.
+         */
+        uint32_t                    indicesCount = {0};
+        /**
+         * \brief The bounding box of the mesh in the local coordinate system.
+         */
+        ogls::mathCore::BoundingBox localBounds;
+        /**
+         * \brief The world matrix of the object in the format of the selected graphical API.
+         */
+        ogls::mathCore::Mat4        worldMatrix  = ogls::mathCore::TransformMatrix{}.getResultMatrix();
+
+};  // struct GpuCulledObject
+
+/**
+ * \brief GpuCuller culls objects on the GPU and draws visible ones with one indirect draw call.
+ *
+ * Bounds and world matrices of objects are uploaded into the shader storage buffer once. Every frame cull() runs
+ * the compute shader, which tests world boxes of objects against planes of the frustum and appends
+ * DrawElementsIndirectCommand -s of visible ones through the atomic counter. draw() issues
+ * [glMultiDrawElementsIndirectCount()](https://docs.gl/gl4/glMultiDrawElementsIndirectCount), which reads the number
+ * of commands from the same counter, so the CPU never reads the visibility and its cost doesn't depend on a number
+ * of objects.
+ *
+ * The vertex shader of the drawn objects gets the world matrix by the index of the object, which is passed as
+ * gl_BaseInstance (see resources/shaders/vs/gpuCulledMesh.vert):
+ * \code{.glsl}
+ * layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+ * mat4 world = objects[gl_BaseInstance].world;
+ * \endcode
+ *
+ * Usage example:
+ * \code{.cpp}
+ * culler.setCamera(view, projection);
+ * culler.cull();
+ * pipelineStateManager::apply(meshesPipelineState);
+ * culler.draw();
+ * \endcode
+ */
+class GpuCuller final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of GpuCuller.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The binding point of the shader storage buffer with objects.
+         */
+        static constexpr GLuint objectsBinding = {0};
+
+        /**
+         * \brief Constructs new GpuCuller, creates the compute shader program and uploads objects.
+         *
+         * \param objects - objects to cull and draw.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if OpenGL objects can't be created,
+         * exceptions, which can be thrown by ogls::oglCore::shader::makeComputeShaderProgram().
+         */
+        explicit GpuCuller(std::span<const GpuCulledObject> objects);
+        OGLS_NOT_COPYABLE(GpuCuller)
+        GpuCuller(GpuCuller&& obj) noexcept;
+        ~GpuCuller() noexcept;
+
+        GpuCuller& operator=(GpuCuller&& obj) noexcept;
+
+        /**
+         * \brief Runs the compute shader, which rebuilds the list of draw commands of visible objects.
+         *
+         * It waits for nothing: the barrier only orders the following draw() after the compute shader on the GPU.
+         */
+        void   cull();
+        /**
+         * \brief Draws visible objects by the commands, which have been written by the last cull().
+         *
+         * The pipeline state with the vertex array object and the shader program of objects must be applied.
+         */
+        void   draw() const;
+        /**
+         * \brief Returns a number of uploaded objects.
+         */
+        size_t getObjectsCount() const noexcept;
+        /**
+         * \brief Sets the camera, which frustum objects are tested against.
+         *
+         * \param view       - the view transformation.
+         * \param projection - the perspective or orthographic projection.
+         */
+        void   setCamera(const ogls::mathCore::TransformMatrix& view,
+                         const ogls::mathCore::TransformMatrix& projection);
+        /**
+         * \brief Replaces the world matrix of the object. Only the matrix is uploaded.
+         *
+         * \param index       - the index of the object in objects passed to the constructor.
+         * \param worldMatrix - new world matrix of the object.
+         * \throw std::out_of_range, if there is no object with the index.
+         */
+        void   setWorldMatrix(size_t index, const ogls::mathCore::Mat4& worldMatrix);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class GpuCuller
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,280 @@
+#include "gpuParticleSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "pipelineState.h"
+#include "shaderProgram.h"
+#include "uniforms.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief The binding point of the buffer with draw commands, which instanceCount -s are counters of particles.
+     */
+    constexpr auto commandsBinding    = GLuint{2};
+    /**
+     * \brief The binding point of the buffer, into which particles are written by the compute shader.
+     */
+    constexpr auto destinationBinding = GLuint{1};
+    /**
+     * \brief The binding point of the buffer, from which particles are read by the compute and vertex shaders.
+     */
+    constexpr auto sourceBinding      = GLuint{0};
+    /**
+     * \brief A number of vertices of the billboard (two triangles).
+     */
+    constexpr auto verticesPerQuad    = GLuint{6};
+    /**
+     * \brief local_size_x of the compute shader.
+     */
+    constexpr auto workGroupSize      = uint32_t{64};
+
+    /**
+     * \brief DrawArraysIndirectCommand is the command, which is read by
+     * [glDrawArraysIndirect()](https://docs.gl/gl4/glDrawArraysIndirect).
+     */
+    struct DrawArraysIndirectCommand final
+    {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint first;
+            GLuint baseInstance;
+
+    };  // struct DrawArraysIndirectCommand
+
+    /**
+     * \brief The size of Particle in the std430 layout of the shaders.
+     */
+    constexpr auto particleSize = size_t{3 * 4 * sizeof(GLfloat)};
+    /**
+     * \brief The value, to which the counter of the destination buffer is reset before the update.
+     */
+    constexpr auto zeroCounter  = GLuint{0};
+
+    /**
+     * \brief UpdateUniforms are uniforms of the update compute shader.
+     */
+    struct UpdateUniforms final
+    {
+            ogls::oglCore::shader::VectorUniform<GLfloat, 1>* deltaTime       = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLuint, 1>*  destination     = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLuint, 1>*  emitCount       = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLfloat, 4>* emitterColor    = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLfloat, 2>* emitterLifeSize = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLfloat, 4>* emitterPosition = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLfloat, 4>* emitterVelocity = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLfloat, 3>* gravity         = nullptr;
+            ogls::oglCore::shader::VectorUniform<GLuint, 1>*  seed            = nullptr;
+
+    };  // struct UpdateUniforms
+
+}  // namespace
+
+class GpuParticleSystem::Impl
+{
+    public:
+        explicit Impl(uint32_t maxParticlesCount) : capacity{maxParticlesCount}
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore;
+            using namespace ogls::oglCore::vertex;
+
+
+            if (capacity == 0)
+            {
+                throw std::invalid_argument{"The capacity of the particle system must be greater than 0."};
+            }
+
+            for (auto& particlesBuffer : particlesBuffers)
+            {
+                particlesBuffer = std::make_unique<Buffer>(BufferTarget::ShaderStorageBuffer,
+                                                           ArrayData{nullptr, size_t{capacity} * particleSize},
+                                                           BufferDataUsage::DynamicCopy);
+            }
+            commandsBuffer = std::make_unique<Buffer>(BufferTarget::DrawIndirectBuffer,
+                                                      ArrayData{initialCommands.data(), sizeof(initialCommands)},
+                                                      BufferDataUsage::DynamicCopy);
+
+            updateProgram  = shader::makeComputeShaderProgram("resources/shaders/cs/gpuParticles.comp");
+            updateUniforms = UpdateUniforms{
+              .deltaTime{&updateProgram->getVectorUniform<GLfloat, 1>("uDeltaTime")},
+              .destination{&updateProgram->getVectorUniform<GLuint, 1>("uDestination")},
+              .emitCount{&updateProgram->getVectorUniform<GLuint, 1>("uEmitCount")},
+              .emitterColor{&updateProgram->getVectorUniform<GLfloat, 4>("uEmitterColor")},
+              .emitterLifeSize{&updateProgram->getVectorUniform<GLfloat, 2>("uEmitterLifeSize")},
+              .emitterPosition{&updateProgram->getVectorUniform<GLfloat, 4>("uEmitterPosition")},
+              .emitterVelocity{&updateProgram->getVectorUniform<GLfloat, 4>("uEmitterVelocity")},
+              .gravity{&updateProgram->getVectorUniform<GLfloat, 3>("uGravity")},
+              .seed{&updateProgram->getVectorUniform<GLuint, 1>("uSeed")}};
+
+            auto renderProgram = std::shared_ptr<shader::ShaderProgram>{shader::makeShaderProgram(
+              "resources/shaders/vs/gpuParticle.vert", "resources/shaders/fs/gpuParticle.frag")};
+            projection = &renderProgram->getMatrixUniform<4, 4>("uProjection");
+            view       = &renderProgram->getMatrixUniform<4, 4>("uView");
+
+            // Particles are additive, so they needn't be sorted, and they don't write the depth
+            auto blend      = pipeline::BlendState{};
+            blend.dstAlpha  = pipeline::BlendFactor::One;
+            blend.dstRgb    = pipeline::BlendFactor::One;
+            blend.isEnabled = true;
+            blend.srcAlpha  = pipeline::BlendFactor::Zero;
+            blend.srcRgb    = pipeline::BlendFactor::SrcAlpha;
+
+            auto depth             = pipeline::DepthState{};
+            depth.function         = pipeline::CompareFunction::Lequal;
+            depth.isTestEnabled    = true;
+            depth.isWritingEnabled = false;
+
+            renderPipelineState =
+              pipeline::pipelineStateManager::create({.blend{blend},
+                                                      .depth{depth},
+                                                      .raster{},
+                                                      .shaderProgram{std::move(renderProgram)},
+                                                      .vertexArray{std::make_shared<VertexArray>()}});
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        const uint32_t                                                capacity;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>                commandsBuffer;
+        /**
+         * \brief The index of the buffer with alive particles. It is the destination of the last update().
+         */
+        uint32_t                                                      current             = {0};
+        /**
+         * \brief The fraction of the particle, which hasn't been born by previous updates.
+         */
+        float                                                         emitAccumulator     = {0.0f};
+        ParticleEmitter                                               emitter;
+        ogls::mathCore::Vec3                                          gravity             = {0.0f, -9.81f, 0.0f};
+        /**
+         * \brief Commands draw billboards of particles of the buffer with the same index.
+         */
+        const std::array<DrawArraysIndirectCommand, 2>                initialCommands     = {
+          DrawArraysIndirectCommand{verticesPerQuad, 0, 0, 0}, DrawArraysIndirectCommand{verticesPerQuad, 0, 0, 0}};
+        std::array<std::unique_ptr<ogls::oglCore::vertex::Buffer>, 2> particlesBuffers;
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   projection          = nullptr;
+        ogls::mathCore::Mat4                                          projectionMatrix;
+        std::shared_ptr<const ogls::oglCore::pipeline::PipelineState> renderPipelineState = nullptr;
+        uint32_t                                                      updatesCount        = {0};
+        std::unique_ptr<ogls::oglCore::shader::ShaderProgram>         updateProgram;
+        UpdateUniforms                                                updateUniforms;
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   view                = nullptr;
+        ogls::mathCore::Mat4                                          viewMatrix;
+
+};  // class GpuParticleSystem::Impl
+
+GpuParticleSystem::GpuParticleSystem(uint32_t capacity) : m_impl{std::make_unique<Impl>(capacity)}
+{
+}
+
+GpuParticleSystem::GpuParticleSystem(GpuParticleSystem&& obj) noexcept = default;
+
+GpuParticleSystem::~GpuParticleSystem() noexcept = default;
+
+GpuParticleSystem& GpuParticleSystem::operator=(GpuParticleSystem&& obj) noexcept = default;
+
+uint32_t GpuParticleSystem::getCapacity() const noexcept
+{
+    return m_impl->capacity;
+}
+
+void GpuParticleSystem::render() const
+{
+    using namespace ogls::oglCore;
+
+
+    const auto& impl = *m_impl;
+
+    pipeline::pipelineStateManager::apply(*impl.renderPipelineState);
+    impl.projection->setData(impl.projectionMatrix);
+    impl.view->setData(impl.viewMatrix);
+
+    impl.particlesBuffers[impl.current]->bindBase(vertex::BufferTarget::ShaderStorageBuffer, sourceBinding);
+    impl.commandsBuffer->bind();
+
+    OGLS_GLCall(glDrawArraysIndirect(
+      GL_TRIANGLES, reinterpret_cast<const void*>(size_t{impl.current} * sizeof(DrawArraysIndirectCommand))));
+}
+
+void GpuParticleSystem::setCamera(const ogls::mathCore::TransformMatrix& view,
+                                  const ogls::mathCore::TransformMatrix& projection)
+{
+    m_impl->projectionMatrix = projection.getResultMatrix();
+    m_impl->viewMatrix       = view.getResultMatrix();
+}
+
+void GpuParticleSystem::setEmitter(const ParticleEmitter& emitter) noexcept
+{
+    m_impl->emitter = emitter;
+}
+
+void GpuParticleSystem::setGravity(const ogls::mathCore::Vec3& gravity) noexcept
+{
+    m_impl->gravity = gravity;
+}
+
+void GpuParticleSystem::update(float deltaTime)
+{
+    using namespace ogls;
+    using namespace ogls::oglCore::vertex;
+
+
+    auto&       impl     = *m_impl;
+    const auto& emitter  = impl.emitter;
+    const auto& uniforms = impl.updateUniforms;
+
+    // Particles, which don't fit into the capacity, are dropped instead of being postponed
+    impl.emitAccumulator += std::max(emitter.rate, 0.0f) * std::max(deltaTime, 0.0f);
+    const auto emitCount = static_cast<uint32_t>(std::min(std::floor(impl.emitAccumulator),
+                                                          static_cast<float>(impl.capacity)));
+    impl.emitAccumulator -= std::floor(impl.emitAccumulator);
+
+    const auto destination = 1 - impl.current;
+    impl.commandsBuffer->setSubData(
+      static_cast<GLintptr>(destination * sizeof(DrawArraysIndirectCommand)
+                            + offsetof(DrawArraysIndirectCommand, instanceCount)),
+      ArrayData{&zeroCounter, sizeof(zeroCounter)});
+
+    impl.updateProgram->use();
+    uniforms.deltaTime->setData({deltaTime});
+    uniforms.destination->setData({destination});
+    uniforms.emitCount->setData({emitCount});
+    uniforms.emitterColor->setData(emitter.color);
+    uniforms.emitterLifeSize->setData({emitter.lifetime, emitter.size});
+    uniforms.emitterPosition->setData(
+      {emitter.position.x(), emitter.position.y(), emitter.position.z(), emitter.positionSpread});
+    uniforms.emitterVelocity->setData(
+      {emitter.velocity.x(), emitter.velocity.y(), emitter.velocity.z(), emitter.velocitySpread});
+    uniforms.gravity->setData({impl.gravity.x(), impl.gravity.y(), impl.gravity.z()});
+    // The golden ratio spreads seeds of successive updates over the whole range
+    uniforms.seed->setData({impl.updatesCount * 0x9E'37'79'B9u});
+
+    impl.particlesBuffers[impl.current]->bindBase(BufferTarget::ShaderStorageBuffer, sourceBinding);
+    impl.particlesBuffers[destination]->bindBase(BufferTarget::ShaderStorageBuffer, destinationBinding);
+    impl.commandsBuffer->bindBase(BufferTarget::ShaderStorageBuffer, commandsBinding);
+
+    // The number of alive particles is known only on the GPU, so all threads, which can have work, are started
+    const auto groupsCount = (uint64_t{impl.capacity} + emitCount + workGroupSize - 1) / workGroupSize;
+    OGLS_GLCall(glDispatchCompute(static_cast<GLuint>(groupsCount), 1, 1));
+    // Particles are read as the shader storage and their counter is read as the indirect command
+    OGLS_GLCall(glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT));
+
+    impl.current = destination;
+    ++impl.updatesCount;
+}
+
+}  // namespace app::renderer
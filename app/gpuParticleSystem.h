@@ -0,0 +1,143 @@
+#ifndef APP_RENDERER_GPU_PARTICLE_SYSTEM_H
+#define APP_RENDERER_GPU_PARTICLE_SYSTEM_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "helpers/macros.h"
+#include "mathCore/transformMatrix.h"
+#include "mathCore/vector.h"
+
+namespace app::renderer
+{
+/**
+ * \brief ParticleEmitter describes, where and which particles are born.
+ *
+ * Every particle gets random deviations from the position and the velocity, which are uniform in the cube with
+ * the half size of the spread.
+ */
+struct ParticleEmitter final
+{
+        /**
+         * \brief The color of new particles (RGBA). The alpha fades out to 0 by the end of the life.
+         */
+        std::array<float, 4> color          = {1.0f, 1.0f, 1.0f, 1.0f};
+        /**
+         * \brief A number of seconds, which particles live.
+         */
+        float                lifetime       = {2.0f};
+        /**
+         * \brief The center of the emitter in the world coordinate system.
+         */
+        ogls::mathCore::Vec3 position       = ogls::mathCore::Vec3{0.0f};
+        /**
+         * \brief The half size of the cube around the position, in which particles are born.
+         */
+        float                positionSpread = {0.0f};
+        /**
+         * \brief A number of particles, which are born per second.
+         */
+        float                rate           = {0.0f};
+        /**
+         * \brief The size of the billboard of the particle in world units.
+         */
+        float                size           = {0.05f};
+        /**
+         * \brief The average velocity of new particles.
+         */
+        ogls::mathCore::Vec3 velocity       = ogls::mathCore::Vec3{0.0f};
+        /**
+         * \brief The half size of the cube around the velocity, from which velocities of new particles are taken.
+         */
+        float                velocitySpread = {0.0f};
+
+};  // struct ParticleEmitter
+
+/**
+ * \brief GpuParticleSystem emits, simulates and draws particles without any particle data on the CPU.
+ *
+ * Particles are stored in two shader storage buffers, which are swapped every update(). The update compute shader
+ * integrates alive particles of the source buffer and appends survivors and new particles to the destination
+ * buffer through the atomic counter. The counter is instanceCount of the indirect draw command, so render() draws
+ * instanced billboards by [glDrawArraysIndirect()](https://docs.gl/gl4/glDrawArraysIndirect) and the number of
+ * alive particles is never read back.
+ *
+ * Compute shaders are used instead of transform feedback, because the renderer requires OpenGL 4.6 anyway and
+ * appending into the compacted buffer doesn't map onto transform feedback.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * particles.setEmitter(emitter);
+ * particles.update(deltaTime);
+ * particles.setCamera(view, projection);
+ * particles.render();
+ * \endcode
+ */
+class GpuParticleSystem final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of GpuParticleSystem.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new GpuParticleSystem without particles, creates buffers, shader programs and
+         * the pipeline state.
+         *
+         * \param capacity - the maximal number of alive particles. Particles, which don't fit, aren't born.
+         * \throw std::invalid_argument, if the capacity is 0,
+         * ogls::exceptions::GLRecAcquisitionException(), if OpenGL objects can't be created,
+         * exceptions, which can be thrown by makeShaderProgram() and makeComputeShaderProgram().
+         */
+        explicit GpuParticleSystem(uint32_t capacity = {1'000'000});
+        OGLS_NOT_COPYABLE(GpuParticleSystem)
+        GpuParticleSystem(GpuParticleSystem&& obj) noexcept;
+        ~GpuParticleSystem() noexcept;
+
+        GpuParticleSystem& operator=(GpuParticleSystem&& obj) noexcept;
+
+        /**
+         * \brief Returns the maximal number of alive particles.
+         */
+        uint32_t getCapacity() const noexcept;
+        /**
+         * \brief Draws alive particles as billboards, which face the camera, with the additive blending.
+         */
+        void     render() const;
+        /**
+         * \brief Sets the camera, to which billboards are turned.
+         *
+         * \param view       - the view transformation.
+         * \param projection - the perspective or orthographic projection.
+         */
+        void     setCamera(const ogls::mathCore::TransformMatrix& view,
+                           const ogls::mathCore::TransformMatrix& projection);
+        /**
+         * \brief Sets the emitter of new particles. Already born particles aren't changed.
+         */
+        void     setEmitter(const ParticleEmitter& emitter) noexcept;
+        /**
+         * \brief Sets the acceleration, which is applied to all particles.
+         */
+        void     setGravity(const ogls::mathCore::Vec3& gravity) noexcept;
+        /**
+         * \brief Emits new particles and simulates alive ones on the GPU.
+         *
+         * \param deltaTime - the time in seconds since the previous update.
+         */
+        void     update(float deltaTime);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class GpuParticleSystem
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,91 @@
+#include "lodSelection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace app::renderer
+{
+LodProjection makeLodProjection(const ogls::mathCore::TransformMatrix& view,
+                                const ogls::mathCore::TransformMatrix& projection, float viewportHeight) noexcept
+{
+    const auto matrix = projection.getResultMatrix();
+    const auto p      = matrix.getPointerToData();
+
+    // The diagonal and the last element don't depend on the notation of vectors: the last element is 0 only for
+    // the perspective projection, and [1][1] scales y of the view space into the range [-1, 1]
+    return LodProjection{.isPerspective{p[15] == 0.0f},
+                         .pixelsPerUnit{std::abs(p[5]) * viewportHeight * 0.5f},
+                         .view{view.getResultMatrix()}};
+}
+
+float calculatePixelsPerUnit(const LodProjection& projection, const ogls::mathCore::BoundingBox& worldBounds,
+                             const ogls::mathCore::Mat4& worldMatrix) noexcept
+{
+    using namespace ogls::mathCore;
+
+
+    // Errors are measured in the local coordinate system, so they are scaled by the largest scale of the object
+    const auto m = worldMatrix.getPointerToData();
+
+    // Returns the element of the transformation in the notation of column vectors
+    const auto at = [m](size_t row, size_t column)
+    {
+        return OGLS_VECTOR_IS_COLUMN ? m[row * 4 + column] : m[column * 4 + row];
+    };
+
+    auto worldScale = 0.0f;
+    for (auto c = size_t{0}; c < 3; ++c)
+    {
+        worldScale = std::max(worldScale, std::sqrt(at(0, c) * at(0, c) + at(1, c) * at(1, c) + at(2, c) * at(2, c)));
+    }
+
+    if (!projection.isPerspective)
+    {
+        return projection.pixelsPerUnit * worldScale;
+    }
+
+    // The distance from the camera to the nearest point of the bounding sphere
+    const auto viewBounds = transformBoundingBox(BoundingBox{.center{worldBounds.center}, .halfExtents{Vec3{0.0f}}},
+                                                 projection.view);
+    const auto distance   = viewBounds.center.length() - worldBounds.halfExtents.length();
+    if (distance <= 0.0f)
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    return projection.pixelsPerUnit * worldScale / distance;
+}
+
+size_t selectLod(std::span<const ogls::assets::MeshLod> lods, float pixelsPerUnit, size_t currentLod,
+                 const LodSettings& settings) noexcept
+{
+    if (lods.empty())
+    {
+        return 0;
+    }
+
+    const auto isVisible = [pixelsPerUnit](const ogls::assets::MeshLod& lod, float limit)
+    {
+        // The full-detail level has no error even if the object encloses the camera
+        return lod.error > 0.0f && lod.error * pixelsPerUnit > limit;
+    };
+
+    auto result = std::min(currentLod, lods.size() - 1);
+    if (isVisible(lods[result], settings.maxScreenError))
+    {
+        while (result > 0 && isVisible(lods[result], settings.maxScreenError))
+        {
+            --result;
+        }
+        return result;
+    }
+
+    const auto coarserLimit = settings.maxScreenError * (1.0f - settings.hysteresis);
+    while (result + 1 < lods.size() && !isVisible(lods[result + 1], coarserLimit))
+    {
+        ++result;
+    }
+    return result;
+}
+
+}  // namespace app::renderer
@@ -0,0 +1,91 @@
+#ifndef APP_RENDERER_LOD_SELECTION_H
+#define APP_RENDERER_LOD_SELECTION_H
+
+#include <cstddef>
+#include <span>
+
+#include "assets/meshData.h"
+#include "mathCore/boundingBox.h"
+#include "mathCore/matrix.h"
+#include "mathCore/transformMatrix.h"
+
+namespace app::renderer
+{
+/**
+ * \brief LodSettings describes, how levels of detail are selected.
+ */
+struct LodSettings final
+{
+        /**
+         * \brief The fraction of maxScreenError, by which the error of the coarser level must be below the limit
+         * to switch to it. It prevents flickering of objects, which are on the boundary between two levels.
+         */
+        float hysteresis     = {0.25f};
+        /**
+         * \brief The maximal visible error of the simplification in pixels.
+         */
+        float maxScreenError = {1.0f};
+
+};  // struct LodSettings
+
+/**
+ * \brief LodProjection contains everything, what is needed to project geometric errors of levels of detail onto
+ * the screen. It is calculated once per frame by makeLodProjection().
+ */
+struct LodProjection final
+{
+        /**
+         * \brief Whether the projection is perspective. The orthographic projection doesn't depend on the distance.
+         */
+        bool                 isPerspective = {true};
+        /**
+         * \brief A number of pixels, which one unit of the view space takes on the screen at the distance 1
+         * (the perspective projection) or at any distance (the orthographic projection).
+         */
+        float                pixelsPerUnit = {0.0f};
+        /**
+         * \brief The view matrix.
+         */
+        ogls::mathCore::Mat4 view;
+
+};  // struct LodProjection
+
+/**
+ * \brief Makes LodProjection of the camera.
+ *
+ * \param view           - the view transformation.
+ * \param projection     - the perspective or orthographic projection.
+ * \param viewportHeight - the height of the viewport in pixels.
+ */
+LodProjection makeLodProjection(const ogls::mathCore::TransformMatrix& view,
+                                const ogls::mathCore::TransformMatrix& projection, float viewportHeight) noexcept;
+/**
+ * \brief Calculates, how many pixels one unit of the local coordinate system of the object takes on the screen.
+ *
+ * The nearest point of the bounding sphere of the object is used, so the error is never underestimated.
+ * The object, which encloses the camera, gets the infinite value.
+ *
+ * \param projection  - the projection of the camera.
+ * \param worldBounds - the bounding box of the object in the world coordinate system.
+ * \param worldMatrix - the world matrix of the object, which scale is applied to its errors.
+ */
+float         calculatePixelsPerUnit(const LodProjection& projection, const ogls::mathCore::BoundingBox& worldBounds,
+                                     const ogls::mathCore::Mat4& worldMatrix) noexcept;
+/**
+ * \brief Selects the coarsest level of detail, which error is invisible.
+ *
+ * The finer level is selected as soon as the error of the current one exceeds the limit, but the coarser level is
+ * selected only when its error is below the limit reduced by the hysteresis.
+ *
+ * \param lods          - levels of detail from the finest one to the coarsest one.
+ * \param pixelsPerUnit - the result of calculatePixelsPerUnit() for the object.
+ * \param currentLod    - the level selected in the previous frame.
+ * \param settings      - settings of the selection.
+ * \return the index of the selected level.
+ */
+size_t        selectLod(std::span<const ogls::assets::MeshLod> lods, float pixelsPerUnit, size_t currentLod,
+                        const LodSettings& settings) noexcept;
+
+}  // namespace app::renderer
+
+#endif
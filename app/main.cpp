@@ -1,11 +1,16 @@
-#include <iostream>
+#include <algorithm>
+#include <filesystem>
 #include <memory>
 
 #include <glad/glad.h>
-#include <glfw3.h>
 
 #include "exceptions.h"
+#include "helpers/allocationTracker.h"
+#include "helpers/logger.h"
+#include "helpers/virtualFileSystem.h"
+#include "renderLoop.h"
 #include "renderer.h"
+#include "simulation.h"
 #include "window.h"
 
 namespace
@@ -14,10 +19,20 @@ constexpr auto           WIDTH  = int{800};
 constexpr auto           HEIGHT = int{600};
 constexpr decltype(auto) TITLE  = "OpenGL Study Project";
 
+// The archive with cooked assets. If it doesn't exist, loose files from the resources folder are used.
+constexpr decltype(auto) ASSETS_ARCHIVE = "resources.ogla";
+
+// Every N-th allocation of the thread captures its call stack, if allocations are tracked
+constexpr auto ALLOCATION_SAMPLING_PERIOD = uint32_t{64};
+constexpr auto TOP_ALLOCATION_SITES_COUNT = size_t{5};
+
+void logAllocationStatistics(const app::RenderLoop& renderLoop);
+
 }  // namespace
 
 int main()
 {
+    using namespace app;
     using namespace app::renderer;
     using namespace ogls;
     using namespace ogls::exceptions;
@@ -30,32 +45,95 @@ int main()
     }
     catch (const WindowInitializationException& exc)
     {
-        std::cerr << exc.what() << std::endl;
+        OGLS_LOG_ERROR("{}", exc.what());
         return -1;
     }
 
-    glfwSwapInterval(4);
+    if (std::filesystem::exists(ASSETS_ARCHIVE))
+    {
+        try
+        {
+            helpers::getDefaultVirtualFileSystem().mountArchive(ASSETS_ARCHIVE);
+        }
+        catch (const FileException& exc)
+        {
+            OGLS_LOG_ERROR("{}", exc.what());
+        }
+    }
 
     auto renderer = std::unique_ptr<Renderer>{};
     try
     {
         renderer = std::make_unique<Renderer>();
+        renderer->setCamera(mathCore::TransformMatrix{}, mathCore::TransformMatrix::createOrthographicProjection(),
+                            static_cast<float>(HEIGHT));
     }
     catch (const GLRecAcquisitionException& exc)
     {
-        std::cerr << exc.what() << std::endl;
+        OGLS_LOG_ERROR("{}", exc.what());
         return -2;
     }
 
-    // Render loop
-    while (!window->shouldClose())
-    {
-        renderer->render();
+    auto simulation = Simulation{};
 
-        window->swapBuffers();
+    // The scene is redrawn only when something changes, so the static scene doesn't load the CPU and the GPU.
+    // Drawn frames start as late as the vertical synchronization allows, so they show the freshest inputs.
+    auto renderLoop = std::unique_ptr<RenderLoop>{};
+    try
+    {
+        renderLoop = std::make_unique<RenderLoop>(
+          *window, *renderer, simulation,
+          RenderLoopSettings{.mode{RenderMode::OnDemand}, .pacing{.mode{PacingMode::LowLatency}, .swapInterval{1}}});
+    }
+    catch (const GLRecAcquisitionException& exc)
+    {
+        OGLS_LOG_ERROR("{}", exc.what());
+        return -2;
+    }
+    if constexpr (helpers::isAllocationTrackingEnabled())
+    {
+        helpers::setCallStackSampling(ALLOCATION_SAMPLING_PERIOD);
+    }
+    renderLoop->run();
 
-        glfwPollEvents();
+    const auto& timings = renderLoop->getFramePacer().getAverageTimings();
+    OGLS_LOG_INFO("Frames: {}, CPU: {} ms, GPU: {} ms, swap: {} ms, wait: {} ms, input latency: {} ms.",
+                  renderLoop->getFramesCount(), timings.cpuTime.count(), timings.gpuTime.count(),
+                  timings.swapTime.count(), timings.waitTime.count(), timings.inputLatency.count());
+    if constexpr (helpers::isAllocationTrackingEnabled())
+    {
+        logAllocationStatistics(*renderLoop);
     }
 
     return 0;
 }
+
+namespace
+{
+void logAllocationStatistics(const app::RenderLoop& renderLoop)
+{
+    using namespace ogls::helpers;
+
+
+    const auto  framesCount = std::max(renderLoop.getFramesCount(), uint64_t{1});
+    const auto& statistics  = renderLoop.getAllocationStatistics();
+    const auto  total       = statistics.getTotal();
+    OGLS_LOG_INFO("Allocations per frame: {} ({} bytes), frees per frame: {}.", total.allocationsCount / framesCount,
+                  total.allocatedBytes / framesCount, total.freesCount / framesCount);
+
+    for (auto i = size_t{0}; i < allocationSubsystemsCount; ++i)
+    {
+        const auto  subsystem = static_cast<AllocationSubsystem>(i);
+        const auto& counters  = statistics.getCounters(subsystem);
+        OGLS_LOG_INFO("    {}: {} allocations ({} bytes) per frame.", toString(subsystem),
+                      counters.allocationsCount / framesCount, counters.allocatedBytes / framesCount);
+    }
+
+    for (const auto& site : getTopAllocationSites(TOP_ALLOCATION_SITES_COUNT))
+    {
+        OGLS_LOG_INFO("Sampled site of {}: {} allocations ({} bytes):\n{}", toString(site.subsystem),
+                      site.allocationsCount, site.allocatedBytes, formatCallStack(site.callStack));
+    }
+}
+
+}  // namespace
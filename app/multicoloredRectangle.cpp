@@ -1,26 +1,26 @@
 #include "multicoloredRectangle.h"
 
-#include <array>
 #include <cmath>
 #include <exception>
 #include <stdexcept>
+#include <vector>
 
 #include <glad/glad.h>
 
-#include "buffer.h"
-#include "generalTypes.h"
-#include "helpers/debugHelpers.h"
-#include "helpers/helpers.h"
+#include "assets/meshData.h"
 #include "shaderProgram.h"
 #include "texture.h"
 #include "uniforms.h"
 
 namespace app
 {
-MulticoloredRectangle::MulticoloredRectangle(std::shared_ptr<ogls::oglCore::vertex::VertexArray>   vao,
-                                             std::shared_ptr<ogls::oglCore::shader::ShaderProgram> shaderProgram) :
-    SceneObject{std::move(vao), shaderProgram},
-    m_colorCoefficient{shaderProgram->getVectorUniform<float, 1>("k")}
+MulticoloredRectangle::MulticoloredRectangle(renderer::RenderResources& resources, renderer::EntityStore& entityStore,
+                                             renderer::Entity entity, renderer::TextureHandle nextTexture) :
+    SceneObject{entityStore, entity},
+    m_colorCoefficient{resources.getResourceManager()
+                         .getShaderProgram(resources.getMaterial(entityStore.getMaterial(entity))->shaderProgram)
+                         ->getVectorUniform<float, 1>("k")},
+    m_nextTexture{nextTexture}, m_resources{&resources}
 {
 }
 
@@ -29,112 +29,95 @@ void MulticoloredRectangle::setColorCoefficient(float k)
     // TODO:
     if (k >= 0.0 && !isgreater(k, 1.0))
     {
-        m_shaderProgram->use();
+        const auto material = m_resources->getMaterial(m_entityStore->getMaterial(m_entity));
+        m_resources->getResourceManager().getShaderProgram(material->shaderProgram)->use();
         m_colorCoefficient.setData(k);
+        invalidate();
         return;
     }
     // throw std::out_of_range{"k must be in the range [0; 1]."};
 }
 
-void MulticoloredRectangle::render()
+void MulticoloredRectangle::update()
 {
-    using namespace ogls::helpers;
-    using namespace ogls::oglCore;
-
+    using namespace ogls::oglCore::texture;
 
-    m_vao->bind();
-    m_shaderProgram->use();
-    applyTexturesConfiguration();
 
     if (m_counter++ == 300)
     {
-        auto textureData =
-          std::shared_ptr<texture::TextureData>{readTextureFromFile("resources/textures/awesomeface.png")};
-        textureData->format = texture::TexturePixelFormat::Rgba;
-        texture::castBaseTextureToTexture<2>(m_texturesConfiguration, 0, 0)->setData(textureData);
+        // The texture is shared by ResourceManager, so the material is switched to another texture
+        // instead of changing the data of the current one
+        const auto material = m_resources->getMaterial(m_entityStore->getMaterial(m_entity));
+        material->textures  = TexturesConfiguration{
+          {0, std::vector<std::shared_ptr<BaseTexture>>{m_resources->getResourceManager().getTexture(m_nextTexture)}}
+        };
+        invalidate();
     }
-
-    OGLS_GLCall(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr));
 }
 
-std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle()
+std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle(renderer::RenderResources& resources,
+                                                                 renderer::EntityStore&     entityStore,
+                                                                 renderer::SceneGraph&      sceneGraph)
 {
     using namespace ogls;
-    using namespace ogls::oglCore::shader;
     using namespace ogls::oglCore::texture;
     using namespace ogls::oglCore::vertex;
 
 
-    static auto callCounter = int{0};
+    auto& resourceManager = resources.getResourceManager();
 
     // clang-format off
-    static const auto points  = std::array<GLfloat, 28>{
-		-0.5f, -0.5f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f,
-		-0.5f,  0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
-		 0.5f,  0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f,
-		 0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f
-	};
+    const auto meshData = assets::MeshData{
+        .attributes{
+            VertexAttribute{.byteOffset{0}, .count{2}, .index{0}, .normalized{false}, .type{VertexAttrType::Float}},
+            VertexAttribute{.byteOffset{getByteSizeOfType(VertexAttrType::Float) * 2}, .count{3}, .index{1},
+                            .normalized{false}, .type{VertexAttrType::Float}},
+            VertexAttribute{.byteOffset{getByteSizeOfType(VertexAttrType::Float) * 5}, .count{2}, .index{2},
+                            .normalized{false}, .type{VertexAttrType::Float}}
+        },
+        .bounds{.center{0.0f, 0.0f, 0.0f}, .halfExtents{0.5f, 0.5f, 0.0f}},
+        .indices{0, 1, 2, 2, 3, 0},
+        .lods{},
+        .vertices{
+            -0.5f, -0.5f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f,
+            -0.5f,  0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+             0.5f,  0.5f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+             0.5f, -0.5f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f
+        }
+    };
     // clang-format on
-    static const auto indices = std::array<GLuint, 6>{0, 1, 2, 2, 3, 0};
-
-    // Configure VAO, VBO and EBO only once
-    static auto VAO = std::make_shared<VertexArray>();
-
-    static auto coordinateMap =
-      VertexAttribute{.byteOffset{0}, .count{2}, .index{0}, .normalized{false}, .type{VertexAttrType::Float}};
-    static auto colorMap  = VertexAttribute{.byteOffset{getByteSizeOfType(VertexAttrType::Float) * 2},
-                                            .count{3},
-                                            .index{1},
-                                            .normalized{false},
-                                            .type{VertexAttrType::Float}};
-    static auto texCoords = VertexAttribute{.byteOffset{getByteSizeOfType(VertexAttrType::Float) * 5},
-                                            .count{2},
-                                            .index{2},
-                                            .normalized{false},
-                                            .type{VertexAttrType::Float}};
-
-    static auto layout = VertexBufferLayout{};
-    if (callCounter == 0)
-    {
-        layout.addVertexAttribute(coordinateMap);
-        layout.addVertexAttribute(colorMap);
-        layout.addVertexAttribute(texCoords);
-    }
-
-    static auto data = ArrayData{reinterpret_cast<const void*>(points.data()), sizeof(points)};
-    static auto VBO  = std::make_shared<Buffer>(BufferTarget::ArrayBuffer, data, BufferDataUsage::StaticDraw, layout);
-    if (callCounter == 0)
-    {
-        VAO->addBuffer(VBO);
-    }
 
-    static auto EBO =
-      std::make_shared<Buffer>(BufferTarget::ElementArrayBuffer,
-                               ArrayData{reinterpret_cast<const void*>(indices.data()), sizeof(indices)},
-                               BufferDataUsage::StaticDraw);
-    if (callCounter == 0)
-    {
-        VAO->addBuffer(EBO);
-    }
+    // Repeated calls reuse the mesh, the shader program and the textures loaded by the first call
+    const auto mesh          = resourceManager.loadMesh(meshData);
+    const auto shaderProgram = resourceManager.loadShaderProgram("resources/shaders/vs/vertexShader.vert",
+                                                                 "resources/shaders/fs/fragmentShader.frag");
+    const auto texture       = resourceManager.loadTexture("resources/textures/wooden_container.jpg");
+    const auto nextTexture   = resourceManager.loadTexture("resources/textures/awesomeface.png");
 
-    // Create shader program only once
-    static auto shaderProgram = std::shared_ptr<ShaderProgram>{
-      makeShaderProgram("resources/shaders/vs/vertexShader.vert", "resources/shaders/fs/fragmentShader.frag")};
-
-    // Load textures only once
-    static auto textureData =
-      std::shared_ptr<TextureData>{helpers::readTextureFromFile("resources/textures/wooden_container.jpg")};
-    static auto                  texture2D = std::make_shared<Texture<2>>(TextureTarget::Texture2d, textureData);
-    static TexturesConfiguration texturesConfig{
-      {0, std::vector<std::shared_ptr<BaseTexture>>{texture2D}}
+    auto textures = TexturesConfiguration{
+      {0, std::vector<std::shared_ptr<BaseTexture>>{resourceManager.getTexture(texture)}}
     };
-
-    ++callCounter;
-
-    // Create new MulticoloredRectangle
-    auto rect = new MulticoloredRectangle{VAO, shaderProgram};
-    rect->setTexturesConfiguration(texturesConfig);
-    return std::unique_ptr<MulticoloredRectangle>(rect);
+    auto&      world    = resourceManager.getShaderProgram(shaderProgram)->getMatrixUniform<4, 4>("uWorld");
+    const auto material = resources.addMaterial(renderer::Material{.blend{},
+                                                                   .depth{},
+                                                                   .modelMatrix{&world},
+                                                                   .raster{},
+                                                                   .shaderProgram{shaderProgram},
+                                                                   .textures{std::move(textures)}});
+    // The material holds own reference to the shader program
+    resourceManager.release(shaderProgram);
+
+    const auto node   = sceneGraph.addNode(mathCore::Transform{});
+    const auto entity = entityStore.createEntity(node, mesh, material, meshData.bounds);
+
+    // The small translated child circles around the center of the rectangle, if world matrices of the scene graph
+    // reach the shader in the right notation
+    const auto childTransform = mathCore::Transform{.scale{mathCore::Vec3{0.25f, 0.25f, 1.0f}},
+                                                    .translation{mathCore::Vec3{0.75f, 0.0f, 0.0f}}};
+    entityStore.createEntity(sceneGraph.addNode(childTransform, node), mesh, material, meshData.bounds);
+
+    return std::unique_ptr<MulticoloredRectangle>(
+      new MulticoloredRectangle{resources, entityStore, entity, nextTexture});
 }
 
 }  // namespace app
@@ -1,6 +1,7 @@
 #ifndef APP_MULTICOLORED_RECTANGLE_H
 #define APP_MULTICOLORED_RECTANGLE_H
 
+#include "renderResources.h"
 #include "sceneObject.h"
 
 namespace app
@@ -23,19 +24,21 @@ class MulticoloredRectangle : public renderer::SceneObject
         void setColorCoefficient(float k);
 
         /**
-         * \brief Renders multicolored rectangle on the scene.
+         * \brief Updates the state of the rectangle. It must be called per every render loop iteration.
          */
-        void render() override;
+        void update();
 
     private:
         /**
-         * \brief Constructs an object with specified vertex array object and shader program.
+         * \brief Constructs an object, which controls the entity of the rectangle.
          *
-         * \param vao           - a vertex array object, which contains necessary vertex configuration.
-         * \param shaderProgram - a shader program, which is used for rendering of the rectangle.
+         * \param resources   - the resources, which contain the material of the rectangle.
+         * \param entityStore - the store, which contains the entity of the rectangle.
+         * \param entity      - the entity of the rectangle.
+         * \param nextTexture - the texture, which replaces the initial one after some time.
          */
-        MulticoloredRectangle(std::shared_ptr<ogls::oglCore::vertex::VertexArray>   vao,
-                              std::shared_ptr<ogls::oglCore::shader::ShaderProgram> shaderProgram);
+        MulticoloredRectangle(renderer::RenderResources& resources, renderer::EntityStore& entityStore,
+                              renderer::Entity entity, renderer::TextureHandle nextTexture);
 
     private:
         /**
@@ -45,20 +48,40 @@ class MulticoloredRectangle : public renderer::SceneObject
         /**
          * \brief Counter to count a number of rendering iterations.
          */
-        int                                             m_counter = {0};
+        int                                             m_counter   = {0};
+        /**
+         * \brief The texture, which replaces the initial one after some time.
+         */
+        renderer::TextureHandle                         m_nextTexture;
+        /**
+         * \brief The resources, which contain the material of the rectangle.
+         */
+        renderer::RenderResources*                      m_resources = nullptr;
 
 
-        friend std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle();
+        friend std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle(renderer::RenderResources& resources,
+                                                                                renderer::EntityStore&     entityStore,
+                                                                                renderer::SceneGraph&      sceneGraph);
 
 };  // class MulticoloredRectangle
 
 /**
  * \brief Creates new MulticoloredRectangle object.
  *
+ * The mesh, the shader program and textures are loaded by the resource manager of the resources (only once for
+ * all rectangles), new material is registered in the resources, the entity is created in the store and is attached
+ * to new root node of the scene graph. The smaller entity with the same mesh and material is attached to the child
+ * node, which is shifted along X, so it follows the rotation of the rectangle.
+ *
+ * \param resources   - the resources to register the mesh and the material of the rectangle.
+ * \param entityStore - the store to create the entity of the rectangle.
+ * \param sceneGraph  - the scene graph to add the node of the rectangle.
  * \return std::unique_ptr on created MulticoloredRectangle.
  * \throw ogls::exceptions::GLRecAcquisitionException(), see ogls::oglCore::shader::makeShaderProgram().
  */
-std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle();
+std::unique_ptr<MulticoloredRectangle> makeMulticoloredRectangle(renderer::RenderResources& resources,
+                                                                 renderer::EntityStore&     entityStore,
+                                                                 renderer::SceneGraph&      sceneGraph);
 
 }  // namespace app
 
@@ -0,0 +1,231 @@
+#include "occlusionCuller.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "pipelineState.h"
+#include "shaderProgram.h"
+#include "uniforms.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief Corners of the cube [-1, 1]^3, which is scaled into the box in the vertex shader.
+     */
+    constexpr auto cubeVertices = std::array<GLfloat, 24>{-1.0f, -1.0f, -1.0f, 1.0f,  -1.0f, -1.0f,
+                                                          1.0f,  1.0f,  -1.0f, -1.0f, 1.0f,  -1.0f,
+                                                          -1.0f, -1.0f, 1.0f,  1.0f,  -1.0f, 1.0f,
+                                                          1.0f,  1.0f,  1.0f,  -1.0f, 1.0f,  1.0f};
+    /**
+     * \brief Triangles of faces of the cube. Faces aren't culled, so their orientation doesn't matter.
+     */
+    constexpr auto cubeIndices  = std::array<GLuint, 36>{0, 1, 2, 2, 3, 0, 4, 5, 6, 6, 7, 4, 0, 1, 5, 5, 4, 0,
+                                                         3, 2, 6, 6, 7, 3, 0, 3, 7, 7, 4, 0, 1, 2, 6, 6, 5, 1};
+
+    std::array<float, 3> toArray(const ogls::mathCore::Vec3& v) noexcept;
+
+}  // namespace
+
+class OcclusionCuller::Impl
+{
+    public:
+        explicit Impl(const OcclusionSettings& s) : settings{s}
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore;
+            using namespace ogls::oglCore::vertex;
+
+
+            auto layout = VertexBufferLayout{};
+            layout.addVertexAttribute({.byteOffset{0}, .count{3}, .index{0}});
+
+            auto vao = std::make_shared<VertexArray>();
+            vao->addBuffer(std::make_shared<Buffer>(BufferTarget::ArrayBuffer,
+                                                    ArrayData{cubeVertices.data(), sizeof(cubeVertices)},
+                                                    BufferDataUsage::StaticDraw, layout));
+            vao->addBuffer(std::make_shared<Buffer>(BufferTarget::ElementArrayBuffer,
+                                                    ArrayData{cubeIndices.data(), sizeof(cubeIndices)},
+                                                    BufferDataUsage::StaticDraw));
+
+            auto shaderProgram = std::shared_ptr<shader::ShaderProgram>{shader::makeShaderProgram(
+              "resources/shaders/vs/occlusionBox.vert", "resources/shaders/fs/occlusionBox.frag")};
+
+            boxCenter      = &shaderProgram->getVectorUniform<float, 3>("uBoxCenter");
+            boxHalfExtents = &shaderProgram->getVectorUniform<float, 3>("uBoxHalfExtents");
+            projection     = &shaderProgram->getMatrixUniform<4, 4>("uProjection");
+            view           = &shaderProgram->getMatrixUniform<4, 4>("uView");
+
+            // Boxes only test against the depth of visible objects, and nothing of them must be visible
+            auto blend                  = pipeline::BlendState{};
+            blend.isColorWritingEnabled = false;
+
+            auto depth             = pipeline::DepthState{};
+            depth.function         = pipeline::CompareFunction::Lequal;
+            depth.isTestEnabled    = true;
+            depth.isWritingEnabled = false;
+
+            pipelineState = pipeline::pipelineStateManager::create({.blend{blend},
+                                                                    .depth{depth},
+                                                                    .raster{},
+                                                                    .shaderProgram{std::move(shaderProgram)},
+                                                                    .vertexArray{std::move(vao)}});
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Checks whether the box expanded by the margin encloses the camera.
+         */
+        bool isEnclosingCamera(const ogls::mathCore::BoundingBox& worldBounds) const noexcept
+        {
+            const auto viewBounds = ogls::mathCore::transformBoundingBox(worldBounds, viewMatrix);
+            const auto& c = viewBounds.center;
+            const auto& e = viewBounds.halfExtents;
+            const auto  m = settings.cameraMargin;
+
+            return std::abs(c.x()) <= e.x() + m && std::abs(c.y()) <= e.y() + m && std::abs(c.z()) <= e.z() + m;
+        }
+
+        /**
+         * \brief Returns the frame, after which the object, which has just been found visible, is queried again.
+         */
+        uint32_t makeNextQueryFrame() noexcept
+        {
+            const auto interval = std::max(settings.visibleQueryInterval, uint32_t{1});
+            return frame + interval + spreadCounter++ % interval;
+        }
+
+    public:
+        ogls::oglCore::shader::VectorUniform<float, 3>*               boxCenter        = nullptr;
+        ogls::oglCore::shader::VectorUniform<float, 3>*               boxHalfExtents   = nullptr;
+        uint32_t                                                      frame            = {0};
+        std::shared_ptr<const ogls::oglCore::pipeline::PipelineState> pipelineState    = nullptr;
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   projection       = nullptr;
+        ogls::mathCore::Mat4                                          projectionMatrix;
+        const OcclusionSettings                                       settings;
+        uint32_t                                                      spreadCounter    = {0};
+        ogls::oglCore::shader::MatrixUniform<4, 4>*                   view             = nullptr;
+        ogls::mathCore::Mat4                                          viewMatrix;
+
+};  // class OcclusionCuller::Impl
+
+OcclusionCuller::OcclusionCuller(const OcclusionSettings& settings) : m_impl{std::make_unique<Impl>(settings)}
+{
+}
+
+OcclusionCuller::OcclusionCuller(OcclusionCuller&& obj) noexcept = default;
+
+OcclusionCuller::~OcclusionCuller() noexcept = default;
+
+OcclusionCuller& OcclusionCuller::operator=(OcclusionCuller&& obj) noexcept = default;
+
+void OcclusionCuller::beginFrame() noexcept
+{
+    ++m_impl->frame;
+}
+
+void OcclusionCuller::beginQueries()
+{
+    ogls::oglCore::pipeline::pipelineStateManager::apply(*m_impl->pipelineState);
+
+    m_impl->projection->setData(m_impl->projectionMatrix);
+    m_impl->view->setData(m_impl->viewMatrix);
+}
+
+void OcclusionCuller::issueQuery(OcclusionState& state, const ogls::mathCore::BoundingBox& worldBounds)
+{
+    using namespace ogls::oglCore::query;
+
+
+    if (!state.query)
+    {
+        state.query = std::make_unique<Query>(QueryTarget::AnySamplesPassedConservative);
+    }
+
+    m_impl->boxCenter->setData(toArray(worldBounds.center));
+    m_impl->boxHalfExtents->setData(toArray(worldBounds.halfExtents));
+
+    state.query->begin();
+    OGLS_GLCall(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(cubeIndices.size()), GL_UNSIGNED_INT, nullptr));
+    state.query->end();
+
+    state.isQueryNeeded  = false;
+    state.isQueryPending = true;
+}
+
+void OcclusionCuller::setCamera(const ogls::mathCore::TransformMatrix& view,
+                                const ogls::mathCore::TransformMatrix& projection)
+{
+    m_impl->projectionMatrix = projection.getResultMatrix();
+    m_impl->viewMatrix       = view.getResultMatrix();
+}
+
+void OcclusionCuller::updateState(OcclusionState& state, const ogls::mathCore::BoundingBox& worldBounds)
+{
+    auto& impl = *m_impl;
+
+    if (state.isQueryPending)
+    {
+        if (const auto samplesPassed = state.query->tryGetResult())
+        {
+            const auto wasVisible = state.isVisible;
+
+            state.isQueryPending = false;
+            state.isVisible      = *samplesPassed != 0;
+            if (state.isVisible && !wasVisible)
+            {
+                state.nextQueryFrame = impl.makeNextQueryFrame();
+            }
+        }
+    }
+
+    // The box, which is clipped by the near plane, can pass no samples even if the object is in front of the camera
+    if (impl.isEnclosingCamera(worldBounds))
+    {
+        if (!state.isVisible)
+        {
+            state.isVisible      = true;
+            state.nextQueryFrame = impl.makeNextQueryFrame();
+        }
+        state.isQueryNeeded = false;
+        return;
+    }
+
+    if (state.isQueryPending)
+    {
+        state.isQueryNeeded = false;
+    }
+    else if (!state.isVisible)
+    {
+        state.isQueryNeeded = true;
+    }
+    else
+    {
+        state.isQueryNeeded = impl.frame >= state.nextQueryFrame;
+        if (state.isQueryNeeded)
+        {
+            state.nextQueryFrame = impl.makeNextQueryFrame();
+        }
+    }
+}
+
+namespace
+{
+    std::array<float, 3> toArray(const ogls::mathCore::Vec3& v) noexcept
+    {
+        return {v.x(), v.y(), v.z()};
+    }
+
+}  // namespace
+
+}  // namespace app::renderer
@@ -0,0 +1,149 @@
+#ifndef APP_RENDERER_OCCLUSION_CULLER_H
+#define APP_RENDERER_OCCLUSION_CULLER_H
+
+#include <cstdint>
+#include <memory>
+
+#include "helpers/macros.h"
+#include "mathCore/boundingBox.h"
+#include "mathCore/transformMatrix.h"
+#include "query.h"
+
+namespace app::renderer
+{
+/**
+ * \brief OcclusionSettings describes, how often visibility of objects is checked by OcclusionCuller.
+ */
+struct OcclusionSettings final
+{
+        /**
+         * \brief The distance, by which boxes are expanded to check whether they enclose the camera. It must be
+         * greater than the distance to the near plane, otherwise boxes clipped by the near plane are culled.
+         */
+        float    cameraMargin         = {0.5f};
+        /**
+         * \brief The minimal number of frames between two queries of the visible object. The actual interval is
+         * spread up to twice this value, so visible objects don't issue their queries in the same frame.
+         */
+        uint32_t visibleQueryInterval = {8};
+
+};  // struct OcclusionSettings
+
+/**
+ * \brief OcclusionState is the visibility of the object, which OcclusionCuller remembers between frames.
+ */
+struct OcclusionState final
+{
+        /**
+         * \brief Specification whether the object must be queried in this frame. It is set by
+         * OcclusionCuller::updateState().
+         */
+        bool                                         isQueryNeeded  = false;
+        /**
+         * \brief Specification whether the query is issued and its result hasn't been read yet.
+         */
+        bool                                         isQueryPending = false;
+        /**
+         * \brief The visibility by the last read result. New objects are visible.
+         */
+        bool                                         isVisible      = true;
+        /**
+         * \brief The frame, after which the visible object is queried again.
+         */
+        uint32_t                                     nextQueryFrame = {0};
+        /**
+         * \brief The query of the object. It is created on the first query.
+         */
+        std::unique_ptr<ogls::oglCore::query::Query> query          = nullptr;
+
+};  // struct OcclusionState
+
+/**
+ * \brief OcclusionCuller checks visibility of objects by hardware occlusion queries of their bounding boxes.
+ *
+ * Boxes are drawn with GL_ANY_SAMPLES_PASSED_CONSERVATIVE queries after visible objects have filled the depth
+ * buffer, and without writing into color and depth buffers. Results are never waited for: they are read in
+ * the following frames as soon as they are available, so the CPU doesn't stall the pipeline.
+ *
+ * Temporal coherence decides, what is queried:
+ * - visible objects are drawn normally and are queried only once in a few frames (see OcclusionSettings), because
+ *   the visible object usually stays visible;
+ * - hidden objects are queried every frame and drawn with the conditional rendering on their queries, so the object,
+ *   which has become visible, appears in the same frame without waiting for the result on the CPU;
+ * - the object isn't queried again till the result of its previous query is read;
+ * - boxes, which enclose the camera, are always visible and aren't queried, because their front faces are clipped.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * culler.beginFrame();
+ * // update states, draw visible objects
+ * culler.beginQueries();
+ * // issue queries, draw hidden objects with the conditional rendering
+ * \endcode
+ */
+class OcclusionCuller final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of OcclusionCuller.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new OcclusionCuller and creates the box mesh and the pipeline state to draw queries.
+         *
+         * \param settings - settings of re-querying.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if OpenGL objects can't be created.
+         */
+        explicit OcclusionCuller(const OcclusionSettings& settings = {});
+        OGLS_NOT_COPYABLE(OcclusionCuller)
+        OcclusionCuller(OcclusionCuller&& obj) noexcept;
+        ~OcclusionCuller() noexcept;
+
+        OcclusionCuller& operator=(OcclusionCuller&& obj) noexcept;
+
+        /**
+         * \brief Starts new frame. States must be updated by updateState() after it.
+         */
+        void beginFrame() noexcept;
+        /**
+         * \brief Applies the pipeline state to draw boxes. It must be called after visible objects are drawn and
+         * before issueQuery() -s of the frame.
+         */
+        void beginQueries();
+        /**
+         * \brief Draws the box of the object inside its query and marks the query as pending.
+         *
+         * \param state       - the state of the object, which OcclusionState::isQueryNeeded is set.
+         * \param worldBounds - the bounding box of the object in the world coordinate system.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if the query can't be created.
+         */
+        void issueQuery(OcclusionState& state, const ogls::mathCore::BoundingBox& worldBounds);
+        /**
+         * \brief Sets the camera, which boxes are drawn by.
+         *
+         * \param view       - the view transformation.
+         * \param projection - the perspective or orthographic projection.
+         */
+        void setCamera(const ogls::mathCore::TransformMatrix& view, const ogls::mathCore::TransformMatrix& projection);
+        /**
+         * \brief Reads the result of the pending query, if it is available, updates the visibility of the object
+         * and decides, whether it must be queried in this frame.
+         *
+         * \param state       - the state of the object.
+         * \param worldBounds - the bounding box of the object in the world coordinate system.
+         */
+        void updateState(OcclusionState& state, const ogls::mathCore::BoundingBox& worldBounds);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class OcclusionCuller
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,293 @@
+#include "pulledMeshPool.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "mathCore/transform.h"
+#include "vertexBufferLayout.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief The offset of the attribute, which the vertex doesn't have.
+     */
+    constexpr auto absentAttribute = std::numeric_limits<GLuint>::max();
+
+    /**
+     * \brief DrawArraysIndirectCommand is the command, which is read by
+     * [glMultiDrawArraysIndirect()](https://docs.gl/gl4/glMultiDrawArraysIndirect).
+     */
+    struct DrawArraysIndirectCommand final
+    {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint first;
+            GLuint baseInstance;
+
+    };  // struct DrawArraysIndirectCommand
+
+    /**
+     * \brief GpuDraw is the record of the draw in the std430 layout of Draw in the vertex shader.
+     */
+    struct GpuDraw final
+    {
+            std::array<float, 16>                                  worldMatrix;
+            std::array<GLuint, PulledMeshPool::maxAttributesCount> attributeOffsets;
+            GLuint                                                 firstFloat;
+            GLuint                                                 vertexStride;
+            std::array<GLuint, 2>                                  padding;
+
+    };  // struct GpuDraw
+
+    static_assert(sizeof(DrawArraysIndirectCommand) == 4 * sizeof(GLuint));
+    static_assert(sizeof(GpuDraw) == 96);
+
+    /**
+     * \brief PulledMesh is the mesh in buffers of the pool.
+     */
+    struct PulledMesh final
+    {
+            /**
+             * \brief Offsets of attributes in floats from the beginning of the vertex, absentAttribute if the
+             * vertex doesn't have the attribute.
+             */
+            std::array<GLuint, PulledMeshPool::maxAttributesCount> attributeOffsets;
+            ogls::mathCore::BoundingBox                            bounds;
+            /**
+             * \brief The index of the first float of the mesh in the vertex buffer.
+             */
+            GLuint                                                 firstFloat   = {0};
+            /**
+             * \brief The position of the first index of the mesh in the index buffer.
+             */
+            GLuint                                                 firstIndex   = {0};
+            std::vector<ogls::assets::MeshLod>                     lods;
+            /**
+             * \brief A number of floats in the vertex.
+             */
+            GLuint                                                 vertexStride = {0};
+
+    };  // struct PulledMesh
+
+    /**
+     * \brief Loads the data into the stream buffer, which is recreated only if the data doesn't fit into it.
+     */
+    void uploadStreamData(std::unique_ptr<ogls::oglCore::vertex::Buffer>& buffer,
+                          ogls::oglCore::vertex::BufferTarget target, const ogls::ArrayData& data);
+
+}  // namespace
+
+class PulledMeshPool::Impl
+{
+    public:
+        Impl() : vertexArray{std::make_shared<ogls::oglCore::vertex::VertexArray>()}
+        {
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Reloads vertices and indices, if meshes have been added since the last reloading.
+         */
+        void updateMeshesBuffers()
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore::vertex;
+
+
+            if (!areMeshesBuffersStale)
+            {
+                return;
+            }
+
+            indicesBuffer  = std::make_unique<Buffer>(BufferTarget::ShaderStorageBuffer,
+                                                      ArrayData{indices.data(), indices.size() * sizeof(GLuint)},
+                                                      BufferDataUsage::StaticDraw);
+            verticesBuffer = std::make_unique<Buffer>(BufferTarget::ShaderStorageBuffer,
+                                                      ArrayData{vertices.data(), vertices.size() * sizeof(GLfloat)},
+                                                      BufferDataUsage::StaticDraw);
+            areMeshesBuffersStale = false;
+        }
+
+    public:
+        bool                                                areMeshesBuffersStale = false;
+        std::vector<DrawArraysIndirectCommand>              commands;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>      commandsBuffer;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>      drawsBuffer;
+        std::vector<GpuDraw>                                gpuDraws;
+        std::vector<GLuint>                                 indices;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>      indicesBuffer;
+        std::vector<PulledMesh>                             meshes;
+        std::shared_ptr<ogls::oglCore::vertex::VertexArray> vertexArray;
+        std::vector<GLfloat>                                vertices;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer>      verticesBuffer;
+
+};  // class PulledMeshPool::Impl
+
+PulledMeshPool::PulledMeshPool() : m_impl{std::make_unique<Impl>()}
+{
+}
+
+PulledMeshPool::PulledMeshPool(PulledMeshPool&& obj) noexcept = default;
+
+PulledMeshPool::~PulledMeshPool() noexcept = default;
+
+PulledMeshPool& PulledMeshPool::operator=(PulledMeshPool&& obj) noexcept = default;
+
+uint32_t PulledMeshPool::addMesh(const ogls::assets::MeshDataView& meshData)
+{
+    using namespace ogls::oglCore::vertex;
+
+
+    if (meshData.attributes.empty() || meshData.indices.empty() || meshData.vertices.empty())
+    {
+        throw std::invalid_argument{"The mesh data must contain vertices, indices and attributes."};
+    }
+
+    auto mesh = PulledMesh{};
+    mesh.attributeOffsets.fill(absentAttribute);
+
+    auto layout = VertexBufferLayout{};
+    for (const auto& attribute : meshData.attributes)
+    {
+        if (attribute.type != VertexAttrType::Float || attribute.index >= maxAttributesCount)
+        {
+            throw std::invalid_argument{"Pulled vertices can have only float attributes with small indices."};
+        }
+
+        layout.addVertexAttribute(attribute);
+        mesh.attributeOffsets[attribute.index] = static_cast<GLuint>(attribute.byteOffset / sizeof(GLfloat));
+    }
+    if (mesh.attributeOffsets[0] == absentAttribute)
+    {
+        throw std::invalid_argument{"Pulled vertices must have the position as the attribute 0."};
+    }
+
+    mesh.vertexStride        = static_cast<GLuint>(layout.getStride() / sizeof(GLfloat));
+    const auto verticesCount = meshData.vertices.size() / mesh.vertexStride;
+    if (std::ranges::any_of(meshData.indices, [verticesCount](GLuint index) { return index >= verticesCount; }))
+    {
+        throw std::invalid_argument{"Indices of the mesh must refer to existing vertices."};
+    }
+
+    auto& impl      = *m_impl;
+    mesh.bounds     = meshData.bounds;
+    mesh.firstFloat = static_cast<GLuint>(impl.vertices.size());
+    mesh.firstIndex = static_cast<GLuint>(impl.indices.size());
+    mesh.lods.assign(meshData.lods.begin(), meshData.lods.end());
+    if (mesh.lods.empty())
+    {
+        mesh.lods.push_back(
+          {.error{0.0f}, .indicesCount{static_cast<uint32_t>(meshData.indices.size())}, .indicesOffset{0}});
+    }
+
+    impl.vertices.insert(impl.vertices.end(), meshData.vertices.begin(), meshData.vertices.end());
+    impl.indices.insert(impl.indices.end(), meshData.indices.begin(), meshData.indices.end());
+    impl.meshes.push_back(std::move(mesh));
+    impl.areMeshesBuffersStale = true;
+
+    return static_cast<uint32_t>(impl.meshes.size() - 1);
+}
+
+void PulledMeshPool::draw(std::span<const PulledDraw> draws)
+{
+    using namespace ogls;
+    using namespace ogls::oglCore::vertex;
+
+
+    auto& impl = *m_impl;
+
+    impl.commands.clear();
+    impl.gpuDraws.clear();
+    for (const auto& draw : draws)
+    {
+        if (draw.mesh >= impl.meshes.size())
+        {
+            continue;
+        }
+
+        const auto& mesh = impl.meshes[draw.mesh];
+        const auto& lod  = mesh.lods[std::min<size_t>(draw.lod, mesh.lods.size() - 1)];
+
+        const auto gpuDraw = GpuDraw{.worldMatrix{ogls::mathCore::toGpuMatrix(draw.worldMatrix)},
+                                     .attributeOffsets{mesh.attributeOffsets},
+                                     .firstFloat{mesh.firstFloat},
+                                     .vertexStride{mesh.vertexStride},
+                                     .padding{}};
+
+        // Non-indexed draws start gl_VertexID from 'first', so it is the position in the index buffer of the pool
+        impl.commands.push_back({.count{lod.indicesCount},
+                                 .instanceCount{1},
+                                 .first{mesh.firstIndex + lod.indicesOffset},
+                                 .baseInstance{static_cast<GLuint>(impl.gpuDraws.size())}});
+        impl.gpuDraws.push_back(gpuDraw);
+    }
+
+    if (impl.commands.empty())
+    {
+        return;
+    }
+
+    impl.updateMeshesBuffers();
+    uploadStreamData(impl.drawsBuffer, BufferTarget::ShaderStorageBuffer,
+                     ArrayData{impl.gpuDraws.data(), impl.gpuDraws.size() * sizeof(GpuDraw)});
+    uploadStreamData(impl.commandsBuffer, BufferTarget::DrawIndirectBuffer,
+                     ArrayData{impl.commands.data(), impl.commands.size() * sizeof(DrawArraysIndirectCommand)});
+
+    impl.indicesBuffer->bindBase(BufferTarget::ShaderStorageBuffer, indicesBinding);
+    impl.verticesBuffer->bindBase(BufferTarget::ShaderStorageBuffer, verticesBinding);
+    impl.drawsBuffer->bindBase(BufferTarget::ShaderStorageBuffer, drawsBinding);
+    impl.commandsBuffer->bind();
+
+    OGLS_GLCall(glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(impl.commands.size()), 0));
+}
+
+const ogls::mathCore::BoundingBox& PulledMeshPool::getBounds(uint32_t mesh) const
+{
+    return m_impl->meshes.at(mesh).bounds;
+}
+
+size_t PulledMeshPool::getMeshesCount() const noexcept
+{
+    return m_impl->meshes.size();
+}
+
+std::shared_ptr<ogls::oglCore::vertex::VertexArray> PulledMeshPool::getVertexArray() const noexcept
+{
+    return m_impl->vertexArray;
+}
+
+namespace
+{
+    void uploadStreamData(std::unique_ptr<ogls::oglCore::vertex::Buffer>& buffer,
+                          ogls::oglCore::vertex::BufferTarget target, const ogls::ArrayData& data)
+    {
+        using namespace ogls::oglCore::vertex;
+
+
+        if (!buffer || buffer->getData().size < data.size)
+        {
+            // The capacity is doubled, so the buffer is recreated only a few times while the scene grows
+            const auto capacity = std::max(data.size, buffer ? buffer->getData().size * 2 : size_t{0});
+            buffer = std::make_unique<Buffer>(target, ogls::ArrayData{nullptr, capacity}, BufferDataUsage::StreamDraw);
+        }
+        else
+        {
+            buffer->invalidateData();
+        }
+
+        buffer->setSubData(0, data);
+    }
+
+}  // namespace
+
+}  // namespace app::renderer
@@ -0,0 +1,139 @@
+#ifndef APP_RENDERER_PULLED_MESH_POOL_H
+#define APP_RENDERER_PULLED_MESH_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <glad/glad.h>
+
+#include "assets/meshData.h"
+#include "helpers/macros.h"
+#include "mathCore/boundingBox.h"
+#include "mathCore/transformMatrix.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+/**
+ * \brief PulledDraw is one mesh, which is drawn by PulledMeshPool::draw().
+ */
+struct PulledDraw final
+{
+        /**
+         * \brief The level of detail of the mesh. It is clamped to the coarsest level of the mesh.
+         */
+        uint32_t             lod         = {0};
+        /**
+         * \brief The index of the mesh, which was returned by PulledMeshPool::addMesh().
+         */
+        uint32_t             mesh        = {0};
+        /**
+         * \brief The world matrix of the mesh in the format of the selected graphical API.
+         */
+        ogls::mathCore::Mat4 worldMatrix = ogls::mathCore::TransformMatrix{}.getResultMatrix();
+
+};  // struct PulledDraw
+
+/**
+ * \brief PulledMeshPool keeps vertices and indices of all its meshes in shader storage buffers, from which vertex
+ * shaders fetch them themselves (programmable vertex pulling).
+ *
+ * Meshes have no vertex array objects: the only empty one is shared by all of them (see getVertexArray()), so
+ * switching meshes changes no state and any number of meshes are drawn by one
+ * [glMultiDrawArraysIndirect()](https://docs.gl/gl4/glMultiDrawArraysIndirect). Every draw gets the record with
+ * its world matrix and the format of its vertices by gl_BaseInstance, and gl_VertexID is the position in the index
+ * buffer of the pool (see resources/shaders/vs/pulledMesh.vert):
+ * \code{.glsl}
+ * const Draw draw = draws[gl_BaseInstance];
+ * const uint vertex = indices[gl_VertexID];
+ * const uint first = draw.firstFloat + vertex * draw.vertexStride;
+ * \endcode
+ *
+ * Attributes of vertices must be floats, the attribute with index 0 is the position. It is an alternative to
+ * ResourceManager::loadMesh(), meshes of the pool are drawn by pipeline states created with getVertexArray().
+ */
+class PulledMeshPool final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of PulledMeshPool.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The binding point of the shader storage buffer with records of draws.
+         */
+        static constexpr GLuint drawsBinding       = {3};
+        /**
+         * \brief The binding point of the shader storage buffer with indices of all meshes.
+         */
+        static constexpr GLuint indicesBinding     = {1};
+        /**
+         * \brief The maximal number of attributes of the vertex, which shaders can fetch.
+         */
+        static constexpr size_t maxAttributesCount = {4};
+        /**
+         * \brief The binding point of the shader storage buffer with vertices of all meshes.
+         */
+        static constexpr GLuint verticesBinding    = {2};
+
+        /**
+         * \brief Constructs new PulledMeshPool without meshes and creates its empty vertex array object.
+         *
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if OpenGL objects can't be created.
+         */
+        PulledMeshPool();
+        OGLS_NOT_COPYABLE(PulledMeshPool)
+        PulledMeshPool(PulledMeshPool&& obj) noexcept;
+        ~PulledMeshPool() noexcept;
+
+        PulledMeshPool& operator=(PulledMeshPool&& obj) noexcept;
+
+        /**
+         * \brief Appends the mesh to the pool. Buffers are reloaded by the next draw().
+         *
+         * \param meshData - the mesh. Its data is copied.
+         * \return the index of the mesh.
+         * \throw std::invalid_argument, if the mesh has no vertices, indices or the position, if its attributes
+         * aren't floats or their indices aren't less than maxAttributesCount, if indices refer to nonexistent
+         * vertices.
+         */
+        uint32_t                                            addMesh(const ogls::assets::MeshDataView& meshData);
+        /**
+         * \brief Draws meshes by one multi-draw call.
+         *
+         * The pipeline state created with getVertexArray() and the shader program, which pulls vertices, must be
+         * applied.
+         *
+         * \param draws - meshes to draw. Draws with nonexistent meshes are skipped.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if buffers can't be created.
+         */
+        void                                                draw(std::span<const PulledDraw> draws);
+        /**
+         * \brief Returns the bounding box of the mesh in the local coordinate system.
+         *
+         * \throw std::out_of_range, if there is no mesh with the index.
+         */
+        const ogls::mathCore::BoundingBox&                  getBounds(uint32_t mesh) const;
+        /**
+         * \brief Returns a number of meshes in the pool.
+         */
+        size_t                                              getMeshesCount() const noexcept;
+        /**
+         * \brief Returns the empty vertex array object, which is bound for all meshes of the pool.
+         */
+        std::shared_ptr<ogls::oglCore::vertex::VertexArray> getVertexArray() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class PulledMeshPool
+
+}  // namespace app::renderer
+
+#endif
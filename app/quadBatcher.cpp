@@ -0,0 +1,254 @@
+#include "quadBatcher.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "helpers/debugHelpers.h"
+#include "openglLimits.h"
+#include "pipelineState.h"
+#include "shaderProgram.h"
+#include "textureUnit.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief QuadVertex is a vertex of the quad in the format, which is expected by the quad batch shaders.
+     *
+     * It is the vertex format of MulticoloredRectangle extended by the index of the texture slot.
+     */
+    struct QuadVertex final
+    {
+            GLfloat x = {0.0f}, y = {0.0f};
+            GLfloat r = {0.0f}, g = {0.0f}, b = {0.0f};
+            GLfloat u = {0.0f}, v = {0.0f};
+            GLfloat textureSlot = {0.0f};
+
+    };  // struct QuadVertex
+
+    std::vector<GLuint>                                 generateQuadIndices(size_t quadsNumber);
+    std::shared_ptr<ogls::oglCore::texture::Texture<2>> makeWhiteTexture();
+
+}  // namespace
+
+class QuadBatcher::Impl
+{
+    public:
+        explicit Impl(size_t maxQuads) : maxQuadsPerBatch{maxQuads}
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore;
+            using namespace ogls::oglCore::vertex;
+
+
+            if (maxQuadsPerBatch == 0)
+            {
+                throw std::invalid_argument{"The maximum number of quads in the batch must be greater than 0."};
+            }
+
+            texturesSlotsNumber = std::min(maxTextureSlots, getOpenglLimit(LimitName::MaxTextureImageUnits));
+
+            vertices.reserve(maxQuadsPerBatch * 4);
+            indices = generateQuadIndices(maxQuadsPerBatch);
+
+            auto layout = VertexBufferLayout{};
+            layout.addVertexAttribute({.byteOffset{static_cast<int>(offsetof(QuadVertex, x))}, .count{2}, .index{0}});
+            layout.addVertexAttribute({.byteOffset{static_cast<int>(offsetof(QuadVertex, r))}, .count{3}, .index{1}});
+            layout.addVertexAttribute({.byteOffset{static_cast<int>(offsetof(QuadVertex, u))}, .count{2}, .index{2}});
+            layout.addVertexAttribute(
+              {.byteOffset{static_cast<int>(offsetof(QuadVertex, textureSlot))}, .count{1}, .index{3}});
+
+            auto vao = std::make_shared<VertexArray>();
+
+            verticesBuffer = std::make_shared<Buffer>(BufferTarget::ArrayBuffer,
+                                                      ArrayData{nullptr, maxQuadsPerBatch * 4 * sizeof(QuadVertex)},
+                                                      BufferDataUsage::StreamDraw, layout);
+            vao->addBuffer(verticesBuffer);
+
+            indicesBuffer = std::make_shared<Buffer>(BufferTarget::ElementArrayBuffer,
+                                                     ArrayData{indices.data(), indices.size() * sizeof(GLuint)},
+                                                     BufferDataUsage::StaticDraw);
+            vao->addBuffer(indicesBuffer);
+
+            auto shaderProgram = std::shared_ptr<shader::ShaderProgram>{shader::makeShaderProgram(
+              "resources/shaders/vs/quadBatch.vert", "resources/shaders/fs/quadBatch.frag")};
+
+            auto blend      = pipeline::BlendState{};
+            blend.isEnabled = true;
+            blend.srcRgb    = pipeline::BlendFactor::SrcAlpha;
+            blend.dstRgb    = pipeline::BlendFactor::OneMinusSrcAlpha;
+            blend.srcAlpha  = pipeline::BlendFactor::One;
+            blend.dstAlpha  = pipeline::BlendFactor::OneMinusSrcAlpha;
+
+            pipelineState = pipeline::pipelineStateManager::create({.blend{blend},
+                                                                    .depth{},
+                                                                    .raster{},
+                                                                    .shaderProgram{std::move(shaderProgram)},
+                                                                    .vertexArray{std::move(vao)}});
+
+            whiteTexture = makeWhiteTexture();
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Returns the slot of the texture in the current batch.
+         *
+         * If the texture is not used by the current batch yet, it occupies a free slot. If there is no free slot,
+         * the batch is flushed before.
+         */
+        GLfloat acquireTextureSlot(const std::shared_ptr<ogls::oglCore::texture::Texture<2>>& texture)
+        {
+            const auto it = std::find(textureSlots.begin(), textureSlots.end(), texture);
+            if (it != textureSlots.end())
+            {
+                return static_cast<GLfloat>(std::distance(textureSlots.begin(), it));
+            }
+
+            if (std::ssize(textureSlots) == texturesSlotsNumber)
+            {
+                flush();
+            }
+
+            textureSlots.push_back(texture);
+            return static_cast<GLfloat>(textureSlots.size() - 1);
+        }
+
+        /**
+         * \brief Draws all quads of the current batch by one draw call and starts new batch.
+         */
+        void flush()
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore;
+
+
+            if (vertices.empty())
+            {
+                return;
+            }
+
+            verticesBuffer->invalidateData();
+            verticesBuffer->setSubData(0, ArrayData{vertices.data(), vertices.size() * sizeof(QuadVertex)});
+
+            pipeline::pipelineStateManager::apply(*pipelineState);
+
+            auto texturesConfiguration = texture::TexturesConfiguration{};
+            for (auto i = size_t{0}; i < textureSlots.size(); ++i)
+            {
+                texturesConfiguration.insert({static_cast<GLuint>(i), {textureSlots[i]}});
+            }
+            texture::applyTexturesConfiguration(texturesConfiguration);
+
+            const auto indicesCount = static_cast<GLsizei>(vertices.size() / 4 * 6);
+            OGLS_GLCall(glDrawElements(GL_TRIANGLES, indicesCount, GL_UNSIGNED_INT, nullptr));
+
+            vertices.clear();
+            textureSlots.clear();
+            ++drawCallsCount;
+        }
+
+    public:
+        size_t                                                           drawCallsCount      = {0};
+        std::vector<GLuint>                                              indices;
+        std::shared_ptr<ogls::oglCore::vertex::Buffer>                   indicesBuffer       = nullptr;
+        const size_t                                                     maxQuadsPerBatch    = {0};
+        std::shared_ptr<const ogls::oglCore::pipeline::PipelineState>    pipelineState       = nullptr;
+        size_t                                                           quadsCount          = {0};
+        std::vector<std::shared_ptr<ogls::oglCore::texture::Texture<2>>> textureSlots;
+        GLint                                                            texturesSlotsNumber = {0};
+        std::vector<QuadVertex>                                          vertices;
+        std::shared_ptr<ogls::oglCore::vertex::Buffer>                   verticesBuffer      = nullptr;
+        std::shared_ptr<ogls::oglCore::texture::Texture<2>>              whiteTexture        = nullptr;
+
+};  // class QuadBatcher::Impl
+
+QuadBatcher::QuadBatcher(size_t maxQuadsPerBatch) : m_impl{std::make_unique<Impl>(maxQuadsPerBatch)}
+{
+}
+
+QuadBatcher::~QuadBatcher() noexcept = default;
+
+void QuadBatcher::begin() noexcept
+{
+    m_impl->vertices.clear();
+    m_impl->textureSlots.clear();
+    m_impl->drawCallsCount = {0};
+    m_impl->quadsCount     = {0};
+}
+
+void QuadBatcher::draw(const Quad& quad)
+{
+    if (m_impl->vertices.size() == m_impl->maxQuadsPerBatch * 4)
+    {
+        m_impl->flush();
+    }
+
+    const auto slot = m_impl->acquireTextureSlot(quad.texture ? quad.texture : m_impl->whiteTexture);
+
+    const auto [x0, y0] = quad.position;
+    const auto x1 = x0 + quad.size[0], y1 = y0 + quad.size[1];
+    const auto [r, g, b]        = quad.color;
+    const auto [u0, v0, u1, v1] = quad.uvRect;
+
+    m_impl->vertices.push_back({x0, y0, r, g, b, u0, v0, slot});
+    m_impl->vertices.push_back({x0, y1, r, g, b, u0, v1, slot});
+    m_impl->vertices.push_back({x1, y1, r, g, b, u1, v1, slot});
+    m_impl->vertices.push_back({x1, y0, r, g, b, u1, v0, slot});
+
+    ++m_impl->quadsCount;
+}
+
+void QuadBatcher::end()
+{
+    m_impl->flush();
+}
+
+size_t QuadBatcher::getDrawCallsCount() const noexcept
+{
+    return m_impl->drawCallsCount;
+}
+
+size_t QuadBatcher::getQuadsCount() const noexcept
+{
+    return m_impl->quadsCount;
+}
+
+namespace
+{
+    std::vector<GLuint> generateQuadIndices(size_t quadsNumber)
+    {
+        auto indices = std::vector<GLuint>{};
+        indices.reserve(quadsNumber * 6);
+
+        for (auto i = GLuint{0}; i < quadsNumber; ++i)
+        {
+            const auto first = i * 4;
+            indices.insert(indices.end(), {first, first + 1, first + 2, first + 2, first + 3, first});
+        }
+
+        return indices;
+    }
+
+    std::shared_ptr<ogls::oglCore::texture::Texture<2>> makeWhiteTexture()
+    {
+        using namespace ogls::oglCore::texture;
+
+
+        auto pixel = TextureData::DataType{new unsigned char[3]{255, 255, 255}, [](unsigned char* p) { delete[] p; }};
+        auto data  = std::make_shared<TextureData>(std::move(pixel), 1, 1, 3, TexturePixelFormat::Rgb);
+        return std::make_shared<Texture<2>>(TextureTarget::Texture2d, std::move(data));
+    }
+
+}  // namespace
+
+}  // namespace app::renderer
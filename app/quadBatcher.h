@@ -0,0 +1,125 @@
+#ifndef APP_RENDERER_QUAD_BATCHER_H
+#define APP_RENDERER_QUAD_BATCHER_H
+
+#include <array>
+#include <memory>
+
+#include "helpers/macros.h"
+#include "texture.h"
+
+namespace app::renderer
+{
+/**
+ * \brief Quad is a textured and colored rectangle, which can be drawn by QuadBatcher.
+ */
+struct Quad final
+{
+        /**
+         * \brief The color, which is multiplied with the texture color (RGB in the range [0, 1]).
+         */
+        std::array<float, 3>                                 color    = {1.0f, 1.0f, 1.0f};
+        /**
+         * \brief The position of the bottom-left corner of the quad in normalized device coordinates.
+         */
+        std::array<float, 2>                                 position = {0.0f, 0.0f};
+        /**
+         * \brief The width and the height of the quad in normalized device coordinates.
+         */
+        std::array<float, 2>                                 size     = {0.0f, 0.0f};
+        /**
+         * \brief The texture of the quad. If it is nullptr, the quad is filled with the color only.
+         */
+        std::shared_ptr<ogls::oglCore::texture::Texture<2>> texture  = nullptr;
+        /**
+         * \brief The rectangle of the texture (or of the region of the texture atlas), which is mapped on the quad.
+         *
+         * The order is {u0, v0, u1, v1}, where (u0, v0) is mapped on the bottom-left corner of the quad.
+         */
+        std::array<float, 4>                                 uvRect   = {0.0f, 0.0f, 1.0f, 1.0f};
+
+};  // struct Quad
+
+/**
+ * \brief QuadBatcher collects quads during the frame and draws them with as few draw calls as possible.
+ *
+ * All quads are written into one streaming vertex buffer, which shares one static index buffer.
+ * Textures of the quads are bound to consecutive texture units and the shader selects the sampler by the slot
+ * stored in the vertex (comparing it with the uniform loop counter, because indices of sampler arrays must be
+ * dynamically uniform), so quads with different textures are drawn by one draw call. The batch is flushed only
+ * if all texture slots are occupied or the vertex buffer is full.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * batcher.begin();
+ * for (const auto& sprite : sprites)
+ * {
+ *     batcher.draw(sprite);
+ * }
+ * batcher.end();
+ * \endcode
+ */
+class QuadBatcher
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of QuadBatcher.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The maximum number of textures, which can be used by one draw call.
+         *
+         * It must match the size of the sampler array in the quad batch fragment shader.
+         */
+        static constexpr int maxTextureSlots = {16};
+
+        /**
+         * \brief Constructs new QuadBatcher and allocates vertex and index buffers for maxQuadsPerBatch quads.
+         *
+         * \param maxQuadsPerBatch - the maximum number of quads, which can be drawn by one draw call.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), std::invalid_argument,
+         * see ogls::oglCore::shader::makeShaderProgram().
+         */
+        explicit QuadBatcher(size_t maxQuadsPerBatch = {10'000});
+        OGLS_NOT_COPYABLE_MOVABLE(QuadBatcher)
+        ~QuadBatcher() noexcept;
+
+        /**
+         * \brief Starts new frame of the quads drawing.
+         *
+         * Quads, which were not drawn by end(), are discarded. Draw calls counter is reset.
+         */
+        void   begin() noexcept;
+        /**
+         * \brief Adds the quad into the current batch.
+         *
+         * If there is no free texture slot for the texture of the quad or the batch is full, the batch is flushed.
+         *
+         * \param quad - the quad to be drawn.
+         */
+        void   draw(const Quad& quad);
+        /**
+         * \brief Flushes all quads, which were added after begin().
+         */
+        void   end();
+        /**
+         * \brief Returns a number of draw calls, which were issued after begin().
+         */
+        size_t getDrawCallsCount() const noexcept;
+        /**
+         * \brief Returns a number of quads, which were added after begin().
+         */
+        size_t getQuadsCount() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class QuadBatcher
+
+}  // namespace app::renderer
+
+#endif
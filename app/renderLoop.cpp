@@ -0,0 +1,146 @@
+#include "renderLoop.h"
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+#include "objectNamesManager.h"
+
+namespace app
+{
+namespace
+{
+    /**
+     * \brief Converts the maximal frame rate into the minimal duration of the frame.
+     *
+     * \return the duration or zero, if the frame rate isn't limited.
+     * \throw std::invalid_argument, if the frame rate is negative or isn't a finite number.
+     */
+    Simulation::Clock::duration toMinFrameDuration(float maxFrameRate);
+
+}  // namespace
+
+class RenderLoop::Impl
+{
+    public:
+        Impl(ogls::Window& w, renderer::Renderer& r, Simulation& sim, const RenderLoopSettings& s) :
+            framePacer{w, s.pacing}, minFrameDuration{toMinFrameDuration(s.maxFrameRate)}, mode{s.mode}, renderer{r},
+            simulation{sim}, window{w}
+        {
+            // Decoded textures are uploaded by render(), so the sleeping loop must be woken up
+            renderer.setRedrawCallback([&w]() { w.invalidate(); });
+            // The memory of the frame is reused, when the pacer has waited for the GPU to complete it
+            renderer.setFramesInFlight(framePacer.getQueuedFramesCount());
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        ogls::helpers::AllocationStatistics allocationStatistics;
+        FramePacer                          framePacer;
+        uint64_t                            framesCount = {0};
+        ogls::helpers::AllocationStatistics lastFrameAllocations;
+        const Simulation::Clock::duration   minFrameDuration;
+        const RenderMode                    mode;
+        renderer::Renderer&                 renderer;
+        Simulation&                         simulation;
+        ogls::Window&                       window;
+
+};  // class RenderLoop::Impl
+
+RenderLoop::RenderLoop(ogls::Window& window, renderer::Renderer& renderer, Simulation& simulation,
+                       const RenderLoopSettings& settings) :
+    m_impl{std::make_unique<Impl>(window, renderer, simulation, settings)}
+{
+}
+
+RenderLoop::RenderLoop(RenderLoop&& obj) noexcept = default;
+
+RenderLoop::~RenderLoop() noexcept = default;
+
+RenderLoop& RenderLoop::operator=(RenderLoop&& obj) noexcept = default;
+
+const ogls::helpers::AllocationStatistics& RenderLoop::getAllocationStatistics() const noexcept
+{
+    return m_impl->allocationStatistics;
+}
+
+uint64_t RenderLoop::getFramesCount() const noexcept
+{
+    return m_impl->framesCount;
+}
+
+const FramePacer& RenderLoop::getFramePacer() const noexcept
+{
+    return m_impl->framePacer;
+}
+
+const ogls::helpers::AllocationStatistics& RenderLoop::getLastFrameAllocations() const noexcept
+{
+    return m_impl->lastFrameAllocations;
+}
+
+void RenderLoop::run()
+{
+    auto& impl = *m_impl;
+
+    using Clock = Simulation::Clock;
+
+
+    auto nextFrameTime = Clock::time_point{};
+    while (!impl.window.shouldClose())
+    {
+        const auto now      = Clock::now();
+        const auto state    = impl.simulation.getInterpolatedState(now);
+        const auto isCapped = now < nextFrameTime;
+
+        // The invalidation isn't taken while the frame is capped, so it is drawn by the first frame after the cap
+        if (!isCapped
+            && (impl.mode == RenderMode::Continuous || impl.window.takeInvalidation()
+                || impl.renderer.needsRedraw(state)))
+        {
+            OGLS_ALLOCATION_SCOPE(App);
+            // Allocations between frames aren't counted
+            ogls::helpers::takeAllocationStatistics();
+
+            // Inputs and the state are sampled again after the pacer has waited for the GPU queue
+            impl.framePacer.beginFrame();
+            impl.window.pollEvents();
+            impl.renderer.render(impl.simulation.getInterpolatedState(Clock::now()));
+            impl.framePacer.present();
+            // Objects, which have been released during the frame, are deleted, when the GPU completes it
+            ogls::oglCore::objectNamesManager::endFrame();
+            ++impl.framesCount;
+
+            impl.lastFrameAllocations = ogls::helpers::takeAllocationStatistics();
+            impl.allocationStatistics += impl.lastFrameAllocations;
+            nextFrameTime = now + impl.minFrameDuration;
+        }
+        else
+        {
+            // The simulation state can change only once per tick, so there is no sense to check it more often
+            const auto timeout = isCapped ? nextFrameTime - now : impl.simulation.getTickDuration();
+            impl.window.waitEvents(timeout);
+        }
+    }
+}
+
+namespace
+{
+    Simulation::Clock::duration toMinFrameDuration(float maxFrameRate)
+    {
+        using namespace std::chrono;
+
+
+        if (maxFrameRate < 0.0f || !std::isfinite(maxFrameRate))
+        {
+            throw std::invalid_argument{"The maximal frame rate must be a non-negative finite number."};
+        }
+        return maxFrameRate > 0.0f ? duration_cast<Simulation::Clock::duration>(duration<double>{1.0 / maxFrameRate})
+                                   : Simulation::Clock::duration::zero();
+    }
+
+}  // namespace
+
+}  // namespace app
@@ -0,0 +1,127 @@
+#ifndef APP_RENDER_LOOP_H
+#define APP_RENDER_LOOP_H
+
+#include <cstdint>
+#include <memory>
+
+#include "framePacer.h"
+#include "helpers/allocationTracker.h"
+#include "helpers/macros.h"
+#include "renderer.h"
+#include "simulation.h"
+#include "window.h"
+
+namespace app
+{
+/**
+ * \brief RenderMode defines when RenderLoop draws frames.
+ */
+enum class RenderMode : uint8_t
+{
+    /**
+     * \brief Frames are drawn one after another.
+     */
+    Continuous,
+    /**
+     * \brief The loop sleeps in the wait for events and draws the frame only if the window is invalidated or
+     * the renderer needs the redraw.
+     */
+    OnDemand
+};
+
+/**
+ * \brief RenderLoopSettings are parameters of RenderLoop.
+ */
+struct RenderLoopSettings final
+{
+        /**
+         * \brief The maximal number of frames per second. If it is 0, the frame rate isn't limited by the loop.
+         */
+        float              maxFrameRate = {0.0f};
+        RenderMode         mode         = RenderMode::OnDemand;
+        /**
+         * \brief The limit of frames queued to the GPU, the swap interval and the latency mode.
+         */
+        FramePacerSettings pacing;
+
+};  // struct RenderLoopSettings
+
+/**
+ * \brief RenderLoop runs the loop of the window: processes events and draws frames of the renderer.
+ *
+ * In the render-on-demand mode the thread sleeps in the wait for events between frames, so the static scene costs
+ * no CPU and GPU time. The frame is drawn, when the window is invalidated (it is resized, uncovered or
+ * ogls::Window::invalidate() is called, e.g. by the renderer after the texture is decoded) or
+ * Renderer::needsRedraw() returns true. The simulation state is checked once per tick of the simulation.
+ *
+ * Every drawn frame is paced by FramePacer: events are polled and the simulation state is sampled again right after
+ * FramePacer::beginFrame(), so the frame shows inputs, which are as fresh as the pacing mode allows.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * auto loop = RenderLoop{window, renderer, simulation, {.maxFrameRate{30.0f}, .mode{RenderMode::OnDemand}}};
+ * loop.run();
+ * \endcode
+ */
+class RenderLoop final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of RenderLoop.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new RenderLoop. Objects must outlive the loop.
+         *
+         * \param window     - the window, which events are processed and to which frames are drawn.
+         * \param renderer   - the renderer, which draws frames.
+         * \param simulation - the simulation, which states are drawn.
+         * \param settings   - the mode of the loop and the limit of the frame rate.
+         * \throw std::invalid_argument, if the maximal frame rate is negative or pacing settings are invalid.
+         * \throw ogls::exceptions::GLRecAcquisitionException(), if the frame pacer can't create timer queries.
+         */
+        RenderLoop(ogls::Window& window, renderer::Renderer& renderer, Simulation& simulation,
+                   const RenderLoopSettings& settings = {});
+        OGLS_NOT_COPYABLE(RenderLoop)
+        RenderLoop(RenderLoop&& obj) noexcept;
+        ~RenderLoop() noexcept;
+
+        RenderLoop& operator=(RenderLoop&& obj) noexcept;
+
+        /**
+         * \brief Returns sums of heap allocations, which all threads have made during drawn frames. The average per
+         * frame is the sum divided by getFramesCount().
+         *
+         * Allocations are counted only if ogls::helpers::isAllocationTrackingEnabled().
+         */
+        const ogls::helpers::AllocationStatistics& getAllocationStatistics() const noexcept;
+        /**
+         * \brief Returns a number of drawn frames.
+         */
+        uint64_t                                   getFramesCount() const noexcept;
+        /**
+         * \brief Returns the pacer, which measures timings of drawn frames.
+         */
+        const FramePacer&                          getFramePacer() const noexcept;
+        /**
+         * \brief Returns heap allocations, which all threads have made during the last drawn frame.
+         */
+        const ogls::helpers::AllocationStatistics& getLastFrameAllocations() const noexcept;
+        /**
+         * \brief Runs the loop till the window should be closed.
+         */
+        void                                       run();
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class RenderLoop
+
+}  // namespace app
+
+#endif
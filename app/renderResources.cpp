@@ -0,0 +1,146 @@
+#include "renderResources.h"
+
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "helpers/helpers.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief PipelineStateKey identifies the cached pipeline state by the pair of the mesh and the material.
+     */
+    using PipelineStateKey = std::pair<MeshHandle, MaterialHandle>;
+
+    struct PipelineStateKeyHash final
+    {
+            size_t operator()(const PipelineStateKey& key) const noexcept
+            {
+                auto seed = std::hash<uint64_t>{}(key.first.pack());
+                ogls::helpers::hashCombine(seed, std::hash<uint64_t>{}(key.second.pack()));
+                return seed;
+            }
+
+    };  // struct PipelineStateKeyHash
+
+}  // namespace
+
+class RenderResources::Impl
+{
+    public:
+        explicit Impl(ResourceManager& manager) : resourceManager{manager}
+        {
+        }
+
+        ~Impl() noexcept
+        {
+            for (const auto& material : materials)
+            {
+                resourceManager.release(material.shaderProgram);
+            }
+        }
+
+    public:
+        /**
+         * \brief Cached pipeline states of pairs of the mesh and the material.
+         */
+        std::unordered_map<PipelineStateKey, std::shared_ptr<const ogls::oglCore::pipeline::PipelineState>,
+                           PipelineStateKeyHash>
+                                                     pipelineStates;
+        /**
+         * \brief Registered materials.
+         */
+        ogls::helpers::SlotMap<MaterialTag, Material> materials;
+        /**
+         * \brief The manager, which owns meshes and shader programs.
+         */
+        ResourceManager&                              resourceManager;
+
+};  // class RenderResources::Impl
+
+RenderResources::RenderResources(ResourceManager& resourceManager) :
+    m_impl{std::make_unique<Impl>(resourceManager)}
+{
+}
+
+RenderResources::RenderResources(RenderResources&& obj) noexcept = default;
+
+RenderResources::~RenderResources() noexcept = default;
+
+RenderResources& RenderResources::operator=(RenderResources&& obj) noexcept = default;
+
+MaterialHandle RenderResources::addMaterial(Material material)
+{
+    m_impl->resourceManager.addReference(material.shaderProgram);
+    return m_impl->materials.insert(std::move(material));
+}
+
+Material* RenderResources::getMaterial(MaterialHandle material) noexcept
+{
+    return m_impl->materials.get(material);
+}
+
+const Material* RenderResources::getMaterial(MaterialHandle material) const noexcept
+{
+    return m_impl->materials.get(material);
+}
+
+const Mesh* RenderResources::getMesh(MeshHandle mesh) const noexcept
+{
+    return m_impl->resourceManager.getMesh(mesh);
+}
+
+ResourceManager& RenderResources::getResourceManager() const noexcept
+{
+    return m_impl->resourceManager;
+}
+
+const ogls::oglCore::pipeline::PipelineState& RenderResources::getPipelineState(MeshHandle     mesh,
+                                                                                MaterialHandle material)
+{
+    using namespace ogls::oglCore::pipeline;
+
+
+    const auto key = PipelineStateKey{mesh, material};
+    if (const auto it = m_impl->pipelineStates.find(key); it != m_impl->pipelineStates.end())
+    {
+        return *it->second;
+    }
+
+    const auto meshPtr     = getMesh(mesh);
+    const auto materialPtr = getMaterial(material);
+    if (!meshPtr || !materialPtr)
+    {
+        throw std::invalid_argument{"The mesh or the material doesn't exist."};
+    }
+
+    const auto& shaderProgram = m_impl->resourceManager.getShaderProgram(materialPtr->shaderProgram);
+
+    auto state = pipelineStateManager::create(PipelineStateDescription{.blend{materialPtr->blend},
+                                                                       .depth{materialPtr->depth},
+                                                                       .raster{materialPtr->raster},
+                                                                       .shaderProgram{shaderProgram},
+                                                                       .vertexArray{meshPtr->vertexArray}});
+    return *m_impl->pipelineStates.emplace(key, std::move(state)).first->second;
+}
+
+size_t RenderResources::releaseStalePipelineStates()
+{
+    return std::erase_if(m_impl->pipelineStates,
+                         [this](const auto& item) { return !m_impl->resourceManager.getMesh(item.first.first); });
+}
+
+void RenderResources::removeMaterial(MaterialHandle material)
+{
+    if (const auto materialPtr = getMaterial(material))
+    {
+        m_impl->resourceManager.release(materialPtr->shaderProgram);
+        m_impl->materials.erase(material);
+        std::erase_if(m_impl->pipelineStates, [material](const auto& item) { return item.first.second == material; });
+    }
+}
+
+}  // namespace app::renderer
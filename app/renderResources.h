@@ -0,0 +1,140 @@
+#ifndef APP_RENDERER_RENDER_RESOURCES_H
+#define APP_RENDERER_RENDER_RESOURCES_H
+
+#include <memory>
+
+#include "helpers/handle.h"
+#include "helpers/macros.h"
+#include "pipelineState.h"
+#include "resourceManager.h"
+#include "textureUnit.h"
+#include "uniforms.h"
+
+namespace app::renderer
+{
+/**
+ * \brief MaterialTag is a tag of MaterialHandle.
+ */
+struct MaterialTag;
+
+/**
+ * \brief MaterialHandle refers to the Material registered in RenderResources.
+ */
+using MaterialHandle = ogls::helpers::Handle<MaterialTag>;
+
+/**
+ * \brief Material describes how the mesh is shaded: the shader program, the textures and the fixed-function state.
+ *
+ * One Material is shared by all entities, which use it.
+ */
+struct Material final
+{
+        /**
+         * \brief The blending state.
+         */
+        ogls::oglCore::pipeline::BlendState           blend;
+        /**
+         * \brief The depth test state.
+         */
+        ogls::oglCore::pipeline::DepthState           depth;
+        /**
+         * \brief The uniform of the shader program, which receives the world matrix of the entity,
+         * or nullptr if the shader program doesn't use it.
+         */
+        ogls::oglCore::shader::MatrixUniform<4, 4>*   modelMatrix = nullptr;
+        /**
+         * \brief The rasterization state.
+         */
+        ogls::oglCore::pipeline::RasterState          raster;
+        /**
+         * \brief The shader program loaded by ResourceManager.
+         */
+        ShaderProgramHandle                           shaderProgram;
+        /**
+         * \brief The configuration of texture units.
+         */
+        ogls::oglCore::texture::TexturesConfiguration textures;
+
+};  // struct Material
+
+/**
+ * \brief RenderResources is a registry of materials, which are referred by handles.
+ *
+ * It also caches PipelineState objects of every used pair of the mesh and the material, so they are resolved
+ * only once and are not rebuilt every frame. Meshes and shader programs are owned by ResourceManager.
+ */
+class RenderResources final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of RenderResources.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new RenderResources.
+         *
+         * \param resourceManager - the manager, which owns meshes and shader programs. It must outlive this object.
+         */
+        explicit RenderResources(ResourceManager& resourceManager);
+        OGLS_NOT_COPYABLE(RenderResources)
+        RenderResources(RenderResources&& obj) noexcept;
+        ~RenderResources() noexcept;
+
+        RenderResources& operator=(RenderResources&& obj) noexcept;
+
+        /**
+         * \brief Registers new material. The material holds a reference to its shader program.
+         *
+         * \param material - the material to register.
+         * \return the handle of registered material.
+         * \throw std::out_of_range, if the shader program of the material doesn't exist.
+         */
+        MaterialHandle                                 addMaterial(Material material);
+        /**
+         * \brief Returns the material or nullptr if the handle is stale.
+         */
+        Material*                                      getMaterial(MaterialHandle material) noexcept;
+        /**
+         * \brief Returns the material or nullptr if the handle is stale.
+         */
+        const Material*                                getMaterial(MaterialHandle material) const noexcept;
+        /**
+         * \brief Returns the mesh or nullptr if the handle is stale (see ResourceManager::getMesh()).
+         */
+        const Mesh*                                    getMesh(MeshHandle mesh) const noexcept;
+        /**
+         * \brief Returns the manager, which owns meshes and shader programs.
+         */
+        ResourceManager&                               getResourceManager() const noexcept;
+        /**
+         * \brief Returns the pipeline state to draw the mesh with the material.
+         *
+         * The state is created on the first request and is cached until the mesh or the material is removed.
+         *
+         * \throw std::invalid_argument, if any of handles is stale.
+         */
+        const ogls::oglCore::pipeline::PipelineState& getPipelineState(MeshHandle mesh, MaterialHandle material);
+        /**
+         * \brief Removes cached pipeline states of meshes, which were destroyed by ResourceManager::releaseUnused().
+         *
+         * \return a number of removed pipeline states.
+         */
+        size_t                                         releaseStalePipelineStates();
+        /**
+         * \brief Removes the material and all cached pipeline states, which use it.
+         */
+        void                                           removeMaterial(MaterialHandle material);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class RenderResources
+
+}  // namespace app::renderer
+
+#endif
@@ -1,26 +1,123 @@
 #include "renderer.h"
 
+#include <memory_resource>
+#include <optional>
+
+#include "drawPacket.h"
+#include "entityStore.h"
 #include "helpers/debugHelpers.h"
+#include "helpers/frameArena.h"
+#include "helpers/helpers.h"
+#include "helpers/threadPool.h"
+#include "lodSelection.h"
 #include "multicoloredRectangle.h"
+#include "occlusionCuller.h"
 #include "openglLimits.h"
+#include "pipelineState.h"
+#include "quadBatcher.h"
+#include "renderResources.h"
+#include "resourceManager.h"
 
 namespace app::renderer
 {
+namespace
+{
+    /**
+     * \brief The number of frames, temporary data of which is kept, till Renderer::setFramesInFlight() is called.
+     */
+    constexpr auto defaultFramesInFlight = size_t{2};
+
+}  // namespace
+
 class Renderer::Impl
 {
     public:
         Impl()
         {
             ogls::oglCore::initOpenglLimits();
-            coloredRectangle = makeMulticoloredRectangle();
+            coloredRectangle = makeMulticoloredRectangle(renderResources, entityStore, sceneGraph);
+            occlusionCuller  = std::make_unique<OcclusionCuller>();
+            quadBatcher      = std::make_unique<QuadBatcher>();
+        }
+
+        /**
+         * \brief Draws all entities of the entity store.
+         *
+         * If the camera is set, entities hidden by occlusion queries are drawn after the visible ones with
+         * the conditional rendering, and queries are tested against the depth of visible entities.
+         */
+        void renderEntities()
+        {
+            resourceManager.processLoadedResources();
+            entityStore.syncTransforms(sceneGraph);
+            if (lodProjection)
+            {
+                entityStore.selectLods(*lodProjection, lodSettings, renderResources);
+                occlusionCuller->beginFrame();
+                entityStore.updateOcclusion(*occlusionCuller);
+            }
+
+            auto drawPackets = std::pmr::vector<DrawPacket>{&frameArena.getResource()};
+            entityStore.collectDrawPackets(drawPackets);
+            submitDrawPackets(drawPackets, renderResources);
+
+            if (lodProjection)
+            {
+                entityStore.issueOcclusionQueries(*occlusionCuller);
+
+                drawPackets.clear();
+                entityStore.collectOccludedDrawPackets(drawPackets);
+                submitDrawPackets(drawPackets, renderResources);
+            }
+        }
+
+        /**
+         * \brief Draws the strip of small colored quads along the bottom edge of the window by the quad batcher.
+         *
+         * \param colorCoefficient - the green component of quads.
+         */
+        void renderQuadsStrip(float colorCoefficient)
+        {
+            constexpr auto columns = int{128}, rows = int{8};
+            constexpr auto width = 2.0f / columns, height = 0.2f / rows;
+
+            quadBatcher->begin();
+            for (auto row = int{0}; row < rows; ++row)
+            {
+                for (auto column = int{0}; column < columns; ++column)
+                {
+                    const auto c = static_cast<float>(column) / columns;
+                    quadBatcher->draw({.color{c, colorCoefficient, 1.0f - c},
+                                       .position{-1.0f + column * width, -1.0f + row * height},
+                                       .size{width * 0.9f, height * 0.9f},
+                                       .texture{nullptr},
+                                       .uvRect{0.0f, 0.0f, 1.0f, 1.0f}});
+                }
+            }
+            quadBatcher->end();
         }
 
         virtual ~Impl() noexcept = default;
 
     public:
+        // The manager must be constructed before and destroyed after everything, what refers to its resources
+        ResourceManager                        resourceManager;
         std::unique_ptr<MulticoloredRectangle> coloredRectangle = nullptr;
-        float                                  currentK         = {0.0};
-        float                                  increment        = {0.05};
+        EntityStore                            entityStore;
+        /**
+         * \brief The memory of temporary data of frames, e.g. draw packets.
+         */
+        ogls::helpers::FrameArena              frameArena{defaultFramesInFlight};
+        std::optional<LodProjection>           lodProjection    = std::nullopt;
+        LodSettings                            lodSettings;
+        std::unique_ptr<OcclusionCuller>       occlusionCuller  = nullptr;
+        std::unique_ptr<QuadBatcher>           quadBatcher      = nullptr;
+        /**
+         * \brief The state of the last render() or std::nullopt, if nothing has been rendered yet.
+         */
+        std::optional<SimulationState>         renderedState    = std::nullopt;
+        RenderResources                        renderResources{resourceManager};
+        SceneGraph                             sceneGraph;
 
 };  // Renderer::Impl
 
@@ -28,24 +125,59 @@ Renderer::Renderer() : m_impl{std::make_unique<Impl>()}
 {
 }
 
-void Renderer::render()
+bool Renderer::needsRedraw(const SimulationState& state) const
 {
-    OGLS_GLCall(glClearColor(0.1176f, 0.5647, 1.0f, 1.0f));
-    OGLS_GLCall(glClear(GL_COLOR_BUFFER_BIT));
+    const auto& impl = *m_impl;
 
-    if (m_impl->currentK >= 1.0f)
-    {
-        m_impl->increment = -0.05f;
-    }
-    else if (m_impl->currentK <= 0)
+    return impl.renderedState != state || impl.sceneGraph.hasPendingUpdates() || impl.entityStore.hasChanges()
+        || impl.resourceManager.hasLoadedResources();
+}
+
+void Renderer::render(const SimulationState& state)
+{
+    using namespace ogls::oglCore::pipeline;
+
+
+    m_impl->frameArena.beginFrame();
+
+    pipelineStateManager::clear(ClearColor{0.1176f, 0.5647f, 1.0f, 1.0f},
+                                ogls::helpers::toUType(ClearBufferBit::ColorBufferBit)
+                                  | ogls::helpers::toUType(ClearBufferBit::DepthBufferBit));
+
+    // The unchanged transformation doesn't make the tree dirty
+    const auto rectangleNode = m_impl->coloredRectangle->getSceneNode();
+    if (!isTransformsEqual(m_impl->sceneGraph.getLocalTransform(rectangleNode), state.rectangleTransform))
     {
-        m_impl->increment = 0.05f;
+        m_impl->sceneGraph.setLocalTransform(rectangleNode, state.rectangleTransform);
     }
+    m_impl->sceneGraph.updateWorldTransforms(&ogls::helpers::getDefaultThreadPool());
+
+    m_impl->coloredRectangle->setColorCoefficient(state.colorCoefficient);
+    m_impl->coloredRectangle->update();
+    m_impl->renderEntities();
+    m_impl->renderQuadsStrip(state.colorCoefficient);
 
-    m_impl->coloredRectangle->setColorCoefficient(m_impl->currentK);
-    m_impl->coloredRectangle->render();
+    // Changes, which are made while rendering, are already drawn
+    m_impl->entityStore.clearChanges();
+    m_impl->renderedState = state;
+}
+
+void Renderer::setCamera(const ogls::mathCore::TransformMatrix& view,
+                         const ogls::mathCore::TransformMatrix& projection, float viewportHeight)
+{
+    m_impl->lodProjection = makeLodProjection(view, projection, viewportHeight);
+    m_impl->occlusionCuller->setCamera(view, projection);
+    m_impl->entityStore.markChanged();
+}
 
-    m_impl->currentK += m_impl->increment;
+void Renderer::setFramesInFlight(size_t framesCount)
+{
+    m_impl->frameArena = ogls::helpers::FrameArena{framesCount};
+}
+
+void Renderer::setRedrawCallback(std::function<void()> callback)
+{
+    m_impl->resourceManager.setLoadedCallback(std::move(callback));
 }
 
 }  // namespace app::renderer
@@ -1,9 +1,12 @@
 #ifndef APP_RENDERER_RENDERER_H
 #define APP_RENDERER_RENDERER_H
 
+#include <functional>
 #include <memory>
 
 #include "helpers/macros.h"
+#include "mathCore/transformMatrix.h"
+#include "simulation.h"
 
 /**
  * \namespace app
@@ -37,13 +40,48 @@ class Renderer
         OGLS_NOT_COPYABLE_MOVABLE(Renderer)
         virtual ~Renderer() noexcept = default;
 
+        /**
+         * \brief Checks whether the frame must be redrawn in the render-on-demand mode.
+         *
+         * \param state - the state of the scene, which would be rendered.
+         * \return true if the state differs from the rendered one, scene nodes or entities have been changed or
+         * decoded textures wait for the upload since the last render(), false otherwise.
+         */
+        virtual bool needsRedraw(const SimulationState& state) const;
         /**
          * \brief Performs rendering.
          *
          * This method must be overridden to define all stuff, which must be rendered on the screen.
          * It must be called per every render loop iteration.
+         *
+         * \param state - the state of the scene, which is simulated on the separate thread by Simulation.
+         */
+        virtual void render(const SimulationState& state);
+        /**
+         * \brief Sets the camera, by which levels of detail of meshes are selected and hidden entities are culled by
+         * occlusion queries. Until it is set, meshes are drawn at full detail and without culling.
+         *
+         * \param view           - the view transformation.
+         * \param projection     - the perspective or orthographic projection.
+         * \param viewportHeight - the height of the viewport in pixels.
+         */
+        void         setCamera(const ogls::mathCore::TransformMatrix& view,
+                               const ogls::mathCore::TransformMatrix& projection, float viewportHeight);
+        /**
+         * \brief Sets a number of frames, which can be processed by the GPU at the same time. Temporary data of
+         * the frame, which is allocated from the arena of the frame, is kept, till so many next frames begin.
+         *
+         * \param framesCount - a number of frames, which the GPU queue can hold, see FramePacer.
+         * \throw std::invalid_argument, if framesCount is 0.
+         */
+        void         setFramesInFlight(size_t framesCount);
+        /**
+         * \brief Sets the function, which is called from other threads, when the frame must be redrawn because of
+         * them (e.g. the texture has been decoded). It is supposed to wake up the render loop.
+         *
+         * \param callback - the thread-safe function.
          */
-        virtual void render();
+        void         setRedrawCallback(std::function<void()> callback);
 
     private:
         /**
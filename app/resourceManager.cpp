@@ -0,0 +1,558 @@
+#include "resourceManager.h"
+
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "assets/binaryMesh.h"
+#include "assets/binaryTexture.h"
+#include "assets/cookedAsset.h"
+#include "assets/meshImporter.h"
+#include "assets/meshSimplifier.h"
+#include "buffer.h"
+#include "helpers/helpers.h"
+#include "helpers/virtualFileSystem.h"
+#include "vertexBufferLayout.h"
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief ResourceCache stores resources of one kind, their keys and reference counters.
+     */
+    template<typename Tag, typename Resource>
+    class ResourceCache final
+    {
+        public:
+            using HandleType = ogls::helpers::Handle<Tag>;
+
+            /**
+             * \brief Entry is the resource with its key and reference counter.
+             */
+            struct Entry final
+            {
+                    std::string key;
+                    size_t      refCount = {0};
+                    Resource    resource;
+
+            };  // struct Entry
+
+        public:
+            /**
+             * \brief Returns the handle of the resource with the key and increments its reference counter
+             * or returns invalid handle if there is no such resource.
+             */
+            HandleType acquire(const std::string& key)
+            {
+                const auto it = handles.find(key);
+                if (it == handles.end())
+                {
+                    return HandleType{};
+                }
+
+                ++entries.get(it->second)->refCount;
+                return it->second;
+            }
+
+            /**
+             * \brief Returns the entry or throws std::out_of_range if the handle is stale.
+             */
+            Entry& getEntry(HandleType handle)
+            {
+                const auto entry = entries.get(handle);
+                if (!entry)
+                {
+                    throw std::out_of_range{"The resource doesn't exist."};
+                }
+                return *entry;
+            }
+
+            /**
+             * \brief Returns the entry or throws std::out_of_range if the handle is stale.
+             */
+            const Entry& getEntry(HandleType handle) const
+            {
+                const auto entry = entries.get(handle);
+                if (!entry)
+                {
+                    throw std::out_of_range{"The resource doesn't exist."};
+                }
+                return *entry;
+            }
+
+            /**
+             * \brief Adds new resource with one reference.
+             */
+            HandleType insert(std::string key, Resource resource)
+            {
+                const auto handle = entries.insert(Entry{.key{key}, .refCount{1}, .resource{std::move(resource)}});
+                handles.emplace(std::move(key), handle);
+                return handle;
+            }
+
+            /**
+             * \brief Decrements the reference counter of the resource if it exists.
+             */
+            void release(HandleType handle) noexcept
+            {
+                if (const auto entry = entries.get(handle); entry && entry->refCount > 0)
+                {
+                    --entry->refCount;
+                }
+            }
+
+            /**
+             * \brief Destroys resources, which are not referenced and which are allowed to be destroyed.
+             *
+             * \return a number of destroyed resources.
+             */
+            size_t releaseUnused(const std::function<bool(const Resource&)>& canBeDestroyed)
+            {
+                auto unused = std::vector<HandleType>{};
+                for (auto i = size_t{0}; i < entries.size(); ++i)
+                {
+                    const auto handle = entries.getHandle(i);
+                    const auto entry  = entries.get(handle);
+                    if (entry->refCount == 0 && canBeDestroyed(entry->resource))
+                    {
+                        unused.push_back(handle);
+                    }
+                }
+
+                for (const auto handle : unused)
+                {
+                    handles.erase(entries.get(handle)->key);
+                    entries.erase(handle);
+                }
+                return unused.size();
+            }
+
+        public:
+            /**
+             * \brief Resources.
+             */
+            ogls::helpers::SlotMap<Tag, Entry>          entries;
+            /**
+             * \brief Mapping of keys of resources into their handles.
+             */
+            std::unordered_map<std::string, HandleType> handles;
+
+    };  // class ResourceCache
+
+    /**
+     * \brief TextureResource is the texture, which can be still being decoded.
+     */
+    struct TextureResource final
+    {
+            /**
+             * \brief The error of the failed loading.
+             */
+            std::exception_ptr                                                error   = nullptr;
+            /**
+             * \brief The decoded data, which is not uploaded yet.
+             */
+            std::future<std::shared_ptr<ogls::oglCore::texture::TextureData>> pendingData;
+            /**
+             * \brief The texture, which is nullptr until the data is uploaded.
+             */
+            std::shared_ptr<ogls::oglCore::texture::Texture<2>>               texture = nullptr;
+
+    };  // struct TextureResource
+
+    /**
+     * \brief LoadedCallback is the callback of finished loads, which is shared with tasks of the pool, so it
+     * stays alive, even if the manager is destroyed before they finish.
+     */
+    struct LoadedCallback final
+    {
+            std::function<void()> callback;
+            std::mutex            mutex;
+
+    };  // struct LoadedCallback
+
+    using ogls::assets::MeshDataView;
+
+    size_t                                               calculateMeshDataHash(const MeshDataView& meshData) noexcept;
+    std::shared_ptr<ogls::oglCore::texture::TextureData> decodeTexture(const std::string& pathToFile);
+    void                                                 notify(LoadedCallback& loadedCallback);
+    Mesh                                                 makeMesh(const MeshDataView& meshData);
+
+}  // namespace
+
+class ResourceManager::Impl
+{
+    public:
+        explicit Impl(ogls::helpers::ThreadPool& threadPool) : pool{threadPool}
+        {
+        }
+
+        /**
+         * \brief Creates the texture from decoded data or remembers the error of decoding.
+         */
+        void finishTextureLoading(TextureResource& resource)
+        {
+            using namespace ogls::oglCore::texture;
+
+
+            try
+            {
+                const auto data  = resource.pendingData.get();
+                resource.texture = std::make_shared<Texture<2>>(TextureTarget::Texture2d, data);
+            }
+            catch (...)
+            {
+                resource.error = std::current_exception();
+            }
+        }
+
+    public:
+        /**
+         * \brief The callback of finished loads of textures.
+         */
+        std::shared_ptr<LoadedCallback>                                                        loadedCallback =
+          std::make_shared<LoadedCallback>();
+        /**
+         * \brief Loaded meshes.
+         */
+        ResourceCache<MeshTag, Mesh>                                                           meshes;
+        /**
+         * \brief The pool to decode textures.
+         */
+        ogls::helpers::ThreadPool&                                                             pool;
+        /**
+         * \brief Loaded shader programs.
+         */
+        ResourceCache<ShaderProgramTag, std::shared_ptr<ogls::oglCore::shader::ShaderProgram>> shaderPrograms;
+        /**
+         * \brief Loaded and in-flight textures.
+         */
+        ResourceCache<TextureTag, TextureResource>                                             textures;
+
+};  // class ResourceManager::Impl
+
+ResourceManager::ResourceManager(ogls::helpers::ThreadPool& pool) : m_impl{std::make_unique<Impl>(pool)}
+{
+}
+
+ResourceManager::~ResourceManager() noexcept = default;
+
+void ResourceManager::addReference(MeshHandle mesh)
+{
+    ++m_impl->meshes.getEntry(mesh).refCount;
+}
+
+void ResourceManager::addReference(ShaderProgramHandle shaderProgram)
+{
+    ++m_impl->shaderPrograms.getEntry(shaderProgram).refCount;
+}
+
+void ResourceManager::addReference(TextureHandle texture)
+{
+    ++m_impl->textures.getEntry(texture).refCount;
+}
+
+const Mesh* ResourceManager::getMesh(MeshHandle mesh) const noexcept
+{
+    const auto entry = m_impl->meshes.entries.get(mesh);
+    return entry ? &entry->resource : nullptr;
+}
+
+const std::shared_ptr<ogls::oglCore::shader::ShaderProgram>& ResourceManager::getShaderProgram(
+  ShaderProgramHandle shaderProgram) const
+{
+    return m_impl->shaderPrograms.getEntry(shaderProgram).resource;
+}
+
+ResourceState ResourceManager::getState(TextureHandle texture) const
+{
+    const auto& resource = m_impl->textures.getEntry(texture).resource;
+
+    if (resource.error)
+    {
+        return ResourceState::Failed;
+    }
+    return resource.texture ? ResourceState::Loaded : ResourceState::Loading;
+}
+
+const std::shared_ptr<ogls::oglCore::texture::Texture<2>>& ResourceManager::getTexture(TextureHandle texture)
+{
+    auto& resource = m_impl->textures.getEntry(texture).resource;
+
+    if (resource.pendingData.valid())
+    {
+        m_impl->finishTextureLoading(resource);
+    }
+    if (resource.error)
+    {
+        std::rethrow_exception(resource.error);
+    }
+    return resource.texture;
+}
+
+MeshHandle ResourceManager::loadMesh(const ogls::assets::MeshData& meshData)
+{
+    const auto view = ogls::assets::makeMeshDataView(meshData);
+
+    auto key = std::format("{:016x}:{}:{}", calculateMeshDataHash(view), view.vertices.size(), view.indices.size());
+    if (const auto handle = m_impl->meshes.acquire(key); handle.isValid())
+    {
+        return handle;
+    }
+    return m_impl->meshes.insert(std::move(key), makeMesh(view));
+}
+
+MeshHandle ResourceManager::loadMesh(const std::string& pathToFile)
+{
+    if (const auto handle = m_impl->meshes.acquire(pathToFile); handle.isValid())
+    {
+        return handle;
+    }
+
+    // The cooked artifact is preferred to the source file, which is imported only during the development
+    const auto cookedPath = ogls::assets::getCookedAssetPath(pathToFile);
+    if (std::filesystem::path{pathToFile}.extension() == ".oglmesh"
+        || ogls::helpers::getDefaultVirtualFileSystem().isFileExist(cookedPath))
+    {
+        // The mapped data is handed to buffers as is
+        const auto binaryMesh = ogls::assets::BinaryMesh{cookedPath};
+        return m_impl->meshes.insert(pathToFile, makeMesh(binaryMesh.getView()));
+    }
+
+    auto meshData = ogls::assets::importMeshFile(pathToFile, m_impl->pool);
+    ogls::assets::buildMeshLods(meshData, {}, m_impl->pool);
+    return m_impl->meshes.insert(pathToFile, makeMesh(ogls::assets::makeMeshDataView(meshData)));
+}
+
+ShaderProgramHandle ResourceManager::loadShaderProgram(const std::string& pathToVertexShader,
+                                                       const std::string& pathToFragmentShader)
+{
+    auto key = pathToVertexShader + '|' + pathToFragmentShader;
+    if (const auto handle = m_impl->shaderPrograms.acquire(key); handle.isValid())
+    {
+        return handle;
+    }
+
+    auto shaderProgram = std::shared_ptr<ogls::oglCore::shader::ShaderProgram>{
+      ogls::oglCore::shader::makeShaderProgram(pathToVertexShader, pathToFragmentShader)};
+    return m_impl->shaderPrograms.insert(std::move(key), std::move(shaderProgram));
+}
+
+TextureHandle ResourceManager::loadTexture(const std::string& pathToFile)
+{
+    if (const auto handle = m_impl->textures.acquire(pathToFile); handle.isValid())
+    {
+        return handle;
+    }
+
+    auto resource        = TextureResource{};
+    auto promise         = std::promise<std::shared_ptr<ogls::oglCore::texture::TextureData>>{};
+    resource.pendingData = promise.get_future();
+
+    // The future of the task becomes ready only after the task returns, so the woken render loop could find
+    // nothing to upload. The promise is set before the notification instead. The failure is shown by the next
+    // frame too.
+    m_impl->pool.submit(
+      [pathToFile, promise = std::move(promise), loadedCallback = m_impl->loadedCallback]() mutable
+      {
+          try
+          {
+              promise.set_value(decodeTexture(pathToFile));
+          }
+          catch (...)
+          {
+              promise.set_exception(std::current_exception());
+          }
+          notify(*loadedCallback);
+      });
+    return m_impl->textures.insert(pathToFile, std::move(resource));
+}
+
+bool ResourceManager::hasLoadedResources() const
+{
+    for (const auto& entry : m_impl->textures.entries)
+    {
+        const auto& resource = entry.resource;
+        if (resource.pendingData.valid()
+            && resource.pendingData.wait_for(std::chrono::seconds{0}) == std::future_status::ready)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t ResourceManager::processLoadedResources()
+{
+    auto uploadedNumber = size_t{0};
+
+    for (auto& entry : m_impl->textures.entries)
+    {
+        auto& resource = entry.resource;
+        if (resource.pendingData.valid()
+            && resource.pendingData.wait_for(std::chrono::seconds{0}) == std::future_status::ready)
+        {
+            m_impl->finishTextureLoading(resource);
+            ++uploadedNumber;
+        }
+    }
+
+    return uploadedNumber;
+}
+
+void ResourceManager::release(MeshHandle mesh) noexcept
+{
+    m_impl->meshes.release(mesh);
+}
+
+void ResourceManager::release(ShaderProgramHandle shaderProgram) noexcept
+{
+    m_impl->shaderPrograms.release(shaderProgram);
+}
+
+void ResourceManager::release(TextureHandle texture) noexcept
+{
+    m_impl->textures.release(texture);
+}
+
+size_t ResourceManager::releaseUnused()
+{
+    return m_impl->meshes.releaseUnused([](const Mesh&) { return true; })
+           + m_impl->shaderPrograms.releaseUnused([](const auto&) { return true; })
+           + m_impl->textures.releaseUnused([](const TextureResource& r) { return !r.pendingData.valid(); });
+}
+
+void ResourceManager::setLoadedCallback(std::function<void()> callback)
+{
+    auto& loadedCallback = *m_impl->loadedCallback;
+
+    auto lock               = std::scoped_lock{loadedCallback.mutex};
+    loadedCallback.callback = std::move(callback);
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    size_t calculateMeshDataHash(const MeshDataView& meshData) noexcept
+    {
+        using ogls::helpers::hashCombine;
+
+
+        auto seed = size_t{0};
+        for (const auto& attribute : meshData.attributes)
+        {
+            hashCombine(seed, std::hash<int>{}(attribute.byteOffset));
+            hashCombine(seed, std::hash<GLint>{}(attribute.count));
+            hashCombine(seed, std::hash<GLuint>{}(attribute.index));
+            hashCombine(seed, std::hash<GLboolean>{}(attribute.normalized));
+            hashCombine(seed, std::hash<GLenum>{}(ogls::helpers::toUType(attribute.type)));
+        }
+
+        const auto hashBytes = [](const auto& v)
+        {
+            return std::hash<std::string_view>{}(
+              std::string_view{reinterpret_cast<const char*>(v.data()), v.size() * sizeof(v[0])});
+        };
+        hashCombine(seed, hashBytes(meshData.indices));
+        hashCombine(seed, hashBytes(meshData.lods));
+        hashCombine(seed, hashBytes(meshData.vertices));
+
+        return seed;
+    }
+
+    std::shared_ptr<ogls::oglCore::texture::TextureData> decodeTexture(const std::string& pathToFile)
+    {
+        using namespace ogls::oglCore::texture;
+
+
+        // The cooked texture already has all levels in the runtime format
+        if (const auto cookedPath = ogls::assets::getCookedAssetPath(pathToFile);
+            ogls::helpers::getDefaultVirtualFileSystem().isFileExist(cookedPath))
+        {
+            return std::shared_ptr<TextureData>{ogls::assets::readBinaryTexture(cookedPath)};
+        }
+
+        auto data = std::shared_ptr<TextureData>{ogls::helpers::readTextureFromFile(pathToFile)};
+
+        switch (data->nChannels)
+        {
+            case 1:
+                data->format         = TexturePixelFormat::Red;
+                data->internalFormat = TextureInternalFormat::R8;
+                break;
+            case 4:
+                data->format         = TexturePixelFormat::Rgba;
+                data->internalFormat = TextureInternalFormat::Rgba8;
+                break;
+            default:
+                break;
+        }
+
+        return data;
+    }
+
+    Mesh makeMesh(const MeshDataView& meshData)
+    {
+        using namespace ogls::oglCore::vertex;
+
+
+        if (meshData.attributes.empty() || meshData.indices.empty() || meshData.vertices.empty())
+        {
+            throw std::invalid_argument{"The mesh data must contain vertices, indices and attributes."};
+        }
+
+        auto layout = VertexBufferLayout{};
+        for (const auto& attribute : meshData.attributes)
+        {
+            layout.addVertexAttribute(attribute);
+        }
+
+        // The mesh data is destroyed after loading, so buffers are created empty and keep no pointer to it
+        auto vertices = std::make_shared<Buffer>(BufferTarget::ArrayBuffer,
+                                                 ogls::ArrayData{nullptr, meshData.vertices.size_bytes()},
+                                                 BufferDataUsage::StaticDraw, layout);
+        vertices->setSubData(0, ogls::ArrayData{meshData.vertices.data(), meshData.vertices.size_bytes()});
+        auto indices = std::make_shared<Buffer>(BufferTarget::ElementArrayBuffer,
+                                                ogls::ArrayData{nullptr, meshData.indices.size_bytes()},
+                                                BufferDataUsage::StaticDraw);
+        indices->setSubData(0, ogls::ArrayData{meshData.indices.data(), meshData.indices.size_bytes()});
+
+        auto vao = std::make_shared<VertexArray>();
+        vao->addBuffer(std::move(vertices));
+        vao->addBuffer(std::move(indices));
+
+        auto lods = std::vector<ogls::assets::MeshLod>(meshData.lods.begin(), meshData.lods.end());
+        if (lods.empty())
+        {
+            lods.push_back(
+              {.error{0.0f}, .indicesCount{static_cast<uint32_t>(meshData.indices.size())}, .indicesOffset{0}});
+        }
+
+        return Mesh{.bounds{meshData.bounds},
+                    .indicesCount{static_cast<GLsizei>(lods.front().indicesCount)},
+                    .lods{std::move(lods)},
+                    .vertexArray{std::move(vao)}};
+    }
+
+    void notify(LoadedCallback& loadedCallback)
+    {
+        auto lock = std::scoped_lock{loadedCallback.mutex};
+        if (loadedCallback.callback)
+        {
+            loadedCallback.callback();
+        }
+    }
+
+}  // namespace
+
+}  // namespace app::renderer
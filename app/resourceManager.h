@@ -0,0 +1,251 @@
+#ifndef APP_RENDERER_RESOURCE_MANAGER_H
+#define APP_RENDERER_RESOURCE_MANAGER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "assets/meshData.h"
+#include "helpers/handle.h"
+#include "helpers/macros.h"
+#include "helpers/threadPool.h"
+#include "mathCore/boundingBox.h"
+#include "shaderProgram.h"
+#include "texture.h"
+#include "vertexArray.h"
+
+namespace app::renderer
+{
+/**
+ * \brief MeshTag is a tag of MeshHandle.
+ */
+struct MeshTag;
+/**
+ * \brief ShaderProgramTag is a tag of ShaderProgramHandle.
+ */
+struct ShaderProgramTag;
+/**
+ * \brief TextureTag is a tag of TextureHandle.
+ */
+struct TextureTag;
+
+/**
+ * \brief MeshHandle refers to the Mesh loaded by ResourceManager.
+ */
+using MeshHandle          = ogls::helpers::Handle<MeshTag>;
+/**
+ * \brief ShaderProgramHandle refers to the shader program loaded by ResourceManager.
+ */
+using ShaderProgramHandle = ogls::helpers::Handle<ShaderProgramTag>;
+/**
+ * \brief TextureHandle refers to the texture loaded by ResourceManager.
+ */
+using TextureHandle       = ogls::helpers::Handle<TextureTag>;
+
+/**
+ * \brief Mesh is an indexed geometry, which is drawn by one draw call.
+ */
+struct Mesh final
+{
+        /**
+         * \brief The bounding box of the geometry in the local coordinate system.
+         */
+        ogls::mathCore::BoundingBox                         bounds;
+        /**
+         * \brief A number of indices of the full-detail level.
+         */
+        GLsizei                                             indicesCount = {0};
+        /**
+         * \brief Levels of detail from the finest one to the coarsest one. There is at least one level. Indices of
+         * all levels are stored in the same element array buffer.
+         */
+        std::vector<ogls::assets::MeshLod>                  lods;
+        /**
+         * \brief The vertex array object, which contains vertex and element array buffers.
+         */
+        std::shared_ptr<ogls::oglCore::vertex::VertexArray> vertexArray  = nullptr;
+
+};  // struct Mesh
+
+/**
+ * \brief ResourceState is a state of the resource, which is loaded asynchronously.
+ */
+enum class ResourceState : uint8_t
+{
+    Failed,
+    Loaded,
+    Loading
+};
+
+/**
+ * \brief ResourceManager loads shader programs, textures and meshes once and shares them by handles.
+ *
+ * Requests are deduplicated: shader programs, textures and mesh files by paths of their files, meshes created
+ * from the data by the hash of their content. A repeated request returns the handle of already loaded resource
+ * and increments its reference counter. Textures are decoded on the thread pool, and a request of the texture,
+ * which is still being decoded, returns the handle of that in-flight load. OpenGL objects are created only
+ * on the thread, which owns the context.
+ *
+ * Every load...() and addReference() must be paired with release(). Resources, which are not referenced anymore,
+ * are destroyed only by releaseUnused(), so the resource released and requested again during one frame is not
+ * reloaded.
+ */
+class ResourceManager final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of ResourceManager.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new ResourceManager.
+         *
+         * \param pool - the pool to decode textures and to import meshes.
+         */
+        explicit ResourceManager(ogls::helpers::ThreadPool& pool = ogls::helpers::getDefaultThreadPool());
+        OGLS_NOT_COPYABLE_MOVABLE(ResourceManager)
+        ~ResourceManager() noexcept;
+
+        /**
+         * \brief Increments the reference counter of the mesh.
+         *
+         * \throw std::out_of_range, if the mesh doesn't exist.
+         */
+        void                                                        addReference(MeshHandle mesh);
+        /**
+         * \brief Increments the reference counter of the shader program.
+         *
+         * \throw std::out_of_range, if the shader program doesn't exist.
+         */
+        void                                                        addReference(ShaderProgramHandle shaderProgram);
+        /**
+         * \brief Increments the reference counter of the texture.
+         *
+         * \throw std::out_of_range, if the texture doesn't exist.
+         */
+        void                                                        addReference(TextureHandle texture);
+        /**
+         * \brief Returns the mesh or nullptr if the handle is stale.
+         */
+        const Mesh*                                                 getMesh(MeshHandle mesh) const noexcept;
+        /**
+         * \brief Returns the shader program.
+         *
+         * \throw std::out_of_range, if the shader program doesn't exist.
+         */
+        const std::shared_ptr<ogls::oglCore::shader::ShaderProgram>& getShaderProgram(
+          ShaderProgramHandle shaderProgram) const;
+        /**
+         * \brief Returns the state of the texture loading.
+         *
+         * \throw std::out_of_range, if the texture doesn't exist.
+         */
+        ResourceState                                               getState(TextureHandle texture) const;
+        /**
+         * \brief Returns the texture. If the texture is still being decoded, waits for it and uploads it.
+         *
+         * \throw std::out_of_range, if the texture doesn't exist.
+         * Exceptions of ogls::helpers::readTextureFromFile(), if the texture loading has failed.
+         */
+        const std::shared_ptr<ogls::oglCore::texture::Texture<2>>&  getTexture(TextureHandle texture);
+        /**
+         * \brief Checks whether there are decoded textures, which will be uploaded by processLoadedResources().
+         */
+        bool                                                        hasLoadedResources() const;
+        /**
+         * \brief Creates the mesh from the data or returns the existing mesh with the same content.
+         *
+         * \param meshData - the geometry of the mesh.
+         * \return the handle of the mesh.
+         * \throw std::invalid_argument, if there are no vertices, indices or attributes.
+         */
+        MeshHandle                                                  loadMesh(const ogls::assets::MeshData& meshData);
+        /**
+         * \brief Loads the mesh from the file or returns the existing one loaded from the same file.
+         *
+         * The engine-native mesh (*.oglmesh, see ogls::assets::BinaryMesh) is uploaded directly from the mapped
+         * file. If the cooked mesh exists (see ogls::assets::getCookedAssetPath()), it is used instead of the source
+         * file. Other formats are imported by ogls::assets::importMeshFile() and simplified into levels of detail
+         * by ogls::assets::buildMeshLods() on the thread pool.
+         *
+         * \param pathToFile - relative to the root folder path to the mesh file.
+         * \return the handle of the mesh.
+         * \throw std::invalid_argument, if the mesh is empty or the file is malformed.
+         * Exceptions of ogls::assets::BinaryMesh and ogls::assets::importMeshFile().
+         */
+        MeshHandle                                                  loadMesh(const std::string& pathToFile);
+        /**
+         * \brief Loads the shader program or returns the existing one created from the same files.
+         *
+         * \param pathToVertexShader   - relative to the root folder path to vertex shader source code.
+         * \param pathToFragmentShader - relative to the root folder path to fragment shader source code.
+         * \return the handle of the shader program.
+         * \throw exceptions of ogls::oglCore::shader::makeShaderProgram().
+         */
+        ShaderProgramHandle                                         loadShaderProgram(
+                                                                      const std::string& pathToVertexShader,
+                                                                      const std::string& pathToFragmentShader);
+        /**
+         * \brief Starts asynchronous loading of the texture or returns the existing (or in-flight) one
+         * loaded from the same file.
+         *
+         * If the cooked texture exists (see ogls::assets::getCookedAssetPath()), its precomputed levels are loaded
+         * instead of decoding the image.
+         *
+         * \param pathToFile - relative to the root folder path to the image.
+         * \return the handle of the texture.
+         */
+        TextureHandle                                               loadTexture(const std::string& pathToFile);
+        /**
+         * \brief Uploads textures, decoding of which has finished. It doesn't wait for unfinished ones.
+         *
+         * It is supposed to be called per every render loop iteration.
+         *
+         * \return a number of uploaded textures.
+         */
+        size_t                                                      processLoadedResources();
+        /**
+         * \brief Decrements the reference counter of the mesh. Nothing happens if the handle is stale.
+         */
+        void                                                        release(MeshHandle mesh) noexcept;
+        /**
+         * \brief Decrements the reference counter of the shader program. Nothing happens if the handle is stale.
+         */
+        void                                                        release(ShaderProgramHandle shaderProgram) noexcept;
+        /**
+         * \brief Decrements the reference counter of the texture. Nothing happens if the handle is stale.
+         */
+        void                                                        release(TextureHandle texture) noexcept;
+        /**
+         * \brief Destroys all resources, which are not referenced anymore. In-flight loads are not destroyed.
+         *
+         * \return a number of destroyed resources.
+         */
+        size_t                                                      releaseUnused();
+        /**
+         * \brief Sets the function, which is called when decoding of the texture finishes (successfully or not).
+         *
+         * It is called from the thread of the pool, so it must be thread-safe. It is supposed to wake up
+         * the render loop, which waits for events (see ogls::Window::invalidate()).
+         *
+         * \param callback - the function or the empty function to stop notifications.
+         */
+        void                                                        setLoadedCallback(std::function<void()> callback);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class ResourceManager
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,363 @@
+#include "sceneGraph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace app::renderer
+{
+namespace
+{
+    /**
+     * \brief NodeFlag represents bits of the state of the scene node.
+     */
+    enum class NodeFlag : uint8_t
+    {
+        LocalChanged  = 0x01,
+        RootScheduled = 0x02,
+        WorldChanged  = 0x04
+    };
+
+    constexpr auto invalidIndex = std::numeric_limits<size_t>::max();
+
+    constexpr bool hasFlag(uint8_t flags, NodeFlag flag) noexcept
+    {
+        return (flags & static_cast<uint8_t>(flag)) != 0;
+    }
+
+}  // namespace
+
+class SceneGraph::Impl
+{
+    public:
+        /**
+         * \brief Returns an index of the node in the arrays or throws std::out_of_range if the node doesn't exist.
+         */
+        size_t getIndex(NodeId node) const
+        {
+            if (node >= idToIndex.size() || idToIndex[node] == invalidIndex)
+            {
+                throw std::out_of_range{"The scene node doesn't exist."};
+            }
+            return idToIndex[node];
+        }
+
+        /**
+         * \brief Checks whether the node exists and has no parent.
+         */
+        bool isRootNode(NodeId node) const noexcept
+        {
+            return node < idToIndex.size() && idToIndex[node] != invalidIndex
+                   && parents[idToIndex[node]] == invalidIndex;
+        }
+
+        /**
+         * \brief Marks the node dirty and schedules its tree for the next update.
+         */
+        void markDirty(size_t index)
+        {
+            flags[index] |= static_cast<uint8_t>(NodeFlag::LocalChanged);
+
+            auto root = index;
+            while (parents[root] != invalidIndex)
+            {
+                root = parents[root];
+            }
+
+            if (!hasFlag(flags[root], NodeFlag::RootScheduled))
+            {
+                flags[root] |= static_cast<uint8_t>(NodeFlag::RootScheduled);
+                scheduledRoots.push_back(ids[root]);
+            }
+        }
+
+        /**
+         * \brief Recalculates world matrices in the range of one tree and clears flags of its nodes.
+         *
+         * \param treeChangedNodes - the container, into which nodes with recalculated world matrices are added.
+         */
+        void updateTree(size_t begin, size_t end, std::vector<NodeId>& treeChangedNodes)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto parent         = parents[i];
+                const auto isLocalChanged = hasFlag(flags[i], NodeFlag::LocalChanged);
+
+                if (isLocalChanged)
+                {
+                    localMatrices[i] = ogls::mathCore::makeTransformMatrix(localTransforms[i]);
+                }
+
+                if (isLocalChanged || (parent != invalidIndex && hasFlag(flags[parent], NodeFlag::WorldChanged)))
+                {
+                    worldMatrices[i] = parent == invalidIndex
+                                         ? localMatrices[i]
+                                         : ogls::mathCore::combineAffineTransforms(worldMatrices[parent],
+                                                                                   localMatrices[i]);
+                    flags[i] |= static_cast<uint8_t>(NodeFlag::WorldChanged);
+                    treeChangedNodes.push_back(ids[i]);
+                }
+            }
+
+            std::fill(flags.begin() + begin, flags.begin() + end, uint8_t{0});
+        }
+
+    public:
+        /**
+         * \brief Nodes, which world matrices have been recalculated by the last update.
+         */
+        std::vector<NodeId>                    changedNodes;
+        /**
+         * \brief Flags of nodes (see NodeFlag).
+         */
+        std::vector<uint8_t>                   flags;
+        /**
+         * \brief Unused identifiers of removed nodes.
+         */
+        std::vector<NodeId>                    freeIds;
+        /**
+         * \brief Mapping of the node identifier into the index in the arrays.
+         */
+        std::vector<size_t>                    idToIndex;
+        /**
+         * \brief Identifiers of nodes.
+         */
+        std::vector<NodeId>                    ids;
+        /**
+         * \brief Cached local matrices of nodes.
+         */
+        std::vector<ogls::mathCore::Mat4>      localMatrices;
+        /**
+         * \brief Local transformations of nodes.
+         */
+        std::vector<ogls::mathCore::Transform> localTransforms;
+        /**
+         * \brief Indices of parents of nodes.
+         */
+        std::vector<size_t>                    parents;
+        /**
+         * \brief Identifiers of root nodes of trees, which must be updated.
+         */
+        std::vector<NodeId>                    scheduledRoots;
+        /**
+         * \brief Numbers of nodes in subtrees including the node itself.
+         */
+        std::vector<size_t>                    subtreeSizes;
+        /**
+         * \brief Changed nodes of each scheduled tree. Trees are updated in parallel, so they don't share containers.
+         */
+        std::vector<std::vector<NodeId>>       treesChangedNodes;
+        /**
+         * \brief Cached world matrices of nodes.
+         */
+        std::vector<ogls::mathCore::Mat4>      worldMatrices;
+
+};  // class SceneGraph::Impl
+
+SceneGraph::SceneGraph() : m_impl{std::make_unique<Impl>()}
+{
+}
+
+SceneGraph::SceneGraph(SceneGraph&& obj) noexcept = default;
+
+SceneGraph::~SceneGraph() noexcept = default;
+
+SceneGraph& SceneGraph::operator=(SceneGraph&& obj) noexcept = default;
+
+SceneGraph::NodeId SceneGraph::addNode(const ogls::mathCore::Transform& localTransform, NodeId parent)
+{
+    auto& impl = *m_impl;
+
+    const auto parentIndex = parent == invalidNodeId ? invalidIndex : impl.getIndex(parent);
+    const auto index = parentIndex == invalidIndex ? impl.ids.size() : parentIndex + impl.subtreeSizes[parentIndex];
+
+    auto id = NodeId{0};
+    if (impl.freeIds.empty())
+    {
+        id = impl.idToIndex.size();
+        impl.idToIndex.push_back(index);
+    }
+    else
+    {
+        id = impl.freeIds.back();
+        impl.freeIds.pop_back();
+        impl.idToIndex[id] = index;
+    }
+
+    // Shift indices of nodes, which are placed after the inserted one
+    for (auto i = size_t{0}; i < impl.idToIndex.size(); ++i)
+    {
+        if (i != id && impl.idToIndex[i] != invalidIndex && impl.idToIndex[i] >= index)
+        {
+            ++impl.idToIndex[i];
+        }
+    }
+    for (auto& p : impl.parents)
+    {
+        if (p != invalidIndex && p >= index)
+        {
+            ++p;
+        }
+    }
+
+    impl.flags.insert(impl.flags.begin() + index, uint8_t{0});
+    impl.ids.insert(impl.ids.begin() + index, id);
+    impl.localMatrices.insert(impl.localMatrices.begin() + index, ogls::mathCore::Mat4{});
+    impl.localTransforms.insert(impl.localTransforms.begin() + index, localTransform);
+    impl.parents.insert(impl.parents.begin() + index, parentIndex);
+    impl.subtreeSizes.insert(impl.subtreeSizes.begin() + index, size_t{1});
+    impl.worldMatrices.insert(impl.worldMatrices.begin() + index, ogls::mathCore::Mat4{});
+
+    for (auto ancestor = parentIndex; ancestor != invalidIndex; ancestor = impl.parents[ancestor])
+    {
+        ++impl.subtreeSizes[ancestor];
+    }
+
+    impl.markDirty(index);
+    return id;
+}
+
+std::span<const SceneGraph::NodeId> SceneGraph::getChangedNodes() const noexcept
+{
+    return m_impl->changedNodes;
+}
+
+const ogls::mathCore::Transform& SceneGraph::getLocalTransform(NodeId node) const
+{
+    return m_impl->localTransforms[m_impl->getIndex(node)];
+}
+
+size_t SceneGraph::getNodesCount() const noexcept
+{
+    return m_impl->ids.size();
+}
+
+SceneGraph::NodeId SceneGraph::getParent(NodeId node) const
+{
+    const auto parentIndex = m_impl->parents[m_impl->getIndex(node)];
+    return parentIndex == invalidIndex ? invalidNodeId : m_impl->ids[parentIndex];
+}
+
+const ogls::mathCore::Mat4& SceneGraph::getWorldMatrix(NodeId node) const
+{
+    return m_impl->worldMatrices[m_impl->getIndex(node)];
+}
+
+bool SceneGraph::hasPendingUpdates() const noexcept
+{
+    return !m_impl->scheduledRoots.empty();
+}
+
+bool SceneGraph::isNodeExist(NodeId node) const noexcept
+{
+    return node < m_impl->idToIndex.size() && m_impl->idToIndex[node] != invalidIndex;
+}
+
+void SceneGraph::removeNode(NodeId node)
+{
+    auto& impl = *m_impl;
+
+    const auto begin = impl.getIndex(node);
+    const auto count = impl.subtreeSizes[begin];
+    const auto end   = begin + count;
+
+    for (auto ancestor = impl.parents[begin]; ancestor != invalidIndex; ancestor = impl.parents[ancestor])
+    {
+        impl.subtreeSizes[ancestor] -= count;
+    }
+
+    for (auto i = begin; i < end; ++i)
+    {
+        impl.idToIndex[impl.ids[i]] = invalidIndex;
+        impl.freeIds.push_back(impl.ids[i]);
+    }
+
+    // Freed identifiers can be reused by new nodes, so they mustn't stay scheduled
+    std::erase_if(impl.scheduledRoots, [&impl](NodeId id) { return impl.idToIndex[id] == invalidIndex; });
+
+    for (auto& index : impl.idToIndex)
+    {
+        if (index != invalidIndex && index >= end)
+        {
+            index -= count;
+        }
+    }
+    for (auto& p : impl.parents)
+    {
+        if (p != invalidIndex && p >= end)
+        {
+            p -= count;
+        }
+    }
+
+    const auto eraseRange = [begin, end](auto& v) { v.erase(v.begin() + begin, v.begin() + end); };
+    eraseRange(impl.flags);
+    eraseRange(impl.ids);
+    eraseRange(impl.localMatrices);
+    eraseRange(impl.localTransforms);
+    eraseRange(impl.parents);
+    eraseRange(impl.subtreeSizes);
+    eraseRange(impl.worldMatrices);
+}
+
+void SceneGraph::setLocalTransform(NodeId node, const ogls::mathCore::Transform& transform)
+{
+    const auto index               = m_impl->getIndex(node);
+    m_impl->localTransforms[index] = transform;
+    m_impl->markDirty(index);
+}
+
+size_t SceneGraph::updateWorldTransforms(ogls::helpers::ThreadPool* pool)
+{
+    auto& impl = *m_impl;
+
+    impl.changedNodes.clear();
+    if (impl.scheduledRoots.empty())
+    {
+        return 0;
+    }
+
+    // Trees are updated in parallel, so each range must be processed by one task only
+    std::erase_if(impl.scheduledRoots, [&impl](NodeId id) { return !impl.isRootNode(id); });
+    std::ranges::sort(impl.scheduledRoots);
+    const auto duplicates = std::ranges::unique(impl.scheduledRoots);
+    impl.scheduledRoots.erase(duplicates.begin(), duplicates.end());
+
+    // Containers of trees are kept between updates, so their memory is reused
+    if (impl.treesChangedNodes.size() < impl.scheduledRoots.size())
+    {
+        impl.treesChangedNodes.resize(impl.scheduledRoots.size());
+    }
+
+    const auto updateScheduledTree = [&impl](size_t i)
+    {
+        const auto begin = impl.idToIndex[impl.scheduledRoots[i]];
+        impl.treesChangedNodes[i].clear();
+        impl.updateTree(begin, begin + impl.subtreeSizes[begin], impl.treesChangedNodes[i]);
+    };
+
+    if (pool && impl.scheduledRoots.size() > 1)
+    {
+        pool->parallelFor(impl.scheduledRoots.size(), updateScheduledTree);
+    }
+    else
+    {
+        for (auto i = size_t{0}; i < impl.scheduledRoots.size(); ++i)
+        {
+            updateScheduledTree(i);
+        }
+    }
+
+    for (auto i = size_t{0}; i < impl.scheduledRoots.size(); ++i)
+    {
+        const auto& treeChangedNodes = impl.treesChangedNodes[i];
+        impl.changedNodes.insert(impl.changedNodes.end(), treeChangedNodes.begin(), treeChangedNodes.end());
+    }
+
+    impl.scheduledRoots.clear();
+    return impl.changedNodes.size();
+}
+
+}  // namespace app::renderer
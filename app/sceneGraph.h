@@ -0,0 +1,135 @@
+#ifndef APP_RENDERER_SCENE_GRAPH_H
+#define APP_RENDERER_SCENE_GRAPH_H
+
+#include <limits>
+#include <memory>
+#include <span>
+
+#include "helpers/macros.h"
+#include "helpers/threadPool.h"
+#include "mathCore/transform.h"
+
+namespace app::renderer
+{
+/**
+ * \brief SceneGraph is a hierarchy of transformations of scene nodes.
+ *
+ * Nodes are stored in flat arrays sorted in such way that every parent precedes its children and every subtree
+ * occupies a contiguous range. World matrices are cached and recalculated by updateWorldTransforms() only for nodes,
+ * local transform of which was changed, and for their descendants. If nothing was changed since the last update,
+ * updateWorldTransforms() returns immediately. getChangedNodes() lists the recalculated nodes, so data, which depends
+ * on world matrices, is updated only for them.
+ *
+ * Adding and removing of nodes shift the arrays, so they are supposed to be done while the scene building,
+ * not every frame.
+ */
+class SceneGraph final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of SceneGraph.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief NodeId is a stable identifier of the scene node, which stays valid until the node is removed.
+         */
+        using NodeId = size_t;
+
+        /**
+         * \brief The NodeId, which doesn't refer to any node. It is used as a parent of root nodes.
+         */
+        static constexpr auto invalidNodeId = std::numeric_limits<NodeId>::max();
+
+    public:
+        SceneGraph();
+        OGLS_NOT_COPYABLE(SceneGraph)
+        SceneGraph(SceneGraph&& obj) noexcept;
+        ~SceneGraph() noexcept;
+
+        SceneGraph& operator=(SceneGraph&& obj) noexcept;
+
+        /**
+         * \brief Adds new node into the graph.
+         *
+         * \param localTransform - the transformation of the node relatively to the parent node.
+         * \param parent         - the parent node or invalidNodeId to add new root node.
+         * \return the identifier of added node.
+         * \throw std::out_of_range, if the parent node doesn't exist.
+         */
+        NodeId                              addNode(const ogls::mathCore::Transform& localTransform,
+                                                    NodeId                           parent = invalidNodeId);
+        /**
+         * \brief Returns nodes, which world matrices have been recalculated by the last updateWorldTransforms().
+         *
+         * The span is valid till the next updateWorldTransforms().
+         */
+        std::span<const NodeId>             getChangedNodes() const noexcept;
+        /**
+         * \brief Returns the local transformation of the node.
+         *
+         * \throw std::out_of_range, if the node doesn't exist.
+         */
+        const ogls::mathCore::Transform&    getLocalTransform(NodeId node) const;
+        /**
+         * \brief Returns a number of nodes in the graph.
+         */
+        size_t                              getNodesCount() const noexcept;
+        /**
+         * \brief Returns the parent of the node or invalidNodeId for the root node.
+         *
+         * \throw std::out_of_range, if the node doesn't exist.
+         */
+        NodeId                              getParent(NodeId node) const;
+        /**
+         * \brief Returns the world matrix of the node, which was calculated by the last updateWorldTransforms().
+         *
+         * \throw std::out_of_range, if the node doesn't exist.
+         */
+        const ogls::mathCore::Mat4&         getWorldMatrix(NodeId node) const;
+        /**
+         * \brief Checks whether there are dirty nodes, which world matrices will be recalculated by the next
+         * updateWorldTransforms().
+         */
+        bool                                hasPendingUpdates() const noexcept;
+        /**
+         * \brief Checks if the node exists in the graph.
+         */
+        bool                                isNodeExist(NodeId node) const noexcept;
+        /**
+         * \brief Removes the node and all its descendants.
+         *
+         * \throw std::out_of_range, if the node doesn't exist.
+         */
+        void                                removeNode(NodeId node);
+        /**
+         * \brief Sets new local transformation of the node and marks it dirty.
+         *
+         * The world matrices of the node and its descendants are recalculated by the next updateWorldTransforms().
+         *
+         * \throw std::out_of_range, if the node doesn't exist.
+         */
+        void                                setLocalTransform(NodeId node, const ogls::mathCore::Transform& transform);
+        /**
+         * \brief Recalculates world matrices of dirty nodes and their descendants.
+         *
+         * Every dirty tree is processed by one linear pass over its contiguous range. If the pool is passed,
+         * different trees are processed in parallel.
+         *
+         * \param pool - the pool to process different trees in parallel or nullptr to process them sequentially.
+         * \return a number of recalculated world matrices.
+         */
+        size_t                              updateWorldTransforms(ogls::helpers::ThreadPool* pool = nullptr);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class SceneGraph
+
+}  // namespace app::renderer
+
+#endif
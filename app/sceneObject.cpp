@@ -2,21 +2,24 @@
 
 namespace app::renderer
 {
-SceneObject::SceneObject(std::shared_ptr<ogls::oglCore::vertex::VertexArray>   vao,
-                         std::shared_ptr<ogls::oglCore::shader::ShaderProgram> shaderProgram) :
-    m_vao{std::move(vao)},
-    m_shaderProgram{std::move(shaderProgram)}
+SceneObject::SceneObject(EntityStore& entityStore, Entity entity) noexcept :
+    m_entity{entity}, m_entityStore{&entityStore}
 {
 }
 
-void SceneObject::setTexturesConfiguration(ogls::oglCore::texture::TexturesConfiguration texturesConfiguration)
+Entity SceneObject::getEntity() const noexcept
 {
-    m_texturesConfiguration = std::move(texturesConfiguration);
+    return m_entity;
 }
 
-void SceneObject::applyTexturesConfiguration()
+SceneGraph::NodeId SceneObject::getSceneNode() const
 {
-    ogls::oglCore::texture::applyTexturesConfiguration(m_texturesConfiguration);
+    return m_entityStore->getSceneNode(m_entity);
+}
+
+void SceneObject::invalidate() noexcept
+{
+    m_entityStore->markChanged();
 }
 
 }  // namespace app::renderer
@@ -1,67 +1,60 @@
 #ifndef APP_RENDERER_SCENE_OBJECT_H
 #define APP_RENDERER_SCENE_OBJECT_H
 
-#include <memory>
-#include <vector>
-
+#include "entityStore.h"
 #include "helpers/macros.h"
-#include "shaderProgram.h"
-#include "textureUnit.h"
-#include "vertexArray.h"
+#include "sceneGraph.h"
 
 namespace app::renderer
 {
 /**
- * \brief SceneObject is a base abstract class for all classes, which represents something, what can be rendered.
+ * \brief SceneObject is a base class for controllers of entities, which need some per-object logic.
+ *
+ * SceneObject doesn't render anything: the data of the entity is stored in EntityStore and is drawn together with
+ * all other entities via DrawPacket -s. Derived classes only change the data of their entity.
  */
 class SceneObject
 {
     public:
-        SceneObject() = default;
+        SceneObject() = delete;
         OGLS_DEFAULT_COPYABLE_MOVABLE(SceneObject)
         /**
-         * \brief Constructs new SceneObject using a vertex array object and a shader program.
+         * \brief Constructs new SceneObject, which controls the entity.
          *
-         * \param vao           - a vertex array object, which contains necessary vertex configuration.
-         * \param shaderProgram - a shader program, which is used for rendering.
+         * \param entityStore - the store, which contains the entity.
+         * \param entity      - the controlled entity.
          */
-        SceneObject(std::shared_ptr<ogls::oglCore::vertex::VertexArray>   vao,
-                    std::shared_ptr<ogls::oglCore::shader::ShaderProgram> shaderProgram);
-        virtual ~SceneObject() noexcept = default;
+        SceneObject(EntityStore& entityStore, Entity entity) noexcept;
+        ~SceneObject() noexcept = default;
 
         /**
-         * \brief Sets a configuration of texture units, which is used for rendering of the object.
-         *
-         * \param texturesConfiguration - a configuration of texture units.
+         * \brief Returns the controlled entity.
          */
-        virtual void setTexturesConfiguration(ogls::oglCore::texture::TexturesConfiguration texturesConfiguration);
-
+        Entity             getEntity() const noexcept;
         /**
-         * \brief Renders something on the scene.
+         * \brief Returns the node of the scene graph, which holds the transformation of the object.
+         *
+         * \throw std::out_of_range, if the entity was destroyed.
          */
-        virtual void render() = 0;
+        SceneGraph::NodeId getSceneNode() const;
 
     protected:
         /**
-         * \brief Applies set textures configuration to be used while the following rendering.
+         * \brief Requests the redraw of the object in the render-on-demand mode.
          *
-         * See ogls::oglCore::texture::applyTexturesConfiguration().
+         * Derived classes must call it after changes, which aren't made through EntityStore or SceneGraph.
          */
-        void applyTexturesConfiguration();
+        void invalidate() noexcept;
 
     protected:
         /**
-         * \brief Shader program, which is used to render this object.
-         */
-        std::shared_ptr<ogls::oglCore::shader::ShaderProgram> m_shaderProgram = nullptr;
-        /**
-         * \brief Configuration of texture units, which is used to render this object.
+         * \brief The controlled entity.
          */
-        ogls::oglCore::texture::TexturesConfiguration         m_texturesConfiguration;
+        Entity       m_entity;
         /**
-         * \brief Vertex array object, which is used to render this object.
+         * \brief The store, which contains the entity.
          */
-        std::shared_ptr<ogls::oglCore::vertex::VertexArray>   m_vao = nullptr;
+        EntityStore* m_entityStore = nullptr;
 
 };  // SceneObject
 
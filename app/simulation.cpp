@@ -0,0 +1,240 @@
+#include "simulation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+
+#include "helpers/floats.h"
+#include "helpers/tripleBuffer.h"
+
+namespace app
+{
+namespace
+{
+    /**
+     * \brief The change of the color coefficient per second.
+     */
+    constexpr auto colorSpeed    = float{0.75f};
+    /**
+     * \brief The maximal lag of the simulation thread, after which missed ticks aren't caught up, but skipped.
+     */
+    constexpr auto maxLagTicks   = int{8};
+    /**
+     * \brief The rotation of the rectangle in degrees per second.
+     */
+    constexpr auto rotationSpeed = float{30.0f};
+
+    /**
+     * \brief Snapshot is the result of one tick, which is passed from the simulation thread to the render thread.
+     */
+    struct Snapshot final
+    {
+            SimulationState               current;
+            Simulation::Clock::time_point currentTime;
+            SimulationState               previous;
+            uint64_t                      tick = {0};
+
+    };  // struct Snapshot
+
+    bool                        isEqual(const ogls::mathCore::Vec3& v1, const ogls::mathCore::Vec3& v2) noexcept;
+    SimulationState             interpolate(const SimulationState& from, const SimulationState& to,
+                                            float alpha) noexcept;
+    float                       lerp(float from, float to, float alpha) noexcept;
+    /**
+     * \brief Converts the tick rate into the duration of the tick.
+     *
+     * \throw std::invalid_argument, if the tick rate isn't positive or the tick is shorter than the clock period.
+     */
+    Simulation::Clock::duration toTickDuration(float tickRate);
+
+}  // namespace
+
+class Simulation::Impl
+{
+    public:
+        explicit Impl(float tickRate) :
+            tickDuration{toTickDuration(tickRate)},
+            tickSeconds{std::chrono::duration<float>{tickDuration}.count()}
+        {
+            // The thread is the last member, so it is stopped before the rest of members are destroyed
+            thread = std::jthread{[this](std::stop_token stopToken) { run(stopToken); }};
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Simulates ticks at their moments till the stop is requested.
+         */
+        void run(const std::stop_token& stopToken)
+        {
+            auto state    = SimulationState{};
+            auto nextTick = Clock::now();
+
+            while (!stopToken.stop_requested())
+            {
+                std::this_thread::sleep_until(nextTick);
+
+                auto& snapshot       = snapshots.getWriteValue();
+                snapshot.previous    = state;
+                step(state);
+                snapshot.current     = state;
+                snapshot.currentTime = nextTick;
+                snapshot.tick        = ticksCount.fetch_add(1, std::memory_order_relaxed) + 1;
+                snapshots.publish();
+
+                // After the long suspension of the thread missed ticks are skipped instead of being simulated
+                // without pauses, because the render thread can't interpolate across the burst of ticks anyway
+                nextTick += tickDuration;
+                if (const auto now = Clock::now(); now - nextTick > tickDuration * maxLagTicks)
+                {
+                    nextTick = now;
+                }
+            }
+        }
+
+        /**
+         * \brief Advances the state by one tick.
+         */
+        void step(SimulationState& state) noexcept
+        {
+            state.colorCoefficient += colorDirection * colorSpeed * tickSeconds;
+            if (state.colorCoefficient >= 1.0f || state.colorCoefficient <= 0.0f)
+            {
+                state.colorCoefficient = std::clamp(state.colorCoefficient, 0.0f, 1.0f);
+                colorDirection         = -colorDirection;
+            }
+
+            auto& angle = state.rectangleTransform.rotationAngle;
+            angle       = std::fmod(angle + rotationSpeed * tickSeconds, 360.0f);
+        }
+
+    public:
+        /**
+         * \brief The direction of the change of the color coefficient. It is used only by the simulation thread.
+         */
+        float                                 colorDirection = {1.0f};
+        ogls::helpers::TripleBuffer<Snapshot> snapshots;
+        const Clock::duration                 tickDuration;
+        const float                           tickSeconds;
+        std::atomic<uint64_t>                 ticksCount = {0};
+        std::jthread                          thread;
+
+};  // class Simulation::Impl
+
+Simulation::Simulation(float tickRate) : m_impl{std::make_unique<Impl>(tickRate)}
+{
+}
+
+Simulation::Simulation(Simulation&& obj) noexcept = default;
+
+Simulation::~Simulation() noexcept = default;
+
+Simulation& Simulation::operator=(Simulation&& obj) noexcept = default;
+
+SimulationState Simulation::getInterpolatedState(Clock::time_point time)
+{
+    auto& impl = *m_impl;
+
+    impl.snapshots.acquireLatest();
+    const auto& snapshot = impl.snapshots.getReadValue();
+    if (snapshot.tick == 0)
+    {
+        return snapshot.current;
+    }
+
+    // The moment one tick before the passed one lies between the previous and the current ticks of the snapshot
+    const auto elapsed = std::chrono::duration<float>{time - snapshot.currentTime}.count();
+    return interpolate(snapshot.previous, snapshot.current, std::clamp(elapsed / impl.tickSeconds, 0.0f, 1.0f));
+}
+
+Simulation::Clock::duration Simulation::getTickDuration() const noexcept
+{
+    return m_impl->tickDuration;
+}
+
+uint64_t Simulation::getTicksCount() const noexcept
+{
+    return m_impl->ticksCount.load(std::memory_order_relaxed);
+}
+
+bool operator==(const SimulationState& s1, const SimulationState& s2) noexcept
+{
+    using ogls::helpers::isFloatsEqual;
+
+
+    return isFloatsEqual(s1.colorCoefficient, s2.colorCoefficient)
+        && isTransformsEqual(s1.rectangleTransform, s2.rectangleTransform);
+}
+
+bool isTransformsEqual(const ogls::mathCore::Transform& t1, const ogls::mathCore::Transform& t2) noexcept
+{
+    using ogls::helpers::isFloatsEqual;
+
+
+    return isFloatsEqual(t1.rotationAngle, t2.rotationAngle) && isEqual(t1.rotationAxis, t2.rotationAxis)
+        && isEqual(t1.scale, t2.scale) && isEqual(t1.translation, t2.translation);
+}
+
+namespace
+{
+    bool isEqual(const ogls::mathCore::Vec3& v1, const ogls::mathCore::Vec3& v2) noexcept
+    {
+        using ogls::helpers::isFloatsEqual;
+
+
+        return isFloatsEqual(v1.x(), v2.x()) && isFloatsEqual(v1.y(), v2.y()) && isFloatsEqual(v1.z(), v2.z());
+    }
+
+    SimulationState interpolate(const SimulationState& from, const SimulationState& to, float alpha) noexcept
+    {
+        const auto& fromTransform = from.rectangleTransform;
+        const auto& toTransform   = to.rectangleTransform;
+
+        // The angle is wrapped into [0, 360), so it is interpolated along the shortest arc
+        auto angleDelta = toTransform.rotationAngle - fromTransform.rotationAngle;
+        if (angleDelta > 180.0f)
+        {
+            angleDelta -= 360.0f;
+        }
+        else if (angleDelta < -180.0f)
+        {
+            angleDelta += 360.0f;
+        }
+
+        auto  result            = to;
+        auto& transform         = result.rectangleTransform;
+        result.colorCoefficient = lerp(from.colorCoefficient, to.colorCoefficient, alpha);
+        transform.rotationAngle = fromTransform.rotationAngle + angleDelta * alpha;
+        transform.scale         = fromTransform.scale + (toTransform.scale - fromTransform.scale) * alpha;
+        transform.translation =
+          fromTransform.translation + (toTransform.translation - fromTransform.translation) * alpha;
+        return result;
+    }
+
+    float lerp(float from, float to, float alpha) noexcept
+    {
+        return from + (to - from) * alpha;
+    }
+
+    Simulation::Clock::duration toTickDuration(float tickRate)
+    {
+        using namespace std::chrono;
+
+
+        const auto tickDuration = tickRate > 0.0f && std::isfinite(tickRate)
+                                  ? duration_cast<Simulation::Clock::duration>(duration<double>{1.0 / tickRate})
+                                  : Simulation::Clock::duration::zero();
+        if (tickDuration <= Simulation::Clock::duration::zero())
+        {
+            throw std::invalid_argument{"The tick rate of the simulation must be positive."};
+        }
+        return tickDuration;
+    }
+
+}  // namespace
+
+}  // namespace app
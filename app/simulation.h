@@ -0,0 +1,116 @@
+#ifndef APP_SIMULATION_H
+#define APP_SIMULATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "helpers/macros.h"
+#include "mathCore/transform.h"
+
+namespace app
+{
+/**
+ * \brief SimulationState is the state of the demo scene, which is advanced by Simulation and is drawn by Renderer.
+ */
+struct SimulationState final
+{
+        /**
+         * \brief The color coefficient of the rectangle and the quads strip in the range [0, 1].
+         */
+        float                     colorCoefficient = {0.0f};
+        /**
+         * \brief The local transformation of the rectangle.
+         */
+        ogls::mathCore::Transform rectangleTransform;
+
+};  // struct SimulationState
+
+/**
+ * \brief Checks equality of two SimulationState.
+ *
+ * \return true if all values of states are equal within the precision of floats, false otherwise.
+ */
+bool operator==(const SimulationState& s1, const SimulationState& s2) noexcept;
+/**
+ * \brief Checks equality of two transformations within the precision of floats.
+ */
+bool isTransformsEqual(const ogls::mathCore::Transform& t1, const ogls::mathCore::Transform& t2) noexcept;
+
+/**
+ * \brief Simulation advances SimulationState by ticks of the fixed duration on its own thread.
+ *
+ * Ticks are scheduled at absolute moments, so the simulation doesn't drift and doesn't depend on the frame rate:
+ * slow frames don't slow it down and fast frames don't speed it up. After every tick the thread publishes
+ * the snapshot with states of the previous and the current ticks into the lock-free triple buffer, so the render
+ * thread never waits for the simulation thread and vice versa.
+ *
+ * getInterpolatedState() returns the state one tick in the past, interpolated between two last ticks, so motion is
+ * smooth at any frame rate at the cost of one tick of latency.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * auto simulation = Simulation{};
+ * while (!window.shouldClose())
+ * {
+ *     renderer.render(simulation.getInterpolatedState(Simulation::Clock::now()));
+ *     window.swapBuffers();
+ * }
+ * \endcode
+ */
+class Simulation final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of Simulation.
+         */
+        class Impl;
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * \brief Constructs new Simulation and starts its thread.
+         *
+         * \param tickRate - a number of ticks per second.
+         * \throw std::invalid_argument, if the tick rate isn't positive.
+         */
+        explicit Simulation(float tickRate = {60.0f});
+        OGLS_NOT_COPYABLE(Simulation)
+        Simulation(Simulation&& obj) noexcept;
+        /**
+         * \brief Stops the thread of the simulation and waits for its completion.
+         */
+        ~Simulation() noexcept;
+
+        Simulation& operator=(Simulation&& obj) noexcept;
+
+        /**
+         * \brief Returns the state of the scene at the moment one tick before the passed one.
+         *
+         * It must be called only by one (render) thread.
+         *
+         * \param time - the current moment.
+         * \return the state, interpolated between two last ticks.
+         */
+        SimulationState getInterpolatedState(Clock::time_point time);
+        /**
+         * \brief Returns the duration of one tick.
+         */
+        Clock::duration getTickDuration() const noexcept;
+        /**
+         * \brief Returns a number of ticks, which have been simulated.
+         */
+        uint64_t        getTicksCount() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class Simulation
+
+}  // namespace app
+
+#endif
@@ -0,0 +1,136 @@
+#include "skinningPalettes.h"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "buffer.h"
+#include "generalTypes.h"
+#include "vertexBufferLayout.h"
+
+namespace app::renderer
+{
+namespace
+{
+    static_assert(sizeof(SkinnedVertex) == 8 * sizeof(float) + sizeof(ogls::animation::SkinningInfluences));
+
+}  // namespace
+
+class SkinningPalettes::Impl
+{
+    public:
+        explicit Impl(uint32_t maxMatricesCount) : capacity{maxMatricesCount}
+        {
+            using namespace ogls;
+            using namespace ogls::oglCore::vertex;
+
+
+            if (capacity == 0)
+            {
+                throw std::invalid_argument{"The capacity of skinning palettes must be greater than 0."};
+            }
+
+            // Slices point into matrices, so they are never reallocated
+            matrices.reserve(capacity);
+            palettesBuffer = std::make_unique<Buffer>(
+              BufferTarget::ShaderStorageBuffer,
+              ArrayData{nullptr, size_t{capacity} * sizeof(animation::JointMatrix)}, BufferDataUsage::StreamDraw);
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        const uint32_t                                 capacity;
+        std::vector<ogls::animation::JointMatrix>      matrices;
+        std::unique_ptr<ogls::oglCore::vertex::Buffer> palettesBuffer;
+
+};  // class SkinningPalettes::Impl
+
+SkinningPalettes::SkinningPalettes(uint32_t capacity) : m_impl{std::make_unique<Impl>(capacity)}
+{
+}
+
+SkinningPalettes::SkinningPalettes(SkinningPalettes&& obj) noexcept = default;
+
+SkinningPalettes::~SkinningPalettes() noexcept = default;
+
+SkinningPalettes& SkinningPalettes::operator=(SkinningPalettes&& obj) noexcept = default;
+
+void SkinningPalettes::bind() const
+{
+    m_impl->palettesBuffer->bindBase(ogls::oglCore::vertex::BufferTarget::ShaderStorageBuffer, palettesBinding);
+}
+
+void SkinningPalettes::clear() noexcept
+{
+    m_impl->matrices.clear();
+}
+
+uint32_t SkinningPalettes::getMatricesCount() const noexcept
+{
+    return static_cast<uint32_t>(m_impl->matrices.size());
+}
+
+PaletteSlice SkinningPalettes::reserve(size_t jointsCount)
+{
+    auto& impl = *m_impl;
+
+    const auto offset = impl.matrices.size();
+    if (jointsCount > impl.capacity - offset)
+    {
+        throw std::length_error{"Skinning palettes don't fit into the capacity."};
+    }
+
+    impl.matrices.resize(offset + jointsCount);
+    return PaletteSlice{.matrices{impl.matrices.data() + offset, jointsCount}, .offset{static_cast<uint32_t>(offset)}};
+}
+
+void SkinningPalettes::upload()
+{
+    using namespace ogls;
+
+
+    auto& impl = *m_impl;
+
+    if (!impl.matrices.empty())
+    {
+        // Palettes of the previous frame can still be read, so the driver gives new memory instead of waiting
+        impl.palettesBuffer->invalidateData();
+        impl.palettesBuffer->setSubData(
+          0, ArrayData{impl.matrices.data(), impl.matrices.size() * sizeof(animation::JointMatrix)});
+    }
+    bind();
+}
+
+std::shared_ptr<ogls::oglCore::vertex::Buffer> makeSkinnedVertexBuffer(std::span<const SkinnedVertex> vertices)
+{
+    using namespace ogls;
+    using namespace ogls::oglCore::vertex;
+
+
+    const auto attributes = std::array{
+      VertexAttribute{.byteOffset{static_cast<int>(offsetof(SkinnedVertex, position))}, .count{3}, .index{0},
+                      .normalized{false}, .type{VertexAttrType::Float}},
+      VertexAttribute{.byteOffset{static_cast<int>(offsetof(SkinnedVertex, normal))}, .count{3}, .index{1},
+                      .normalized{false}, .type{VertexAttrType::Float}},
+      VertexAttribute{.byteOffset{static_cast<int>(offsetof(SkinnedVertex, texCoord))}, .count{2}, .index{2},
+                      .normalized{false}, .type{VertexAttrType::Float}},
+      VertexAttribute{.byteOffset{static_cast<int>(offsetof(SkinnedVertex, influences.joints))}, .count{4},
+                      .index{3}, .normalized{false}, .type{VertexAttrType::UnsignedByte}},
+      VertexAttribute{.byteOffset{static_cast<int>(offsetof(SkinnedVertex, influences.weights))}, .count{4},
+                      .index{4}, .normalized{true}, .type{VertexAttrType::UnsignedByte}}
+    };
+
+    auto layout = VertexBufferLayout{};
+    for (const auto& attribute : attributes)
+    {
+        layout.addVertexAttribute(attribute);
+    }
+
+    return std::make_shared<Buffer>(BufferTarget::ArrayBuffer, ArrayData{vertices.data(), vertices.size_bytes()},
+                                    BufferDataUsage::StaticDraw, layout);
+}
+
+}  // namespace app::renderer
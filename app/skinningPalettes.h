@@ -0,0 +1,141 @@
+#ifndef APP_RENDERER_SKINNING_PALETTES_H
+#define APP_RENDERER_SKINNING_PALETTES_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <glad/glad.h>
+
+#include "buffer.h"
+#include "helpers/macros.h"
+#include "skeleton.h"
+
+namespace app::renderer
+{
+/**
+ * \brief SkinnedVertex is the vertex of the skinned mesh. Joints and weights are packed into 8 bytes.
+ */
+struct SkinnedVertex final
+{
+        std::array<float, 3>                position;
+        std::array<float, 3>                normal;
+        std::array<float, 2>                texCoord;
+        ogls::animation::SkinningInfluences influences;
+
+};  // struct SkinnedVertex
+
+/**
+ * \brief PaletteSlice is the part of SkinningPalettes, which is reserved for the palette of one character.
+ */
+struct PaletteSlice final
+{
+        /**
+         * \brief Matrices of the palette, which are filled by ogls::animation::Skeleton::computeSkinningPalette().
+         */
+        std::span<ogls::animation::JointMatrix> matrices;
+        /**
+         * \brief The index of the first matrix in the buffer, which is the value of uPaletteOffset of the character.
+         */
+        uint32_t                                offset = {0};
+
+};  // struct PaletteSlice
+
+/**
+ * \brief SkinningPalettes batches skinning palettes of all characters of the frame and uploads them into one
+ * shader storage buffer with one call.
+ *
+ * Slices are reserved sequentially, after that palettes are calculated into them by worker threads in parallel, and
+ * the batch is uploaded before the first skinned draw. resources/shaders/vs/skinnedMesh.vert reads the palette of
+ * the character from palettesBinding at the offset of its slice.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * palettes.clear();
+ * for (auto& character : characters)
+ * {
+ *     character.palette = palettes.reserve(character.skeleton->getJointsCount());
+ * }
+ * pool.parallelFor(characters.size(), [&](size_t i) { characters[i].animate(deltaTime); });
+ * palettes.upload();
+ * \endcode
+ */
+class SkinningPalettes final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of SkinningPalettes.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The binding point of the shader storage buffer with palettes.
+         */
+        static constexpr GLuint palettesBinding = {4};
+
+        /**
+         * \brief Constructs new SkinningPalettes and creates the buffer.
+         *
+         * \param capacity - the maximal number of matrices of all palettes of the frame.
+         * \throw std::invalid_argument, if the capacity is 0,
+         * ogls::exceptions::GLRecAcquisitionException(), if the buffer can't be created.
+         */
+        explicit SkinningPalettes(uint32_t capacity);
+        OGLS_NOT_COPYABLE(SkinningPalettes)
+        SkinningPalettes(SkinningPalettes&& obj) noexcept;
+        ~SkinningPalettes() noexcept;
+
+        SkinningPalettes& operator=(SkinningPalettes&& obj) noexcept;
+
+        /**
+         * \brief Binds the buffer to palettesBinding.
+         */
+        void         bind() const;
+        /**
+         * \brief Releases all reserved slices. Their matrices mustn't be used after it.
+         */
+        void         clear() noexcept;
+        /**
+         * \brief Returns a number of reserved matrices.
+         */
+        uint32_t     getMatricesCount() const noexcept;
+        /**
+         * \brief Reserves matrices for the palette of one character.
+         *
+         * Matrices of reserved slices stay valid till clear(), so they are filled in parallel.
+         *
+         * \param jointsCount - a number of joints of the skeleton of the character.
+         * \return the reserved slice.
+         * \throw std::length_error, if matrices don't fit into the capacity.
+         */
+        PaletteSlice reserve(size_t jointsCount);
+        /**
+         * \brief Uploads all reserved palettes into the buffer by one call and binds it.
+         */
+        void         upload();
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class SkinningPalettes
+
+/**
+ * \brief Creates the vertex buffer of the skinned mesh, which can be added to the vertex array.
+ *
+ * The layout has the position, the normal and the texture coordinate at attributes 0-2, indices of joints as
+ * integers at the attribute 3 and weights as normalized bytes at the attribute 4.
+ *
+ * \param vertices - vertices of the mesh.
+ * \return the buffer with the layout of SkinnedVertex.
+ * \throw ogls::exceptions::GLRecAcquisitionException(), if the buffer can't be created.
+ */
+std::shared_ptr<ogls::oglCore::vertex::Buffer> makeSkinnedVertexBuffer(std::span<const SkinnedVertex> vertices);
+
+}  // namespace app::renderer
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef OGLS_ANIMATION_ANIMATION_CLIP_H
+#define OGLS_ANIMATION_ANIMATION_CLIP_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+#include "helpers/macros.h"
+#include "localPose.h"
+
+namespace ogls::animation
+{
+/**
+ * \brief ClipCompressionSettings are the maximal errors of the compressed clip, within which keys are removed.
+ */
+struct ClipCompressionSettings final
+{
+        /**
+         * \brief The maximal difference of components of unit quaternions.
+         */
+        float rotationTolerance    = {0.001f};
+        /**
+         * \brief The maximal difference of components of scales.
+         */
+        float scaleTolerance       = {0.0001f};
+        /**
+         * \brief The maximal difference of components of translations in units of the model.
+         */
+        float translationTolerance = {0.0001f};
+
+};  // struct ClipCompressionSettings
+
+/**
+ * \brief AnimationClip is the compressed animation of all joints of the skeleton.
+ *
+ * Every joint has 3 tracks: rotations, scales and translations. Rotations are quantized into 48 bits by
+ * the smallest three components of the quaternion. Keys of every track are fitted to the curve: the key is removed,
+ * if the linear interpolation between its neighbours restores all removed samples within the tolerance. Times of
+ * keys are 16-bit numbers of frames of the source animation.
+ *
+ * sample() finds keys of all tracks, decodes them into two poses and interpolates them in SIMD lanes.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * const auto clip = AnimationClip{skeleton.getJointsCount(), 30.0f, bakedFrames};
+ * clip.sample(std::fmod(time, clip.getDuration()), pose);
+ * skeleton.computeSkinningPalette(pose, palette);
+ * \endcode
+ */
+class AnimationClip final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of AnimationClip.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new AnimationClip by compressing the baked animation.
+         *
+         * \param jointsCount - a number of joints of the skeleton.
+         * \param sampleRate  - a number of frames of the baked animation per second.
+         * \param frames      - transformations of all joints of the 1st frame, then of the 2nd one etc.
+         * \param settings    - the precision of the compression.
+         * \throw std::invalid_argument, if there are no joints or frames, the number of transformations isn't
+         * a multiple of the number of joints, there are more than 65536 frames or the sample rate isn't positive.
+         */
+        AnimationClip(size_t jointsCount, float sampleRate, std::span<const JointTransform> frames,
+                      const ClipCompressionSettings& settings = {});
+        OGLS_NOT_COPYABLE(AnimationClip)
+        AnimationClip(AnimationClip&& obj) noexcept;
+        ~AnimationClip() noexcept;
+
+        AnimationClip& operator=(AnimationClip&& obj) noexcept;
+
+        /**
+         * \brief Returns the length of the clip in seconds.
+         */
+        float  getDuration() const noexcept;
+        /**
+         * \brief Returns a number of joints of the skeleton.
+         */
+        size_t getJointsCount() const noexcept;
+        /**
+         * \brief Returns a number of keys of all tracks after the compression.
+         */
+        size_t getKeysCount() const noexcept;
+        /**
+         * \brief Calculates the pose at the moment of the clip.
+         *
+         * It doesn't change the clip, so one clip is sampled for many characters in parallel.
+         *
+         * \param time - the moment in seconds. It is clamped to the clip, looping is up to the caller.
+         * \param pose - the destination, which is resized to the number of joints of the clip.
+         */
+        void   sample(float time, LocalPose& pose) const;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class AnimationClip
+
+}  // namespace ogls::animation
+
+#endif
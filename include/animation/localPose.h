@@ -0,0 +1,136 @@
+#ifndef OGLS_ANIMATION_LOCAL_POSE_H
+#define OGLS_ANIMATION_LOCAL_POSE_H
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "helpers/macros.h"
+
+/**
+ * \namespace ogls::animation
+ * \brief animation namespace contains types and functions of the skeletal animation: compressed clips, sampling
+ * and blending of poses and composition of skinning palettes.
+ */
+namespace ogls::animation
+{
+/**
+ * \brief JointTransform is the transformation of the joint relative to its parent: scale, then rotation, then
+ * translation.
+ */
+struct JointTransform final
+{
+        /**
+         * \brief The unit quaternion (x, y, z, w).
+         */
+        std::array<float, 4> rotation    = {0.0f, 0.0f, 0.0f, 1.0f};
+        std::array<float, 3> scale       = {1.0f, 1.0f, 1.0f};
+        std::array<float, 3> translation = {0.0f, 0.0f, 0.0f};
+
+};  // struct JointTransform
+
+/**
+ * \brief PoseChannel is the index of one component of transformations of all joints in LocalPose.
+ */
+enum class PoseChannel : size_t
+{
+    RotationX,
+    RotationY,
+    RotationZ,
+    RotationW,
+    ScaleX,
+    ScaleY,
+    ScaleZ,
+    TranslationX,
+    TranslationY,
+    TranslationZ
+};
+
+/**
+ * \brief LocalPose is the set of transformations of joints relative to their parents.
+ *
+ * Transformations are stored as the structure of arrays: every PoseChannel is the separate array of all joints,
+ * so sampling, blending and conversion into matrices process SIMD lanes of neighbour joints. Arrays are padded
+ * to jointsAlignment with identity transformations, so kernels of any SIMD width read only whole lanes.
+ */
+class LocalPose final
+{
+    public:
+        /**
+         * \brief A number of PoseChannel -s.
+         */
+        static constexpr size_t channelsCount   = {10};
+        /**
+         * \brief Arrays of channels have the size, which is a multiple of it.
+         */
+        static constexpr size_t jointsAlignment = {8};
+
+        /**
+         * \brief Constructs new LocalPose, in which all joints have identity transformations.
+         *
+         * \param jointsCount - a number of joints.
+         */
+        explicit LocalPose(size_t jointsCount = {0});
+        OGLS_DEFAULT_COPYABLE_MOVABLE(LocalPose)
+        ~LocalPose() noexcept = default;
+
+        /**
+         * \brief Returns the array of the channel of all joints. Its size is getPaddedJointsCount().
+         */
+        const float*   getChannel(PoseChannel channel) const noexcept;
+        /**
+         * \brief Returns the array of the channel of all joints. Its size is getPaddedJointsCount().
+         */
+        float*         getChannel(PoseChannel channel) noexcept;
+        /**
+         * \brief Returns the transformation of the joint.
+         *
+         * \throw std::out_of_range, if there is no such joint.
+         */
+        JointTransform getJoint(size_t joint) const;
+        /**
+         * \brief Returns a number of joints.
+         */
+        size_t         getJointsCount() const noexcept;
+        /**
+         * \brief Returns the size of arrays of channels: a number of joints rounded up to jointsAlignment.
+         */
+        size_t         getPaddedJointsCount() const noexcept;
+        /**
+         * \brief Changes a number of joints. New joints get identity transformations.
+         */
+        void           resize(size_t jointsCount);
+        /**
+         * \brief Sets the transformation of the joint.
+         *
+         * \throw std::out_of_range, if there is no such joint.
+         */
+        void           setJoint(size_t joint, const JointTransform& transform);
+
+    private:
+        /**
+         * \brief Arrays of components of transformations in the order of PoseChannel.
+         */
+        std::array<std::vector<float>, channelsCount> m_channels;
+        size_t                                        m_jointsCount = {0};
+
+};  // class LocalPose
+
+/**
+ * \brief Blends poses with weights: rotations by normalized weighted sum of quaternions in the hemisphere of
+ * the first pose, scales and translations by weighted average.
+ *
+ * Joints are processed in SIMD lanes, so poses of many characters are blended with several instructions per joint.
+ *
+ * \param poses   - poses with the same number of joints. The result can be one of them.
+ * \param weights - weights of poses. They needn't be normalized.
+ * \param result  - the destination, which is resized to the number of joints of poses.
+ * \throw std::invalid_argument, if there are no poses, numbers of poses and weights differ, poses have different
+ * numbers of joints or the sum of weights isn't positive.
+ */
+void blendPoses(std::span<const LocalPose* const> poses, std::span<const float> weights, LocalPose& result);
+
+}  // namespace ogls::animation
+
+#endif
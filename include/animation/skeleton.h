@@ -0,0 +1,115 @@
+#ifndef OGLS_ANIMATION_SKELETON_H
+#define OGLS_ANIMATION_SKELETON_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "localPose.h"
+
+namespace ogls::animation
+{
+/**
+ * \brief JointMatrix is the 4x4 matrix of the joint for column vectors in the column-major order of mat4 in GLSL
+ * (the same as ogls::mathCore::toGpuMatrix() returns), so the palette of them is uploaded to shaders as it is.
+ *
+ * Mat4 isn't used, because it also stores its dimensions, and the palette must be the contiguous array of floats.
+ */
+using JointMatrix = std::array<float, 16>;
+
+/**
+ * \brief SkinningInfluences are joints, which move the vertex, packed into 8 bytes of vertex attributes.
+ */
+struct SkinningInfluences final
+{
+        /**
+         * \brief Indices of joints in the skeleton.
+         */
+        std::array<uint8_t, 4> joints  = {0};
+        /**
+         * \brief Weights of joints normalized to 255, so they are read by shaders as normalized unsigned bytes.
+         * Their sum is exactly 255.
+         */
+        std::array<uint8_t, 4> weights = {255, 0, 0, 0};
+
+};  // struct SkinningInfluences
+
+/**
+ * \brief Skeleton is the hierarchy of joints and their bind pose.
+ *
+ * Every parent precedes its children, so transformations of joints relative to the model are composed in one
+ * pass over contiguous arrays without recursion.
+ */
+class Skeleton final
+{
+    public:
+        /**
+         * \brief The index of the parent of root joints.
+         */
+        static constexpr int32_t noParent = {-1};
+
+        /**
+         * \brief Constructs new Skeleton and calculates inverse bind matrices of joints.
+         *
+         * \param parents  - indices of parents of joints or noParent.
+         * \param bindPose - transformations of joints relative to their parents, in which the mesh is modelled.
+         * \throw std::invalid_argument, if there are no joints or more than 256 of them, numbers of parents and
+         * transformations differ, or any parent doesn't precede its child.
+         */
+        Skeleton(std::vector<int32_t> parents, std::span<const JointTransform> bindPose);
+        OGLS_DEFAULT_COPYABLE_MOVABLE(Skeleton)
+        ~Skeleton() noexcept = default;
+
+        /**
+         * \brief Calculates the skinning palette: transformations of joints from the bind pose into the pose
+         * relative to the model.
+         *
+         * It doesn't change the skeleton, so palettes of many characters are calculated in parallel.
+         *
+         * \param pose    - the pose with the same number of joints as the skeleton.
+         * \param palette - the destination with the size of at least the number of joints.
+         * \throw std::invalid_argument, if sizes of the pose or the palette don't match the skeleton.
+         */
+        void                        computeSkinningPalette(const LocalPose&       pose,
+                                                           std::span<JointMatrix> palette) const;
+        /**
+         * \brief Returns the bind pose, which can be the fallback pose of the character.
+         */
+        const LocalPose&            getBindPose() const noexcept;
+        /**
+         * \brief Returns a number of joints.
+         */
+        size_t                      getJointsCount() const noexcept;
+        /**
+         * \brief Returns indices of parents of joints.
+         */
+        const std::vector<int32_t>& getParents() const noexcept;
+
+    private:
+        /**
+         * \brief The bind pose relative to parents.
+         */
+        LocalPose                          m_bindPose;
+        /**
+         * \brief Inverse transformations of joints in the bind pose relative to the model: 3 rows of the affine
+         * matrix in the notation of column vectors.
+         */
+        std::vector<std::array<float, 12>> m_inverseBindMatrices;
+        std::vector<int32_t>               m_parents;
+
+};  // class Skeleton
+
+/**
+ * \brief Packs up to 4 joints with the greatest weights into vertex attributes.
+ *
+ * \param joints  - indices of joints, which move the vertex.
+ * \param weights - weights of joints. They needn't be normalized.
+ * \return packed influences. The vertex without positive weights is bound to the joint 0.
+ * \throw std::invalid_argument, if numbers of joints and weights differ or any joint index doesn't fit into a byte.
+ */
+SkinningInfluences packInfluences(std::span<const uint32_t> joints, std::span<const float> weights);
+
+}  // namespace ogls::animation
+
+#endif
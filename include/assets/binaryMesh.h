@@ -0,0 +1,144 @@
+#ifndef OGLS_ASSETS_BINARY_MESH_H
+#define OGLS_ASSETS_BINARY_MESH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "assets/meshData.h"
+#include "helpers/macros.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief BinaryMeshHeader is the header at the beginning of the engine-native mesh file (*.oglmesh).
+ *
+ * The layout of the file is:
+ * header | attributes | levels of detail | aligned vertices | aligned indices.
+ * Vertices and indices are stored exactly as they are uploaded into buffers, so the file is used without parsing.
+ * All values are little-endian.
+ */
+struct BinaryMeshHeader final
+{
+        /**
+         * \brief The signature of the mesh file.
+         */
+        std::array<char, 4>  magic             = {'O', 'G', 'L', 'M'};
+        /**
+         * \brief The version of the mesh format.
+         */
+        uint32_t             version           = {2};
+        /**
+         * \brief A number of BinaryMeshAttribute records after the header.
+         */
+        uint32_t             attributesCount   = {0};
+        /**
+         * \brief A number of GLuint indices.
+         */
+        uint32_t             indicesCount      = {0};
+        /**
+         * \brief A number of MeshLod records after attributes.
+         */
+        uint32_t             lodsCount         = {0};
+        /**
+         * \brief Zero bytes, which align the following fields.
+         */
+        uint32_t             reserved          = {0};
+        /**
+         * \brief The offset of indices from the beginning of the file. It is a multiple of binaryMeshDataAlignment.
+         */
+        uint64_t             indicesOffset     = {0};
+        /**
+         * \brief The offset of vertices from the beginning of the file. It is a multiple of binaryMeshDataAlignment.
+         */
+        uint64_t             verticesOffset    = {0};
+        /**
+         * \brief A number of GLfloat values of vertices.
+         */
+        uint64_t             verticesCount     = {0};
+        /**
+         * \brief The center of the bounding box.
+         */
+        std::array<float, 3> boundsCenter      = {};
+        /**
+         * \brief Half sizes of the bounding box.
+         */
+        std::array<float, 3> boundsHalfExtents = {};
+
+};  // struct BinaryMeshHeader
+
+/**
+ * \brief BinaryMeshAttribute is the stored form of ogls::oglCore::vertex::VertexAttribute, which doesn't depend
+ * on the compiler.
+ */
+struct BinaryMeshAttribute final
+{
+        int32_t  byteOffset = {0};
+        int32_t  count      = {0};
+        uint32_t index      = {0};
+        uint32_t normalized = {0};
+        uint32_t type       = {0};
+
+};  // struct BinaryMeshAttribute
+
+/**
+ * \brief The alignment of vertices and indices in the mesh file.
+ */
+constexpr auto binaryMeshDataAlignment = size_t{16};
+
+/**
+ * \brief BinaryMesh is the mesh file read through ogls::helpers::VirtualFileSystem.
+ *
+ * The file is mapped (or stored in the mapped archive), so the view points directly into the mapped memory and
+ * can be handed to buffers without any copying or parsing.
+ */
+class BinaryMesh final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of BinaryMesh.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Reads and validates the mesh file.
+         *
+         * \param pathToFile - relative to the root folder path to the mesh file.
+         * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
+         */
+        explicit BinaryMesh(const std::string& pathToFile);
+        OGLS_NOT_COPYABLE(BinaryMesh)
+        BinaryMesh(BinaryMesh&& obj) noexcept;
+        ~BinaryMesh() noexcept;
+
+        BinaryMesh& operator=(BinaryMesh&& obj) noexcept;
+
+        /**
+         * \brief Returns the view of the geometry. It is valid as long as the BinaryMesh exists.
+         */
+        const MeshDataView& getView() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class BinaryMesh
+
+/**
+ * \brief Serializes the geometry into the content of the mesh file.
+ *
+ * \param meshData - the geometry to serialize.
+ * \return the content of the mesh file.
+ * \throw std::invalid_argument, if there are too many attributes, levels of detail or indices.
+ */
+std::vector<std::byte> serializeBinaryMesh(const MeshDataView& meshData);
+
+}  // namespace ogls::assets
+
+#endif
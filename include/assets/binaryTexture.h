@@ -0,0 +1,98 @@
+#ifndef OGLS_ASSETS_BINARY_TEXTURE_H
+#define OGLS_ASSETS_BINARY_TEXTURE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "textureTypes.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief BinaryTextureHeader is the header at the beginning of the engine-native texture file (*.ogltex).
+ *
+ * The layout of the file is:
+ * header | uint64_t sizes of levels | aligned data of levels.
+ * The data of levels is stored exactly as it is uploaded into the texture (see
+ * ogls::oglCore::texture::TextureData::levelSizes), so the file is used without decoding.
+ * All values are little-endian.
+ */
+struct BinaryTextureHeader final
+{
+        /**
+         * \brief The signature of the texture file.
+         */
+        std::array<char, 4> magic          = {'O', 'G', 'L', 'T'};
+        /**
+         * \brief The version of the texture format.
+         */
+        uint32_t            version        = {1};
+        /**
+         * \brief The width in pixels of the level 0.
+         */
+        uint32_t            width          = {0};
+        /**
+         * \brief The height in pixels of the level 0.
+         */
+        uint32_t            height         = {0};
+        /**
+         * \brief The depth in pixels of the level 0.
+         */
+        uint32_t            depth          = {0};
+        /**
+         * \brief The value of ogls::oglCore::texture::TextureInternalFormat.
+         */
+        uint32_t            internalFormat = {0};
+        /**
+         * \brief The value of ogls::oglCore::texture::TexturePixelFormat.
+         */
+        uint32_t            pixelFormat    = {0};
+        /**
+         * \brief The value of ogls::oglCore::texture::TexturePixelType.
+         */
+        uint32_t            pixelType      = {0};
+        /**
+         * \brief A number of color channels of the source image.
+         */
+        uint32_t            nChannels      = {0};
+        /**
+         * \brief A number of stored mipmap levels.
+         */
+        uint32_t            levelsCount    = {0};
+        /**
+         * \brief The offset of the data of levels from the beginning of the file. It is a multiple of
+         * binaryTextureDataAlignment.
+         */
+        uint64_t            dataOffset     = {0};
+
+};  // struct BinaryTextureHeader
+
+/**
+ * \brief The alignment of the data of levels in the texture file.
+ */
+constexpr auto binaryTextureDataAlignment = size_t{16};
+
+/**
+ * \brief Reads and validates the texture file through ogls::helpers::VirtualFileSystem.
+ *
+ * \param pathToFile - relative to the root folder path to the texture file.
+ * \return the data of all stored levels. TextureData::level is a number of stored levels.
+ * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
+ */
+std::unique_ptr<oglCore::texture::TextureData> readBinaryTexture(const std::string& pathToFile);
+/**
+ * \brief Serializes the texture data into the content of the texture file.
+ *
+ * \param textureData - the data with precomputed levels (TextureData::levelSizes mustn't be empty).
+ * \return the content of the texture file.
+ * \throw std::invalid_argument, if the data doesn't specify levels.
+ */
+std::vector<std::byte>                         serializeBinaryTexture(const oglCore::texture::TextureData& textureData);
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef OGLS_ASSETS_COOKED_ASSET_H
+#define OGLS_ASSETS_COOKED_ASSET_H
+
+#include <string>
+#include <string_view>
+
+namespace ogls::assets
+{
+/**
+ * \brief AssetKind is a kind of the source asset, which defines how the asset is cooked.
+ */
+enum class AssetKind
+{
+    /**
+     * \brief *.obj, *.gltf and *.glb files cooked into *.oglmesh (see BinaryMesh).
+     */
+    Mesh,
+    /**
+     * \brief Files, which are packed as is.
+     */
+    Other,
+    /**
+     * \brief GLSL files, includes of which are resolved and which are validated.
+     */
+    Shader,
+    /**
+     * \brief Images cooked into *.ogltex (see readBinaryTexture()).
+     */
+    Texture
+};
+
+/**
+ * \brief Returns the kind of the source asset by the extension of its path.
+ */
+AssetKind   getAssetKind(std::string_view pathToSource);
+/**
+ * \brief Returns the path, by which the cooked asset is stored in the archive.
+ *
+ * Cooked meshes and textures get the extension of the engine-native format appended to the source path
+ * (e.g. "resources/textures/face.png.ogltex"), so the runtime can look for the cooked artifact first and fall back
+ * to the source file. Shaders and other files keep the source path, so they are replaced transparently.
+ *
+ * \param pathToSource - the path to the source asset.
+ * \return the path of the cooked asset.
+ */
+std::string getCookedAssetPath(std::string_view pathToSource);
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef OGLS_ASSETS_MESH_DATA_H
+#define OGLS_ASSETS_MESH_DATA_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "mathCore/boundingBox.h"
+#include "vertexBufferLayout.h"
+
+/**
+ * \namespace ogls::assets
+ * \brief assets namespace contains importers and engine-native formats of assets.
+ */
+namespace ogls::assets
+{
+/**
+ * \brief MeshLod is a level of detail of the mesh. All levels share vertices of the mesh and differ only by indices,
+ * which are stored one after another in the same index array.
+ */
+struct MeshLod final
+{
+        /**
+         * \brief The estimated deviation of the simplified surface from the original one in units of the local
+         * coordinate system. It is 0 for the full-detail level.
+         */
+        float    error         = {0.0f};
+        /**
+         * \brief A number of indices of the level.
+         */
+        uint32_t indicesCount  = {0};
+        /**
+         * \brief The offset (in indices) of the first index of the level.
+         */
+        uint32_t indicesOffset = {0};
+
+};  // struct MeshLod
+
+/**
+ * \brief MeshData is an indexed geometry in the CPU memory, from which the Mesh is created.
+ */
+struct MeshData final
+{
+        /**
+         * \brief Vertex attributes of interleaved vertices.
+         */
+        std::vector<oglCore::vertex::VertexAttribute> attributes;
+        /**
+         * \brief The bounding box of vertices.
+         */
+        mathCore::BoundingBox                         bounds;
+        /**
+         * \brief Indices of triangles of all levels of detail.
+         */
+        std::vector<GLuint>                           indices;
+        /**
+         * \brief Levels of detail from the finest one to the coarsest one. If it is empty, all indices are
+         * the only level.
+         */
+        std::vector<MeshLod>                          lods;
+        /**
+         * \brief Interleaved vertices in the format described by attributes.
+         */
+        std::vector<GLfloat>                          vertices;
+
+};  // struct MeshData
+
+/**
+ * \brief MeshDataView is a non-owning view of the indexed geometry, which is stored either in MeshData
+ * or in the mapped file (see BinaryMesh).
+ */
+struct MeshDataView final
+{
+        /**
+         * \brief Vertex attributes of interleaved vertices.
+         */
+        std::span<const oglCore::vertex::VertexAttribute> attributes;
+        /**
+         * \brief The bounding box of vertices.
+         */
+        mathCore::BoundingBox                             bounds;
+        /**
+         * \brief Indices of triangles of all levels of detail.
+         */
+        std::span<const GLuint>                           indices;
+        /**
+         * \brief Levels of detail from the finest one to the coarsest one. If it is empty, all indices are
+         * the only level.
+         */
+        std::span<const MeshLod>                          lods;
+        /**
+         * \brief Interleaved vertices in the format described by attributes.
+         */
+        std::span<const GLfloat>                          vertices;
+
+};  // struct MeshDataView
+
+/**
+ * \brief Returns the view of the mesh data. The view is valid as long as the data isn't changed or destroyed.
+ */
+MeshDataView makeMeshDataView(const MeshData& meshData) noexcept;
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef OGLS_ASSETS_MESH_IMPORTER_H
+#define OGLS_ASSETS_MESH_IMPORTER_H
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "assets/meshData.h"
+#include "helpers/threadPool.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief Imports the geometry from the glTF 2.0 asset (*.gltf or *.glb).
+ *
+ * Triangle primitives of all meshes are merged into one MeshData without applying transformations of nodes.
+ * Buffers can be embedded as base64 data URIs, stored in the binary chunk of *.glb or in external files, which
+ * are read through ogls::helpers::VirtualFileSystem. Primitives are converted in parallel on the pool.
+ * Vertices have the layout described by getImportedVertexAttributes(). Missing normals are generated.
+ *
+ * \param content       - the content of *.gltf or *.glb file.
+ * \param baseDirectory - the directory, relative to which URIs of external buffers are resolved.
+ * \param pool          - the pool to convert primitives.
+ * \return the imported geometry.
+ * \throw std::invalid_argument, if the asset is malformed or uses unsupported features (sparse accessors).
+ * Exceptions of ogls::helpers::VirtualFileSystem::readFile().
+ */
+MeshData importGltf(std::span<const std::byte> content, std::string_view baseDirectory,
+                    helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+/**
+ * \brief Imports the geometry from the Wavefront OBJ text.
+ *
+ * The text is split into chunks of lines, which are parsed in parallel on the pool with std::from_chars().
+ * Polygons are triangulated as fans. Only the geometry is imported: materials, groups and smoothing groups
+ * are ignored. Vertices have the layout described by getImportedVertexAttributes(). Missing normals are generated.
+ *
+ * \param text - the content of *.obj file.
+ * \param pool - the pool to parse chunks.
+ * \return the imported geometry.
+ * \throw std::invalid_argument, if the text is malformed or indices are out of range.
+ */
+MeshData importObj(std::string_view text, helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+/**
+ * \brief Reads the file through ogls::helpers::VirtualFileSystem and imports it by importObj() or importGltf()
+ * depending on the extension (*.obj, *.gltf, *.glb).
+ *
+ * \param pathToFile - relative to the root folder path to the file.
+ * \param pool       - the pool to parse the file.
+ * \return the imported geometry.
+ * \throw std::invalid_argument, if the extension is not supported.
+ * Exceptions of importObj(), importGltf() and ogls::helpers::VirtualFileSystem::readFile().
+ */
+MeshData importMeshFile(const std::string& pathToFile, helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+/**
+ * \brief Returns vertex attributes of imported meshes: the position (index 0, vec3), the normal (index 1, vec3)
+ * and the texture coordinates (index 2, vec2) of interleaved GLfloat vertices.
+ */
+std::span<const oglCore::vertex::VertexAttribute> getImportedVertexAttributes() noexcept;
+
+}  // namespace ogls::assets
+
+#endif
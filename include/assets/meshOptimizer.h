@@ -0,0 +1,39 @@
+#ifndef OGLS_ASSETS_MESH_OPTIMIZER_H
+#define OGLS_ASSETS_MESH_OPTIMIZER_H
+
+#include <span>
+
+#include "assets/meshData.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief Reorders triangles to improve the hit rate of the post-transform vertex cache of the GPU.
+ *
+ * It is the linear-speed vertex cache optimization by Tom Forsyth: triangles are emitted greedily by the score,
+ * which grows for vertices recently used (they are in the simulated cache) and for vertices with few remaining
+ * triangles (so they aren't left isolated).
+ *
+ * \param indices       - indices of triangles, which are reordered in place.
+ * \param verticesCount - a number of vertices, which indices refer to.
+ */
+void optimizeVertexCache(std::span<GLuint> indices, size_t verticesCount);
+/**
+ * \brief Reorders vertices in the order of the first use by indices and removes unused vertices, so the vertex
+ * fetch reads the buffer almost sequentially. Indices are remapped accordingly.
+ *
+ * \param meshData - the mesh to optimize.
+ */
+void optimizeVertexFetch(MeshData& meshData);
+/**
+ * \brief Optimizes the mesh by optimizeVertexCache() and then optimizeVertexFetch().
+ * The geometry itself isn't changed, so the result is rendered identically.
+ *
+ * \param meshData - the mesh to optimize.
+ * \throw std::invalid_argument, if indices refer to nonexistent vertices.
+ */
+void optimizeMesh(MeshData& meshData);
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef OGLS_ASSETS_MESH_SIMPLIFIER_H
+#define OGLS_ASSETS_MESH_SIMPLIFIER_H
+
+#include <span>
+#include <vector>
+
+#include "assets/meshData.h"
+#include "helpers/threadPool.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief SimplifiedIndices is the result of simplifyMesh().
+ */
+struct SimplifiedIndices final
+{
+        /**
+         * \brief The estimated deviation of the simplified surface from the original one (the root of the largest
+         * mean squared distance of the moved vertex to planes of original triangles around it).
+         */
+        float               error = {0.0f};
+        /**
+         * \brief Indices of triangles of the simplified mesh. They refer to the same vertices as the original ones.
+         */
+        std::vector<GLuint> indices;
+
+};  // struct SimplifiedIndices
+
+/**
+ * \brief MeshLodSettings describes, which levels of detail are built by buildMeshLods().
+ */
+struct MeshLodSettings final
+{
+        /**
+         * \brief The maximal number of levels including the full-detail one.
+         */
+        size_t maxLodsCount      = {5};
+        /**
+         * \brief The minimal number of triangles of the level. Coarser levels aren't built.
+         */
+        size_t minTrianglesCount = {32};
+        /**
+         * \brief The ratio of numbers of triangles of two neighbour levels.
+         */
+        float  reductionRatio    = {0.5f};
+
+};  // struct MeshLodSettings
+
+/**
+ * \brief Simplifies the mesh by the quadric error metric edge collapse.
+ *
+ * Every vertex accumulates quadrics of planes of its triangles (weighted by areas of triangles). The edge collapse
+ * moves one vertex of the edge into another one, and its cost is the quadric distance from the remaining vertex to
+ * planes of both vertices. Collapses are applied in passes from the cheapest one, vertices changed by the pass
+ * aren't changed again till the next pass. Vertices aren't moved, so the simplified mesh uses the same vertex
+ * buffer. Collapses, which flip triangles, aren't applied. Vertices of open borders move only along borders,
+ * and vertices of attribute seams (several vertices at the same position) don't move at all.
+ *
+ * \param meshData           - the mesh, which positions are stored in the attribute 0.
+ * \param indices            - indices of triangles to simplify.
+ * \param targetIndicesCount - the desired number of indices. The result can have more indices, if the mesh
+ *                             can't be simplified further.
+ * \return the simplified indices and the error of the simplification.
+ * \throw std::invalid_argument, if there is no position attribute or indices refer to nonexistent vertices.
+ */
+SimplifiedIndices simplifyMesh(const MeshDataView& meshData, std::span<const GLuint> indices,
+                               size_t targetIndicesCount);
+/**
+ * \brief Builds the chain of levels of detail of the mesh.
+ *
+ * Levels are simplified from the full-detail level independently of each other on the thread pool, so errors
+ * don't accumulate through the chain. Every level is optimized for the vertex cache. Levels, which are not
+ * simplified noticeably compared to the previous one, are dropped. Indices of all levels are stored one after
+ * another in meshData.indices.
+ *
+ * \param meshData - the mesh. If it already has levels, they are rebuilt from the first one.
+ * \param settings - settings of levels.
+ * \param pool     - the pool, on which levels are simplified. It mustn't be the pool of the calling task.
+ * \throw std::invalid_argument, if there is no position attribute or indices refer to nonexistent vertices.
+ */
+void              buildMeshLods(MeshData& meshData, const MeshLodSettings& settings = {},
+                                helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef OGLS_CULLING_DEPTH_RASTERIZER_H
+#define OGLS_CULLING_DEPTH_RASTERIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "helpers/macros.h"
+#include "helpers/threadPool.h"
+#include "mathCore/boundingBox.h"
+#include "mathCore/matrix.h"
+#include "mathCore/transformMatrix.h"
+
+/**
+ * \namespace ogls::culling
+ * \brief culling namespace contains types and functions, which reject invisible objects on the CPU before any
+ * rendering commands are issued.
+ */
+namespace ogls::culling
+{
+/**
+ * \brief Occluder is the mesh, which hides objects behind it. It is usually a simplified version of the big
+ * object (walls, floors, buildings).
+ *
+ * Occluder doesn't own its data, which must be alive during DepthRasterizer::renderOccluders().
+ */
+struct Occluder final
+{
+        /**
+         * \brief Indices of triangles. They must refer to existing vertices.
+         */
+        std::span<const uint32_t> indices;
+        /**
+         * \brief Specification whether both sides of triangles hide objects. Otherwise triangles, which are seen
+         * from the back (clockwise on the screen), are skipped.
+         */
+        bool                      isDoubleSided = false;
+        /**
+         * \brief Positions of vertices in the local coordinate system. Every vertex starts with x, y, z.
+         */
+        std::span<const float>    positions;
+        /**
+         * \brief A number of floats between beginnings of two vertices in positions.
+         */
+        size_t                    stride        = {3};
+        /**
+         * \brief The world matrix of the occluder in the format of the selected graphical API.
+         */
+        mathCore::Mat4            worldMatrix   = mathCore::TransformMatrix{}.getResultMatrix();
+
+};  // struct Occluder
+
+/**
+ * \brief DepthRasterizer is the low-resolution software depth rasterizer, which checks whether objects are
+ * hidden behind occluders.
+ *
+ * The depth buffer is divided into tiles of tileWidth x tileHeight pixels, and the farthest depth of every tile
+ * is kept in the coarse level of the hierarchical depth buffer. renderOccluders() transforms occluders on the thread
+ * pool and rasterizes them by rows of tiles in parallel, every row of tiles is written by one task only. Pixels are
+ * processed by SSE2 or AVX2 instructions (AVX2 is used if the library is built with USE_AVX2), on other CPUs by
+ * the portable code.
+ *
+ * isVisible() projects the bounding box onto the screen and compares its nearest depth at first with the coarse
+ * level and after that only in tiles, which can't reject the box, with pixels. The test is conservative: the box,
+ * which crosses the near plane, is always visible.
+ *
+ * The depth is the depth of the window coordinates in the range [0, 1], where 0 is the near plane. Rows of the buffer
+ * go from the bottom of the screen.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * rasterizer.clear();
+ * rasterizer.setViewProjection(viewProjection);
+ * rasterizer.renderOccluders(occluders);
+ * for (const auto& object : objects)
+ * {
+ *     object.isCulled = !rasterizer.isVisible(object.worldBounds);
+ * }
+ * \endcode
+ */
+class DepthRasterizer final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of DepthRasterizer.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The height of the tile in pixels.
+         */
+        static constexpr size_t tileHeight = {8};
+        /**
+         * \brief The width of the tile in pixels.
+         */
+        static constexpr size_t tileWidth  = {8};
+
+        /**
+         * \brief Constructs new DepthRasterizer with the cleared depth buffer.
+         *
+         * \param width  - the width of the depth buffer in pixels. It is rounded up to the multiple of tileWidth.
+         * \param height - the height of the depth buffer in pixels. It is rounded up to the multiple of tileHeight.
+         * \throw std::invalid_argument, if the width or the height is 0.
+         */
+        DepthRasterizer(size_t width, size_t height);
+        OGLS_NOT_COPYABLE(DepthRasterizer)
+        DepthRasterizer(DepthRasterizer&& obj) noexcept;
+        ~DepthRasterizer() noexcept;
+
+        DepthRasterizer& operator=(DepthRasterizer&& obj) noexcept;
+
+        /**
+         * \brief Fills the depth buffer with the far plane.
+         */
+        void   clear() noexcept;
+        /**
+         * \brief Returns the depth of the pixel.
+         *
+         * \throw std::out_of_range, if the pixel is outside the buffer.
+         */
+        float  getDepth(size_t x, size_t y) const;
+        /**
+         * \brief Returns the height of the depth buffer in pixels.
+         */
+        size_t getHeight() const noexcept;
+        /**
+         * \brief Returns the width of the depth buffer in pixels.
+         */
+        size_t getWidth() const noexcept;
+        /**
+         * \brief Checks whether any part of the box can be seen through occluders rendered since the last clear().
+         *
+         * It only reads the depth buffer, so it can be called from several threads at the same time.
+         *
+         * \param worldBounds - the bounding box of the object in the world coordinate system.
+         * \return false if the box is hidden by occluders, is outside the viewport or is beyond the far plane,
+         * true otherwise.
+         */
+        bool   isVisible(const mathCore::BoundingBox& worldBounds) const noexcept;
+        /**
+         * \brief Renders occluders into the depth buffer. The nearer depth of every pixel remains.
+         *
+         * \param occluders - occluders to render.
+         * \param pool      - the pool, on which occluders are transformed and rows of tiles are rasterized.
+         *                    It mustn't be the pool of the calling task.
+         * \throw std::invalid_argument, if indices of the occluder refer to nonexistent vertices.
+         */
+        void   renderOccluders(std::span<const Occluder> occluders,
+                               helpers::ThreadPool&      pool = helpers::getDefaultThreadPool());
+        /**
+         * \brief Sets the view-projection transformation of the camera, which is applied to occluders and boxes.
+         *
+         * \param viewProjection - the combined view and projection Matrix<4, 4> in the format of the selected
+         *                         graphical API.
+         */
+        void   setViewProjection(const mathCore::Mat4& viewProjection) noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class DepthRasterizer
+
+}  // namespace ogls::culling
+
+#endif
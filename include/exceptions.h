@@ -85,6 +85,16 @@ class FileReadingException : public FileException
 
 };  // class FileReadingException
 
+/**
+ * \brief FileWritingException is an exception to indicate error while writing file.
+ */
+class FileWritingException : public FileException
+{
+    public:
+        using FileException::FileException;
+
+};  // class FileWritingException
+
 //------ WINDOW EXCEPTIONS
 
 /**
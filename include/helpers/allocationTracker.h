@@ -0,0 +1,198 @@
+#ifndef OGLS_HELPERS_ALLOCATION_TRACKER_H
+#define OGLS_HELPERS_ALLOCATION_TRACKER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "helpers/macros.h"
+
+/**
+ * \brief Attributes heap allocations of the current thread till the end of the enclosing block to the subsystem.
+ *
+ * If OGLS_TRACK_ALLOCATIONS isn't defined (the CMake option TRACK_ALLOCATIONS is OFF), the macro adds nothing.
+ *
+ * \param Subsystem - the name of the value of ogls::helpers::AllocationSubsystem, e.g. MathCore.
+ */
+#ifdef OGLS_TRACK_ALLOCATIONS
+#    define OGLS_ALLOCATION_SCOPE(Subsystem)                                                           \
+        const auto oglsAllocationScope =                                                              \
+          ogls::helpers::AllocationScope{ogls::helpers::AllocationSubsystem::Subsystem}
+#else
+#    define OGLS_ALLOCATION_SCOPE(Subsystem)
+#endif
+
+namespace ogls::helpers
+{
+/**
+ * \brief AllocationSubsystem is the part of the program, to which heap allocations are attributed.
+ */
+enum class AllocationSubsystem : uint8_t
+{
+    App,
+    Helpers,
+    MathCore,
+    OpenglCore,
+    /**
+     * \brief Allocations outside of any AllocationScope.
+     */
+    Unknown
+};
+
+/**
+ * \brief The number of values of AllocationSubsystem.
+ */
+inline constexpr auto allocationSubsystemsCount = size_t{5};
+
+/**
+ * \brief AllocationCounters counts heap allocations and frees.
+ *
+ * Frees are attributed to the subsystem, which has allocated the memory.
+ */
+struct AllocationCounters final
+{
+        AllocationCounters& operator+=(const AllocationCounters& other) noexcept;
+
+        uint64_t allocatedBytes   = {0};
+        uint64_t allocationsCount = {0};
+        uint64_t freedBytes       = {0};
+        uint64_t freesCount       = {0};
+
+};  // struct AllocationCounters
+
+/**
+ * \brief AllocationStatistics contains counters of all subsystems.
+ */
+struct AllocationStatistics final
+{
+        AllocationStatistics& operator+=(const AllocationStatistics& other) noexcept;
+
+        /**
+         * \brief Returns counters of the subsystem.
+         */
+        const AllocationCounters& getCounters(AllocationSubsystem subsystem) const noexcept;
+        /**
+         * \brief Returns the sum of counters of all subsystems.
+         */
+        AllocationCounters        getTotal() const noexcept;
+
+        /**
+         * \brief Counters of subsystems. The index is the value of AllocationSubsystem.
+         */
+        std::array<AllocationCounters, allocationSubsystemsCount> subsystems;
+
+};  // struct AllocationStatistics
+
+/**
+ * \brief AllocationSite is the call stack, from which sampled allocations have been made.
+ */
+struct AllocationSite final
+{
+        /**
+         * \brief The size of sampled allocations in bytes.
+         */
+        uint64_t            allocatedBytes   = {0};
+        /**
+         * \brief The number of sampled allocations.
+         */
+        uint64_t            allocationsCount = {0};
+        /**
+         * \brief Return addresses from operator new to the outermost function. The first addresses belong to
+         * the tracker itself, their number depends on inlining.
+         */
+        std::vector<void*>  callStack;
+        AllocationSubsystem subsystem        = {AllocationSubsystem::Unknown};
+
+};  // struct AllocationSite
+
+/**
+ * \brief AllocationScope attributes heap allocations of the current thread to the subsystem, while it exists.
+ *
+ * Scopes can be nested, the innermost one wins. OGLS_ALLOCATION_SCOPE() is the preferred way to create scopes,
+ * because it disappears, when tracking of allocations is disabled.
+ */
+class AllocationScope final
+{
+    public:
+        /**
+         * \brief Makes the subsystem current for the thread.
+         *
+         * \param subsystem - the subsystem, to which allocations are attributed.
+         */
+        explicit AllocationScope(AllocationSubsystem subsystem) noexcept;
+        OGLS_NOT_COPYABLE_MOVABLE(AllocationScope)
+        /**
+         * \brief Restores the subsystem, which was current before the scope.
+         */
+        ~AllocationScope() noexcept;
+
+    private:
+        AllocationSubsystem m_previousSubsystem = {AllocationSubsystem::Unknown};
+
+};  // class AllocationScope
+
+/**
+ * \brief Checks whether the global operator new and operator delete are replaced by the counting ones.
+ *
+ * \return true if OGLS_TRACK_ALLOCATIONS is defined, false otherwise. Other functions of the tracker return
+ * empty results in the last case.
+ */
+constexpr bool isAllocationTrackingEnabled() noexcept
+{
+#ifdef OGLS_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * \brief Formats the call stack of the allocation site into lines of the form "module(function+offset) [address]".
+ *
+ * Function names are available only for exported symbols, e.g. with -rdynamic on Linux. Otherwise only addresses
+ * are written.
+ *
+ * \param callStack - return addresses, see AllocationSite::callStack.
+ */
+std::string                 formatCallStack(std::span<void* const> callStack);
+/**
+ * \brief Returns the subsystem, to which allocations of the current thread are attributed.
+ */
+AllocationSubsystem         getCurrentAllocationSubsystem() noexcept;
+/**
+ * \brief Returns sampled allocation sites with the biggest size of allocations.
+ *
+ * \param count - the maximal number of returned sites.
+ * \return sites sorted by AllocationSite::allocatedBytes in descending order.
+ */
+std::vector<AllocationSite> getTopAllocationSites(size_t count);
+/**
+ * \brief Forgets all collected allocation sites.
+ */
+void                        resetAllocationSites();
+/**
+ * \brief Sets how often call stacks of allocations are captured.
+ *
+ * Capturing takes microseconds, so only every period-th allocation of each thread is sampled. Collected sites are
+ * kept, till resetAllocationSites() is called.
+ *
+ * \param period - the number of allocations per sample or 0 to disable capturing (the default).
+ */
+void                        setCallStackSampling(uint32_t period) noexcept;
+/**
+ * \brief Returns counters of allocations of all threads, which have been made since the previous call, and resets
+ * them. Called once per frame, it gives per-frame statistics.
+ */
+AllocationStatistics        takeAllocationStatistics() noexcept;
+/**
+ * \brief Returns the string representation of the subsystem.
+ */
+std::string_view            toString(AllocationSubsystem subsystem) noexcept;
+
+}  // namespace ogls::helpers
+
+#endif
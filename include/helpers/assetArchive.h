@@ -0,0 +1,204 @@
+#ifndef OGLS_HELPERS_ASSET_ARCHIVE_H
+#define OGLS_HELPERS_ASSET_ARCHIVE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief ArchiveCompression is a compression of the archive entry.
+ */
+enum class ArchiveCompression : uint32_t
+{
+    None = 0,
+    /**
+     * \brief See compressBlock().
+     */
+    Lz   = 1
+};
+
+/**
+ * \brief ArchiveHeader is the header at the beginning of the asset archive file.
+ *
+ * The layout of the archive is:
+ * header | entries sorted by pathHash | paths | aligned data of entries.
+ */
+struct ArchiveHeader final
+{
+        /**
+         * \brief The signature of the archive file.
+         */
+        std::array<char, 4> magic        = {'O', 'G', 'L', 'A'};
+        /**
+         * \brief The version of the archive format.
+         */
+        uint32_t            version      = {1};
+        /**
+         * \brief A number of entries in the archive.
+         */
+        uint64_t            entriesCount = {0};
+
+};  // struct ArchiveHeader
+
+/**
+ * \brief ArchiveEntry is a record of the archive index, which describes one packed file.
+ */
+struct ArchiveEntry final
+{
+        /**
+         * \brief The compression of the stored data.
+         */
+        ArchiveCompression compression  = ArchiveCompression::None;
+        /**
+         * \brief The offset of the stored data from the beginning of the archive. It is a multiple of
+         * archiveDataAlignment.
+         */
+        uint64_t           dataOffset   = {0};
+        /**
+         * \brief The size of the data before compression.
+         */
+        uint64_t           originalSize = {0};
+        /**
+         * \brief The hash of the normalized path (see calculateAssetPathHash()).
+         */
+        uint64_t           pathHash     = {0};
+        /**
+         * \brief The length of the normalized path.
+         */
+        uint32_t           pathLength   = {0};
+        /**
+         * \brief The offset of the normalized path from the beginning of the archive.
+         */
+        uint64_t           pathOffset   = {0};
+        /**
+         * \brief The size of the stored (possibly compressed) data.
+         */
+        uint64_t           storedSize   = {0};
+
+};  // struct ArchiveEntry
+
+/**
+ * \brief AssetArchiveItem is a file, which must be packed into the archive by writeAssetArchive().
+ */
+struct AssetArchiveItem final
+{
+        /**
+         * \brief The requested compression.
+         * The data is stored uncompressed, if the compression doesn't reduce its size.
+         */
+        ArchiveCompression     compression = ArchiveCompression::None;
+        /**
+         * \brief The content of the file.
+         */
+        std::vector<std::byte> data;
+        /**
+         * \brief The path, by which the file is read from the archive.
+         */
+        std::string            path;
+
+};  // struct AssetArchiveItem
+
+/**
+ * \brief The alignment of the data of every entry, which allows to use the mapped data as arrays of any type.
+ */
+constexpr auto archiveDataAlignment = size_t{16};
+
+/**
+ * \brief AssetArchive provides read-only access to the files packed into one archive.
+ *
+ * The archive is mapped into the memory, so the index lookup is a binary search over the mapped array of entries
+ * and uncompressed data is returned without copying.
+ */
+class AssetArchive final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of AssetArchive.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Opens and validates the archive.
+         *
+         * \param pathToArchive - a path to the archive file.
+         * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
+         */
+        explicit AssetArchive(const std::filesystem::path& pathToArchive);
+        OGLS_NOT_COPYABLE(AssetArchive)
+        AssetArchive(AssetArchive&& obj) noexcept;
+        ~AssetArchive() noexcept;
+
+        AssetArchive& operator=(AssetArchive&& obj) noexcept;
+
+        /**
+         * \brief Finds the entry of the file.
+         *
+         * \param path - the path of the file (it is normalized by normalizeAssetPath()).
+         * \return the entry or nullptr if there is no such file in the archive.
+         */
+        const ArchiveEntry*             findEntry(std::string_view path) const;
+        /**
+         * \brief Returns all entries of the archive.
+         */
+        std::span<const ArchiveEntry>   getEntries() const noexcept;
+        /**
+         * \brief Returns the normalized path of the entry.
+         */
+        std::string_view                getPath(const ArchiveEntry& entry) const noexcept;
+        /**
+         * \brief Returns the stored (possibly compressed) data of the entry. The view is valid until the archive
+         * is destroyed.
+         */
+        std::span<const std::byte>      getStoredData(const ArchiveEntry& entry) const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class AssetArchive
+
+/**
+ * \brief Calculates the FNV-1a hash of the normalized path.
+ */
+constexpr uint64_t calculateAssetPathHash(std::string_view normalizedPath) noexcept
+{
+    auto hash = uint64_t{0xCB'F2'9C'E4'84'22'23'25};
+    for (const auto c : normalizedPath)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x01'00'00'00'01'B3;
+    }
+    return hash;
+}
+
+/**
+ * \brief Converts the path into the form used as the key of archive entries: '/' separators,
+ * no leading "./" and no repeated separators.
+ */
+std::string normalizeAssetPath(std::string_view path);
+/**
+ * \brief Packs the files into new archive.
+ *
+ * \param pathToArchive - a path to the archive file to create.
+ * \param items         - files to pack.
+ * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileWritingException(),
+ * std::invalid_argument if two items have the same path.
+ */
+void        writeAssetArchive(const std::filesystem::path& pathToArchive, std::span<const AssetArchiveItem> items);
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef OGLS_HELPERS_COMPRESSION_H
+#define OGLS_HELPERS_COMPRESSION_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ogls::helpers
+{
+/**
+ * \brief Compresses the data by the fast LZ77 compression in the LZ4-like block format.
+ *
+ * The block is a sequence of (token, literals, offset, match length) groups. The compression ratio is modest,
+ * but the decompression is a simple copy loop, which is faster than reading uncompressed data from the disk.
+ *
+ * \param data - the data to compress.
+ * \return the compressed block.
+ */
+std::vector<std::byte> compressBlock(std::span<const std::byte> data);
+/**
+ * \brief Decompresses the block created by compressBlock().
+ *
+ * \param block       - the compressed block.
+ * \param destination - the memory for decompressed data. Its size must be equal to the size of the original data.
+ * \throw std::invalid_argument, if the block is corrupted or doesn't match the size of the destination.
+ */
+void                   decompressBlock(std::span<const std::byte> block, std::span<std::byte> destination);
+
+}  // namespace ogls::helpers
+
+#endif
@@ -42,7 +42,7 @@ namespace ogls::helpers
     }
 
 /**
- * \brief Checks OpenGL error and prints OpenGL error in std::cerr.
+ * \brief Checks OpenGL error and logs OpenGL error by the default logger.
  *
  * \param file     - the file name, from which the function is called.
  * \param function - the name of the function, from which the function is called.
@@ -0,0 +1,174 @@
+#ifndef OGLS_HELPERS_FRAME_ARENA_H
+#define OGLS_HELPERS_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief LinearArena is the memory resource, which allocates memory by bumping the pointer inside big blocks and frees
+ * all of it at once by reset().
+ *
+ * deallocate() does nothing, so standard containers with std::pmr::polymorphic_allocator can use the arena for
+ * temporary data without any frees. If the current block is full, the new block is taken from the upstream
+ * resource. reset() returns the blocks to the upstream resource, if there were several of them, and the next block
+ * gets the size of all of them, so the arena stabilizes on the single block of the peak size.
+ *
+ * The arena isn't thread-safe.
+ */
+class LinearArena final : public std::pmr::memory_resource
+{
+    public:
+        /**
+         * \brief The default size of blocks in bytes.
+         */
+        static constexpr auto defaultBlockSize = size_t{64 * 1'024};
+
+        /**
+         * \brief Constructs new empty LinearArena. The memory is allocated on the first allocation.
+         *
+         * \param blockSize - the minimal size of blocks in bytes.
+         * \param upstream  - the resource, from which blocks are allocated. It must outlive the arena.
+         */
+        explicit LinearArena(size_t                     blockSize = defaultBlockSize,
+                             std::pmr::memory_resource* upstream  = std::pmr::get_default_resource());
+        OGLS_NOT_COPYABLE_MOVABLE(LinearArena)
+        /**
+         * \brief Returns all blocks to the upstream resource.
+         */
+        ~LinearArena() noexcept override;
+
+        /**
+         * \brief Returns the size of all blocks in bytes.
+         */
+        size_t getCapacity() const noexcept;
+        /**
+         * \brief Returns the size of memory, which has been allocated since the last reset(), in bytes.
+         */
+        size_t getUsedSize() const noexcept;
+        /**
+         * \brief Frees all allocated memory. Objects in the memory must be already destroyed or be trivially
+         * destructible.
+         */
+        void   reset() noexcept;
+
+    private:
+        /**
+         * \brief Block is the memory, from which allocations are made.
+         */
+        struct Block final
+        {
+                std::byte* memory = {nullptr};
+                size_t     size   = {0};
+
+        };  // struct Block
+
+        /**
+         * \throw std::bad_alloc, if the upstream resource can't allocate the new block.
+         */
+        void* allocateFromNewBlock(size_t bytes, size_t alignment);
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* pointer, size_t bytes, size_t alignment) noexcept override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+        void  releaseBlocks() noexcept;
+
+    private:
+        std::vector<Block>         m_blocks;
+        size_t                     m_blockSize = {0};
+        std::byte*                 m_current   = {nullptr};
+        std::byte*                 m_end       = {nullptr};
+        std::pmr::memory_resource* m_upstream  = {nullptr};
+        /**
+         * \brief The size of memory, which has been allocated from the blocks before the current one.
+         */
+        size_t                     m_usedSize  = {0};
+
+};  // class LinearArena
+
+/**
+ * \brief FrameArena provides the memory for temporary data of frames, which lives, till the GPU completes the frame.
+ *
+ * The arena has the LinearArena for each of framesCount frames, which can be processed by the GPU at the same time.
+ * beginFrame() switches to the arena of the next frame and frees it, so the memory of the frame stays valid during
+ * next framesCount - 1 frames. Worker threads get own sub-arenas of the frame by getThreadResource(), so they
+ * allocate without locks.
+ *
+ * \code
+ * auto arena = ogls::helpers::FrameArena{maxQueuedFrames};
+ * while (isRunning)
+ * {
+ *     waitForGpuFrame(frameIndex - maxQueuedFrames);
+ *     arena.beginFrame();
+ *     auto packets = std::pmr::vector<DrawPacket>{&arena.getResource()};
+ *     ...
+ * }
+ * \endcode
+ */
+class FrameArena final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of FrameArena.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new FrameArena.
+         *
+         * \param framesCount - a number of frames, memory of which is in use at the same time. It mustn't be less than
+         *                      a number of frames, which can be queued to the GPU.
+         * \param blockSize   - the minimal size of blocks of arenas in bytes.
+         * \throw std::invalid_argument, if framesCount is 0.
+         */
+        explicit FrameArena(size_t framesCount, size_t blockSize = LinearArena::defaultBlockSize);
+        OGLS_NOT_COPYABLE(FrameArena)
+        FrameArena(FrameArena&& obj) noexcept;
+        ~FrameArena() noexcept;
+
+        FrameArena& operator=(FrameArena&& obj) noexcept;
+
+        /**
+         * \brief Switches to the arena of the next frame and frees memory of the frame, which used it framesCount
+         * frames ago. The GPU must have completed that frame.
+         *
+         * It mustn't be called, while other threads use the memory of the arena.
+         */
+        void                       beginFrame() noexcept;
+        /**
+         * \brief Returns a number of frames, memory of which is in use at the same time.
+         */
+        size_t                     getFramesCount() const noexcept;
+        /**
+         * \brief Returns the arena of the current frame. It must be used only by the thread, which calls beginFrame().
+         */
+        std::pmr::memory_resource& getResource() noexcept;
+        /**
+         * \brief Returns the sub-arena of the calling thread in the current frame.
+         *
+         * The sub-arena is created on the first call of the thread in the frame, next calls take it without locks.
+         *
+         * \throw std::bad_alloc.
+         */
+        std::pmr::memory_resource& getThreadResource();
+        /**
+         * \brief Returns the size of memory, which has been allocated in the current frame by all threads, in bytes.
+         */
+        size_t                     getUsedSize() const;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class FrameArena
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,234 @@
+#ifndef OGLS_HELPERS_HANDLE_H
+#define OGLS_HELPERS_HANDLE_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ogls::helpers
+{
+/**
+ * \brief Handle is a generational index, which refers to an object stored in SlotMap.
+ *
+ * The generation is incremented every time the slot is released, so a Handle to removed object never refers
+ * to another object, which reused the same slot.
+ *
+ * \param Tag - an arbitrary type to make Handle -s of different kinds of objects incompatible.
+ */
+template<typename Tag>
+struct Handle final
+{
+        /**
+         * \brief The index, which doesn't refer to any slot.
+         */
+        static constexpr auto invalidIndex = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * \brief Checks if the Handle was obtained from SlotMap (it still can be stale).
+         */
+        constexpr bool isValid() const noexcept
+        {
+            return index != invalidIndex;
+        }
+
+        /**
+         * \brief Packs the Handle into one 64-bit integer, for example, to use it as a key.
+         */
+        constexpr uint64_t pack() const noexcept
+        {
+            return (uint64_t{generation} << 32) | index;
+        }
+
+        constexpr bool operator==(const Handle&) const noexcept = default;
+
+        /**
+         * \brief The generation of the slot at the moment of the Handle creation.
+         */
+        uint32_t generation = {0};
+        /**
+         * \brief The index of the slot.
+         */
+        uint32_t index      = {invalidIndex};
+
+};  // struct Handle
+
+/**
+ * \brief SlotMap stores objects in a dense contiguous array and gives out stable Handle -s to them.
+ *
+ * Insertion, removal and access by Handle are O(1). Removal moves the last object into the place of removed one,
+ * so the order of objects in the dense array is not preserved.
+ *
+ * \param Tag  - the tag of Handle -s.
+ * \param Type - the type of stored objects.
+ */
+template<typename Tag, typename Type>
+class SlotMap final
+{
+    public:
+        using HandleType = Handle<Tag>;
+
+    public:
+        /**
+         * \brief Returns an iterator to the first object of the dense array.
+         */
+        auto begin() noexcept
+        {
+            return m_objects.begin();
+        }
+
+        /**
+         * \brief Returns an iterator to the first object of the dense array.
+         */
+        auto begin() const noexcept
+        {
+            return m_objects.begin();
+        }
+
+        /**
+         * \brief Checks if the Handle refers to an existing object.
+         */
+        bool contains(HandleType handle) const noexcept
+        {
+            return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation
+                   && m_slots[handle.index].denseIndex != HandleType::invalidIndex;
+        }
+
+        /**
+         * \brief Returns an iterator past the last object of the dense array.
+         */
+        auto end() noexcept
+        {
+            return m_objects.end();
+        }
+
+        /**
+         * \brief Returns an iterator past the last object of the dense array.
+         */
+        auto end() const noexcept
+        {
+            return m_objects.end();
+        }
+
+        /**
+         * \brief Removes the object.
+         *
+         * \return true if the object was removed, false if the Handle is stale.
+         */
+        bool erase(HandleType handle)
+        {
+            if (!contains(handle))
+            {
+                return false;
+            }
+
+            auto&      slot      = m_slots[handle.index];
+            const auto lastIndex = static_cast<uint32_t>(m_objects.size() - 1);
+
+            if (slot.denseIndex != lastIndex)
+            {
+                m_objects[slot.denseIndex]                        = std::move(m_objects[lastIndex]);
+                m_denseToSlot[slot.denseIndex]                    = m_denseToSlot[lastIndex];
+                m_slots[m_denseToSlot[slot.denseIndex]].denseIndex = slot.denseIndex;
+            }
+
+            m_objects.pop_back();
+            m_denseToSlot.pop_back();
+
+            slot.denseIndex = HandleType::invalidIndex;
+            ++slot.generation;
+            m_freeSlots.push_back(handle.index);
+            return true;
+        }
+
+        /**
+         * \brief Returns the object or nullptr if the Handle is stale.
+         */
+        Type* get(HandleType handle) noexcept
+        {
+            return contains(handle) ? &m_objects[m_slots[handle.index].denseIndex] : nullptr;
+        }
+
+        /**
+         * \brief Returns the object or nullptr if the Handle is stale.
+         */
+        const Type* get(HandleType handle) const noexcept
+        {
+            return contains(handle) ? &m_objects[m_slots[handle.index].denseIndex] : nullptr;
+        }
+
+        /**
+         * \brief Returns the Handle of the object at the position of the dense array.
+         */
+        HandleType getHandle(size_t denseIndex) const noexcept
+        {
+            const auto slotIndex = m_denseToSlot[denseIndex];
+            return HandleType{.generation{m_slots[slotIndex].generation}, .index{slotIndex}};
+        }
+
+        /**
+         * \brief Inserts the object and returns the Handle to it.
+         */
+        HandleType insert(Type object)
+        {
+            auto slotIndex = uint32_t{0};
+
+            if (m_freeSlots.empty())
+            {
+                slotIndex = static_cast<uint32_t>(m_slots.size());
+                m_slots.push_back({});
+            }
+            else
+            {
+                slotIndex = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+
+            m_slots[slotIndex].denseIndex = static_cast<uint32_t>(m_objects.size());
+            m_objects.push_back(std::move(object));
+            m_denseToSlot.push_back(slotIndex);
+
+            return HandleType{.generation{m_slots[slotIndex].generation}, .index{slotIndex}};
+        }
+
+        /**
+         * \brief Returns a number of stored objects.
+         */
+        size_t size() const noexcept
+        {
+            return m_objects.size();
+        }
+
+    private:
+        /**
+         * \brief Slot is an indirection between Handle and the position of the object in the dense array.
+         */
+        struct Slot final
+        {
+                uint32_t denseIndex = {HandleType::invalidIndex};
+                uint32_t generation = {0};
+
+        };  // struct Slot
+
+    private:
+        /**
+         * \brief Indices of slots of objects in the dense array.
+         */
+        std::vector<uint32_t> m_denseToSlot;
+        /**
+         * \brief Indices of released slots.
+         */
+        std::vector<uint32_t> m_freeSlots;
+        /**
+         * \brief The dense array of objects.
+         */
+        std::vector<Type>     m_objects;
+        /**
+         * \brief Slots, to which Handle -s refer.
+         */
+        std::vector<Slot>     m_slots;
+
+};  // class SlotMap
+
+}  // namespace ogls::helpers
+
+#endif
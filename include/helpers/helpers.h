@@ -14,6 +14,19 @@
  */
 namespace ogls::helpers
 {
+/**
+ * \brief Mixes the hash value into the seed.
+ *
+ * The same approach as boost::hash_combine() uses.
+ *
+ * \param seed  - a hash value to be updated.
+ * \param value - a hash value to mix into the seed.
+ */
+constexpr void hashCombine(size_t& seed, size_t value) noexcept
+{
+    seed ^= value + 0x9E'37'79'B9 + (seed << 6) + (seed >> 2);
+}
+
 /**
  * \brief Constructs an instance of std::array<Type, N> using the provided data.
  *
@@ -33,6 +46,8 @@ constexpr std::array<Type, N> makeStdArray(Type (&data)[N]) noexcept
 /**
  * \brief Opens the file and reads the content.
  *
+ * The file is read through getDefaultVirtualFileSystem(), so it can be packed into the mounted archive.
+ *
  * \param pathToFile - a path to file to be read.
  * \return the srd::string with content of the file.
  * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
@@ -42,7 +57,9 @@ std::string readTextFromFile(std::string_view pathToFile);
 /**
  * \brief Opens the file and reads the content as texture image.
  *
- * \param pathToFile - a path to file to be read. Must be null-terminated C-style string.
+ * The file is read through getDefaultVirtualFileSystem() and is decoded directly from the mapped memory.
+ *
+ * \param pathToFile - a path to file to be read.
  * \return bytes of the image and accompanying information about the image.
  * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
  */
@@ -0,0 +1,434 @@
+#ifndef OGLS_HELPERS_LOGGER_H
+#define OGLS_HELPERS_LOGGER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "helpers/macros.h"
+
+/**
+ * \brief The minimal level of messages, which are compiled in by OGLS_LOG(). Calls with lower levels are removed
+ * at compile time. The value is the number of ogls::helpers::LogLevel.
+ */
+#ifndef OGLS_LOG_MIN_LEVEL
+#    ifdef NDEBUG
+#        define OGLS_LOG_MIN_LEVEL 2
+#    else
+#        define OGLS_LOG_MIN_LEVEL 0
+#    endif
+#endif
+
+namespace ogls::helpers
+{
+/**
+ * \brief Writes the message into the default logger, if the level isn't filtered out at compile time.
+ *
+ * The format string must be a string literal, because only the pointer to it is stored till the message is
+ * formatted on the thread of the logger.
+ *
+ * \param level - the level of the message. Must be a constant expression.
+ * \param ...   - the format string and arguments of the message.
+ */
+#define OGLS_LOG(level, ...)                                             \
+    do                                                                   \
+    {                                                                    \
+        if constexpr (ogls::helpers::isLogLevelCompiled(level))          \
+        {                                                                \
+            ogls::helpers::getDefaultLogger().log((level), __VA_ARGS__); \
+        }                                                                \
+    }                                                                    \
+    while (false)
+
+#define OGLS_LOG_TRACE(...)   OGLS_LOG(ogls::helpers::LogLevel::Trace, __VA_ARGS__)
+#define OGLS_LOG_DEBUG(...)   OGLS_LOG(ogls::helpers::LogLevel::Debug, __VA_ARGS__)
+#define OGLS_LOG_INFO(...)    OGLS_LOG(ogls::helpers::LogLevel::Info, __VA_ARGS__)
+#define OGLS_LOG_WARNING(...) OGLS_LOG(ogls::helpers::LogLevel::Warning, __VA_ARGS__)
+#define OGLS_LOG_ERROR(...)   OGLS_LOG(ogls::helpers::LogLevel::Error, __VA_ARGS__)
+
+/**
+ * \brief LogLevel is the severity of the log message.
+ */
+enum class LogLevel : uint8_t
+{
+    Trace   = 0,
+    Debug   = 1,
+    Info    = 2,
+    Warning = 3,
+    Error   = 4,
+    /**
+     * \brief It is used only to disable all messages.
+     */
+    Off     = 5
+};
+
+/**
+ * \brief Checks whether messages of the level are compiled in by OGLS_LOG().
+ */
+constexpr bool isLogLevelCompiled(LogLevel level) noexcept
+{
+    return level >= static_cast<LogLevel>(OGLS_LOG_MIN_LEVEL);
+}
+
+/**
+ * \brief Returns the name of the level.
+ */
+std::string_view toString(LogLevel level) noexcept;
+
+/**
+ * \brief LogMessage is the formatted message, which is passed to sinks.
+ */
+struct LogMessage final
+{
+        LogLevel                              level = {LogLevel::Info};
+        /**
+         * \brief The text of the message. It is valid only during LogSink::write().
+         */
+        std::string_view                      text;
+        /**
+         * \brief The moment, when the message was logged.
+         */
+        std::chrono::system_clock::time_point time;
+
+};  // struct LogMessage
+
+/**
+ * \brief Formats the message as the line "[hh:mm:ss.mmm] [Level] text" with the time in UTC and the line break.
+ */
+std::string toLogLine(const LogMessage& message);
+
+/**
+ * \brief LogSink is the interface of the destination of log messages.
+ *
+ * Methods are called only from the thread of the logger, so sinks needn't be thread-safe for the logger.
+ */
+class LogSink
+{
+    public:
+        LogSink() = default;
+        OGLS_NOT_COPYABLE_MOVABLE(LogSink)
+        virtual ~LogSink() noexcept = default;
+
+        /**
+         * \brief Writes buffered messages into the destination. It is called after every batch of messages.
+         */
+        virtual void flush()
+        {
+        }
+        /**
+         * \brief Writes the message. The sink may buffer it till flush().
+         */
+        virtual void write(const LogMessage& message) = 0;
+
+};  // class LogSink
+
+/**
+ * \brief ConsoleLogSink writes messages into the standard error stream.
+ */
+class ConsoleLogSink final : public LogSink
+{
+    public:
+        ConsoleLogSink() = default;
+
+        void flush() override;
+        void write(const LogMessage& message) override;
+
+};  // class ConsoleLogSink
+
+/**
+ * \brief FileLogSink appends messages to the file.
+ */
+class FileLogSink final : public LogSink
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of FileLogSink.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new FileLogSink and opens the file.
+         *
+         * \param pathToFile - the path to the file. The file is created, if it doesn't exist.
+         * \throw ogls::exceptions::FileOpeningException().
+         */
+        explicit FileLogSink(const std::filesystem::path& pathToFile);
+        ~FileLogSink() noexcept override;
+
+        void flush() override;
+        void write(const LogMessage& message) override;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class FileLogSink
+
+/**
+ * \brief MemoryLogSink keeps the last messages in memory, e.g. to show them in the UI or to check them in tests.
+ */
+class MemoryLogSink final : public LogSink
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of MemoryLogSink.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new MemoryLogSink.
+         *
+         * \param maxMessagesCount - a number of the last messages, which are kept.
+         */
+        explicit MemoryLogSink(size_t maxMessagesCount = {1'024});
+        ~MemoryLogSink() noexcept override;
+
+        /**
+         * \brief Returns lines of kept messages from the oldest one. It can be called from any thread.
+         */
+        std::vector<std::string> getLines() const;
+        void                     write(const LogMessage& message) override;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class MemoryLogSink
+
+namespace detail
+{
+    /**
+     * \brief Formats arguments of the record, which have been encoded by LogArgument.
+     */
+    using LogFormatter = void (*)(std::string_view format, const std::byte* arguments, std::string& result);
+
+    template<typename Type>
+    concept LogStringArgument = std::is_convertible_v<const Type&, std::string_view>;
+
+    template<typename Type>
+    concept LogValueArgument =
+      !LogStringArgument<Type> && std::is_trivially_copyable_v<Type> && std::is_default_constructible_v<Type>;
+
+    /**
+     * \brief LogArgument encodes the argument of the log message into bytes and decodes it on the thread of
+     * the logger. Only strings and trivially copyable values are supported, other values must be formatted into
+     * std::string before the call.
+     */
+    template<typename Type>
+    struct LogArgument;
+
+    /**
+     * \brief Strings are copied, because they can be destroyed before the message is formatted.
+     */
+    template<LogStringArgument Type>
+    struct LogArgument<Type> final
+    {
+            using Decoded = std::string_view;
+
+            static size_t getSize(const Type& value) noexcept
+            {
+                return sizeof(uint32_t) + std::string_view{value}.size();
+            }
+
+            static std::byte* encode(std::byte* out, const Type& value) noexcept
+            {
+                const auto string = std::string_view{value};
+                const auto size   = static_cast<uint32_t>(string.size());
+                std::memcpy(out, &size, sizeof(size));
+                std::memcpy(out + sizeof(size), string.data(), size);
+                return out + sizeof(size) + size;
+            }
+
+            static Decoded decode(const std::byte*& in) noexcept
+            {
+                auto size = uint32_t{0};
+                std::memcpy(&size, in, sizeof(size));
+                const auto result = Decoded{reinterpret_cast<const char*>(in + sizeof(size)), size};
+                in += sizeof(size) + size;
+                return result;
+            }
+
+    };  // struct LogArgument
+
+    template<LogValueArgument Type>
+    struct LogArgument<Type> final
+    {
+            using Decoded = Type;
+
+            static size_t getSize(const Type&) noexcept
+            {
+                return sizeof(Type);
+            }
+
+            static std::byte* encode(std::byte* out, const Type& value) noexcept
+            {
+                std::memcpy(out, &value, sizeof(Type));
+                return out + sizeof(Type);
+            }
+
+            static Decoded decode(const std::byte*& in) noexcept
+            {
+                auto result = Type{};
+                std::memcpy(&result, in, sizeof(Type));
+                in += sizeof(Type);
+                return result;
+            }
+
+    };  // struct LogArgument
+
+    template<typename... Args>
+    void formatLogRecord(std::string_view format, [[maybe_unused]] const std::byte* arguments, std::string& result)
+    {
+        // The braced initialization decodes arguments from left to right
+        auto decoded = std::tuple<typename LogArgument<Args>::Decoded...>{LogArgument<Args>::decode(arguments)...};
+        std::apply([&format, &result](auto&... values)
+                   { std::vformat_to(std::back_inserter(result), format, std::make_format_args(values...)); },
+                   decoded);
+    }
+
+}  // namespace detail
+
+/**
+ * \brief Logger writes messages into sinks on its own thread.
+ *
+ * Every thread, which logs messages, gets its own lock-free ring buffer. log() only copies the pointer to
+ * the format string and raw arguments into the buffer of the calling thread, so it neither formats the message,
+ * nor takes locks, nor waits for sinks. If the buffer is full, the message is dropped and the number of dropped
+ * messages is reported later. The thread of the logger wakes up periodically, formats messages of all buffers,
+ * sorts them by time, writes them into sinks and flushes sinks once per batch.
+ *
+ * Levels lower than OGLS_LOG_MIN_LEVEL are removed at compile time by OGLS_LOG(), the level of the logger filters
+ * messages at run time.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * auto& logger = getDefaultLogger();
+ * logger.addSink(std::make_shared<FileLogSink>("log.txt"));
+ * OGLS_LOG_INFO("Loaded {} meshes in {} ms.", meshesCount, milliseconds);
+ * logger.flush();
+ * \endcode
+ */
+class Logger final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of Logger.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new Logger and starts its thread.
+         *
+         * \param sinks            - sinks, which get messages.
+         * \param threadBufferSize - the size of the buffer of every logging thread in bytes. It is rounded up to
+         *                           the power of 2.
+         */
+        explicit Logger(std::vector<std::shared_ptr<LogSink>> sinks = {}, size_t threadBufferSize = {65'536});
+        OGLS_NOT_COPYABLE_MOVABLE(Logger)
+        /**
+         * \brief Writes all logged messages and stops the thread of the logger.
+         */
+        ~Logger() noexcept;
+
+        /**
+         * \brief Adds the sink. It can be called from any thread.
+         */
+        void     addSink(std::shared_ptr<LogSink> sink);
+        /**
+         * \brief Blocks till all messages, which were logged before the call, are written and sinks are flushed.
+         */
+        void     flush();
+        /**
+         * \brief Returns a number of messages, which have been dropped because of full buffers.
+         */
+        uint64_t getDroppedMessagesCount() const noexcept;
+        /**
+         * \brief Returns the minimal level of messages, which are logged.
+         */
+        LogLevel getLevel() const noexcept;
+        /**
+         * \brief Checks whether messages of the level are logged.
+         */
+        bool     isEnabled(LogLevel level) const noexcept;
+        /**
+         * \brief Writes the message into the buffer of the calling thread.
+         *
+         * \param level  - the level of the message.
+         * \param format - the format string. It must be a string literal.
+         * \param args   - arguments of the message.
+         */
+        template<typename... Args>
+        void     log(LogLevel level, std::format_string<Args...> format, Args&&... args)
+        {
+            if (!isEnabled(level))
+            {
+                return;
+            }
+
+            const auto argumentsSize =
+              (size_t{0} + ... + detail::LogArgument<std::remove_cvref_t<Args>>::getSize(args));
+            auto out = beginRecord(level, &detail::formatLogRecord<std::remove_cvref_t<Args>...>, format.get(),
+                                   argumentsSize);
+            if (out == nullptr)
+            {
+                return;
+            }
+
+            ((out = detail::LogArgument<std::remove_cvref_t<Args>>::encode(out, args)), ...);
+            endRecord();
+        }
+        /**
+         * \brief Removes all sinks. It can be called from any thread.
+         */
+        void     removeSinks();
+        /**
+         * \brief Sets the minimal level of messages, which are logged. LogLevel::Off disables the logging.
+         */
+        void     setLevel(LogLevel level) noexcept;
+
+    private:
+        /**
+         * \brief Reserves the record in the buffer of the calling thread.
+         *
+         * \return the pointer, at which arguments must be written, or nullptr, if the message is dropped.
+         */
+        std::byte* beginRecord(LogLevel level, detail::LogFormatter formatter, std::string_view format,
+                               size_t argumentsSize);
+        /**
+         * \brief Publishes the reserved record to the thread of the logger.
+         */
+        void       endRecord() noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class Logger
+
+/**
+ * \brief Returns the Logger, which is shared by all subsystems of the program. It writes into the console.
+ */
+Logger& getDefaultLogger();
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef OGLS_HELPERS_MAPPED_FILE_H
+#define OGLS_HELPERS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief MappedFile maps the whole file into the memory in the read-only mode.
+ *
+ * The content is accessed directly in the page cache of the OS without copying into the buffer of the process.
+ * Pages are loaded lazily on the first access.
+ */
+class MappedFile final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of MappedFile.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Opens and maps the file.
+         *
+         * \param pathToFile - a path to file to be mapped.
+         * \throw ogls::exceptions::FileOpeningException().
+         */
+        explicit MappedFile(const std::filesystem::path& pathToFile);
+        OGLS_NOT_COPYABLE(MappedFile)
+        MappedFile(MappedFile&& obj) noexcept;
+        ~MappedFile() noexcept;
+
+        MappedFile& operator=(MappedFile&& obj) noexcept;
+
+        /**
+         * \brief Returns the content of the file. The view is valid until the object is destroyed.
+         */
+        std::span<const std::byte> getData() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class MappedFile
+
+}  // namespace ogls::helpers
+
+#endif
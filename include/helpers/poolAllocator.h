@@ -0,0 +1,182 @@
+#ifndef OGLS_HELPERS_POOL_ALLOCATOR_H
+#define OGLS_HELPERS_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "helpers/macros.h"
+
+/**
+ * \brief Adds to the class operator new and operator delete, which take objects of the class from the pool of
+ * the class, see ogls::helpers::getTypePool().
+ *
+ * Objects of derived classes without their own OGLS_POOL_ALLOCATED() are allocated by global operators, because
+ * their size differs from the size of blocks of the pool. If OGLS_USE_IMPL_POOLS isn't defined (the CMake option
+ * USE_IMPL_POOLS is OFF), the macro adds nothing.
+ *
+ * \param ClassX - the name of the class.
+ */
+#ifdef OGLS_USE_IMPL_POOLS
+#    define OGLS_POOL_ALLOCATED(ClassX)                                                  \
+        static void* operator new(size_t size)                                           \
+        {                                                                                \
+            return ogls::helpers::allocateFromTypePool<ClassX>(size);                    \
+        }                                                                                \
+        static void operator delete(void* pointer, size_t size) noexcept                 \
+        {                                                                                \
+            ogls::helpers::deallocateToTypePool<ClassX>(pointer, size);                  \
+        }
+#else
+#    define OGLS_POOL_ALLOCATED(ClassX)
+#endif
+
+namespace ogls::helpers
+{
+/**
+ * \brief ChunkAllocator is the signature of the function, which allocates chunks of memory for pools.
+ *
+ * \param size      - the size of the chunk in bytes.
+ * \param alignment - the alignment of the chunk, the power of 2.
+ * \return the pointer to the chunk or nullptr, if the memory can't be allocated.
+ */
+using ChunkAllocator   = void* (*)(size_t size, size_t alignment);
+/**
+ * \brief ChunkDeallocator is the signature of the function, which frees chunks of ChunkAllocator.
+ */
+using ChunkDeallocator = void (*)(void* chunk, size_t size, size_t alignment);
+
+/**
+ * \brief FixedSizePool allocates blocks of the same size from big chunks of memory.
+ *
+ * Blocks are taken from the free list, so allocation and deallocation take the constant time, and blocks, which are
+ * allocated one after another, lie next to each other in memory. When the free list is empty, the pool allocates
+ * the new chunk, which is twice bigger than the previous one (up to maxBlocksPerChunk blocks). Chunks are never
+ * returned before the pool is destroyed, so the pool keeps the memory of the peak number of blocks.
+ *
+ * All methods are thread-safe.
+ */
+class FixedSizePool final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of FixedSizePool.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief The maximal number of blocks in one chunk.
+         */
+        static constexpr auto maxBlocksPerChunk = size_t{1'024};
+
+        /**
+         * \brief Constructs new empty FixedSizePool.
+         *
+         * \param blockSize      - the size of blocks in bytes.
+         * \param blockAlignment - the alignment of blocks, the power of 2.
+         * \throw std::invalid_argument, if the alignment isn't the power of 2.
+         */
+        FixedSizePool(size_t blockSize, size_t blockAlignment);
+        OGLS_NOT_COPYABLE_MOVABLE(FixedSizePool)
+        /**
+         * \brief Returns all chunks to the allocator, which has allocated them. All blocks must be deallocated.
+         */
+        ~FixedSizePool() noexcept;
+
+        /**
+         * \brief Returns the free block.
+         *
+         * \throw std::bad_alloc, if the new chunk can't be allocated.
+         */
+        void*  allocate();
+        /**
+         * \brief Returns the block to the pool.
+         *
+         * \param block - the block, which has been allocated by this pool.
+         */
+        void   deallocate(void* block) noexcept;
+        /**
+         * \brief Returns a number of allocated blocks.
+         */
+        size_t getAllocatedBlocksCount() const noexcept;
+        /**
+         * \brief Returns the size of blocks in bytes. It isn't less than the requested size.
+         */
+        size_t getBlockSize() const noexcept;
+        /**
+         * \brief Returns a number of blocks in all chunks.
+         */
+        size_t getCapacity() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class FixedSizePool
+
+/**
+ * \brief Sets the function, which allocates chunks of all pools, e.g. to take them from the arena.
+ *
+ * It is the allocator hook of the library. Already allocated chunks are freed by the allocator, which has allocated
+ * them, so the hook can be changed at any time. The memory of the chunk must stay valid, till the pool is destroyed.
+ *
+ * \param allocate   - the function, which allocates chunks. nullptr restores the default allocator, which uses
+ *                     the aligned global operator new.
+ * \param deallocate - the function, which frees chunks of the allocator, or nullptr, if chunks needn't be freed
+ *                     (e.g. the arena frees them all at once).
+ */
+void setPoolChunkAllocator(ChunkAllocator allocate, ChunkDeallocator deallocate);
+
+/**
+ * \brief Returns the pool of objects of the type.
+ *
+ * The pool is created on the first call and is never destroyed, so objects of the type can be deleted even by
+ * destructors of static objects.
+ */
+template<typename Type>
+FixedSizePool& getTypePool()
+{
+    static auto& pool = *new FixedSizePool{sizeof(Type), alignof(Type)};
+    return pool;
+}
+
+/**
+ * \brief Allocates the memory for the object of the type from the pool of the type.
+ *
+ * \param size - the size of the object. If it differs from the size of the type (e.g. it is the object of the derived
+ *               class), the memory is allocated by the global operator new.
+ * \throw std::bad_alloc.
+ */
+template<typename Type>
+void* allocateFromTypePool(size_t size)
+{
+    if (size != sizeof(Type))
+    {
+        return ::operator new(size, std::align_val_t{alignof(Type)});
+    }
+    return getTypePool<Type>().allocate();
+}
+
+/**
+ * \brief Frees the memory, which has been allocated by allocateFromTypePool().
+ *
+ * \param pointer - the pointer to the memory.
+ * \param size    - the size of the object, which has been passed to allocateFromTypePool().
+ */
+template<typename Type>
+void deallocateToTypePool(void* pointer, size_t size) noexcept
+{
+    if (size != sizeof(Type))
+    {
+        ::operator delete(pointer, size, std::align_val_t{alignof(Type)});
+        return;
+    }
+    getTypePool<Type>().deallocate(pointer);
+}
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef OGLS_HELPERS_SIMD_LANES_H
+#define OGLS_HELPERS_SIMD_LANES_H
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define OGLS_SIMD_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define OGLS_SIMD_USE_SSE2
+#endif
+
+/**
+ * \namespace ogls::helpers::simd
+ * \brief simd namespace contains the thin wrapper over SIMD instructions, which processes lanesCount neighbour
+ * floats at once. Masks are Lanes with all bits of the lane set or cleared.
+ *
+ * AVX2 is used if the including target is built with USE_AVX2, otherwise SSE2 or the portable code.
+ */
+namespace ogls::helpers::simd
+{
+#if defined(OGLS_SIMD_USE_AVX2)
+/**
+ * \brief A number of floats in Lanes.
+ */
+constexpr inline auto lanesCount = size_t{8};
+
+/**
+ * \brief Lanes is lanesCount floats processed by one instruction.
+ */
+struct Lanes final
+{
+        __m256 value;
+
+};  // struct Lanes
+
+inline Lanes operator+(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_add_ps(a.value, b.value)};
+}
+
+inline Lanes operator-(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_sub_ps(a.value, b.value)};
+}
+
+inline Lanes operator*(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_mul_ps(a.value, b.value)};
+}
+
+inline Lanes operator/(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_div_ps(a.value, b.value)};
+}
+
+inline Lanes operator&(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_and_ps(a.value, b.value)};
+}
+
+inline Lanes broadcast(float value) noexcept
+{
+    return {_mm256_set1_ps(value)};
+}
+
+inline Lanes greaterOrEqual(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_cmp_ps(a.value, b.value, _CMP_GE_OQ)};
+}
+
+inline Lanes laneIndices() noexcept
+{
+    return {_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f)};
+}
+
+inline Lanes load(const float* data) noexcept
+{
+    return {_mm256_loadu_ps(data)};
+}
+
+inline Lanes max(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_max_ps(a.value, b.value)};
+}
+
+inline Lanes min(Lanes a, Lanes b) noexcept
+{
+    return {_mm256_min_ps(a.value, b.value)};
+}
+
+inline Lanes select(Lanes mask, Lanes ifSet, Lanes ifCleared) noexcept
+{
+    return {_mm256_blendv_ps(ifCleared.value, ifSet.value, mask.value)};
+}
+
+inline Lanes sqrt(Lanes a) noexcept
+{
+    return {_mm256_sqrt_ps(a.value)};
+}
+
+inline void store(float* data, Lanes lanes) noexcept
+{
+    _mm256_storeu_ps(data, lanes.value);
+}
+
+inline uint32_t toBits(Lanes mask) noexcept
+{
+    return static_cast<uint32_t>(_mm256_movemask_ps(mask.value));
+}
+
+#elif defined(OGLS_SIMD_USE_SSE2)
+/**
+ * \brief A number of floats in Lanes.
+ */
+constexpr inline auto lanesCount = size_t{4};
+
+/**
+ * \brief Lanes is lanesCount floats processed by one instruction.
+ */
+struct Lanes final
+{
+        __m128 value;
+
+};  // struct Lanes
+
+inline Lanes operator+(Lanes a, Lanes b) noexcept
+{
+    return {_mm_add_ps(a.value, b.value)};
+}
+
+inline Lanes operator-(Lanes a, Lanes b) noexcept
+{
+    return {_mm_sub_ps(a.value, b.value)};
+}
+
+inline Lanes operator*(Lanes a, Lanes b) noexcept
+{
+    return {_mm_mul_ps(a.value, b.value)};
+}
+
+inline Lanes operator/(Lanes a, Lanes b) noexcept
+{
+    return {_mm_div_ps(a.value, b.value)};
+}
+
+inline Lanes operator&(Lanes a, Lanes b) noexcept
+{
+    return {_mm_and_ps(a.value, b.value)};
+}
+
+inline Lanes broadcast(float value) noexcept
+{
+    return {_mm_set1_ps(value)};
+}
+
+inline Lanes greaterOrEqual(Lanes a, Lanes b) noexcept
+{
+    return {_mm_cmpge_ps(a.value, b.value)};
+}
+
+inline Lanes laneIndices() noexcept
+{
+    return {_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)};
+}
+
+inline Lanes load(const float* data) noexcept
+{
+    return {_mm_loadu_ps(data)};
+}
+
+inline Lanes max(Lanes a, Lanes b) noexcept
+{
+    return {_mm_max_ps(a.value, b.value)};
+}
+
+inline Lanes min(Lanes a, Lanes b) noexcept
+{
+    return {_mm_min_ps(a.value, b.value)};
+}
+
+inline Lanes select(Lanes mask, Lanes ifSet, Lanes ifCleared) noexcept
+{
+    // SSE2 has no blend instruction
+    return {_mm_or_ps(_mm_and_ps(mask.value, ifSet.value), _mm_andnot_ps(mask.value, ifCleared.value))};
+}
+
+inline Lanes sqrt(Lanes a) noexcept
+{
+    return {_mm_sqrt_ps(a.value)};
+}
+
+inline void store(float* data, Lanes lanes) noexcept
+{
+    _mm_storeu_ps(data, lanes.value);
+}
+
+inline uint32_t toBits(Lanes mask) noexcept
+{
+    return static_cast<uint32_t>(_mm_movemask_ps(mask.value));
+}
+
+#else
+/**
+ * \brief A number of floats in Lanes.
+ */
+constexpr inline auto lanesCount = size_t{4};
+
+/**
+ * \brief Lanes is lanesCount floats, which are processed one by one on CPUs without supported SIMD instructions.
+ */
+struct Lanes final
+{
+        std::array<float, lanesCount> value;
+
+};  // struct Lanes
+
+namespace detail
+{
+    template<typename Func>
+    inline Lanes apply(Lanes a, Lanes b, Func func) noexcept
+    {
+        auto result = Lanes{};
+        for (auto i = size_t{0}; i < lanesCount; ++i)
+        {
+            result.value[i] = func(a.value[i], b.value[i]);
+        }
+        return result;
+    }
+
+    inline float fromBits(uint32_t bits) noexcept
+    {
+        return std::bit_cast<float>(bits);
+    }
+
+    inline uint32_t toBits(float value) noexcept
+    {
+        return std::bit_cast<uint32_t>(value);
+    }
+
+}  // namespace detail
+
+inline Lanes operator+(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return x + y; });
+}
+
+inline Lanes operator-(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return x - y; });
+}
+
+inline Lanes operator*(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return x * y; });
+}
+
+inline Lanes operator/(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return x / y; });
+}
+
+inline Lanes operator&(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b,
+                         [](float x, float y) { return detail::fromBits(detail::toBits(x) & detail::toBits(y)); });
+}
+
+inline Lanes broadcast(float value) noexcept
+{
+    return {value, value, value, value};
+}
+
+inline Lanes greaterOrEqual(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return detail::fromBits(x >= y ? ~uint32_t{0} : 0); });
+}
+
+inline Lanes laneIndices() noexcept
+{
+    return {0.0f, 1.0f, 2.0f, 3.0f};
+}
+
+inline Lanes load(const float* data) noexcept
+{
+    return {data[0], data[1], data[2], data[3]};
+}
+
+inline Lanes max(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return x < y ? y : x; });
+}
+
+inline Lanes min(Lanes a, Lanes b) noexcept
+{
+    return detail::apply(a, b, [](float x, float y) { return y < x ? y : x; });
+}
+
+inline Lanes select(Lanes mask, Lanes ifSet, Lanes ifCleared) noexcept
+{
+    auto result = Lanes{};
+    for (auto i = size_t{0}; i < lanesCount; ++i)
+    {
+        result.value[i] = detail::toBits(mask.value[i]) != 0 ? ifSet.value[i] : ifCleared.value[i];
+    }
+    return result;
+}
+
+inline Lanes sqrt(Lanes a) noexcept
+{
+    return detail::apply(a, a, [](float x, float) { return std::sqrt(x); });
+}
+
+inline void store(float* data, Lanes lanes) noexcept
+{
+    for (auto i = size_t{0}; i < lanesCount; ++i)
+    {
+        data[i] = lanes.value[i];
+    }
+}
+
+inline uint32_t toBits(Lanes mask) noexcept
+{
+    auto bits = uint32_t{0};
+    for (auto i = size_t{0}; i < lanesCount; ++i)
+    {
+        bits |= (detail::toBits(mask.value[i]) >> 31) << i;
+    }
+    return bits;
+}
+
+#endif
+
+}  // namespace ogls::helpers::simd
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef OGLS_HELPERS_THREAD_POOL_H
+#define OGLS_HELPERS_THREAD_POOL_H
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief ThreadPool is a fixed set of worker threads, which execute submitted tasks.
+ *
+ * Tasks must not call OpenGL functions, because OpenGL context is current only in the main thread.
+ */
+class ThreadPool final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of ThreadPool.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new ThreadPool and starts worker threads.
+         *
+         * \param threadsNumber - a number of worker threads. If it is 0, one worker thread is started.
+         */
+        explicit ThreadPool(size_t threadsNumber = std::thread::hardware_concurrency());
+        OGLS_NOT_COPYABLE_MOVABLE(ThreadPool)
+        /**
+         * \brief Waits for completion of all submitted tasks and joins worker threads.
+         */
+        ~ThreadPool() noexcept;
+
+        /**
+         * \brief Returns a number of worker threads.
+         */
+        size_t getThreadsNumber() const noexcept;
+        /**
+         * \brief Calls func(i) for every i in the range [0, count) and waits for completion of all calls.
+         *
+         * The range is split into chunks, which are executed by worker threads and by the calling thread.
+         * If func throws an exception, the first thrown exception is rethrown after completion of all chunks.
+         * Must not be called from a task of the same ThreadPool.
+         *
+         * \param count - a number of iterations.
+         * \param func  - a function to call for every iteration.
+         */
+        void   parallelFor(size_t count, const std::function<void(size_t)>& func);
+        /**
+         * \brief Submits the task for asynchronous execution by a worker thread.
+         *
+         * \param task - a callable object without parameters.
+         * \return std::future with the result of the task.
+         */
+        template<typename Func>
+        auto   submit(Func&& task) -> std::future<std::invoke_result_t<std::decay_t<Func>>>
+        {
+            using ResultType = std::invoke_result_t<std::decay_t<Func>>;
+
+            auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(task));
+            auto result       = packagedTask->get_future();
+            pushTask([packagedTask]() { (*packagedTask)(); });
+            return result;
+        }
+
+    private:
+        /**
+         * \brief Adds the task in the queue of tasks and wakes up one worker thread.
+         */
+        void pushTask(std::function<void()> task);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class ThreadPool
+
+/**
+ * \brief Returns the ThreadPool, which is shared by all subsystems of the program.
+ *
+ * The pool is created on the first call with std::thread::hardware_concurrency() - 1 worker threads,
+ * because the calling thread participates in ThreadPool::parallelFor() too.
+ */
+ThreadPool& getDefaultThreadPool();
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef OGLS_HELPERS_TRIPLE_BUFFER_H
+#define OGLS_HELPERS_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief TripleBuffer passes the latest value from one writer thread to one reader thread without locks and waits.
+ *
+ * The writer owns one slot, the reader owns another one, and the third slot is the exchange slot. publish() swaps
+ * the slot of the writer with the exchange slot and marks it as fresh, acquireLatest() takes the exchange slot,
+ * if it is fresh. So the writer never waits for the reader, the reader always sees the complete value and skips
+ * values, which were overwritten before it has read them.
+ *
+ * \param Type - the type of values. It must be default constructible.
+ */
+template<typename Type>
+class TripleBuffer final
+{
+    public:
+        /**
+         * \brief Constructs new TripleBuffer with default constructed values.
+         */
+        TripleBuffer() = default;
+
+        /**
+         * \brief Constructs new TripleBuffer, all slots of which are copies of the value.
+         *
+         * \param value - the initial value, which the reader sees till the first publish().
+         */
+        explicit TripleBuffer(const Type& value) : m_slots{value, value, value}
+        {
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(TripleBuffer)
+        ~TripleBuffer() noexcept = default;
+
+        /**
+         * \brief Takes the latest published value, if there is the one, which the reader hasn't taken yet.
+         * It must be called only by the reader thread.
+         *
+         * \return true if the read value has been replaced by the newer one, false otherwise.
+         */
+        bool        acquireLatest() noexcept
+        {
+            if ((m_exchangeSlot.load(std::memory_order_relaxed) & freshBit) == 0)
+            {
+                return false;
+            }
+
+            const auto latest = m_exchangeSlot.exchange(m_readSlot, std::memory_order_acq_rel);
+            m_readSlot        = static_cast<uint8_t>(latest & slotMask);
+            return true;
+        }
+
+        /**
+         * \brief Returns the value, which the reader has taken by the last acquireLatest().
+         * It must be called only by the reader thread.
+         */
+        const Type& getReadValue() const noexcept
+        {
+            return m_slots[m_readSlot];
+        }
+
+        /**
+         * \brief Returns the slot, into which the writer writes the next value. It must be called only by the
+         * writer thread.
+         *
+         * The slot contains the value, which was published two or more publish() ago, so the value must be
+         * overwritten completely.
+         */
+        Type&       getWriteValue() noexcept
+        {
+            return m_slots[m_writeSlot];
+        }
+
+        /**
+         * \brief Makes the written value available for the reader. It must be called only by the writer thread.
+         */
+        void        publish() noexcept
+        {
+            const auto previous = m_exchangeSlot.exchange(static_cast<uint8_t>(m_writeSlot | freshBit),
+                                                          std::memory_order_acq_rel);
+            m_writeSlot         = static_cast<uint8_t>(previous & slotMask);
+        }
+
+    private:
+        /**
+         * \brief The bit of the exchange slot, which is set, if the slot contains the value unseen by the reader.
+         */
+        static constexpr auto freshBit = uint8_t{4};
+        static constexpr auto slotMask = uint8_t{3};
+
+    private:
+        // Indices of the reader and the writer are on different cache lines, so threads don't invalidate them
+        alignas(64) std::atomic<uint8_t> m_exchangeSlot = {1};
+        alignas(64) uint8_t              m_readSlot     = {0};
+        std::array<Type, 3>              m_slots;
+        alignas(64) uint8_t              m_writeSlot    = {2};
+
+};  // class TripleBuffer
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef OGLS_HELPERS_VIRTUAL_FILE_SYSTEM_H
+#define OGLS_HELPERS_VIRTUAL_FILE_SYSTEM_H
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "helpers/macros.h"
+
+namespace ogls::helpers
+{
+/**
+ * \brief FileView is the read-only content of the file returned by VirtualFileSystem.
+ *
+ * It keeps alive the memory, which the content is stored in (the mapped archive, the mapped loose file or
+ * the buffer with decompressed data), so the view stays valid as long as the FileView exists.
+ */
+class FileView final
+{
+    public:
+        FileView() = default;
+        OGLS_DEFAULT_COPYABLE_MOVABLE(FileView)
+        /**
+         * \brief Constructs new FileView.
+         *
+         * \param data  - the content of the file.
+         * \param owner - the object, which owns the memory of the content.
+         */
+        FileView(std::span<const std::byte> data, std::shared_ptr<const void> owner) noexcept;
+        ~FileView() noexcept = default;
+
+        /**
+         * \brief Returns the content of the file.
+         */
+        std::span<const std::byte> getData() const noexcept;
+        /**
+         * \brief Returns the content of the file as text.
+         */
+        std::string_view           getText() const noexcept;
+
+    private:
+        /**
+         * \brief The content of the file.
+         */
+        std::span<const std::byte>  m_data;
+        /**
+         * \brief The object, which owns the memory of the content.
+         */
+        std::shared_ptr<const void> m_owner = nullptr;
+
+};  // class FileView
+
+/**
+ * \brief VirtualFileSystem reads files from mounted asset archives and falls back to loose files on the disk.
+ *
+ * Archives are searched in the reverse order of mounting, so the later mounted archive overrides the earlier ones.
+ * Uncompressed files are returned as views of the mapped archive without any copying. Loose files are mapped too.
+ * The fallback to loose files is intended for the development, when assets are not cooked yet.
+ *
+ * Mounting must not be done concurrently with reading, but reading can be done from any number of threads.
+ */
+class VirtualFileSystem final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of VirtualFileSystem.
+         */
+        class Impl;
+
+    public:
+        VirtualFileSystem();
+        OGLS_NOT_COPYABLE_MOVABLE(VirtualFileSystem)
+        ~VirtualFileSystem() noexcept;
+
+        /**
+         * \brief Checks if the file exists in any mounted archive or as a loose file (if the fallback is enabled).
+         */
+        bool     isFileExist(std::string_view pathToFile) const;
+        /**
+         * \brief Checks if reading of loose files is enabled.
+         */
+        bool     isLooseFilesEnabled() const noexcept;
+        /**
+         * \brief Mounts the asset archive.
+         *
+         * \param pathToArchive - a path to the archive file.
+         * \throw ogls::exceptions::FileOpeningException(), ogls::exceptions::FileReadingException().
+         */
+        void     mountArchive(const std::filesystem::path& pathToArchive);
+        /**
+         * \brief Reads the file.
+         *
+         * \param pathToFile - a path to the file relatively to the root folder.
+         * \return the content of the file.
+         * \throw ogls::exceptions::FileOpeningException() if the file doesn't exist,
+         * ogls::exceptions::FileReadingException() if the packed file is corrupted.
+         */
+        FileView readFile(std::string_view pathToFile) const;
+        /**
+         * \brief Enables or disables reading of loose files. It is enabled by default.
+         */
+        void     setLooseFilesEnabled(bool isEnabled) noexcept;
+        /**
+         * \brief Unmounts all archives.
+         */
+        void     unmountAll() noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class VirtualFileSystem
+
+/**
+ * \brief Returns the file system, which is used by ogls::helpers::readTextFromFile() and
+ * ogls::helpers::readTextureFromFile().
+ */
+VirtualFileSystem& getDefaultVirtualFileSystem();
+
+}  // namespace ogls::helpers
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef OGLS_MATHCORE_BOUNDING_BOX_H
+#define OGLS_MATHCORE_BOUNDING_BOX_H
+
+#include "mathCore/matrix.h"
+#include "mathCore/vector.h"
+
+namespace ogls::mathCore
+{
+/**
+ * \brief BoundingBox is an axis-aligned box, which encloses the object.
+ *
+ * It is stored as the center and half sizes, because this form is the cheapest one to transform and
+ * to test against planes.
+ */
+struct BoundingBox final
+{
+        /**
+         * \brief The center of the box.
+         */
+        Vec3 center      = Vec3{0.0f};
+        /**
+         * \brief Half of the width, the height and the depth of the box.
+         */
+        Vec3 halfExtents = Vec3{0.0f};
+
+};  // struct BoundingBox
+
+/**
+ * \brief Calculates the axis-aligned box, which encloses the box transformed by the affine transformation.
+ *
+ * \param box       - the box in the local coordinate system.
+ * \param transform - the affine transformation Matrix<4, 4> in the format of the selected graphical API.
+ * \return the axis-aligned box in the target coordinate system.
+ */
+BoundingBox transformBoundingBox(const BoundingBox& box, const Mat4& transform) noexcept;
+
+}  // namespace ogls::mathCore
+
+#endif
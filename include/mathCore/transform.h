@@ -0,0 +1,75 @@
+#ifndef OGLS_MATHCORE_TRANSFORM_H
+#define OGLS_MATHCORE_TRANSFORM_H
+
+#include <array>
+
+#include "mathCore/matrix.h"
+#include "mathCore/transformMatrix.h"
+#include "mathCore/vector.h"
+
+namespace ogls::mathCore
+{
+/**
+ * \brief Transform is a decomposed (translation, rotation, scale) affine transformation of the object.
+ *
+ * Unlike TransformMatrix, Transform stores the components instead of the queue of operations, so it is cheap
+ * to copy, to change and to convert into Matrix<4, 4>. The components have the same meaning as the arguments of
+ * TransformMatrix::addTranslation(), TransformMatrix::addRotation() and TransformMatrix::addScale().
+ *
+ * The transformation is applied in the order: scale, rotation, translation.
+ */
+struct Transform final
+{
+        /**
+         * \brief The rotation angle in degrees.
+         */
+        float rotationAngle = {0.0f};
+        /**
+         * \brief The axis of rotation (normalized vector).
+         */
+        Vec3  rotationAxis  = Vec3{0.0f, 0.0f, 1.0f};
+        /**
+         * \brief The scale coefficients of X, Y and Z components.
+         */
+        Vec3  scale         = Vec3{1.0f};
+        /**
+         * \brief The translation Vector<3>.
+         */
+        Vec3  translation   = Vec3{0.0f};
+
+};  // struct Transform
+
+/**
+ * \brief Multiplies two affine transformation matrices in the required order of the selected graphical API.
+ *
+ * The result is the transformation, which applies local at first and parent after that
+ * (parent * local for column vectors, local * parent for row vectors).
+ * The last row (column for row vectors) of both matrices is assumed to be (0, 0, 0, 1),
+ * what allows to skip a quarter of multiplications.
+ *
+ * \param parent - the transformation of the parent coordinate system.
+ * \param local  - the transformation relatively to the parent coordinate system.
+ * \return combined transformation Matrix<4, 4>.
+ */
+Mat4 combineAffineTransforms(const Mat4& parent, const Mat4& local) noexcept;
+/**
+ * \brief Converts the Transform into the Matrix<4, 4> in the format of the selected graphical API.
+ *
+ * \param transform - the Transform to convert.
+ * \return the transformation Matrix<4, 4>.
+ */
+Mat4 makeTransformMatrix(const Transform& transform);
+/**
+ * \brief Returns elements of the transformation in the column-major order of mat4 in GLSL.
+ *
+ * It is used to write the transformation into buffers, which shaders read, so the shader multiplies the matrix by
+ * column vectors. Matrix<4, 4> stores elements row by row, so the transformation for column vectors is transposed.
+ *
+ * \param matrix - the transformation Matrix<4, 4> in the format of the selected graphical API.
+ * \return 16 elements of the transformation column by column.
+ */
+std::array<float, 16> toGpuMatrix(const Mat4& matrix) noexcept;
+
+}  // namespace ogls::mathCore
+
+#endif
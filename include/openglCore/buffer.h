@@ -56,9 +56,10 @@ class Buffer : public ICloneable
          */
         Buffer(Buffer&& obj) noexcept;
         /**
-         * \brief Deletes the buffer object in OpenGL state machine.
+         * \brief Releases the buffer object. It is deleted in OpenGL state machine, when the GPU completes the current
+         * frame.
          *
-         * Wraps [glDeleteBuffers()](https://docs.gl/gl4/glDeleteBuffers).
+         * \see ogls::oglCore::objectNamesManager::releaseBufferName().
          */
         ~Buffer() noexcept;
 
@@ -77,6 +78,27 @@ class Buffer : public ICloneable
          * \brief Wraps [glBindBuffer()](https://docs.gl/gl4/glBindBuffer).
          */
         void                              bind() const;
+        /**
+         * \brief Binds the buffer to the binding point of the indexed target, through which shaders access it.
+         *
+         * Wraps [glBindBufferBase()](https://docs.gl/gl4/glBindBufferBase). The target may differ from the target
+         * of the buffer, e.g. the indirect draw buffer can be filled by the compute shader as the shader storage.
+         *
+         * \param target - one of BufferTarget::AtomicCounterBuffer, BufferTarget::ShaderStorageBuffer,
+         *                 BufferTarget::TransformFeedbackBuffer, BufferTarget::UniformBuffer.
+         * \param index  - the index of the binding point, which is set by 'binding' layout qualifier in the shader.
+         * \throw std::invalid_argument, if the target isn't indexed.
+         */
+        void                              bindBase(BufferTarget target, GLuint index) const;
+        /**
+         * \brief Binds the buffer to the target, which differs from the target of the buffer.
+         *
+         * Wraps [glBindBuffer()](https://docs.gl/gl4/glBindBuffer). It is needed, when the same data store is
+         * used in several roles, e.g. the atomic counter is read as the draw count from BufferTarget::ParameterBuffer.
+         *
+         * \param target - the target to bind the buffer to.
+         */
+        void                              bindToTarget(BufferTarget target) const;
         /**
          * \brief Returns data of the Buffer.
          *
@@ -89,6 +111,28 @@ class Buffer : public ICloneable
          * \return layout of the Buffer.
          */
         std::optional<VertexBufferLayout> getLayout() const noexcept;
+        /**
+         * \brief Invalidates the content of the data store of the buffer.
+         *
+         * Wraps [glInvalidateBufferData()](https://docs.gl/gl4/glInvalidateBufferData).
+         * It allows the driver to orphan the storage instead of synchronizing with pending draw calls,
+         * what is useful for streaming buffers, which are rewritten every frame.
+         */
+        void                              invalidateData();
+        /**
+         * \brief Maps the part of the data store of the buffer into the client's address space.
+         *
+         * Wraps [glMapNamedBufferRange()](https://docs.gl/gl4/glMapBufferRange). The buffer can't be used by
+         * OpenGL commands till unmap(), unless it is mapped persistently.
+         *
+         * \param byteOffset - the offset in bytes of the beginning of the mapped range.
+         * \param length     - the length in bytes of the mapped range.
+         * \param access     - bitwise OR of BufferMapAccessBit values.
+         * \return the pointer to the mapped range.
+         * \throw std::out_of_range, if the range doesn't fit into the data store,
+         * std::runtime_error, if the range can't be mapped.
+         */
+        void*                             mapRange(GLintptr byteOffset, GLsizeiptr length, GLbitfield access);
         /**
          * \brief Sets new Buffer data and loads it in OpenGL buffer.
          *
@@ -99,10 +143,30 @@ class Buffer : public ICloneable
          * \param data - data, which must be set in OpenGL buffer.
          */
         void                              setData(ArrayData data);
+        /**
+         * \brief Loads the data in the part of the data store of OpenGL buffer.
+         *
+         * Wraps [glNamedBufferSubData()](https://docs.gl/gl4/glBufferSubData). The data store is not reallocated
+         * and the data returned by getData() is not changed.
+         *
+         * \param byteOffset - the offset in bytes into the data store, where the data replacement will begin.
+         * \param data       - data, which must be loaded in OpenGL buffer.
+         * \throw std::out_of_range, if the data doesn't fit into the data store.
+         */
+        void                              setSubData(GLintptr byteOffset, const ArrayData& data);
         /**
          * \brief Calls unbindTarget() with the target of the buffer.
          */
         void                              unbind() const;
+        /**
+         * \brief Releases the mapping of the data store, which was created by mapRange().
+         *
+         * Wraps [glUnmapNamedBuffer()](https://docs.gl/gl4/glUnmapBuffer).
+         *
+         * \return false if the data store has become corrupt while it was mapped (e.g. the screen mode has changed),
+         * and it must be loaded again, true otherwise.
+         */
+        bool                              unmap();
 
         Buffer* clone() const override;
 
@@ -0,0 +1,95 @@
+#ifndef OGLS_OGLCORE_SYNC_FENCE_H
+#define OGLS_OGLCORE_SYNC_FENCE_H
+
+#include <chrono>
+#include <memory>
+
+#include <glad/glad.h>
+
+#include "helpers/macros.h"
+
+/**
+ * \namespace ogls::oglCore::sync
+ * \brief sync namespace contains types and functions, which are related to OpenGL sync objects.
+ */
+namespace ogls::oglCore::sync
+{
+/**
+ * \brief Fence is a wrapper over OpenGL fence sync object.
+ *
+ * The fence is signaled, when the GPU completes all commands, which were issued before insert(). So the CPU can
+ * find out, when the GPU has finished the frame, and can limit the number of frames queued to the GPU.
+ *
+ * \see [Sync Object](https://www.khronos.org/opengl/wiki/Sync_Object).
+ */
+class Fence final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of Fence.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new empty Fence. The sync object is created by insert().
+         */
+        Fence();
+        /**
+         * \brief Constructs new Fence as move-copy of other Fence.
+         */
+        Fence(Fence&& obj) noexcept;
+        OGLS_NOT_COPYABLE(Fence)
+        /**
+         * \brief Deletes the sync object in OpenGL state machine.
+         *
+         * Wraps [glDeleteSync()](https://docs.gl/gl4/glDeleteSync).
+         */
+        ~Fence() noexcept;
+
+        /**
+         * \brief Move-copies the state of other Fence.
+         */
+        Fence& operator=(Fence&& obj) noexcept;
+
+        /**
+         * \brief Replaces the sync object by the new one, which is signaled after all previous commands.
+         *
+         * Wraps [glFenceSync()](https://docs.gl/gl4/glFenceSync) with GL_SYNC_GPU_COMMANDS_COMPLETE.
+         *
+         * \throw ogls::exceptions::GLRecAcquisitionException().
+         */
+        void insert();
+        /**
+         * \brief Checks whether the sync object has been created by insert().
+         */
+        bool isInserted() const noexcept;
+        /**
+         * \brief Checks without waiting whether the fence is signaled. The empty fence is signaled.
+         *
+         * Wraps [glGetSynciv()](https://docs.gl/gl4/glGetSync) with GL_SYNC_STATUS.
+         */
+        bool isSignaled() const;
+        /**
+         * \brief Blocks the calling thread till the fence is signaled or the timeout ends. The empty fence is
+         * signaled.
+         *
+         * Wraps [glClientWaitSync()](https://docs.gl/gl4/glClientWaitSync) with GL_SYNC_FLUSH_COMMANDS_BIT, so
+         * the fence can't wait forever for not flushed commands.
+         *
+         * \param timeout - the maximal time of waiting.
+         * \return true if the fence is signaled, false if the timeout has ended.
+         */
+        bool wait(std::chrono::nanoseconds timeout) const;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class Fence
+
+}  // namespace ogls::oglCore::sync
+
+#endif
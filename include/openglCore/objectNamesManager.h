@@ -0,0 +1,121 @@
+#ifndef OGLS_OGLCORE_OBJECT_NAMES_MANAGER_H
+#define OGLS_OGLCORE_OBJECT_NAMES_MANAGER_H
+
+#include <cstddef>
+
+#include <glad/glad.h>
+
+#include "textureTypes.h"
+
+namespace ogls::oglCore
+{
+/**
+ * \brief objectNamesManager namespace contains functions, which create and delete names of OpenGL buffers, textures
+ * and vertex arrays in batches.
+ *
+ * Names are created by one glCreate*() call for the whole batch and are given out one by one. Released names aren't
+ * deleted at once, because the deletion of the object, which the GPU still uses, can stall the driver. They are
+ * collected during the frame and are deleted by one glDelete*() call per type, when the fence of the frame shows,
+ * that the GPU has completed it.
+ *
+ * All functions must be called in the thread of the OpenGL context.
+ */
+namespace objectNamesManager
+{
+    /**
+     * \brief The default number of names, which are created at once.
+     */
+    inline constexpr auto defaultNameBatchSize = GLsizei{32};
+
+    /**
+     * \brief Returns the name of the new buffer object.
+     *
+     * Wraps [glCreateBuffers()](https://docs.gl/gl4/glCreateBuffers), if created names are over.
+     *
+     * \throw ogls::exceptions::GLRecAcquisitionException().
+     */
+    GLuint acquireBufferName();
+    /**
+     * \brief Returns the name of the new texture of the target.
+     *
+     * Wraps [glCreateTextures()](https://docs.gl/gl4/glCreateTextures), if created names of the target are over.
+     *
+     * \param target - the target of the texture. It can't be changed after the creation.
+     * \throw ogls::exceptions::GLRecAcquisitionException().
+     */
+    GLuint acquireTextureName(texture::TextureTarget target);
+    /**
+     * \brief Returns the name of the new vertex array object.
+     *
+     * Wraps [glCreateVertexArrays()](https://docs.gl/gl4/glCreateVertexArrays), if created names are over.
+     *
+     * \throw ogls::exceptions::GLRecAcquisitionException().
+     */
+    GLuint acquireVertexArrayName();
+    /**
+     * \brief Deletes all released objects without waiting for the GPU, e.g. after unloading of the level.
+     *
+     * Wraps [glDeleteBuffers()](https://docs.gl/gl4/glDeleteBuffers),
+     * [glDeleteTextures()](https://docs.gl/gl4/glDeleteTextures)
+     * and [glDeleteVertexArrays()](https://docs.gl/gl4/glDeleteVertexArrays).
+     */
+    void   deleteReleasedObjects();
+    /**
+     * \brief Marks the end of the frame, which has been submitted to the GPU.
+     *
+     * Objects, which have been released during the frame, wait for the fence, which is inserted after the frame.
+     * Objects of frames, which fences are signaled, are deleted.
+     *
+     * Wraps [glDeleteBuffers()](https://docs.gl/gl4/glDeleteBuffers),
+     * [glDeleteTextures()](https://docs.gl/gl4/glDeleteTextures)
+     * and [glDeleteVertexArrays()](https://docs.gl/gl4/glDeleteVertexArrays).
+     *
+     * \throw ogls::exceptions::GLRecAcquisitionException(), if the fence cannot be created.
+     */
+    void   endFrame();
+    /**
+     * \brief Returns the number of released objects, which haven't been deleted yet.
+     */
+    size_t getReleasedObjectsCount() noexcept;
+    /**
+     * \brief Releases the buffer object. It is deleted, when the GPU completes the current frame.
+     *
+     * \param bufferId - the name of the buffer or 0, which is ignored.
+     */
+    void   releaseBufferName(GLuint bufferId);
+    /**
+     * \brief Releases the texture. It is deleted, when the GPU completes the current frame.
+     *
+     * \param textureId - the name of the texture or 0, which is ignored.
+     */
+    void   releaseTextureName(GLuint textureId);
+    /**
+     * \brief Releases the vertex array object. It is deleted, when the GPU completes the current frame.
+     *
+     * \param vaoId - the name of the vertex array object or 0, which is ignored.
+     */
+    void   releaseVertexArrayName(GLuint vaoId);
+    /**
+     * \brief Sets the number of names, which are created at once. Already created names are kept.
+     *
+     * \param batchSize - the number of names.
+     * \throw std::invalid_argument, if batchSize is less than 1.
+     */
+    void   setNameBatchSize(GLsizei batchSize);
+    /**
+     * \brief Deletes all released objects and all created names, which haven't been given out.
+     *
+     * It must be called after the destruction of the last OpenGL object, while the context is still current.
+     * ogls::Window calls it before the destruction of the context. Names, which are released later, aren't deleted.
+     *
+     * Wraps [glDeleteBuffers()](https://docs.gl/gl4/glDeleteBuffers),
+     * [glDeleteTextures()](https://docs.gl/gl4/glDeleteTextures)
+     * and [glDeleteVertexArrays()](https://docs.gl/gl4/glDeleteVertexArrays).
+     */
+    void   shutdown();
+
+}  // namespace objectNamesManager
+
+}  // namespace ogls::oglCore
+
+#endif
@@ -15,6 +15,7 @@ namespace ogls::oglCore
 enum class LimitName : GLenum
 {
     MaxCombinedTextureImageUnits = 0x8B'4D,
+    MaxTextureImageUnits         = 0x88'72,
     MaxVertexAttribs             = 0x88'69
 };
 
@@ -0,0 +1,397 @@
+#ifndef OGLS_OGLCORE_PIPELINE_PIPELINE_STATE_H
+#define OGLS_OGLCORE_PIPELINE_PIPELINE_STATE_H
+
+#include <memory>
+
+#include <glad/glad.h>
+
+#include "helpers/macros.h"
+#include "shaderProgram.h"
+#include "vertexArray.h"
+
+/**
+ * \namespace ogls::oglCore::pipeline
+ * \brief pipeline namespace contains types and functions, which describe and apply the fixed-function state
+ * of OpenGL pipeline (blending, depth test, culling, polygon mode, viewport etc.).
+ */
+namespace ogls::oglCore::pipeline
+{
+/**
+ * \brief BlendEquation represents 'mode' parameter of
+ * [glBlendEquationSeparate()](https://docs.gl/gl4/glBlendEquationSeparate).
+ */
+enum class BlendEquation : GLenum
+{
+    FuncAdd             = 0x80'06,
+    FuncReverseSubtract = 0x80'0B,
+    FuncSubtract        = 0x80'0A,
+    Max                 = 0x80'08,
+    Min                 = 0x80'07
+};
+
+/**
+ * \brief BlendFactor represents 'sfactor' and 'dfactor' parameters of
+ * [glBlendFuncSeparate()](https://docs.gl/gl4/glBlendFuncSeparate).
+ */
+enum class BlendFactor : GLenum
+{
+    ConstantAlpha         = 0x80'03,
+    ConstantColor         = 0x80'01,
+    DstAlpha              = 0x03'04,
+    DstColor              = 0x03'06,
+    One                   = 0x00'01,
+    OneMinusConstantAlpha = 0x80'04,
+    OneMinusConstantColor = 0x80'02,
+    OneMinusDstAlpha      = 0x03'05,
+    OneMinusDstColor      = 0x03'07,
+    OneMinusSrcAlpha      = 0x03'03,
+    OneMinusSrcColor      = 0x03'01,
+    SrcAlpha              = 0x03'02,
+    SrcAlphaSaturate      = 0x03'08,
+    SrcColor              = 0x03'00,
+    Zero                  = 0x00'00
+};
+
+/**
+ * \brief ClearBufferBit represents bits of 'mask' parameter of [glClear()](https://docs.gl/gl4/glClear).
+ */
+enum class ClearBufferBit : GLbitfield
+{
+    ColorBufferBit   = 0x40'00,
+    DepthBufferBit   = 0x01'00,
+    StencilBufferBit = 0x04'00
+};
+
+/**
+ * \brief CompareFunction represents 'func' parameter of [glDepthFunc()](https://docs.gl/gl4/glDepthFunc).
+ */
+enum class CompareFunction : GLenum
+{
+    Always   = 0x02'07,
+    Equal    = 0x02'02,
+    Gequal   = 0x02'06,
+    Greater  = 0x02'04,
+    Lequal   = 0x02'03,
+    Less     = 0x02'01,
+    Never    = 0x02'00,
+    Notequal = 0x02'05
+};
+
+/**
+ * \brief CullFaceMode represents 'mode' parameter of [glCullFace()](https://docs.gl/gl4/glCullFace).
+ */
+enum class CullFaceMode : GLenum
+{
+    Back         = 0x04'05,
+    Front        = 0x04'04,
+    FrontAndBack = 0x04'08
+};
+
+/**
+ * \brief FrontFaceDirection represents 'mode' parameter of [glFrontFace()](https://docs.gl/gl4/glFrontFace).
+ */
+enum class FrontFaceDirection : GLenum
+{
+    Ccw = 0x09'01,
+    Cw  = 0x09'00
+};
+
+/**
+ * \brief PolygonMode represents 'mode' parameter of [glPolygonMode()](https://docs.gl/gl4/glPolygonMode).
+ */
+enum class PolygonMode : GLenum
+{
+    Fill  = 0x1B'02,
+    Line  = 0x1B'01,
+    Point = 0x1B'00
+};
+
+/**
+ * \brief BlendState describes the blending stage of the pipeline.
+ *
+ * \see [Blending](https://www.khronos.org/opengl/wiki/Blending).
+ */
+struct BlendState final
+{
+        bool operator==(const BlendState&) const noexcept = default;
+
+        /**
+         * \brief The blend equation of alpha component.
+         */
+        BlendEquation alphaEquation         = BlendEquation::FuncAdd;
+        /**
+         * \brief The destination blend factor of alpha component.
+         */
+        BlendFactor   dstAlpha              = BlendFactor::Zero;
+        /**
+         * \brief The destination blend factor of RGB components.
+         */
+        BlendFactor   dstRgb                = BlendFactor::Zero;
+        /**
+         * \brief Specification whether writing into the color buffer is enabled
+         * (see [glColorMask()](https://docs.gl/gl4/glColorMask)). Passes, which only fill the depth buffer or
+         * only test against it, disable it.
+         */
+        bool          isColorWritingEnabled = true;
+        /**
+         * \brief Specification whether blending is enabled.
+         */
+        bool          isEnabled             = false;
+        /**
+         * \brief The blend equation of RGB components.
+         */
+        BlendEquation rgbEquation           = BlendEquation::FuncAdd;
+        /**
+         * \brief The source blend factor of alpha component.
+         */
+        BlendFactor   srcAlpha              = BlendFactor::One;
+        /**
+         * \brief The source blend factor of RGB components.
+         */
+        BlendFactor   srcRgb                = BlendFactor::One;
+
+};  // struct BlendState
+
+/**
+ * \brief ClearColor is the color, which is used to clear the color buffer (see
+ * [glClearColor()](https://docs.gl/gl4/glClearColor)).
+ */
+struct ClearColor final
+{
+        bool operator==(const ClearColor&) const noexcept = default;
+
+        GLfloat r = {0.0f}, g = {0.0f}, b = {0.0f}, a = {0.0f};
+
+};  // struct ClearColor
+
+/**
+ * \brief DepthState describes the depth test stage of the pipeline.
+ *
+ * \see [Depth Test](https://www.khronos.org/opengl/wiki/Depth_Test).
+ */
+struct DepthState final
+{
+        bool operator==(const DepthState&) const noexcept = default;
+
+        /**
+         * \brief The function, which is used to compare the depth of the fragment with the value in depth buffer.
+         */
+        CompareFunction function         = CompareFunction::Less;
+        /**
+         * \brief Specification whether depth test is enabled.
+         */
+        bool            isTestEnabled    = false;
+        /**
+         * \brief Specification whether writing into the depth buffer is enabled.
+         */
+        bool            isWritingEnabled = true;
+
+};  // struct DepthState
+
+/**
+ * \brief RasterState describes the rasterization stage of the pipeline.
+ */
+struct RasterState final
+{
+        bool operator==(const RasterState&) const noexcept = default;
+
+        /**
+         * \brief The facets, which are culled if face culling is enabled.
+         */
+        CullFaceMode       cullFace             = CullFaceMode::Back;
+        /**
+         * \brief The orientation of front-facing polygons.
+         */
+        FrontFaceDirection frontFace            = FrontFaceDirection::Ccw;
+        /**
+         * \brief Specification whether face culling is enabled.
+         */
+        bool               isCullingEnabled     = false;
+        /**
+         * \brief Specification whether scissor test is enabled.
+         */
+        bool               isScissorTestEnabled = false;
+        /**
+         * \brief The rasterization mode of front- and back-facing polygons.
+         */
+        PolygonMode        polygonMode          = PolygonMode::Fill;
+
+};  // struct RasterState
+
+/**
+ * \brief Viewport represents parameters of [glViewport()](https://docs.gl/gl4/glViewport).
+ */
+struct Viewport final
+{
+        bool operator==(const Viewport&) const noexcept = default;
+
+        GLint   x = {0}, y = {0};
+        GLsizei width = {0}, height = {0};
+
+};  // struct Viewport
+
+/**
+ * \brief PipelineStateDescription contains everything, which is necessary to create PipelineState.
+ */
+struct PipelineStateDescription final
+{
+        /**
+         * \brief The blending stage configuration.
+         */
+        BlendState                             blend;
+        /**
+         * \brief The depth test stage configuration.
+         */
+        DepthState                             depth;
+        /**
+         * \brief The rasterization stage configuration.
+         */
+        RasterState                            raster;
+        /**
+         * \brief The shader program, which is used by the pipeline.
+         */
+        std::shared_ptr<shader::ShaderProgram> shaderProgram = nullptr;
+        /**
+         * \brief The vertex array object, which defines the vertex layout and the vertex sources of the pipeline.
+         */
+        std::shared_ptr<vertex::VertexArray>   vertexArray   = nullptr;
+
+};  // struct PipelineStateDescription
+
+/**
+ * \brief PipelineState is an immutable snapshot of the pipeline configuration (shader program, vertex layout,
+ * rasterization, depth and blend state).
+ *
+ * PipelineState objects are supposed to be created up front via pipelineStateManager::create() and
+ * applied during rendering via pipelineStateManager::apply(). The hash of the state is calculated once on construction.
+ */
+class PipelineState final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of PipelineState.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new PipelineState object and calculates its hash.
+         *
+         * \param description - a configuration of the pipeline.
+         * \throw std::invalid_argument, if the shader program or the vertex array is not set.
+         */
+        explicit PipelineState(PipelineStateDescription description);
+        PipelineState() = delete;
+        OGLS_NOT_COPYABLE_MOVABLE(PipelineState)
+        ~PipelineState() noexcept;
+
+        /**
+         * \brief Checks equality of two PipelineState.
+         *
+         * \return true if both states reference the same shader program and vertex array and have equal
+         * fixed-function configuration, false otherwise.
+         */
+        bool operator==(const PipelineState& other) const noexcept;
+
+        /**
+         * \brief Returns the blending stage configuration.
+         */
+        const BlendState&                             getBlendState() const noexcept;
+        /**
+         * \brief Returns the depth test stage configuration.
+         */
+        const DepthState&                             getDepthState() const noexcept;
+        /**
+         * \brief Returns the hash of the state, which was calculated on construction.
+         */
+        size_t                                        getHash() const noexcept;
+        /**
+         * \brief Returns the rasterization stage configuration.
+         */
+        const RasterState&                            getRasterState() const noexcept;
+        /**
+         * \brief Returns the shader program of the pipeline.
+         */
+        const std::shared_ptr<shader::ShaderProgram>& getShaderProgram() const noexcept;
+        /**
+         * \brief Returns the vertex array object of the pipeline.
+         */
+        const std::shared_ptr<vertex::VertexArray>&   getVertexArray() const noexcept;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class PipelineState
+
+/**
+ * \brief pipelineStateManager namespace contains functions to create PipelineState objects and to apply them
+ * to OpenGL state machine.
+ *
+ * pipelineStateManager remembers the last applied state and issues only OpenGL calls, which change something.
+ * If OpenGL state is changed bypassing pipelineStateManager, invalidate() must be called.
+ */
+namespace pipelineStateManager
+{
+    /**
+     * \brief Applies the state to OpenGL state machine.
+     *
+     * Only the parts of the state, which differ from the previous applied state, are sent to OpenGL.
+     * If the same PipelineState is applied twice in a row, no OpenGL call is issued.
+     *
+     * Wraps [glUseProgram()](https://docs.gl/gl4/glUseProgram),
+     * [glBindVertexArray()](https://docs.gl/gl4/glBindVertexArray), [glEnable()](https://docs.gl/gl4/glEnable),
+     * [glDisable()](https://docs.gl/gl4/glEnable), [glBlendFuncSeparate()](https://docs.gl/gl4/glBlendFuncSeparate),
+     * [glBlendEquationSeparate()](https://docs.gl/gl4/glBlendEquationSeparate),
+     * [glColorMask()](https://docs.gl/gl4/glColorMask), [glDepthFunc()](https://docs.gl/gl4/glDepthFunc),
+     * [glDepthMask()](https://docs.gl/gl4/glDepthMask),
+     * [glCullFace()](https://docs.gl/gl4/glCullFace), [glFrontFace()](https://docs.gl/gl4/glFrontFace)
+     * and [glPolygonMode()](https://docs.gl/gl4/glPolygonMode).
+     *
+     * \param state - the state to apply.
+     */
+    void                                 apply(const PipelineState& state);
+    /**
+     * \brief Clears the buffers of the current framebuffer.
+     *
+     * Wraps [glClearColor()](https://docs.gl/gl4/glClearColor) (only if the color differs from the previous one)
+     * and [glClear()](https://docs.gl/gl4/glClear). Color and depth writing, which are disabled by the last applied
+     * state, are enabled for cleared buffers.
+     *
+     * \param color - the color to clear the color buffer with.
+     * \param mask  - bitwise OR of ClearBufferBit values.
+     */
+    void                                 clear(const ClearColor& color, GLbitfield mask);
+    /**
+     * \brief Returns PipelineState object for passed description.
+     *
+     * If an equal PipelineState object has been already created and it is still alive, it is returned instead
+     * of creation of a new one.
+     *
+     * \param description - a configuration of the pipeline.
+     * \return the PipelineState object.
+     * \throw std::invalid_argument, see PipelineState::PipelineState().
+     */
+    std::shared_ptr<const PipelineState> create(PipelineStateDescription description);
+    /**
+     * \brief Forgets the remembered state, so the next apply() sends the whole state to OpenGL.
+     *
+     * Must be called if OpenGL state was changed bypassing pipelineStateManager.
+     */
+    void                                 invalidate() noexcept;
+    /**
+     * \brief Wraps [glViewport()](https://docs.gl/gl4/glViewport).
+     *
+     * The call is not issued if the viewport is unchanged.
+     *
+     * \param viewport - the viewport to set.
+     */
+    void                                 setViewport(const Viewport& viewport);
+
+}  // namespace pipelineStateManager
+
+}  // namespace ogls::oglCore::pipeline
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef OGLS_OGLCORE_QUERY_QUERY_H
+#define OGLS_OGLCORE_QUERY_QUERY_H
+
+#include <memory>
+#include <optional>
+
+#include <glad/glad.h>
+
+#include "helpers/macros.h"
+
+/**
+ * \namespace ogls::oglCore::query
+ * \brief query namespace contains types and functions, which are related to OpenGL query objects and
+ * the conditional rendering.
+ */
+namespace ogls::oglCore::query
+{
+/**
+ * \brief ConditionalRenderMode represents 'mode' parameter of
+ * [glBeginConditionalRender()](https://docs.gl/gl4/glBeginConditionalRender).
+ */
+enum class ConditionalRenderMode : GLenum
+{
+    ByRegionNoWait = 0x8E'16,
+    ByRegionWait   = 0x8E'15,
+    NoWait         = 0x8E'14,
+    Wait           = 0x8E'13
+};
+
+/**
+ * \brief QueryTarget represents 'target' parameter of [glBeginQuery()](https://docs.gl/gl4/glBeginQuery).
+ */
+enum class QueryTarget : GLenum
+{
+    AnySamplesPassed                   = 0x8C'2F,
+    AnySamplesPassedConservative       = 0x8D'6A,
+    PrimitivesGenerated                = 0x8C'87,
+    SamplesPassed                      = 0x89'14,
+    TimeElapsed                        = 0x88'BF,
+    TransformFeedbackPrimitivesWritten = 0x8C'88
+};
+
+/**
+ * \brief Query is a wrapper over OpenGL query object.
+ *
+ * The result of the query becomes available some time after end() is called. To avoid stalls of the pipeline
+ * the result should be read by tryGetResult() in one of the next frames, or the query should be used by
+ * beginConditionalRender(), which lets the GPU itself skip rendering commands.
+ *
+ * \see [Query Object](https://www.khronos.org/opengl/wiki/Query_Object).
+ */
+class Query final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of Query.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Ends the conditional rendering.
+         *
+         * Wraps [glEndConditionalRender()](https://docs.gl/gl4/glBeginConditionalRender).
+         */
+        static void endConditionalRender();
+
+        /**
+         * \brief Constructs new Query object and generates new 1 query object in OpenGL state machine.
+         *
+         * Wraps [glCreateQueries()](https://docs.gl/gl4/glCreateQueries).
+         *
+         * \param target - the type of the query.
+         * \throw ogls::exceptions::GLRecAcquisitionException().
+         */
+        explicit Query(QueryTarget target);
+        /**
+         * \brief Constructs new Query as move-copy of other Query.
+         *
+         * New 1 query object in OpenGL state machine is not generated.
+         */
+        Query(Query&& obj) noexcept;
+        OGLS_NOT_COPYABLE(Query)
+        /**
+         * \brief Deletes the query object in OpenGL state machine.
+         *
+         * Wraps [glDeleteQueries()](https://docs.gl/gl4/glDeleteQueries).
+         */
+        ~Query() noexcept;
+
+        /**
+         * \brief Move-copies the state of other Query.
+         */
+        Query& operator=(Query&& obj) noexcept;
+
+        /**
+         * \brief Wraps [glBeginQuery()](https://docs.gl/gl4/glBeginQuery).
+         *
+         * Only one query of the same target can be active at the same time.
+         */
+        void                    begin();
+        /**
+         * \brief Starts the conditional rendering, so the next rendering commands are discarded if the last
+         * result of the query is zero.
+         *
+         * Wraps [glBeginConditionalRender()](https://docs.gl/gl4/glBeginConditionalRender).
+         *
+         * \param mode - specification whether the GPU waits for the result of the query.
+         */
+        void                    beginConditionalRender(ConditionalRenderMode mode) const;
+        /**
+         * \brief Wraps [glEndQuery()](https://docs.gl/gl4/glBeginQuery).
+         */
+        void                    end();
+        /**
+         * \brief Returns the result of the query.
+         *
+         * Blocks until the result is available, so the pipeline can stall.
+         *
+         * Wraps [glGetQueryObjectui64v()](https://docs.gl/gl4/glGetQueryObject) with GL_QUERY_RESULT.
+         */
+        GLuint64                getResult() const;
+        /**
+         * \brief Returns the type of the query.
+         */
+        QueryTarget             getTarget() const noexcept;
+        /**
+         * \brief Checks whether the result of the last issued query is available.
+         *
+         * Wraps [glGetQueryObjectiv()](https://docs.gl/gl4/glGetQueryObject) with GL_QUERY_RESULT_AVAILABLE.
+         */
+        bool                    isResultAvailable() const;
+        /**
+         * \brief Returns the result of the query, if it is available, without waiting for it.
+         *
+         * \see isResultAvailable(), getResult().
+         */
+        std::optional<GLuint64> tryGetResult() const;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class Query
+
+}  // namespace ogls::oglCore::query
+
+#endif
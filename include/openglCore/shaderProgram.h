@@ -100,6 +100,17 @@ class ShaderProgram
          * \throw ogls::exceptions::GLRecAcquisitionException().
          */
         ShaderProgram(const Shader& vertexShader, const Shader& fragmentShader);
+        /**
+         * \brief Constructs new compute ShaderProgram object, generates and compiles new 1 shader program
+         * in OpenGL state machine.
+         *
+         * The program is run by [glDispatchCompute()](https://docs.gl/gl4/glDispatchCompute) after use().
+         *
+         * \param computeShader - an object of Shader class with the type ShaderType::ComputeShader.
+         * \see ShaderProgram(const Shader&, const Shader&).
+         * \throw ogls::exceptions::GLRecAcquisitionException().
+         */
+        explicit ShaderProgram(const Shader& computeShader);
         OGLS_NOT_COPYABLE_MOVABLE(ShaderProgram)
         /**
          * \brief Deletes shader program in OpenGL state machine.
@@ -162,6 +173,10 @@ class ShaderProgram
         VectorUniform<Type, Count>& getVectorUniform(const std::string& name) const;
         /**
          * \brief Wraps [glUseProgram()](https://docs.gl/gl4/glUseProgram).
+         *
+         * The call is skipped if the program is already current.
+         *
+         * \see ogls::oglCore::pipeline::pipelineStateManager.
          */
         void                        use() const;
 
@@ -184,6 +199,15 @@ class ShaderProgram
  */
 std::unique_ptr<ShaderProgram> makeShaderProgram(std::string_view pathToVertexShader,
                                                  std::string_view pathToFragmentShader);
+/**
+ * \brief Creates object of ShaderProgram class, which consists of the compute shader only.
+ *
+ * \param pathToComputeShader - relative to the root folder path to compute shader source code.
+ * \return created ShaderProgram object.
+ * \throw std::runtime_error,
+ * exceptions, which can be thrown by constructors of Shader and ShaderProgram classes.
+ */
+std::unique_ptr<ShaderProgram> makeComputeShaderProgram(std::string_view pathToComputeShader);
 
 }  // namespace ogls::oglCore::shader
 
@@ -29,9 +29,10 @@ class BaseTexture : public ICloneable
         OGLS_DEFAULT_MOVABLE(BaseTexture)
         BaseTexture() = delete;
         /**
-         * \brief Deletes the texture in OpenGL state machine.
+         * \brief Releases the texture. It is deleted in OpenGL state machine, when the GPU completes the current
+         * frame.
          *
-         * Wraps [glDeleteTextures()](https://docs.gl/gl4/glDeleteTextures).
+         * \see ogls::oglCore::objectNamesManager::releaseTextureName().
          */
         virtual ~BaseTexture() noexcept;
 
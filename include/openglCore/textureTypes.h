@@ -2,6 +2,7 @@
 #define OGLS_OGLCORE_TEXTURE_TEXTURE_TYPES_H
 
 #include <memory>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -79,8 +80,16 @@ enum class TextureInternalFormat : GLint
     CompressedRgb                  = 0x84'ED,
     CompressedRgbBptcSignedFloat   = 0x8E'8E,
     CompressedRgbBptcUnsignedFloat = 0x8E'8F,
+    /**
+     * \brief BC1 from EXT_texture_compression_s3tc, which is supported by all desktop implementations.
+     */
+    CompressedRgbS3tcDxt1Ext       = 0x83'F0,
     CompressedRgba                 = 0x84'EE,
     CompressedRgbaBptcUnorm        = 0x8E'8C,
+    /**
+     * \brief BC3 from EXT_texture_compression_s3tc, which is supported by all desktop implementations.
+     */
+    CompressedRgbaS3tcDxt5Ext      = 0x83'F3,
     CompressedSignedRedRgtc1       = 0x8D'BC,
     CompressedSignedRgRgtc2        = 0x8D'BE,
     CompressedSrgb                 = 0x8C'48,
@@ -294,6 +303,12 @@ struct TextureData final
          * \brief The level-of-detail number.
          */
         GLint                 level          = {1};
+        /**
+         * \brief Sizes in bytes of precomputed mipmap levels, which are stored one after another in data starting
+         * from the level 0. If it is empty, data contains only the level 0 and other levels are generated.
+         * The data of compressed internal formats (see isCompressedFormat()) is always specified by levels.
+         */
+        std::vector<GLsizei>  levelSizes;
         /**
          * \brief A number of color channels of the image.
          */
@@ -309,6 +324,12 @@ struct TextureData final
 
 };  // class TextureData
 
+/**
+ * \brief Checks if the internal format is a block-compressed one, data of which is uploaded by
+ * [glCompressedTextureSubImage2D()](https://docs.gl/gl4/glCompressedTexSubImage2D).
+ */
+bool isCompressedFormat(TextureInternalFormat internalFormat) noexcept;
+
 }  // namespace ogls::oglCore::texture
 
 #endif
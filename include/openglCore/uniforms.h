@@ -8,6 +8,7 @@
 #include <glad/glad.h>
 
 #include "helpers/macros.h"
+#include "helpers/poolAllocator.h"
 #include "mathCore/matrix.h"
 
 namespace ogls::oglCore::shader
@@ -77,12 +78,14 @@ class MatrixUniform : public BaseUniform
         /**
          * \brief DataType is a type to represent the data of the uniform variable inside the OpenGL state machine.
          *
-         * mathCore::Matrix elements must be ordered in a column-row order.
+         * mathCore::Matrix has the same rows and columns as the matrix in the shader. Transformations in the format
+         * of OpenGL (see mathCore::TransformMatrix) are multiplied by column vectors in the shader.
          */
         using DataType = mathCore::Matrix<N, M>;
 
     public:
         MatrixUniform() = delete;
+        OGLS_POOL_ALLOCATED(MatrixUniform)
 
         /**
          * \brief Returns a MatrixUniform::DataType representation of the MatrixUniform object.
@@ -93,15 +96,14 @@ class MatrixUniform : public BaseUniform
 
         /**
          * \brief Returns current data, which is stored in OpenGL uniform variable inside the OpenGL state machine.
-         *
-         * mathCore::Matrix elements are ordered in a column-row order.
          */
         DataType getData() const;
         /**
          * \brief Updates the data, which is stored in OpenGL uniform variable inside the OpenGL state machine.
          *
+         * mathCore::Matrix stores elements in the row major order, so the data is uploaded with the transposition.
+         *
          * \param data - the data, which must be set in the OpenGL uniform variable.
-         * mathCore::Matrix elements must be ordered in a column-row order.
          */
         void     setData(const DataType& data);
 
@@ -158,6 +160,7 @@ class VectorUniform : public BaseUniform
 
     public:
         VectorUniform() = delete;
+        OGLS_POOL_ALLOCATED(VectorUniform)
 
         /**
          * \brief Returns a VectorUniform::DataType representation of the VectorUniform object.
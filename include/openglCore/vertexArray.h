@@ -57,9 +57,10 @@ class VertexArray : public ICloneable
          */
         VertexArray(VertexArray&& obj) noexcept;
         /**
-         * \brief Deletes the vertex array object in OpenGL state machine.
+         * \brief Releases the vertex array object. It is deleted in OpenGL state machine, when the GPU completes
+         * the current frame.
          *
-         * Wraps [glDeleteVertexArrays()](https://docs.gl/gl4/glDeleteVertexArrays).
+         * \see ogls::oglCore::objectNamesManager::releaseVertexArrayName().
          */
         ~VertexArray() noexcept;
 
@@ -94,6 +95,10 @@ class VertexArray : public ICloneable
         void                                        addBuffer(std::shared_ptr<Buffer> buffer);
         /**
          * \brief Wraps [glBindVertexArray()](https://docs.gl/gl4/glBindVertexArray).
+         *
+         * The call is skipped if the vertex array object is already bound.
+         *
+         * \see ogls::oglCore::pipeline::pipelineStateManager.
          */
         void                                        bind() const;
         /**
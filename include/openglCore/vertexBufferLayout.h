@@ -31,7 +31,8 @@ struct VertexAttribute final
         GLuint         index      = {0};
         /**
          * \brief Specification whether fixed-point data values should be normalized or converted directly
-         * as fixed-point values when they are accessed.
+         * as fixed-point values when they are accessed. Integer attributes, which aren't normalized, are read by
+         * shaders as integers.
          */
         GLboolean      normalized = false;
         /**
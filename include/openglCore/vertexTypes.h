@@ -17,6 +17,7 @@ enum class BufferTarget : GLenum
     DispatchIndirectBuffer  = 0x90'EE,
     DrawIndirectBuffer      = 0x8F'3F,
     ElementArrayBuffer      = 0x88'93,
+    ParameterBuffer         = 0x80'EE,
     PixelPackBuffer         = 0x88'EB,
     PixelUnpackBuffer       = 0x88'EC,
     QueryBuffer             = 0x91'92,
@@ -39,6 +40,7 @@ enum class BufferBindingTarget : GLenum
     DispatchIndirectBufferBinding  = 0x90'EF,
     DrawIndirectBufferBinding      = 0x8F'43,
     ElementArrayBufferBinding      = 0x88'95,
+    ParameterBufferBinding         = 0x80'EF,
     PixelPackBufferBinding         = 0x88'ED,
     PixelUnpackBufferBinding       = 0x88'EF,
     QueryBufferBinding             = 0x91'93,
@@ -64,6 +66,22 @@ enum class BufferDataUsage : GLenum
     StreamRead  = 0x88'E1
 };
 
+/**
+ * \brief BufferMapAccessBit represents bits of 'access' parameter of
+ * [glMapBufferRange()](https://docs.gl/gl4/glMapBufferRange).
+ */
+enum class BufferMapAccessBit : GLbitfield
+{
+    MapCoherentBit         = 0x00'80,
+    MapFlushExplicitBit    = 0x00'10,
+    MapInvalidateBufferBit = 0x00'08,
+    MapInvalidateRangeBit  = 0x00'04,
+    MapPersistentBit       = 0x00'40,
+    MapReadBit             = 0x00'01,
+    MapUnsynchronizedBit   = 0x00'20,
+    MapWriteBit            = 0x00'02
+};
+
 /**
  * VertexAttrType represents 'type' parameter of
  * [glVertexAttribPointer()](https://docs.gl/gl4/glVertexAttribPointer).
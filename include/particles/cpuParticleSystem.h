@@ -0,0 +1,194 @@
+#ifndef OGLS_PARTICLES_CPU_PARTICLE_SYSTEM_H
+#define OGLS_PARTICLES_CPU_PARTICLE_SYSTEM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "helpers/macros.h"
+#include "helpers/threadPool.h"
+#include "mathCore/matrix.h"
+#include "mathCore/vector.h"
+
+/**
+ * \namespace ogls::particles
+ * \brief particles namespace contains types and functions, which simulate particles on the CPU for targets with
+ * weak GPUs.
+ */
+namespace ogls::particles
+{
+/**
+ * \brief ParticleSpawn is the initial state of the particle, which is passed to CpuParticleSystem::emit().
+ */
+struct ParticleSpawn final
+{
+        /**
+         * \brief The color of the particle (RGBA). The alpha fades out to 0 by the end of the life.
+         */
+        std::array<float, 4> color    = {1.0f, 1.0f, 1.0f, 1.0f};
+        /**
+         * \brief A number of seconds, which the particle lives. Particles with non-positive lifetime aren't born.
+         */
+        float                lifetime = {1.0f};
+        /**
+         * \brief The position in the world coordinate system.
+         */
+        mathCore::Vec3       position = mathCore::Vec3{0.0f};
+        /**
+         * \brief The size of the billboard of the particle in world units.
+         */
+        float                size     = {0.05f};
+        /**
+         * \brief The velocity in world units per second.
+         */
+        mathCore::Vec3       velocity = mathCore::Vec3{0.0f};
+
+};  // struct ParticleSpawn
+
+/**
+ * \brief ParticleVertex is the particle in the format of the vertex buffer, which is read by the shader.
+ *
+ * It matches Particle in the std430 layout of resources/shaders/vs/gpuParticle.vert, so particles simulated on
+ * the CPU and on the GPU are drawn by the same shader program.
+ */
+struct ParticleVertex final
+{
+        /**
+         * \brief x, y, z and the remaining life in seconds.
+         */
+        std::array<float, 4> positionLife;
+        /**
+         * \brief x, y, z of the velocity and the size of the billboard.
+         */
+        std::array<float, 4> velocitySize;
+        /**
+         * \brief The current color (RGBA).
+         */
+        std::array<float, 4> color;
+
+};  // struct ParticleVertex
+
+/**
+ * \brief CpuParticleSettings are parameters of CpuParticleSystem, which are fixed at the construction.
+ */
+struct CpuParticleSettings final
+{
+        /**
+         * \brief The maximal number of alive particles. Particles, which don't fit, aren't born.
+         */
+        uint32_t       capacity              = {262'144};
+        /**
+         * \brief The maximal number of particles, which can be emitted between two updates. It must be a power of 2.
+         */
+        uint32_t       emissionQueueCapacity = {65'536};
+        /**
+         * \brief The acceleration, which is applied to all particles.
+         */
+        mathCore::Vec3 gravity               = {0.0f, -9.81f, 0.0f};
+
+};  // struct CpuParticleSettings
+
+/**
+ * \brief CpuParticleSystem simulates particles on the CPU.
+ *
+ * Particles are stored as the structure of arrays: every component (x of positions, alphas, lives etc.) is the
+ * separate array, so the integration kernel processes SIMD lanes of neighbour particles with SSE2 or AVX2
+ * instructions (see ogls::helpers::simd). update() integrates chunks of chunkSize particles in parallel on the
+ * thread pool, and after that removes dead particles by moving the last alive particle into their place, so alive
+ * particles always occupy the beginning of arrays.
+ *
+ * emit() can be called from any thread at any moment: spawned particles are pushed into the bounded lock-free queue
+ * and are born by the next update().
+ *
+ * Usage example:
+ * \code{.cpp}
+ * particles.emit({.position{emitterPosition}, .velocity{randomVelocity()}});
+ * particles.update(deltaTime);
+ * const auto mapped = static_cast<ParticleVertex*>(buffer.mapRange(0, size, access));
+ * particles.writeVertices({mapped, particles.getAliveCount()});
+ * buffer.unmap();
+ * \endcode
+ */
+class CpuParticleSystem final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of CpuParticleSystem.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief A number of particles, which are processed by one task of the thread pool.
+         */
+        static constexpr size_t chunkSize = {16'384};
+
+        /**
+         * \brief Constructs new CpuParticleSystem without particles and allocates storage for all of them.
+         *
+         * \param settings - the capacity of the system and the gravity.
+         * \throw std::invalid_argument, if the capacity is 0 or the capacity of the emission queue isn't a power of 2.
+         */
+        explicit CpuParticleSystem(const CpuParticleSettings& settings = {});
+        OGLS_NOT_COPYABLE(CpuParticleSystem)
+        CpuParticleSystem(CpuParticleSystem&& obj) noexcept;
+        ~CpuParticleSystem() noexcept;
+
+        CpuParticleSystem& operator=(CpuParticleSystem&& obj) noexcept;
+
+        /**
+         * \brief Queues the particle, which is born by the next update(). It is thread-safe and lock-free.
+         *
+         * \param spawn - the initial state of the particle.
+         * \return false if the emission queue is full and the particle is dropped, true otherwise.
+         */
+        bool     emit(const ParticleSpawn& spawn) noexcept;
+        /**
+         * \brief Returns a number of alive particles after the last update().
+         */
+        size_t   getAliveCount() const noexcept;
+        /**
+         * \brief Returns the maximal number of alive particles.
+         */
+        uint32_t getCapacity() const noexcept;
+        /**
+         * \brief Sets the acceleration, which is applied to all particles.
+         */
+        void     setGravity(const mathCore::Vec3& gravity) noexcept;
+        /**
+         * \brief Integrates alive particles, removes dead ones and gives birth to queued ones.
+         *
+         * It mustn't be called concurrently with itself and writeVertices().
+         *
+         * \param deltaTime - the time in seconds since the previous update.
+         * \param pool      - the pool, on which chunks of particles are integrated. It mustn't be the pool of
+         *                    the calling task.
+         */
+        void     update(float deltaTime, helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+        /**
+         * \brief Converts alive particles into the format of the vertex buffer.
+         *
+         * Chunks of particles are written in parallel, so vertices can be the mapped vertex buffer.
+         *
+         * \param vertices - the destination. If it is smaller than the number of alive particles, the rest of them
+         *                   isn't written.
+         * \param pool     - the pool, on which chunks of particles are written. It mustn't be the pool of
+         *                   the calling task.
+         * \return a number of written vertices.
+         */
+        size_t   writeVertices(std::span<ParticleVertex> vertices,
+                               helpers::ThreadPool&      pool = helpers::getDefaultThreadPool()) const;
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class CpuParticleSystem
+
+}  // namespace ogls::particles
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef OGLS_SPATIAL_SPATIAL_HASH_GRID_H
+#define OGLS_SPATIAL_SPATIAL_HASH_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "helpers/macros.h"
+#include "helpers/threadPool.h"
+#include "mathCore/matrix.h"
+#include "mathCore/point.h"
+#include "mathCore/vector.h"
+
+/**
+ * \namespace ogls::spatial
+ * \brief spatial namespace contains structures, which accelerate searching of objects by their positions.
+ */
+namespace ogls::spatial
+{
+/**
+ * \brief SpatialHashGrid finds points near the position without the scan of all points.
+ *
+ * The space is divided into cubic cells, and every cell is hashed into the bucket of the table, which size is
+ * the power of 2 greater than the doubled number of points. Points are stored sorted by buckets, so points of one
+ * cell lie together in memory. rebuild() sorts points by the counting sort: chunks of points calculate and count
+ * their buckets in parallel on the thread pool, after that they scatter points into their ranges of buckets in
+ * parallel too. Points of the bucket are sorted by identifiers, so results don't depend on the scheduling.
+ *
+ * update() of the point, which stays in its bucket, only changes its position. The point, which moves into another
+ * bucket, is marked as removed in the sorted array and is appended into the overflow list of the new bucket.
+ * Queries check both of them, so the grid is always valid, but long overflow lists make queries slower, so compact()
+ * must be called when needsCompaction() returns true (e.g. once per frame after all updates).
+ *
+ * Identifiers of points are their indices in rebuild() and the following numbers of insert(). They are stable till
+ * the next rebuild(). Queries don't change the grid, so they can be done in parallel, but not concurrently with
+ * modifications. The order of points in results of queryRadius() is unspecified, but it is the same for the same
+ * points and modifications.
+ *
+ * Usage example:
+ * \code{.cpp}
+ * auto grid = SpatialHashGrid{suggestCellSize(positions)};
+ * grid.rebuild(positions);
+ * pool.parallelFor(triggers.size(), [&](size_t i) { grid.queryRadius(triggers[i].center, radius, inside[i]); });
+ * grid.update(playerId, playerPosition);
+ * if (grid.needsCompaction())
+ * {
+ *     grid.compact();
+ * }
+ * \endcode
+ */
+class SpatialHashGrid final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of SpatialHashGrid.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Constructs new empty SpatialHashGrid.
+         *
+         * \param cellSize - the length of the edge of the cell. The best cell size is close to the radius of usual
+         *                   queries, see also suggestCellSize().
+         * \throw std::invalid_argument, if the cell size isn't a positive finite number.
+         */
+        explicit SpatialHashGrid(float cellSize);
+        OGLS_NOT_COPYABLE(SpatialHashGrid)
+        SpatialHashGrid(SpatialHashGrid&& obj) noexcept;
+        ~SpatialHashGrid() noexcept;
+
+        SpatialHashGrid& operator=(SpatialHashGrid&& obj) noexcept;
+
+        /**
+         * \brief Sorts all alive points into the compact table and empties overflow lists. Identifiers are kept.
+         *
+         * \param pool - the pool, on which points are sorted. It mustn't be the pool of the calling task.
+         */
+        void            compact(helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+        /**
+         * \brief Returns the length of the edge of the cell.
+         */
+        float           getCellSize() const noexcept;
+        /**
+         * \brief Returns a number of points, which aren't removed.
+         */
+        size_t          getPointsCount() const noexcept;
+        /**
+         * \brief Returns the position of the point.
+         *
+         * \param id - the identifier of the point.
+         * \throw std::out_of_range, if there is no point with the identifier.
+         */
+        mathCore::Point getPosition(uint32_t id) const;
+        /**
+         * \brief Adds the point into the overflow list of its bucket.
+         *
+         * \param position - the position of the point.
+         * \return the identifier of the point.
+         * \throw std::length_error, if there are already 2^31 - 1 points.
+         */
+        uint32_t        insert(const mathCore::Point& position);
+        /**
+         * \brief Adds the point into the overflow list of its bucket.
+         *
+         * \see insert(const mathCore::Point&).
+         */
+        uint32_t        insert(const mathCore::Vec3& position)
+        {
+            return insert(mathCore::Point{position.x(), position.y(), position.z()});
+        }
+        /**
+         * \brief Checks whether overflow lists or the number of points have grown so much, that queries become
+         * noticeably slower and compact() should be called.
+         */
+        bool            needsCompaction() const noexcept;
+        /**
+         * \brief Finds the nearest points.
+         *
+         * Cells are checked ring by ring around the cell of the center, till the farthest of found points is
+         * nearer than all unchecked cells.
+         *
+         * \param center    - the position, near which points are searched.
+         * \param count     - the maximal number of found points.
+         * \param result    - identifiers of found points sorted from the nearest one. It is cleared before the search.
+         * \param maxRadius - the maximal distance between the center and found points.
+         */
+        void            queryNearest(const mathCore::Point& center, size_t count, std::vector<uint32_t>& result,
+                                     float maxRadius = std::numeric_limits<float>::infinity()) const;
+        /**
+         * \brief Finds the nearest points.
+         *
+         * \see queryNearest(const mathCore::Point&, size_t, std::vector<uint32_t>&, float).
+         */
+        void            queryNearest(const mathCore::Vec3& center, size_t count, std::vector<uint32_t>& result,
+                                     float maxRadius = std::numeric_limits<float>::infinity()) const
+        {
+            queryNearest(mathCore::Point{center.x(), center.y(), center.z()}, count, result, maxRadius);
+        }
+        /**
+         * \brief Finds all points within the sphere.
+         *
+         * \param center - the center of the sphere.
+         * \param radius - the radius of the sphere. Points on the surface are found too.
+         * \param result - identifiers of found points. It is cleared before the search.
+         */
+        void            queryRadius(const mathCore::Point& center, float radius, std::vector<uint32_t>& result) const;
+        /**
+         * \brief Finds all points within the sphere.
+         *
+         * \see queryRadius(const mathCore::Point&, float, std::vector<uint32_t>&).
+         */
+        void            queryRadius(const mathCore::Vec3& center, float radius, std::vector<uint32_t>& result) const
+        {
+            queryRadius(mathCore::Point{center.x(), center.y(), center.z()}, radius, result);
+        }
+        /**
+         * \brief Replaces all points of the grid by new ones and sorts them in parallel.
+         *
+         * \param positions - positions of points. Their indices become identifiers of points.
+         * \param pool      - the pool, on which points are sorted. It mustn't be the pool of the calling task.
+         * \throw std::length_error, if there are more than 2^31 - 1 points.
+         */
+        void            rebuild(std::span<const mathCore::Point> positions,
+                                helpers::ThreadPool&             pool = helpers::getDefaultThreadPool());
+        /**
+         * \brief Removes the point. Its identifier isn't reused till the next rebuild().
+         *
+         * \param id - the identifier of the point.
+         * \throw std::out_of_range, if there is no point with the identifier.
+         */
+        void            remove(uint32_t id);
+        /**
+         * \brief Changes the length of the edge of the cell and sorts points into new cells.
+         *
+         * \param cellSize - the length of the edge of the cell.
+         * \param pool     - the pool, on which points are sorted. It mustn't be the pool of the calling task.
+         * \throw std::invalid_argument, if the cell size isn't a positive finite number.
+         */
+        void            setCellSize(float cellSize, helpers::ThreadPool& pool = helpers::getDefaultThreadPool());
+        /**
+         * \brief Moves the point.
+         *
+         * \param id       - the identifier of the point.
+         * \param position - the new position of the point.
+         * \throw std::out_of_range, if there is no point with the identifier.
+         */
+        void            update(uint32_t id, const mathCore::Point& position);
+        /**
+         * \brief Moves the point.
+         *
+         * \see update(uint32_t, const mathCore::Point&).
+         */
+        void            update(uint32_t id, const mathCore::Vec3& position)
+        {
+            update(id, mathCore::Point{position.x(), position.y(), position.z()});
+        }
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class SpatialHashGrid
+
+/**
+ * \brief Calculates the cell size, which gives the passed average number of points per cell for the dataset.
+ *
+ * Only axes, along which points are spread, are taken into account, so points on the plane get cells for the plane.
+ *
+ * \param positions     - positions of points.
+ * \param pointsPerCell - the desired average number of points in the not empty cell.
+ * \return the cell size or 1, if there are less than 2 different points.
+ */
+float suggestCellSize(std::span<const mathCore::Point> positions, float pointsPerCell = {4.0f}) noexcept;
+
+}  // namespace ogls::spatial
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef OGLS_WINDOW_H
 #define OGLS_WINDOW_H
 
+#include <chrono>
 #include <memory>
 #include <string_view>
 
@@ -38,11 +39,39 @@ class Window
         Window() = delete;
         OGLS_NOT_COPYABLE_MOVABLE(Window)
         /**
-         * \brief Destructs the window and OpenGL context by calling
+         * \brief Deletes remaining names of OpenGL objects (see ogls::oglCore::objectNamesManager::shutdown())
+         * and destructs the window and OpenGL context by calling
          * [glfwTerminate()](https://www.glfw.org/docs/3.3/group__init.html#gaaae48c0a18607ea4a4ba951d939f0901).
          */
         ~Window() noexcept;
 
+        /**
+         * \brief Returns the refresh rate of the monitor, on which the window is shown, in Hz.
+         *
+         * Wraps [glfwGetVideoMode()](https://www.glfw.org/docs/3.3/group__monitor.html#gaba376fa7e76634b4788bddc505d6c9d8).
+         *
+         * \return the refresh rate or 0, if it is unknown.
+         */
+        int  getRefreshRate() const;
+        /**
+         * \brief Requests the redraw of the window and wakes up the thread, which waits in waitEvents().
+         *
+         * It can be called from any thread.
+         */
+        void invalidate() noexcept;
+        /**
+         * \brief Wraps
+         * [glfwPollEvents()](https://www.glfw.org/docs/3.3/group__window.html#ga37bd57223967b4211d60ca1a0bf3c832).
+         */
+        void pollEvents();
+        /**
+         * \brief Wraps
+         * [glfwSwapInterval()](https://www.glfw.org/docs/3.3/group__context.html#ga6d4e0cdf151b5e579bd67f13202994ed).
+         *
+         * \param interval - a number of screen updates to wait for before buffers are swapped. 0 disables
+         *                   the vertical synchronization.
+         */
+        void setSwapInterval(int interval);
         /**
          * \brief Wraps
          * [glfwWindowShouldClose()](https://www.glfw.org/docs/3.3/group__window.html#ga24e02fbfefbb81fc45320989f8140ab5).
@@ -55,6 +84,22 @@ class Window
          * [glfwSwapBuffers()](https://www.glfw.org/docs/3.3/group__window.html#ga15a5a1ee5b3c2ca6b15ca209a12efd14).
          */
         void swapBuffers();
+        /**
+         * \brief Returns whether the window has been invalidated since the last call and resets the invalidation.
+         *
+         * The window is invalidated by invalidate(), when its framebuffer is resized and when the system asks to
+         * refresh its content (e.g. after it was covered by another window). The new window is invalidated.
+         */
+        bool takeInvalidation() noexcept;
+        /**
+         * \brief Wraps
+         * [glfwWaitEventsTimeout()](https://www.glfw.org/docs/3.3/group__window.html#ga605a178db92f1a7f1a925563ef3ea2cf).
+         *
+         * The calling thread sleeps till any event, invalidate() or the end of the timeout.
+         *
+         * \param timeout - the maximal time of waiting. If it isn't positive, events are only polled.
+         */
+        void waitEvents(std::chrono::duration<double> timeout);
 
     private:
         /**
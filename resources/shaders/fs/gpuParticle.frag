@@ -0,0 +1,16 @@
+#version 460 core
+
+in vec4 fColor;
+in vec2 fCorner;
+out vec4 FragColor;
+
+void main()
+{
+	const float distanceSquared = dot(fCorner, fCorner);
+	if (distanceSquared > 1.0)
+	{
+		discard;
+	}
+
+	FragColor = vec4(fColor.rgb, fColor.a * (1.0 - distanceSquared));
+}
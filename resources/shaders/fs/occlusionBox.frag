@@ -0,0 +1,8 @@
+#version 460 core
+
+// Nothing is written, the box is drawn only to count its samples, which pass the depth test
+layout(early_fragment_tests) in;
+
+void main()
+{
+}
@@ -0,0 +1,30 @@
+#version 460 core
+
+in vec4 fColor;
+in vec2 fTexCoord;
+flat in int fTexSlot;
+out vec4 FragColor;
+
+// The size must match app::renderer::QuadBatcher::maxTextureSlots
+const int texturesCount = 16;
+layout(binding = 0) uniform sampler2D textures[texturesCount];
+
+void main()
+{
+	// Indices of sampler arrays must be dynamically uniform, but the slot differs between quads of one draw call.
+	// The loop counter is uniform, so the texture is selected by comparison. Gradients are taken outside the branch,
+	// because implicit derivatives are undefined in non-uniform control flow.
+	const vec2 dx = dFdx(fTexCoord);
+	const vec2 dy = dFdy(fTexCoord);
+
+	vec4 texColor = vec4(0.0);
+	for (int i = 0; i < texturesCount; ++i)
+	{
+		if (i == fTexSlot)
+		{
+			texColor = textureGrad(textures[i], fTexCoord, dx, dy);
+		}
+	}
+
+	FragColor = texColor * fColor;
+}
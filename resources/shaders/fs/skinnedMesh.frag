@@ -0,0 +1,14 @@
+#version 460 core
+
+in vec3 fNormal;
+in vec2 fTexCoord;
+out vec4 FragColor;
+
+layout(binding = 0) uniform sampler2D mainTexture;
+uniform vec3 uLightDirection;
+
+void main()
+{
+	const float diffuse = max(dot(normalize(fNormal), -normalize(uLightDirection)), 0.0);
+	FragColor = texture(mainTexture, fTexCoord) * vec4(vec3(0.3 + 0.7 * diffuse), 1.0);
+}
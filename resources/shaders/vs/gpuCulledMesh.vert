@@ -0,0 +1,28 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPos;
+
+struct Object
+{
+	mat4 world;
+	vec4 boundsCenter;
+	vec4 boundsHalfExtents;
+	uint firstIndex;
+	uint indicesCount;
+	int baseVertex;
+	uint padding;
+};
+
+layout(std430, binding = 0) readonly buffer Objects
+{
+	Object objects[];
+};
+
+uniform mat4 uProjection;
+uniform mat4 uView;
+
+void main()
+{
+	// GpuCuller passes the index of the object as the base instance of its command
+	gl_Position = uProjection * uView * objects[gl_BaseInstance].world * vec4(inPos, 1.0);
+}
@@ -0,0 +1,42 @@
+#version 460 core
+
+struct Particle
+{
+	vec4 positionLife;
+	vec4 velocitySize;
+	vec4 color;
+};
+
+layout(std430, binding = 0) readonly buffer Particles
+{
+	Particle particles[];
+};
+
+uniform mat4 uProjection;
+uniform mat4 uView;
+
+out vec4 fColor;
+out vec2 fCorner;
+
+const vec2 corners[6] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0),
+	vec2(-1.0, -1.0));
+
+void main()
+{
+	fCorner = corners[gl_VertexID];
+
+	// The number of instances can exceed the capacity of the buffer, such billboards are degenerate
+	if (gl_InstanceID >= particles.length())
+	{
+		fColor = vec4(0.0);
+		gl_Position = vec4(0.0);
+		return;
+	}
+
+	const Particle particle = particles[gl_InstanceID];
+	fColor = particle.color;
+
+	// The billboard is expanded in the view space, so it always faces the camera
+	const vec4 center = uView * vec4(particle.positionLife.xyz, 1.0);
+	gl_Position = uProjection * vec4(center.xy + fCorner * particle.velocitySize.w * 0.5, center.zw);
+}
@@ -0,0 +1,13 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPos;
+
+uniform vec3 uBoxCenter;
+uniform vec3 uBoxHalfExtents;
+uniform mat4 uProjection;
+uniform mat4 uView;
+
+void main()
+{
+	gl_Position = uProjection * uView * vec4(uBoxCenter + inPos * uBoxHalfExtents, 1.0);
+}
@@ -0,0 +1,63 @@
+#version 460 core
+
+struct Draw
+{
+	mat4 world;
+	uvec4 attributeOffsets;
+	uint firstFloat;
+	uint vertexStride;
+	uvec2 padding;
+};
+
+layout(std430, binding = 1) readonly buffer Indices
+{
+	uint indices[];
+};
+
+layout(std430, binding = 2) readonly buffer Vertices
+{
+	float vertices[];
+};
+
+layout(std430, binding = 3) readonly buffer Draws
+{
+	Draw draws[];
+};
+
+uniform mat4 uProjection;
+uniform mat4 uView;
+
+out vec2 fTexCoord;
+
+const uint absentAttribute = 0xFFFFFFFFu;
+
+// Returns 'count' floats of the attribute of the vertex or 'fallback', if the vertex doesn't have the attribute
+vec4 fetchAttribute(Draw draw, uint vertex, uint attribute, uint count, vec4 fallback)
+{
+	const uint offset = draw.attributeOffsets[attribute];
+	if (offset == absentAttribute)
+	{
+		return fallback;
+	}
+
+	const uint first = draw.firstFloat + vertex * draw.vertexStride + offset;
+	vec4 result = fallback;
+	for (uint i = 0u; i < count; ++i)
+	{
+		result[i] = vertices[first + i];
+	}
+	return result;
+}
+
+void main()
+{
+	// PulledMeshPool passes the index of the draw as the base instance and the position in the index buffer as
+	// gl_VertexID, so no vertex array attributes are used
+	const Draw draw = draws[gl_BaseInstance];
+	const uint vertex = indices[gl_VertexID];
+
+	const vec3 position = fetchAttribute(draw, vertex, 0u, 3u, vec4(0.0)).xyz;
+	fTexCoord = fetchAttribute(draw, vertex, 2u, 2u, vec4(0.0)).xy;
+
+	gl_Position = uProjection * uView * draw.world * vec4(position, 1.0);
+}
@@ -0,0 +1,34 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPos;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 texCoord;
+layout(location = 3) in uvec4 inJoints;
+layout(location = 4) in vec4 inWeights;
+
+layout(std430, binding = 4) readonly buffer Palettes
+{
+	mat4 palettes[];
+};
+
+uniform uint uPaletteOffset;
+uniform mat4 uProjection;
+uniform mat4 uView;
+uniform mat4 uWorld;
+
+out vec3 fNormal;
+out vec2 fTexCoord;
+
+void main()
+{
+	// Weights are normalized bytes, which sum up to 1, so the blended matrix needn't be normalized
+	const mat4 skin = inWeights.x * palettes[uPaletteOffset + inJoints.x]
+		+ inWeights.y * palettes[uPaletteOffset + inJoints.y]
+		+ inWeights.z * palettes[uPaletteOffset + inJoints.z]
+		+ inWeights.w * palettes[uPaletteOffset + inJoints.w];
+	const mat4 world = uWorld * skin;
+
+	gl_Position = uProjection * uView * world * vec4(inPos, 1.0);
+	fNormal = mat3(world) * inNormal;
+	fTexCoord = texCoord;
+}
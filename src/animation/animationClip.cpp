@@ -0,0 +1,454 @@
+#include "animationClip.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers/simdLanes.h"
+
+namespace ogls::animation
+{
+namespace
+{
+    /**
+     * \brief QuantizedRotation is the unit quaternion without its greatest component, which is restored from
+     * the unit length. Every stored component has 15 bits, the 2 remaining bits keep the index of the omitted one.
+     */
+    using QuantizedRotation = std::array<uint16_t, 3>;
+    /**
+     * \brief Float3 is the key of scales and translations.
+     */
+    using Float3            = std::array<float, 3>;
+    /**
+     * \brief Float4 is the decoded key of any track, which is used by the compression.
+     */
+    using Float4            = std::array<float, 4>;
+
+    /**
+     * \brief The maximal number of frames, which are numbered by 16-bit times of keys.
+     */
+    constexpr auto maxFramesCount     = size_t{65'536};
+    /**
+     * \brief The maximal number of frames between neighbour keys. It limits the time of the curve fitting of long
+     * constant tracks.
+     */
+    constexpr auto maxKeysGap         = size_t{256};
+    /**
+     * \brief The maximal value of the 15-bit component of QuantizedRotation.
+     */
+    constexpr auto quantizedMax       = float{32'767.0f};
+    /**
+     * \brief Components of the unit quaternion except the greatest one are within +-1/sqrt(2).
+     */
+    constexpr auto smallComponentsMax = float{0.707'106'781f};
+
+    /**
+     * \brief Track is the range of keys of one track in arrays of Tracks.
+     */
+    struct Track final
+    {
+            uint32_t firstKey  = {0};
+            uint32_t keysCount = {0};
+
+    };  // struct Track
+
+    /**
+     * \brief Tracks are keys of one kind of all joints. Keys of every track are contiguous.
+     */
+    template<typename Key>
+    struct Tracks final
+    {
+            std::vector<Key>      keys;
+            /**
+             * \brief Tracks of joints in the order of joints.
+             */
+            std::vector<Track>    ranges;
+            /**
+             * \brief Numbers of frames of keys.
+             */
+            std::vector<uint16_t> times;
+
+    };  // struct Tracks
+
+    /**
+     * \brief KeysPair is two neighbour keys of the track and the position of the sampled moment between them.
+     */
+    struct KeysPair final
+    {
+            float  alpha  = {0.0f};
+            size_t first  = {0};
+            size_t second = {0};
+
+    };  // struct KeysPair
+
+    Float4                decode(const QuantizedRotation& rotation) noexcept;
+    QuantizedRotation     encode(const Float4& rotation) noexcept;
+    /**
+     * \brief Returns indices of samples, which stay keys after the curve fitting.
+     *
+     * \param samples    - values of all frames.
+     * \param tolerance  - the maximal difference of components of removed samples and their interpolation.
+     * \param isRotation - true, if samples are quaternions, which are interpolated by nlerp.
+     */
+    std::vector<uint16_t> fitKeys(std::span<const Float4> samples, float tolerance, bool isRotation);
+    Float4                interpolate(const Float4& a, const Float4& b, float alpha, bool isRotation) noexcept;
+    KeysPair              locateKeys(const std::vector<uint16_t>& times, const Track& track, float frame) noexcept;
+
+}  // namespace
+
+class AnimationClip::Impl
+{
+    public:
+        Impl(size_t joints, float rate, std::span<const JointTransform> frames,
+             const ClipCompressionSettings& settings) :
+            jointsCount{joints}, sampleRate{rate}
+        {
+            if (jointsCount == 0 || frames.empty() || frames.size() % jointsCount != 0)
+            {
+                throw std::invalid_argument{"Frames of the clip must have transformations of all joints."};
+            }
+            if (frames.size() / jointsCount > maxFramesCount || !(sampleRate > 0.0f))
+            {
+                throw std::invalid_argument{"The clip must have at most 65536 frames and the positive sample rate."};
+            }
+
+            framesCount = frames.size() / jointsCount;
+
+            auto samples = std::vector<Float4>(framesCount);
+            auto encoded = std::vector<QuantizedRotation>(framesCount);
+            for (auto joint = size_t{0}; joint < jointsCount; ++joint)
+            {
+                // Rotations are fitted after the quantization, so the tolerance includes its error
+                for (auto frame = size_t{0}; frame < framesCount; ++frame)
+                {
+                    encoded[frame] = encode(frames[frame * jointsCount + joint].rotation);
+                    samples[frame] = decode(encoded[frame]);
+                }
+                addTrack(rotations, fitKeys(samples, settings.rotationTolerance, true),
+                         [&encoded](size_t frame) { return encoded[frame]; });
+
+                for (auto frame = size_t{0}; frame < framesCount; ++frame)
+                {
+                    const auto& scale = frames[frame * jointsCount + joint].scale;
+                    samples[frame]    = Float4{scale[0], scale[1], scale[2], 0.0f};
+                }
+                addTrack(scales, fitKeys(samples, settings.scaleTolerance, false),
+                         [&frames, this, joint](size_t frame) { return frames[frame * jointsCount + joint].scale; });
+
+                for (auto frame = size_t{0}; frame < framesCount; ++frame)
+                {
+                    const auto& translation = frames[frame * jointsCount + joint].translation;
+                    samples[frame]          = Float4{translation[0], translation[1], translation[2], 0.0f};
+                }
+                addTrack(translations, fitKeys(samples, settings.translationTolerance, false),
+                         [&frames, this, joint](size_t frame) {
+                             return frames[frame * jointsCount + joint].translation;
+                         });
+            }
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Appends the track with keys of the frames.
+         *
+         * \param tracks    - tracks of the kind of keys.
+         * \param keyFrames - numbers of frames, which are keys.
+         * \param getKey    - the function, which returns the key of the frame.
+         */
+        template<typename Key, typename GetKey>
+        static void addTrack(Tracks<Key>& tracks, const std::vector<uint16_t>& keyFrames, GetKey getKey)
+        {
+            tracks.ranges.push_back(Track{.firstKey{static_cast<uint32_t>(tracks.keys.size())},
+                                          .keysCount{static_cast<uint32_t>(keyFrames.size())}});
+            for (const auto frame : keyFrames)
+            {
+                tracks.keys.push_back(getKey(frame));
+                tracks.times.push_back(frame);
+            }
+        }
+
+    public:
+        size_t                    framesCount = {0};
+        const size_t              jointsCount;
+        Tracks<QuantizedRotation> rotations;
+        const float               sampleRate;
+        Tracks<Float3>            scales;
+        Tracks<Float3>            translations;
+
+};  // class AnimationClip::Impl
+
+AnimationClip::AnimationClip(size_t jointsCount, float sampleRate, std::span<const JointTransform> frames,
+                             const ClipCompressionSettings& settings) :
+    m_impl{std::make_unique<Impl>(jointsCount, sampleRate, frames, settings)}
+{
+}
+
+AnimationClip::AnimationClip(AnimationClip&& obj) noexcept = default;
+
+AnimationClip::~AnimationClip() noexcept = default;
+
+AnimationClip& AnimationClip::operator=(AnimationClip&& obj) noexcept = default;
+
+float AnimationClip::getDuration() const noexcept
+{
+    return static_cast<float>(m_impl->framesCount - 1) / m_impl->sampleRate;
+}
+
+size_t AnimationClip::getJointsCount() const noexcept
+{
+    return m_impl->jointsCount;
+}
+
+size_t AnimationClip::getKeysCount() const noexcept
+{
+    const auto& impl = *m_impl;
+    return impl.rotations.keys.size() + impl.scales.keys.size() + impl.translations.keys.size();
+}
+
+void AnimationClip::sample(float time, LocalPose& pose) const
+{
+    using namespace helpers::simd;
+
+
+    const auto& impl = *m_impl;
+    const auto  frame =
+      std::clamp(time * impl.sampleRate, 0.0f, static_cast<float>(impl.framesCount - 1));
+
+    // Scratch memory is reused by next characters, which are sampled by the same thread
+    thread_local auto nextPose = LocalPose{};
+    thread_local auto alphas   = std::array<std::vector<float>, 3>{};
+    if (pose.getJointsCount() != impl.jointsCount)
+    {
+        pose.resize(impl.jointsCount);
+    }
+    if (nextPose.getJointsCount() != impl.jointsCount)
+    {
+        nextPose.resize(impl.jointsCount);
+    }
+    for (auto& alpha : alphas)
+    {
+        // Padding joints get 0, so they keep identity transformations
+        alpha.assign(pose.getPaddedJointsCount(), 0.0f);
+    }
+
+    const auto setKey = [](LocalPose& destination, PoseChannel firstChannel, size_t joint, const auto& key) {
+        for (auto i = size_t{0}; i < key.size(); ++i)
+        {
+            destination.getChannel(static_cast<PoseChannel>(static_cast<size_t>(firstChannel) + i))[joint] = key[i];
+        }
+    };
+
+    // Keys are decoded into two poses, so the interpolation processes joints in SIMD lanes
+    for (auto joint = size_t{0}; joint < impl.jointsCount; ++joint)
+    {
+        const auto rotation = locateKeys(impl.rotations.times, impl.rotations.ranges[joint], frame);
+        setKey(pose, PoseChannel::RotationX, joint, decode(impl.rotations.keys[rotation.first]));
+        setKey(nextPose, PoseChannel::RotationX, joint, decode(impl.rotations.keys[rotation.second]));
+        alphas[0][joint] = rotation.alpha;
+
+        const auto scale = locateKeys(impl.scales.times, impl.scales.ranges[joint], frame);
+        setKey(pose, PoseChannel::ScaleX, joint, impl.scales.keys[scale.first]);
+        setKey(nextPose, PoseChannel::ScaleX, joint, impl.scales.keys[scale.second]);
+        alphas[1][joint] = scale.alpha;
+
+        const auto translation = locateKeys(impl.translations.times, impl.translations.ranges[joint], frame);
+        setKey(pose, PoseChannel::TranslationX, joint, impl.translations.keys[translation.first]);
+        setKey(nextPose, PoseChannel::TranslationX, joint, impl.translations.keys[translation.second]);
+        alphas[2][joint] = translation.alpha;
+    }
+
+    const auto zero = broadcast(0.0f);
+    const auto one  = broadcast(1.0f);
+    for (auto joint = size_t{0}; joint < pose.getPaddedJointsCount(); joint += lanesCount)
+    {
+        auto from = std::array<Lanes, LocalPose::channelsCount>{};
+        auto to   = std::array<Lanes, LocalPose::channelsCount>{};
+        for (auto c = size_t{0}; c < LocalPose::channelsCount; ++c)
+        {
+            from[c] = load(pose.getChannel(static_cast<PoseChannel>(c)) + joint);
+            to[c]   = load(nextPose.getChannel(static_cast<PoseChannel>(c)) + joint);
+        }
+
+        // Quantized keys are in the hemisphere of their greatest component, so the next key can be flipped
+        const auto dot = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+        const auto sign           = select(greaterOrEqual(dot, zero), one, zero - one);
+        const auto rotationAlpha  = load(alphas[0].data() + joint);
+        const auto rotationWeight = one - rotationAlpha;
+        auto       rotation       = std::array<Lanes, 4>{};
+        for (auto c = size_t{0}; c < rotation.size(); ++c)
+        {
+            rotation[c] = from[c] * rotationWeight + to[c] * sign * rotationAlpha;
+        }
+        const auto length = sqrt(rotation[0] * rotation[0] + rotation[1] * rotation[1] + rotation[2] * rotation[2]
+                                 + rotation[3] * rotation[3]);
+        for (auto c = size_t{0}; c < rotation.size(); ++c)
+        {
+            store(pose.getChannel(static_cast<PoseChannel>(c)) + joint, rotation[c] / length);
+        }
+
+        const auto scaleAlpha       = load(alphas[1].data() + joint);
+        const auto translationAlpha = load(alphas[2].data() + joint);
+        for (auto c = size_t{4}; c < LocalPose::channelsCount; ++c)
+        {
+            const auto alpha = c < 7 ? scaleAlpha : translationAlpha;
+            store(pose.getChannel(static_cast<PoseChannel>(c)) + joint, from[c] + (to[c] - from[c]) * alpha);
+        }
+    }
+}
+
+namespace
+{
+    Float4 decode(const QuantizedRotation& rotation) noexcept
+    {
+        const auto omitted = static_cast<size_t>((rotation[0] >> 15) | ((rotation[1] >> 15) << 1));
+
+        auto result = Float4{};
+        auto sum    = 0.0f;
+        auto stored = size_t{0};
+        for (auto i = size_t{0}; i < result.size(); ++i)
+        {
+            if (i == omitted)
+            {
+                continue;
+            }
+
+            const auto value = static_cast<float>(rotation[stored++] & 0x7F'FF) / quantizedMax;
+            result[i]        = (value * 2.0f - 1.0f) * smallComponentsMax;
+            sum += result[i] * result[i];
+        }
+        result[omitted] = std::sqrt(std::max(1.0f - sum, 0.0f));
+
+        return result;
+    }
+
+    QuantizedRotation encode(const Float4& rotation) noexcept
+    {
+        auto omitted = size_t{0};
+        auto length  = 0.0f;
+        for (auto i = size_t{0}; i < rotation.size(); ++i)
+        {
+            length += rotation[i] * rotation[i];
+            if (std::abs(rotation[i]) > std::abs(rotation[omitted]))
+            {
+                omitted = i;
+            }
+        }
+
+        // q and -q are the same rotation, the one with the positive omitted component is stored
+        length           = std::sqrt(length);
+        const auto scale = length > 0.0f ? (rotation[omitted] < 0.0f ? -1.0f : 1.0f) / length : 0.0f;
+
+        auto result = QuantizedRotation{};
+        auto stored = size_t{0};
+        for (auto i = size_t{0}; i < rotation.size(); ++i)
+        {
+            if (i == omitted)
+            {
+                continue;
+            }
+
+            const auto value = std::clamp((rotation[i] * scale / smallComponentsMax + 1.0f) * 0.5f, 0.0f, 1.0f);
+            result[stored++] = static_cast<uint16_t>(std::lround(value * quantizedMax));
+        }
+        result[0] = static_cast<uint16_t>(result[0] | ((omitted & 1) << 15));
+        result[1] = static_cast<uint16_t>(result[1] | ((omitted >> 1) << 15));
+
+        return result;
+    }
+
+    std::vector<uint16_t> fitKeys(std::span<const Float4> samples, float tolerance, bool isRotation)
+    {
+        const auto fits = [&samples, tolerance, isRotation](size_t first, size_t last) {
+            for (auto frame = first + 1; frame < last; ++frame)
+            {
+                const auto alpha = static_cast<float>(frame - first) / static_cast<float>(last - first);
+                const auto value = interpolate(samples[first], samples[last], alpha, isRotation);
+
+                auto dot = 0.0f;
+                for (auto i = size_t{0}; i < value.size(); ++i)
+                {
+                    dot += value[i] * samples[frame][i];
+                }
+                const auto sign = isRotation && dot < 0.0f ? -1.0f : 1.0f;
+                for (auto i = size_t{0}; i < value.size(); ++i)
+                {
+                    if (std::abs(value[i] - sign * samples[frame][i]) > tolerance)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // Every key is extended greedily to the farthest frame, which keeps all skipped frames within tolerance
+        auto keys  = std::vector<uint16_t>{0};
+        auto first = size_t{0};
+        while (first + 1 < samples.size())
+        {
+            auto last = first + 1;
+            while (last + 1 < samples.size() && last + 1 - first <= maxKeysGap && fits(first, last + 1))
+            {
+                ++last;
+            }
+            keys.push_back(static_cast<uint16_t>(last));
+            first = last;
+        }
+
+        return keys;
+    }
+
+    Float4 interpolate(const Float4& a, const Float4& b, float alpha, bool isRotation) noexcept
+    {
+        auto dot = 0.0f;
+        for (auto i = size_t{0}; i < a.size(); ++i)
+        {
+            dot += a[i] * b[i];
+        }
+        const auto sign = isRotation && dot < 0.0f ? -1.0f : 1.0f;
+
+        auto result = Float4{};
+        auto length = 0.0f;
+        for (auto i = size_t{0}; i < a.size(); ++i)
+        {
+            result[i] = a[i] * (1.0f - alpha) + b[i] * sign * alpha;
+            length += result[i] * result[i];
+        }
+
+        if (isRotation && length > 0.0f)
+        {
+            length = std::sqrt(length);
+            for (auto& component : result)
+            {
+                component /= length;
+            }
+        }
+        return result;
+    }
+
+    KeysPair locateKeys(const std::vector<uint16_t>& times, const Track& track, float frame) noexcept
+    {
+        const auto begin = times.begin() + track.firstKey;
+        const auto end   = begin + track.keysCount;
+        const auto next  = std::upper_bound(begin, end, static_cast<uint16_t>(frame));
+
+        if (next == end)
+        {
+            const auto last = static_cast<size_t>(track.firstKey + track.keysCount - 1);
+            return KeysPair{.alpha{0.0f}, .first{last}, .second{last}};
+        }
+
+        // The first key of the track is at frame 0, so the found key always has the previous one
+        const auto second = static_cast<size_t>(next - times.begin());
+        const auto first  = second - 1;
+        const auto alpha  = (frame - times[first]) / static_cast<float>(times[second] - times[first]);
+        return KeysPair{.alpha{alpha}, .first{first}, .second{second}};
+    }
+
+}  // namespace
+
+}  // namespace ogls::animation
@@ -0,0 +1,191 @@
+#include "localPose.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "helpers/simdLanes.h"
+
+namespace ogls::animation
+{
+namespace
+{
+    /**
+     * \brief Values of channels of the identity transformation in the order of PoseChannel.
+     */
+    constexpr auto identityChannels =
+      std::array<float, LocalPose::channelsCount>{0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f};
+    /**
+     * \brief The minimal length of the blended quaternion, which is normalized. Shorter ones are the result of
+     * opposite rotations with equal weights.
+     */
+    constexpr auto minQuaternionLength = float{1e-6f};
+
+    size_t alignUp(size_t value, size_t alignment) noexcept;
+
+}  // namespace
+
+LocalPose::LocalPose(size_t jointsCount)
+{
+    resize(jointsCount);
+}
+
+const float* LocalPose::getChannel(PoseChannel channel) const noexcept
+{
+    return m_channels[static_cast<size_t>(channel)].data();
+}
+
+float* LocalPose::getChannel(PoseChannel channel) noexcept
+{
+    return m_channels[static_cast<size_t>(channel)].data();
+}
+
+JointTransform LocalPose::getJoint(size_t joint) const
+{
+    if (joint >= m_jointsCount)
+    {
+        throw std::out_of_range{"The pose has no such joint."};
+    }
+
+    // Channels are in the order of PoseChannel
+    const auto& c = m_channels;
+    return JointTransform{.rotation{c[0][joint], c[1][joint], c[2][joint], c[3][joint]},
+                          .scale{c[4][joint], c[5][joint], c[6][joint]},
+                          .translation{c[7][joint], c[8][joint], c[9][joint]}};
+}
+
+size_t LocalPose::getJointsCount() const noexcept
+{
+    return m_jointsCount;
+}
+
+size_t LocalPose::getPaddedJointsCount() const noexcept
+{
+    return m_channels[0].size();
+}
+
+void LocalPose::resize(size_t jointsCount)
+{
+    const auto paddedJointsCount = alignUp(jointsCount, jointsAlignment);
+    for (auto i = size_t{0}; i < channelsCount; ++i)
+    {
+        auto& channel = m_channels[i];
+        channel.resize(paddedJointsCount, identityChannels[i]);
+        // Joints, which are cut, become padding, and padding is always the identity
+        std::fill(channel.begin() + static_cast<ptrdiff_t>(std::min(jointsCount, m_jointsCount)), channel.end(),
+                  identityChannels[i]);
+    }
+    m_jointsCount = jointsCount;
+}
+
+void LocalPose::setJoint(size_t joint, const JointTransform& transform)
+{
+    if (joint >= m_jointsCount)
+    {
+        throw std::out_of_range{"The pose has no such joint."};
+    }
+
+    // Values are in the order of PoseChannel
+    const auto values = std::array<float, channelsCount>{transform.rotation[0],    transform.rotation[1],
+                                                         transform.rotation[2],    transform.rotation[3],
+                                                         transform.scale[0],       transform.scale[1],
+                                                         transform.scale[2],       transform.translation[0],
+                                                         transform.translation[1], transform.translation[2]};
+    for (auto i = size_t{0}; i < channelsCount; ++i)
+    {
+        m_channels[i][joint] = values[i];
+    }
+}
+
+void blendPoses(std::span<const LocalPose* const> poses, std::span<const float> weights, LocalPose& result)
+{
+    using namespace helpers::simd;
+
+
+    if (poses.empty() || poses.size() != weights.size())
+    {
+        throw std::invalid_argument{"Every blended pose must have the weight."};
+    }
+
+    const auto jointsCount = poses.front()->getJointsCount();
+    auto       weightsSum  = 0.0f;
+    for (auto i = size_t{0}; i < poses.size(); ++i)
+    {
+        if (poses[i]->getJointsCount() != jointsCount)
+        {
+            throw std::invalid_argument{"Blended poses must have the same number of joints."};
+        }
+        weightsSum += weights[i];
+    }
+    if (weightsSum <= 0.0f)
+    {
+        throw std::invalid_argument{"The sum of weights of blended poses must be positive."};
+    }
+
+    if (result.getJointsCount() != jointsCount)
+    {
+        result.resize(jointsCount);
+    }
+
+    const auto zero          = broadcast(0.0f);
+    const auto one           = broadcast(1.0f);
+    const auto minusOne      = broadcast(-1.0f);
+    const auto minLength     = broadcast(minQuaternionLength);
+    const auto inverseWeight = broadcast(1.0f / weightsSum);
+
+    // Every lane block is read from all poses before it is written, so the result can alias any of them
+    for (auto joint = size_t{0}; joint < result.getPaddedJointsCount(); joint += lanesCount)
+    {
+        auto reference = std::array<Lanes, 4>{};
+        for (auto c = size_t{0}; c < reference.size(); ++c)
+        {
+            reference[c] = load(poses.front()->getChannel(static_cast<PoseChannel>(c)) + joint);
+        }
+
+        auto sums = std::array<Lanes, LocalPose::channelsCount>{};
+        sums.fill(zero);
+        for (auto i = size_t{0}; i < poses.size(); ++i)
+        {
+            auto values = std::array<Lanes, LocalPose::channelsCount>{};
+            for (auto c = size_t{0}; c < values.size(); ++c)
+            {
+                values[c] = load(poses[i]->getChannel(static_cast<PoseChannel>(c)) + joint);
+            }
+
+            // q and -q are the same rotation, the one closer to the reference is summed
+            const auto dot = values[0] * reference[0] + values[1] * reference[1] + values[2] * reference[2]
+                           + values[3] * reference[3];
+            const auto weight         = broadcast(weights[i]);
+            const auto rotationWeight = weight * select(greaterOrEqual(dot, zero), one, minusOne);
+            for (auto c = size_t{0}; c < 4; ++c)
+            {
+                sums[c] = sums[c] + values[c] * rotationWeight;
+            }
+            for (auto c = size_t{4}; c < sums.size(); ++c)
+            {
+                sums[c] = sums[c] + values[c] * weight;
+            }
+        }
+
+        const auto length =
+          max(sqrt(sums[0] * sums[0] + sums[1] * sums[1] + sums[2] * sums[2] + sums[3] * sums[3]), minLength);
+        for (auto c = size_t{0}; c < 4; ++c)
+        {
+            store(result.getChannel(static_cast<PoseChannel>(c)) + joint, sums[c] / length);
+        }
+        for (auto c = size_t{4}; c < sums.size(); ++c)
+        {
+            store(result.getChannel(static_cast<PoseChannel>(c)) + joint, sums[c] * inverseWeight);
+        }
+    }
+}
+
+namespace
+{
+    size_t alignUp(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+}  // namespace
+
+}  // namespace ogls::animation
@@ -0,0 +1,277 @@
+#include "skeleton.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "helpers/simdLanes.h"
+
+namespace ogls::animation
+{
+namespace
+{
+    /**
+     * \brief Affine is 3 rows of the affine matrix in the notation of column vectors, which are stored one after
+     * another. The 4th row is always (0, 0, 0, 1).
+     */
+    using Affine = std::array<float, 12>;
+
+    /**
+     * \brief The maximal number of joints, which indices fit into SkinningInfluences.
+     */
+    constexpr auto maxJointsCount = size_t{256};
+
+    Affine      inverse(const Affine& m) noexcept;
+    Affine      multiply(const Affine& a, const Affine& b) noexcept;
+    Affine      toAffine(const JointTransform& transform) noexcept;
+    JointMatrix toJointMatrix(const Affine& m) noexcept;
+    /**
+     * \brief Converts transformations of all joints of the pose into affine matrices in SIMD lanes.
+     *
+     * \param pose    - the pose.
+     * \param affines - 12 arrays of elements of matrices with the size of padded joints of the pose.
+     */
+    void        toAffines(const LocalPose& pose, std::array<std::vector<float>, 12>& affines) noexcept;
+
+}  // namespace
+
+Skeleton::Skeleton(std::vector<int32_t> parents, std::span<const JointTransform> bindPose) :
+    m_bindPose{bindPose.size()}, m_parents{std::move(parents)}
+{
+    if (bindPose.empty() || bindPose.size() > maxJointsCount)
+    {
+        throw std::invalid_argument{"The skeleton must have from 1 to 256 joints."};
+    }
+    if (m_parents.size() != bindPose.size())
+    {
+        throw std::invalid_argument{"Every joint of the skeleton must have the parent and the bind transformation."};
+    }
+
+    auto models = std::vector<Affine>(bindPose.size());
+    m_inverseBindMatrices.resize(bindPose.size());
+    for (auto joint = size_t{0}; joint < bindPose.size(); ++joint)
+    {
+        const auto parent = m_parents[joint];
+        if (parent != noParent && (parent < 0 || static_cast<size_t>(parent) >= joint))
+        {
+            throw std::invalid_argument{"The parent of the joint must precede it."};
+        }
+
+        m_bindPose.setJoint(joint, bindPose[joint]);
+        const auto local             = toAffine(bindPose[joint]);
+        models[joint]                = parent == noParent ? local : multiply(models[parent], local);
+        m_inverseBindMatrices[joint] = inverse(models[joint]);
+    }
+}
+
+void Skeleton::computeSkinningPalette(const LocalPose& pose, std::span<JointMatrix> palette) const
+{
+    const auto jointsCount = m_parents.size();
+    if (pose.getJointsCount() != jointsCount || palette.size() < jointsCount)
+    {
+        throw std::invalid_argument{"The pose and the palette must have all joints of the skeleton."};
+    }
+
+    // Scratch memory is reused by next characters, which are animated by the same thread
+    thread_local auto locals = std::array<std::vector<float>, 12>{};
+    thread_local auto models = std::vector<Affine>{};
+    for (auto& element : locals)
+    {
+        element.resize(pose.getPaddedJointsCount());
+    }
+    models.resize(jointsCount);
+
+    toAffines(pose, locals);
+
+    for (auto joint = size_t{0}; joint < jointsCount; ++joint)
+    {
+        auto local = Affine{};
+        for (auto i = size_t{0}; i < local.size(); ++i)
+        {
+            local[i] = locals[i][joint];
+        }
+
+        const auto parent = m_parents[joint];
+        models[joint]     = parent == noParent ? local : multiply(models[parent], local);
+        palette[joint]    = toJointMatrix(multiply(models[joint], m_inverseBindMatrices[joint]));
+    }
+}
+
+const LocalPose& Skeleton::getBindPose() const noexcept
+{
+    return m_bindPose;
+}
+
+size_t Skeleton::getJointsCount() const noexcept
+{
+    return m_parents.size();
+}
+
+const std::vector<int32_t>& Skeleton::getParents() const noexcept
+{
+    return m_parents;
+}
+
+SkinningInfluences packInfluences(std::span<const uint32_t> joints, std::span<const float> weights)
+{
+    if (joints.size() != weights.size())
+    {
+        throw std::invalid_argument{"Every joint of the vertex must have the weight."};
+    }
+    if (std::ranges::any_of(joints, [](uint32_t joint) { return joint >= maxJointsCount; }))
+    {
+        throw std::invalid_argument{"Indices of joints must fit into a byte."};
+    }
+
+    auto order = std::vector<size_t>(joints.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    const auto influencesCount = std::min(order.size(), size_t{4});
+    std::partial_sort(order.begin(), order.begin() + static_cast<ptrdiff_t>(influencesCount), order.end(),
+                      [&weights](size_t a, size_t b) { return weights[a] > weights[b]; });
+
+    auto sum = 0.0f;
+    for (auto i = size_t{0}; i < influencesCount; ++i)
+    {
+        sum += std::max(weights[order[i]], 0.0f);
+    }
+    if (sum <= 0.0f)
+    {
+        return SkinningInfluences{};
+    }
+
+    auto result       = SkinningInfluences{.joints{}, .weights{}};
+    auto quantizedSum = 0;
+    for (auto i = size_t{0}; i < influencesCount; ++i)
+    {
+        result.joints[i]  = static_cast<uint8_t>(joints[order[i]]);
+        result.weights[i] = static_cast<uint8_t>(std::max(weights[order[i]], 0.0f) / sum * 255.0f + 0.5f);
+        quantizedSum += result.weights[i];
+    }
+    // Rounding errors are given to the greatest weight, so weights of every vertex sum up to 1 in shaders
+    result.weights[0] = static_cast<uint8_t>(result.weights[0] + (255 - quantizedSum));
+
+    return result;
+}
+
+namespace
+{
+    Affine inverse(const Affine& m) noexcept
+    {
+        // The inverse of the 3x3 part is its adjugate divided by the determinant
+        const auto c00 = m[5] * m[10] - m[6] * m[9];
+        const auto c01 = m[6] * m[8] - m[4] * m[10];
+        const auto c02 = m[4] * m[9] - m[5] * m[8];
+        const auto det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+        const auto k   = det != 0.0f ? 1.0f / det : 0.0f;
+
+        auto result = Affine{};
+        result[0]   = c00 * k;
+        result[1]   = (m[2] * m[9] - m[1] * m[10]) * k;
+        result[2]   = (m[1] * m[6] - m[2] * m[5]) * k;
+        result[4]   = c01 * k;
+        result[5]   = (m[0] * m[10] - m[2] * m[8]) * k;
+        result[6]   = (m[2] * m[4] - m[0] * m[6]) * k;
+        result[8]   = c02 * k;
+        result[9]   = (m[1] * m[8] - m[0] * m[9]) * k;
+        result[10]  = (m[0] * m[5] - m[1] * m[4]) * k;
+
+        for (auto row = size_t{0}; row < 3; ++row)
+        {
+            result[row * 4 + 3] = -(result[row * 4] * m[3] + result[row * 4 + 1] * m[7] + result[row * 4 + 2] * m[11]);
+        }
+        return result;
+    }
+
+    Affine multiply(const Affine& a, const Affine& b) noexcept
+    {
+        auto result = Affine{};
+        for (auto row = size_t{0}; row < 3; ++row)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                result[row * 4 + column] = a[row * 4] * b[column] + a[row * 4 + 1] * b[4 + column]
+                                         + a[row * 4 + 2] * b[8 + column];
+            }
+            result[row * 4 + 3] += a[row * 4 + 3];
+        }
+        return result;
+    }
+
+    Affine toAffine(const JointTransform& transform) noexcept
+    {
+        auto pose = LocalPose{1};
+        pose.setJoint(0, transform);
+
+        auto affines = std::array<std::vector<float>, 12>{};
+        for (auto& element : affines)
+        {
+            element.resize(pose.getPaddedJointsCount());
+        }
+        toAffines(pose, affines);
+
+        auto result = Affine{};
+        for (auto i = size_t{0}; i < result.size(); ++i)
+        {
+            result[i] = affines[i][0];
+        }
+        return result;
+    }
+
+    JointMatrix toJointMatrix(const Affine& m) noexcept
+    {
+        auto result = JointMatrix{};
+        for (auto row = size_t{0}; row < 4; ++row)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                // Shaders read mat4 column by column
+                result[column * 4 + row] = row < 3 ? m[row * 4 + column] : (column == 3 ? 1.0f : 0.0f);
+            }
+        }
+        return result;
+    }
+
+    void toAffines(const LocalPose& pose, std::array<std::vector<float>, 12>& affines) noexcept
+    {
+        using namespace helpers::simd;
+
+
+        const auto channel = [&pose](PoseChannel c) { return pose.getChannel(c); };
+        const auto one     = broadcast(1.0f);
+        const auto two     = broadcast(2.0f);
+
+        for (auto joint = size_t{0}; joint < pose.getPaddedJointsCount(); joint += lanesCount)
+        {
+            const auto x  = load(channel(PoseChannel::RotationX) + joint);
+            const auto y  = load(channel(PoseChannel::RotationY) + joint);
+            const auto z  = load(channel(PoseChannel::RotationZ) + joint);
+            const auto w  = load(channel(PoseChannel::RotationW) + joint);
+            const auto sx = load(channel(PoseChannel::ScaleX) + joint);
+            const auto sy = load(channel(PoseChannel::ScaleY) + joint);
+            const auto sz = load(channel(PoseChannel::ScaleZ) + joint);
+
+            // The rotation matrix of the unit quaternion, which columns are scaled
+            const auto elements = std::array<Lanes, 12>{
+              (one - two * (y * y + z * z)) * sx,
+              two * (x * y - z * w) * sy,
+              two * (x * z + y * w) * sz,
+              load(channel(PoseChannel::TranslationX) + joint),
+              two * (x * y + z * w) * sx,
+              (one - two * (x * x + z * z)) * sy,
+              two * (y * z - x * w) * sz,
+              load(channel(PoseChannel::TranslationY) + joint),
+              two * (x * z - y * w) * sx,
+              two * (y * z + x * w) * sy,
+              (one - two * (x * x + y * y)) * sz,
+              load(channel(PoseChannel::TranslationZ) + joint)};
+
+            for (auto i = size_t{0}; i < elements.size(); ++i)
+            {
+                store(affines[i].data() + joint, elements[i]);
+            }
+        }
+    }
+
+}  // namespace
+
+}  // namespace ogls::animation
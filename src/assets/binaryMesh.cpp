@@ -0,0 +1,209 @@
+#include "assets/binaryMesh.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "exceptions.h"
+#include "helpers/helpers.h"
+#include "helpers/virtualFileSystem.h"
+
+namespace ogls::assets
+{
+// The file is used directly from the mapped memory, so its layout must not depend on the compiler
+static_assert(std::is_trivially_copyable_v<BinaryMeshHeader> && sizeof(BinaryMeshHeader) == 72);
+static_assert(std::is_trivially_copyable_v<BinaryMeshAttribute> && sizeof(BinaryMeshAttribute) == 20);
+static_assert(std::is_trivially_copyable_v<MeshLod> && sizeof(MeshLod) == 12);
+
+namespace
+{
+    constexpr uint64_t alignOffset(uint64_t offset) noexcept
+    {
+        return (offset + binaryMeshDataAlignment - 1) / binaryMeshDataAlignment * binaryMeshDataAlignment;
+    }
+
+    /**
+     * \brief Returns the view of the array of Type stored in the data. The array is copied into the storage
+     * only if it is not aligned properly in the data.
+     */
+    template<typename Type>
+    std::span<const Type> viewArray(std::span<const std::byte> data, std::vector<Type>& storage)
+    {
+        if (reinterpret_cast<uintptr_t>(data.data()) % alignof(Type) == 0)
+        {
+            return {reinterpret_cast<const Type*>(data.data()), data.size() / sizeof(Type)};
+        }
+
+        storage.resize(data.size() / sizeof(Type));
+        std::memcpy(storage.data(), data.data(), storage.size() * sizeof(Type));
+        return storage;
+    }
+
+}  // namespace
+
+class BinaryMesh::Impl
+{
+    public:
+        explicit Impl(const std::string& pathToFile) : file{helpers::getDefaultVirtualFileSystem().readFile(pathToFile)}
+        {
+            using namespace oglCore::vertex;
+
+
+            const auto data = file.getData();
+
+            const auto throwCorrupted = [&pathToFile]()
+            {
+                throw exceptions::FileReadingException{std::format("The mesh file {} is corrupted.", pathToFile)};
+            };
+
+            if (data.size() < sizeof(BinaryMeshHeader))
+            {
+                throwCorrupted();
+            }
+
+            auto header = BinaryMeshHeader{};
+            std::memcpy(&header, data.data(), sizeof(header));
+
+            const auto attributesSize = uint64_t{header.attributesCount} * sizeof(BinaryMeshAttribute);
+            const auto lodsSize       = uint64_t{header.lodsCount} * sizeof(MeshLod);
+            const auto indicesSize    = uint64_t{header.indicesCount} * sizeof(GLuint);
+            if (header.magic != BinaryMeshHeader{}.magic || header.version != BinaryMeshHeader{}.version
+                || attributesSize + lodsSize > data.size() - sizeof(BinaryMeshHeader)
+                || header.verticesOffset > data.size()
+                || header.verticesCount > (data.size() - header.verticesOffset) / sizeof(GLfloat)
+                || header.indicesOffset > data.size() || indicesSize > data.size() - header.indicesOffset)
+            {
+                throwCorrupted();
+            }
+
+            attributes.reserve(header.attributesCount);
+            for (auto i = size_t{0}; i < header.attributesCount; ++i)
+            {
+                auto attribute = BinaryMeshAttribute{};
+                std::memcpy(&attribute, data.data() + sizeof(BinaryMeshHeader) + i * sizeof(attribute),
+                            sizeof(attribute));
+                attributes.push_back(VertexAttribute{.byteOffset{attribute.byteOffset},
+                                                     .count{attribute.count},
+                                                     .index{attribute.index},
+                                                     .normalized{static_cast<GLboolean>(attribute.normalized != 0)},
+                                                     .type{static_cast<VertexAttrType>(attribute.type)}});
+            }
+
+            const auto lodsData = viewArray(data.subspan(sizeof(BinaryMeshHeader) + attributesSize, lodsSize),
+                                            lodsStorage);
+            if (std::ranges::any_of(lodsData,
+                                    [&header](const MeshLod& lod)
+                                    {
+                                        return uint64_t{lod.indicesOffset} + lod.indicesCount > header.indicesCount;
+                                    }))
+            {
+                throwCorrupted();
+            }
+
+            view = MeshDataView{
+              .attributes{attributes},
+              .bounds{.center{header.boundsCenter[0], header.boundsCenter[1], header.boundsCenter[2]},
+                      .halfExtents{header.boundsHalfExtents[0], header.boundsHalfExtents[1],
+                                   header.boundsHalfExtents[2]}},
+              .indices{viewArray(data.subspan(header.indicesOffset, indicesSize), indicesStorage)},
+              .lods{lodsData},
+              .vertices{viewArray(data.subspan(header.verticesOffset, header.verticesCount * sizeof(GLfloat)),
+                                  verticesStorage)}};
+        }
+
+    public:
+        /**
+         * \brief Vertex attributes converted from the stored form.
+         */
+        std::vector<oglCore::vertex::VertexAttribute> attributes;
+        /**
+         * \brief The content of the mesh file.
+         */
+        helpers::FileView                             file;
+        /**
+         * \brief The copy of indices, which is used only if they are not aligned in the content.
+         */
+        std::vector<GLuint>                           indicesStorage;
+        /**
+         * \brief The copy of levels of detail, which is used only if they are not aligned in the content.
+         */
+        std::vector<MeshLod>                          lodsStorage;
+        /**
+         * \brief The copy of vertices, which is used only if they are not aligned in the content.
+         */
+        std::vector<GLfloat>                          verticesStorage;
+        /**
+         * \brief The view of the geometry.
+         */
+        MeshDataView                                  view;
+
+};  // class BinaryMesh::Impl
+
+BinaryMesh::BinaryMesh(const std::string& pathToFile) : m_impl{std::make_unique<Impl>(pathToFile)}
+{
+}
+
+BinaryMesh::BinaryMesh(BinaryMesh&& obj) noexcept = default;
+
+BinaryMesh::~BinaryMesh() noexcept = default;
+
+BinaryMesh& BinaryMesh::operator=(BinaryMesh&& obj) noexcept = default;
+
+const MeshDataView& BinaryMesh::getView() const noexcept
+{
+    return m_impl->view;
+}
+
+std::vector<std::byte> serializeBinaryMesh(const MeshDataView& meshData)
+{
+    if (meshData.attributes.size() > std::numeric_limits<uint32_t>::max()
+        || meshData.lods.size() > std::numeric_limits<uint32_t>::max()
+        || meshData.indices.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::invalid_argument{"The mesh has too many attributes, levels of detail or indices to be serialized."};
+    }
+
+    auto header = BinaryMeshHeader{};
+
+    header.attributesCount   = static_cast<uint32_t>(meshData.attributes.size());
+    header.indicesCount      = static_cast<uint32_t>(meshData.indices.size());
+    header.lodsCount         = static_cast<uint32_t>(meshData.lods.size());
+    header.verticesCount     = meshData.vertices.size();
+    header.verticesOffset    = alignOffset(sizeof(BinaryMeshHeader)
+                                           + meshData.attributes.size() * sizeof(BinaryMeshAttribute)
+                                           + meshData.lods.size_bytes());
+    header.indicesOffset     = alignOffset(header.verticesOffset + meshData.vertices.size_bytes());
+    header.boundsCenter      = {meshData.bounds.center.x(), meshData.bounds.center.y(), meshData.bounds.center.z()};
+    header.boundsHalfExtents = {meshData.bounds.halfExtents.x(), meshData.bounds.halfExtents.y(),
+                                meshData.bounds.halfExtents.z()};
+
+    // The buffer is zero-initialized, so padding bytes are zeroed and the file is reproducible
+    auto result = std::vector<std::byte>(header.indicesOffset + meshData.indices.size_bytes());
+    std::memcpy(result.data(), &header, sizeof(header));
+
+    auto attributeOffset = sizeof(BinaryMeshHeader);
+    for (const auto& attribute : meshData.attributes)
+    {
+        const auto stored = BinaryMeshAttribute{.byteOffset{attribute.byteOffset},
+                                                .count{attribute.count},
+                                                .index{attribute.index},
+                                                .normalized{attribute.normalized},
+                                                .type{helpers::toUType(attribute.type)}};
+        std::memcpy(result.data() + attributeOffset, &stored, sizeof(stored));
+        attributeOffset += sizeof(stored);
+    }
+    if (!meshData.lods.empty())
+    {
+        std::memcpy(result.data() + attributeOffset, meshData.lods.data(), meshData.lods.size_bytes());
+    }
+
+    std::memcpy(result.data() + header.verticesOffset, meshData.vertices.data(), meshData.vertices.size_bytes());
+    std::memcpy(result.data() + header.indicesOffset, meshData.indices.data(), meshData.indices.size_bytes());
+
+    return result;
+}
+
+}  // namespace ogls::assets
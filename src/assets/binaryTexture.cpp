@@ -0,0 +1,126 @@
+#include "assets/binaryTexture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#include "exceptions.h"
+#include "helpers/helpers.h"
+#include "helpers/virtualFileSystem.h"
+
+namespace ogls::assets
+{
+// The layout of the file must not depend on the compiler
+static_assert(std::is_trivially_copyable_v<BinaryTextureHeader> && sizeof(BinaryTextureHeader) == 48);
+
+namespace
+{
+    constexpr uint64_t alignOffset(uint64_t offset) noexcept
+    {
+        return (offset + binaryTextureDataAlignment - 1) / binaryTextureDataAlignment * binaryTextureDataAlignment;
+    }
+
+}  // namespace
+
+std::unique_ptr<oglCore::texture::TextureData> readBinaryTexture(const std::string& pathToFile)
+{
+    using namespace oglCore::texture;
+
+
+    const auto file = helpers::getDefaultVirtualFileSystem().readFile(pathToFile);
+    const auto data = file.getData();
+
+    const auto throwCorrupted = [&pathToFile]()
+    {
+        throw exceptions::FileReadingException{std::format("The texture file {} is corrupted.", pathToFile)};
+    };
+
+    if (data.size() < sizeof(BinaryTextureHeader))
+    {
+        throwCorrupted();
+    }
+
+    auto header = BinaryTextureHeader{};
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    constexpr auto maxSize = uint32_t{std::numeric_limits<GLsizei>::max()};
+    if (header.magic != BinaryTextureHeader{}.magic || header.version != BinaryTextureHeader{}.version
+        || header.levelsCount == 0 || header.levelsCount > 32 || header.width == 0 || header.width > maxSize
+        || header.height == 0 || header.height > maxSize || header.depth == 0 || header.depth > maxSize
+        || sizeof(BinaryTextureHeader) + header.levelsCount * sizeof(uint64_t) > header.dataOffset
+        || header.dataOffset > data.size())
+    {
+        throwCorrupted();
+    }
+
+    auto levelSizes = std::vector<GLsizei>(header.levelsCount);
+    auto dataSize   = uint64_t{0};
+    for (auto i = size_t{0}; i < levelSizes.size(); ++i)
+    {
+        auto levelSize = uint64_t{0};
+        std::memcpy(&levelSize, data.data() + sizeof(BinaryTextureHeader) + i * sizeof(levelSize), sizeof(levelSize));
+        if (levelSize > maxSize || levelSize > data.size() - header.dataOffset - dataSize)
+        {
+            throwCorrupted();
+        }
+        levelSizes[i]  = static_cast<GLsizei>(levelSize);
+        dataSize      += levelSize;
+    }
+
+    // TextureData owns its memory, so levels are copied out of the mapped file
+    auto pixels = TextureData::DataType{new unsigned char[dataSize], [](unsigned char* ptr) { delete[] ptr; }};
+    std::memcpy(pixels.get(), data.data() + header.dataOffset, dataSize);
+
+    auto result = std::make_unique<TextureData>(
+      std::move(pixels), static_cast<GLsizei>(header.width), static_cast<GLsizei>(header.height),
+      static_cast<GLsizei>(header.depth), static_cast<int>(header.nChannels), static_cast<GLint>(header.levelsCount),
+      static_cast<TexturePixelFormat>(header.pixelFormat), static_cast<TextureInternalFormat>(header.internalFormat),
+      static_cast<TexturePixelType>(header.pixelType));
+    result->levelSizes = std::move(levelSizes);
+
+    return result;
+}
+
+std::vector<std::byte> serializeBinaryTexture(const oglCore::texture::TextureData& textureData)
+{
+    using namespace helpers;
+
+
+    if (textureData.levelSizes.empty() || !textureData.data)
+    {
+        throw std::invalid_argument{"The texture data without precomputed levels cannot be serialized."};
+    }
+
+    auto header = BinaryTextureHeader{};
+
+    header.width          = static_cast<uint32_t>(textureData.width);
+    header.height         = static_cast<uint32_t>(textureData.height);
+    header.depth          = static_cast<uint32_t>(std::max(textureData.depth, 1));
+    header.internalFormat = static_cast<uint32_t>(toUType(textureData.internalFormat));
+    header.pixelFormat    = static_cast<uint32_t>(toUType(textureData.format));
+    header.pixelType      = static_cast<uint32_t>(toUType(textureData.type));
+    header.nChannels      = static_cast<uint32_t>(textureData.nChannels);
+    header.levelsCount    = static_cast<uint32_t>(textureData.levelSizes.size());
+    header.dataOffset     = alignOffset(sizeof(BinaryTextureHeader) + header.levelsCount * sizeof(uint64_t));
+
+    const auto dataSize = std::accumulate(textureData.levelSizes.begin(), textureData.levelSizes.end(), uint64_t{0});
+
+    // The buffer is zero-initialized, so padding bytes are zeroed and the file is reproducible
+    auto result = std::vector<std::byte>(header.dataOffset + dataSize);
+    std::memcpy(result.data(), &header, sizeof(header));
+    for (auto i = size_t{0}; i < textureData.levelSizes.size(); ++i)
+    {
+        const auto levelSize = static_cast<uint64_t>(textureData.levelSizes[i]);
+        std::memcpy(result.data() + sizeof(BinaryTextureHeader) + i * sizeof(levelSize), &levelSize,
+                    sizeof(levelSize));
+    }
+    std::memcpy(result.data() + header.dataOffset, textureData.data.get(), dataSize);
+
+    return result;
+}
+
+}  // namespace ogls::assets
@@ -0,0 +1,58 @@
+#include "assets/cookedAsset.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+
+namespace ogls::assets
+{
+namespace
+{
+    constexpr auto meshExtensions    = std::array<std::string_view, 3>{".glb", ".gltf", ".obj"};
+    constexpr auto shaderExtensions  = std::array<std::string_view, 7>{".comp", ".frag", ".geom", ".glsl",
+                                                                      ".tesc", ".tese", ".vert"};
+    constexpr auto textureExtensions = std::array<std::string_view, 5>{".bmp", ".jpeg", ".jpg", ".png", ".tga"};
+
+}  // namespace
+
+AssetKind getAssetKind(std::string_view pathToSource)
+{
+    auto extension = std::filesystem::path{pathToSource}.extension().string();
+    std::ranges::transform(extension, extension.begin(),
+                           [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+    const auto isIn = [&extension](const auto& extensions)
+    {
+        return std::ranges::find(extensions, extension) != extensions.end();
+    };
+
+    if (isIn(meshExtensions))
+    {
+        return AssetKind::Mesh;
+    }
+    if (isIn(shaderExtensions))
+    {
+        return AssetKind::Shader;
+    }
+    if (isIn(textureExtensions))
+    {
+        return AssetKind::Texture;
+    }
+    return AssetKind::Other;
+}
+
+std::string getCookedAssetPath(std::string_view pathToSource)
+{
+    switch (getAssetKind(pathToSource))
+    {
+        case AssetKind::Mesh:
+            return std::string{pathToSource} + ".oglmesh";
+        case AssetKind::Texture:
+            return std::string{pathToSource} + ".ogltex";
+        default:
+            return std::string{pathToSource};
+    }
+}
+
+}  // namespace ogls::assets
@@ -0,0 +1,506 @@
+#include "assets/meshImporter.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "helpers/virtualFileSystem.h"
+#include "json.h"
+#include "meshImporterImpl.h"
+
+namespace ogls::assets
+{
+namespace
+{
+    constexpr auto glbMagic     = uint32_t{0x46'54'6C'67};  // "glTF"
+    constexpr auto glbJsonChunk = uint32_t{0x4E'4F'53'4A};  // "JSON"
+    constexpr auto glbBinChunk  = uint32_t{0x00'4E'49'42};  // "BIN\0"
+
+    /**
+     * \brief The value of the primitive mode, which means the list of triangles.
+     */
+    constexpr auto trianglesMode = size_t{4};
+
+    /**
+     * \brief GltfComponentType is a type of components of the accessor.
+     */
+    enum class GltfComponentType : uint32_t
+    {
+        Byte          = 5'120,
+        UnsignedByte  = 5'121,
+        Short         = 5'122,
+        UnsignedShort = 5'123,
+        UnsignedInt   = 5'125,
+        Float         = 5'126
+    };
+
+    /**
+     * \brief GltfBuffer is the content of the buffer, which is stored in the binary chunk, in the data URI or
+     * in the external file.
+     */
+    struct GltfBuffer final
+    {
+            /**
+             * \brief The content of the buffer.
+             */
+            std::span<const std::byte> data;
+            /**
+             * \brief The decoded data URI.
+             */
+            std::vector<std::byte>     decodedData;
+            /**
+             * \brief The external file.
+             */
+            helpers::FileView          file;
+
+    };  // struct GltfBuffer
+
+    /**
+     * \brief GltfAccessor is the resolved accessor: the typed view of the buffer.
+     */
+    struct GltfAccessor final
+    {
+            size_t                     componentsCount = {0};
+            GltfComponentType          componentType   = GltfComponentType::Float;
+            size_t                     count           = {0};
+            /**
+             * \brief The data starting from the first element.
+             */
+            std::span<const std::byte> data;
+            bool                       normalized      = false;
+            size_t                     stride          = {0};
+
+    };  // struct GltfAccessor
+
+    /**
+     * \brief GltfPrimitive is the triangle primitive and the place of its data in the merged mesh.
+     */
+    struct GltfPrimitive final
+    {
+            size_t                      firstIndex  = {0};
+            size_t                      firstVertex = {0};
+            std::optional<GltfAccessor> indices;
+            std::optional<GltfAccessor> normals;
+            GltfAccessor                positions;
+            std::optional<GltfAccessor> texCoords;
+
+    };  // struct GltfPrimitive
+
+    std::vector<GltfBuffer> loadBuffers(const JsonValue& document, std::span<const std::byte> binaryChunk,
+                                        std::string_view baseDirectory);
+    GltfAccessor            readAccessor(const JsonValue& document, size_t accessorIndex,
+                                         std::span<const GltfBuffer> buffers);
+    double                  readComponent(const GltfAccessor& accessor, size_t element, size_t component) noexcept;
+
+}  // namespace
+
+MeshData importGltf(std::span<const std::byte> content, std::string_view baseDirectory, helpers::ThreadPool& pool)
+{
+    auto jsonText    = std::string_view{reinterpret_cast<const char*>(content.data()), content.size()};
+    auto binaryChunk = std::span<const std::byte>{};
+
+    const auto readUint32 = [&content](size_t offset)
+    {
+        auto value = uint32_t{0};
+        std::memcpy(&value, content.data() + offset, sizeof(value));
+        return value;
+    };
+    if (content.size() >= 12 && readUint32(0) == glbMagic)
+    {
+        // The binary container: the header and chunks, the first one of which is JSON
+        auto offset = size_t{12};
+        while (offset + 8 <= content.size())
+        {
+            const auto chunkLength = size_t{readUint32(offset)};
+            const auto chunkType   = readUint32(offset + 4);
+            if (chunkLength > content.size() - offset - 8)
+            {
+                throw std::invalid_argument{"The glTF binary container is truncated."};
+            }
+
+            const auto chunkData = content.subspan(offset + 8, chunkLength);
+            if (chunkType == glbJsonChunk)
+            {
+                jsonText = {reinterpret_cast<const char*>(chunkData.data()), chunkData.size()};
+            }
+            else if (chunkType == glbBinChunk && binaryChunk.empty())
+            {
+                binaryChunk = chunkData;
+            }
+            offset += 8 + chunkLength;
+        }
+    }
+
+    const auto document = parseJson(jsonText);
+    const auto buffers  = loadBuffers(document, binaryChunk, baseDirectory);
+
+    auto result = MeshData{};
+    result.attributes.assign(getImportedVertexAttributes().begin(), getImportedVertexAttributes().end());
+
+    // Accessors are resolved sequentially to place every primitive in the merged mesh, then the data is converted
+    // in parallel
+    auto primitives    = std::vector<GltfPrimitive>{};
+    auto verticesCount = size_t{0};
+    auto indicesCount  = size_t{0};
+    if (const auto meshes = document.find("meshes"))
+    {
+        for (const auto& mesh : meshes->getArray())
+        {
+            for (const auto& primitive : mesh.at("primitives").getArray())
+            {
+                if (const auto mode = primitive.find("mode"); mode && mode->getIndex() != trianglesMode)
+                {
+                    continue;
+                }
+
+                const auto& attributes = primitive.at("attributes");
+                const auto  optional   = [&](const JsonValue* accessor) -> std::optional<GltfAccessor>
+                {
+                    return accessor ? std::optional{readAccessor(document, accessor->getIndex(), buffers)}
+                                    : std::nullopt;
+                };
+
+                auto p        = GltfPrimitive{};
+                p.positions   = readAccessor(document, attributes.at("POSITION").getIndex(), buffers);
+                p.normals     = optional(attributes.find("NORMAL"));
+                p.texCoords   = optional(attributes.find("TEXCOORD_0"));
+                p.indices     = optional(primitive.find("indices"));
+                p.firstVertex = verticesCount;
+                p.firstIndex  = indicesCount;
+
+                if (p.positions.componentsCount != 3 || (p.normals && p.normals->componentsCount != 3)
+                    || (p.texCoords && p.texCoords->componentsCount != 2)
+                    || (p.indices && p.indices->componentsCount != 1))
+                {
+                    throw std::invalid_argument{"The glTF primitive has attributes of unexpected types."};
+                }
+
+                verticesCount += p.positions.count;
+                indicesCount  += p.indices ? p.indices->count : p.positions.count;
+                primitives.push_back(p);
+            }
+        }
+    }
+
+    if (verticesCount > std::numeric_limits<GLuint>::max())
+    {
+        throw std::invalid_argument{"The glTF asset has too many vertices."};
+    }
+    result.vertices.resize(verticesCount * importedVertexSize);
+    result.indices.resize(indicesCount);
+
+    pool.parallelFor(
+      primitives.size(),
+      [&](size_t i)
+      {
+          const auto& p        = primitives[i];
+          const auto  vertices = std::span<GLfloat>{result.vertices}.subspan(p.firstVertex * importedVertexSize,
+                                                                            p.positions.count * importedVertexSize);
+          const auto  indices  = std::span<GLuint>{result.indices}.subspan(
+            p.firstIndex, p.indices ? p.indices->count : p.positions.count);
+
+          for (auto v = size_t{0}; v < p.positions.count; ++v)
+          {
+              const auto vertex = vertices.subspan(v * importedVertexSize, importedVertexSize);
+              for (auto c = size_t{0}; c < 3; ++c)
+              {
+                  vertex[importedPositionOffset + c] = static_cast<GLfloat>(readComponent(p.positions, v, c));
+              }
+              if (p.normals && v < p.normals->count)
+              {
+                  for (auto c = size_t{0}; c < 3; ++c)
+                  {
+                      vertex[importedNormalOffset + c] = static_cast<GLfloat>(readComponent(*p.normals, v, c));
+                  }
+              }
+              if (p.texCoords && v < p.texCoords->count)
+              {
+                  // glTF places the origin of texture coordinates at the top left corner, but images are loaded
+                  // flipped vertically (see ogls::helpers::readTextureFromFile())
+                  vertex[importedTexCoordOffset]     = static_cast<GLfloat>(readComponent(*p.texCoords, v, 0));
+                  vertex[importedTexCoordOffset + 1] = static_cast<GLfloat>(1.0 - readComponent(*p.texCoords, v, 1));
+              }
+          }
+
+          for (auto j = size_t{0}; j < indices.size(); ++j)
+          {
+              const auto index = p.indices ? static_cast<size_t>(readComponent(*p.indices, j, 0)) : j;
+              if (index >= p.positions.count)
+              {
+                  throw std::invalid_argument{"The glTF primitive refers to the nonexistent vertex."};
+              }
+              indices[j] = static_cast<GLuint>(index);
+          }
+
+          // Normals are generated while indices are still local to the primitive
+          generateMissingNormals(vertices, indices);
+          for (auto& index : indices)
+          {
+              index += static_cast<GLuint>(p.firstVertex);
+          }
+      });
+
+    result.bounds = calculateImportedBounds(result.vertices);
+
+    return result;
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    std::vector<std::byte> decodeBase64(std::string_view text)
+    {
+        const auto decodeChar = [](char c) -> int
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                return c - 'A';
+            }
+            if (c >= 'a' && c <= 'z')
+            {
+                return c - 'a' + 26;
+            }
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0' + 52;
+            }
+            return c == '+' ? 62 : c == '/' ? 63 : -1;
+        };
+
+        auto result = std::vector<std::byte>{};
+        result.reserve(text.size() / 4 * 3);
+
+        auto accumulator = uint32_t{0};
+        auto bitsCount   = 0;
+        for (const auto c : text)
+        {
+            if (c == '=')
+            {
+                break;
+            }
+
+            const auto value = decodeChar(c);
+            if (value < 0)
+            {
+                throw std::invalid_argument{"The glTF data URI contains invalid base64 data."};
+            }
+
+            accumulator  = (accumulator << 6) | static_cast<uint32_t>(value);
+            bitsCount   += 6;
+            if (bitsCount >= 8)
+            {
+                bitsCount -= 8;
+                result.push_back(static_cast<std::byte>((accumulator >> bitsCount) & 0xFF));
+            }
+        }
+
+        return result;
+    }
+
+    std::string decodeUri(std::string_view uri)
+    {
+        auto result = std::string{};
+        result.reserve(uri.size());
+
+        for (auto i = size_t{0}; i < uri.size(); ++i)
+        {
+            auto value = 0;
+            if (uri[i] == '%' && i + 2 < uri.size()
+                && std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3)
+            {
+                result.push_back(static_cast<char>(value));
+                i += 2;
+            }
+            else
+            {
+                result.push_back(uri[i]);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<GltfBuffer> loadBuffers(const JsonValue& document, std::span<const std::byte> binaryChunk,
+                                        std::string_view baseDirectory)
+    {
+        auto result = std::vector<GltfBuffer>{};
+
+        const auto buffers = document.find("buffers");
+        if (!buffers)
+        {
+            return result;
+        }
+
+        result.resize(buffers->getArray().size());
+        for (auto i = size_t{0}; i < result.size(); ++i)
+        {
+            const auto& description = buffers->getArray()[i];
+            const auto  byteLength  = description.at("byteLength").getIndex();
+            auto&       buffer      = result[i];
+
+            if (const auto uri = description.find("uri"); !uri)
+            {
+                // The buffer without URI refers to the binary chunk of *.glb
+                buffer.data = binaryChunk;
+            }
+            else if (const auto& uriText = uri->getString(); uriText.starts_with("data:"))
+            {
+                const auto dataStart = uriText.find(";base64,");
+                if (dataStart == std::string::npos)
+                {
+                    throw std::invalid_argument{"The glTF data URI is not base64-encoded."};
+                }
+                buffer.decodedData = decodeBase64(std::string_view{uriText}.substr(dataStart + 8));
+                buffer.data        = buffer.decodedData;
+            }
+            else
+            {
+                const auto path = baseDirectory.empty() ? decodeUri(uriText)
+                                                        : std::format("{}/{}", baseDirectory, decodeUri(uriText));
+                buffer.file     = helpers::getDefaultVirtualFileSystem().readFile(path);
+                buffer.data     = buffer.file.getData();
+            }
+
+            if (buffer.data.size() < byteLength)
+            {
+                throw std::invalid_argument{std::format("The glTF buffer {} is shorter than its byteLength.", i)};
+            }
+            buffer.data = buffer.data.first(byteLength);
+        }
+
+        return result;
+    }
+
+    GltfAccessor readAccessor(const JsonValue& document, size_t accessorIndex, std::span<const GltfBuffer> buffers)
+    {
+        const auto& accessors = document.at("accessors").getArray();
+        if (accessorIndex >= accessors.size())
+        {
+            throw std::invalid_argument{std::format("The glTF accessor {} doesn't exist.", accessorIndex)};
+        }
+
+        const auto& description = accessors[accessorIndex];
+        if (description.find("sparse") || !description.find("bufferView"))
+        {
+            throw std::invalid_argument{"Sparse glTF accessors are not supported."};
+        }
+
+        auto result            = GltfAccessor{};
+        result.count           = description.at("count").getIndex();
+        result.componentType   = static_cast<GltfComponentType>(description.at("componentType").getIndex());
+        result.normalized      = description.find("normalized") && description.at("normalized").getBool();
+
+        const auto& type       = description.at("type").getString();
+        result.componentsCount = type == "SCALAR" ? 1
+                                 : type == "VEC2" ? 2
+                                 : type == "VEC3" ? 3
+                                 : type == "VEC4" ? 4
+                                                  : 0;
+
+        auto componentSize = size_t{0};
+        switch (result.componentType)
+        {
+            case GltfComponentType::Byte:
+            case GltfComponentType::UnsignedByte:
+                componentSize = 1;
+                break;
+            case GltfComponentType::Short:
+            case GltfComponentType::UnsignedShort:
+                componentSize = 2;
+                break;
+            case GltfComponentType::UnsignedInt:
+            case GltfComponentType::Float:
+                componentSize = 4;
+                break;
+        }
+        if (componentSize == 0 || result.componentsCount == 0)
+        {
+            throw std::invalid_argument{std::format("The glTF accessor {} has unsupported type.", accessorIndex)};
+        }
+
+        const auto& bufferViews     = document.at("bufferViews").getArray();
+        const auto  bufferViewIndex = description.at("bufferView").getIndex();
+        if (bufferViewIndex >= bufferViews.size())
+        {
+            throw std::invalid_argument{std::format("The glTF buffer view {} doesn't exist.", bufferViewIndex)};
+        }
+
+        const auto& bufferView  = bufferViews[bufferViewIndex];
+        const auto  bufferIndex = bufferView.at("buffer").getIndex();
+        if (bufferIndex >= buffers.size())
+        {
+            throw std::invalid_argument{std::format("The glTF buffer {} doesn't exist.", bufferIndex)};
+        }
+
+        const auto elementSize = componentSize * result.componentsCount;
+        const auto stride      = bufferView.find("byteStride");
+        result.stride          = stride ? stride->getIndex() : elementSize;
+
+        const auto viewOffset     = bufferView.find("byteOffset") ? bufferView.at("byteOffset").getIndex() : 0;
+        const auto viewLength     = bufferView.at("byteLength").getIndex();
+        const auto accessorOffset = description.find("byteOffset") ? description.at("byteOffset").getIndex() : 0;
+        const auto& buffer        = buffers[bufferIndex].data;
+
+        const auto dataLength = result.count == 0 ? 0 : result.stride * (result.count - 1) + elementSize;
+        if (result.stride < elementSize || viewOffset > buffer.size() || viewLength > buffer.size() - viewOffset
+            || accessorOffset > viewLength || dataLength > viewLength - accessorOffset)
+        {
+            throw std::invalid_argument{std::format("The glTF accessor {} is out of its buffer.", accessorIndex)};
+        }
+
+        result.data = buffer.subspan(viewOffset + accessorOffset, dataLength);
+        return result;
+    }
+
+    double readComponent(const GltfAccessor& accessor, size_t element, size_t component) noexcept
+    {
+        const auto read = [&]<typename Type>(Type)
+        {
+            auto value = Type{};
+            std::memcpy(&value, accessor.data.data() + element * accessor.stride + component * sizeof(Type),
+                        sizeof(Type));
+            return value;
+        };
+
+        // Normalized integers are converted accordingly to the glTF specification
+        switch (accessor.componentType)
+        {
+            case GltfComponentType::Byte:
+            {
+                const auto value = static_cast<double>(read(int8_t{}));
+                return accessor.normalized ? std::max(value / 127.0, -1.0) : value;
+            }
+            case GltfComponentType::UnsignedByte:
+            {
+                const auto value = static_cast<double>(read(uint8_t{}));
+                return accessor.normalized ? value / 255.0 : value;
+            }
+            case GltfComponentType::Short:
+            {
+                const auto value = static_cast<double>(read(int16_t{}));
+                return accessor.normalized ? std::max(value / 32'767.0, -1.0) : value;
+            }
+            case GltfComponentType::UnsignedShort:
+            {
+                const auto value = static_cast<double>(read(uint16_t{}));
+                return accessor.normalized ? value / 65'535.0 : value;
+            }
+            case GltfComponentType::UnsignedInt:
+                return static_cast<double>(read(uint32_t{}));
+            case GltfComponentType::Float:
+                return static_cast<double>(read(float{}));
+        }
+        return 0.0;
+    }
+
+}  // namespace
+
+}  // namespace ogls::assets
@@ -0,0 +1,396 @@
+#include "json.h"
+
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace ogls::assets
+{
+namespace
+{
+    /**
+     * \brief The maximum nesting of arrays and objects, which protects the parser from the stack overflow.
+     */
+    constexpr auto maxDepth = size_t{256};
+
+    /**
+     * \brief Appends the code point encoded in UTF-8.
+     */
+    void appendCodePoint(std::string& str, char32_t codePoint)
+    {
+        if (codePoint < 0x80)
+        {
+            str.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x8'00)
+        {
+            str.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x1'00'00)
+        {
+            str.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            str.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            str.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            str.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    /**
+     * \brief JsonParser is a recursive descent parser of JSON.
+     */
+    class JsonParser final
+    {
+        public:
+            explicit JsonParser(std::string_view text) noexcept : m_text{text}
+            {
+            }
+
+            JsonValue parseDocument()
+            {
+                auto result = parseValue(0);
+                skipWhitespace();
+                if (m_position != m_text.size())
+                {
+                    throwError("unexpected data after the root value");
+                }
+                return result;
+            }
+
+        private:
+            void expect(char c)
+            {
+                if (m_position >= m_text.size() || m_text[m_position] != c)
+                {
+                    throwError(std::format("'{}' is expected", c));
+                }
+                ++m_position;
+            }
+
+            JsonValue parseArray(size_t depth)
+            {
+                expect('[');
+
+                auto result = JsonValue::Array{};
+                skipWhitespace();
+                if (tryConsume(']'))
+                {
+                    return JsonValue{std::move(result)};
+                }
+
+                do
+                {
+                    result.push_back(parseValue(depth + 1));
+                    skipWhitespace();
+                } while (tryConsume(','));
+                expect(']');
+
+                return JsonValue{std::move(result)};
+            }
+
+            char32_t parseCodePoint()
+            {
+                const auto parseHex = [this]()
+                {
+                    auto value = uint32_t{0};
+                    if (m_position + 4 > m_text.size()
+                        || std::from_chars(m_text.data() + m_position, m_text.data() + m_position + 4, value, 16).ptr
+                             != m_text.data() + m_position + 4)
+                    {
+                        throwError("invalid unicode escape sequence");
+                    }
+                    m_position += 4;
+                    return static_cast<char32_t>(value);
+                };
+
+                const auto high = parseHex();
+                if (high < 0xD8'00 || high > 0xDB'FF)
+                {
+                    return high;
+                }
+
+                // The surrogate pair
+                expect('\\');
+                expect('u');
+                const auto low = parseHex();
+                if (low < 0xDC'00 || low > 0xDF'FF)
+                {
+                    throwError("invalid surrogate pair");
+                }
+                return 0x1'00'00 + ((high - 0xD8'00) << 10) + (low - 0xDC'00);
+            }
+
+            JsonValue parseLiteral(std::string_view literal, JsonValue::Value value)
+            {
+                if (!m_text.substr(m_position).starts_with(literal))
+                {
+                    throwError("unknown literal");
+                }
+                m_position += literal.size();
+                return JsonValue{std::move(value)};
+            }
+
+            JsonValue parseNumber()
+            {
+                const auto begin = m_text.data() + m_position;
+                const auto end   = m_text.data() + m_text.size();
+
+                auto number       = double{0.0};
+                const auto result = std::from_chars(begin, end, number);
+                if (result.ec != std::errc{} || !std::isfinite(number))
+                {
+                    throwError("invalid number");
+                }
+                m_position += static_cast<size_t>(result.ptr - begin);
+
+                return JsonValue{number};
+            }
+
+            JsonValue parseObject(size_t depth)
+            {
+                expect('{');
+
+                auto result = JsonValue::Object{};
+                skipWhitespace();
+                if (tryConsume('}'))
+                {
+                    return JsonValue{std::move(result)};
+                }
+
+                do
+                {
+                    skipWhitespace();
+                    auto key = parseString();
+                    skipWhitespace();
+                    expect(':');
+                    result.emplace_back(std::move(key), parseValue(depth + 1));
+                    skipWhitespace();
+                } while (tryConsume(','));
+                expect('}');
+
+                return JsonValue{std::move(result)};
+            }
+
+            std::string parseString()
+            {
+                expect('"');
+
+                auto result = std::string{};
+                while (true)
+                {
+                    if (m_position >= m_text.size())
+                    {
+                        throwError("unterminated string");
+                    }
+
+                    const auto c = m_text[m_position++];
+                    if (c == '"')
+                    {
+                        return result;
+                    }
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        throwError("control character in string");
+                    }
+                    if (c != '\\')
+                    {
+                        result.push_back(c);
+                        continue;
+                    }
+
+                    if (m_position >= m_text.size())
+                    {
+                        throwError("unterminated string");
+                    }
+                    switch (const auto escaped = m_text[m_position++])
+                    {
+                        case '"':
+                        case '\\':
+                        case '/':
+                            result.push_back(escaped);
+                            break;
+                        case 'b':
+                            result.push_back('\b');
+                            break;
+                        case 'f':
+                            result.push_back('\f');
+                            break;
+                        case 'n':
+                            result.push_back('\n');
+                            break;
+                        case 'r':
+                            result.push_back('\r');
+                            break;
+                        case 't':
+                            result.push_back('\t');
+                            break;
+                        case 'u':
+                            appendCodePoint(result, parseCodePoint());
+                            break;
+                        default:
+                            throwError("invalid escape sequence");
+                    }
+                }
+            }
+
+            JsonValue parseValue(size_t depth)
+            {
+                if (depth > maxDepth)
+                {
+                    throwError("too deep nesting");
+                }
+
+                skipWhitespace();
+                if (m_position >= m_text.size())
+                {
+                    throwError("unexpected end of the document");
+                }
+
+                switch (m_text[m_position])
+                {
+                    case '{':
+                        return parseObject(depth);
+                    case '[':
+                        return parseArray(depth);
+                    case '"':
+                        return JsonValue{parseString()};
+                    case 't':
+                        return parseLiteral("true", true);
+                    case 'f':
+                        return parseLiteral("false", false);
+                    case 'n':
+                        return parseLiteral("null", nullptr);
+                    default:
+                        return parseNumber();
+                }
+            }
+
+            void skipWhitespace() noexcept
+            {
+                while (m_position < m_text.size()
+                       && (m_text[m_position] == ' ' || m_text[m_position] == '\t' || m_text[m_position] == '\n'
+                           || m_text[m_position] == '\r'))
+                {
+                    ++m_position;
+                }
+            }
+
+            [[noreturn]] void throwError(std::string_view description) const
+            {
+                throw std::invalid_argument{
+                  std::format("Malformed JSON at offset {}: {}.", m_position, description)};
+            }
+
+            bool tryConsume(char c) noexcept
+            {
+                if (m_position < m_text.size() && m_text[m_position] == c)
+                {
+                    ++m_position;
+                    return true;
+                }
+                return false;
+            }
+
+        private:
+            size_t           m_position = {0};
+            std::string_view m_text;
+
+    };  // class JsonParser
+
+    [[noreturn]] void throwTypeMismatch(std::string_view expectedType)
+    {
+        throw std::invalid_argument{std::format("The JSON value is not {}.", expectedType)};
+    }
+
+}  // namespace
+
+JsonValue::JsonValue(Value value) noexcept : m_value{std::move(value)}
+{
+}
+
+const JsonValue& JsonValue::at(std::string_view key) const
+{
+    if (const auto member = find(key))
+    {
+        return *member;
+    }
+    throw std::invalid_argument{std::format("The JSON object doesn't have the member \"{}\".", key)};
+}
+
+const JsonValue* JsonValue::find(std::string_view key) const
+{
+    const auto object = std::get_if<Object>(&m_value);
+    if (!object)
+    {
+        throwTypeMismatch("an object");
+    }
+
+    for (const auto& [memberKey, member] : *object)
+    {
+        if (memberKey == key)
+        {
+            return &member;
+        }
+    }
+    return nullptr;
+}
+
+const JsonValue::Array& JsonValue::getArray() const
+{
+    if (const auto array = std::get_if<Array>(&m_value))
+    {
+        return *array;
+    }
+    throwTypeMismatch("an array");
+}
+
+bool JsonValue::getBool() const
+{
+    if (const auto boolean = std::get_if<bool>(&m_value))
+    {
+        return *boolean;
+    }
+    throwTypeMismatch("a boolean");
+}
+
+size_t JsonValue::getIndex() const
+{
+    const auto number = getNumber();
+    if (number < 0.0 || number != std::floor(number) || number > 9'007'199'254'740'992.0)
+    {
+        throwTypeMismatch("a non-negative integer");
+    }
+    return static_cast<size_t>(number);
+}
+
+double JsonValue::getNumber() const
+{
+    if (const auto number = std::get_if<double>(&m_value))
+    {
+        return *number;
+    }
+    throwTypeMismatch("a number");
+}
+
+const std::string& JsonValue::getString() const
+{
+    if (const auto str = std::get_if<std::string>(&m_value))
+    {
+        return *str;
+    }
+    throwTypeMismatch("a string");
+}
+
+JsonValue parseJson(std::string_view text)
+{
+    return JsonParser{text}.parseDocument();
+}
+
+}  // namespace ogls::assets
@@ -0,0 +1,101 @@
+#ifndef OGLS_ASSETS_JSON_H
+#define OGLS_ASSETS_JSON_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ogls::assets
+{
+/**
+ * \brief JsonValue is a value of the parsed JSON document.
+ *
+ * It is the minimal read-only DOM, which is enough to read glTF assets. Accessors throw std::invalid_argument
+ * if the value has another type, so a malformed asset is reported by the same exception as a syntax error.
+ */
+class JsonValue final
+{
+    public:
+        using Array  = std::vector<JsonValue>;
+        /**
+         * \brief Members of the object in the order of the document. glTF objects are small, so the linear search
+         * is faster than any map.
+         */
+        using Object = std::vector<std::pair<std::string, JsonValue>>;
+        using Value  = std::variant<std::nullptr_t, bool, double, std::string, Array, Object>;
+
+    public:
+        JsonValue() = default;
+        /**
+         * \brief Constructs new JsonValue.
+         *
+         * \param value - the value.
+         */
+        explicit JsonValue(Value value) noexcept;
+
+        /**
+         * \brief Returns the member of the object.
+         *
+         * \throw std::invalid_argument, if the value is not an object or there is no such member.
+         */
+        const JsonValue&   at(std::string_view key) const;
+        /**
+         * \brief Returns the member of the object or nullptr if there is no such member.
+         *
+         * \throw std::invalid_argument, if the value is not an object.
+         */
+        const JsonValue*   find(std::string_view key) const;
+        /**
+         * \brief Returns the array.
+         *
+         * \throw std::invalid_argument, if the value is not an array.
+         */
+        const Array&       getArray() const;
+        /**
+         * \brief Returns the boolean.
+         *
+         * \throw std::invalid_argument, if the value is not a boolean.
+         */
+        bool               getBool() const;
+        /**
+         * \brief Returns the non-negative integer number, which is used as an index, a count or a size.
+         *
+         * \throw std::invalid_argument, if the value is not a non-negative integer number.
+         */
+        size_t             getIndex() const;
+        /**
+         * \brief Returns the number.
+         *
+         * \throw std::invalid_argument, if the value is not a number.
+         */
+        double             getNumber() const;
+        /**
+         * \brief Returns the string.
+         *
+         * \throw std::invalid_argument, if the value is not a string.
+         */
+        const std::string& getString() const;
+
+    private:
+        /**
+         * \brief The value.
+         */
+        Value m_value = nullptr;
+
+};  // class JsonValue
+
+/**
+ * \brief Parses the JSON document (RFC 8259).
+ *
+ * \param text - the text of the document.
+ * \return the root value.
+ * \throw std::invalid_argument, if the text is malformed.
+ */
+JsonValue parseJson(std::string_view text);
+
+}  // namespace ogls::assets
+
+#endif
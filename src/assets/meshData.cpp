@@ -0,0 +1,14 @@
+#include "assets/meshData.h"
+
+namespace ogls::assets
+{
+MeshDataView makeMeshDataView(const MeshData& meshData) noexcept
+{
+    return MeshDataView{.attributes{meshData.attributes},
+                        .bounds{meshData.bounds},
+                        .indices{meshData.indices},
+                        .lods{meshData.lods},
+                        .vertices{meshData.vertices}};
+}
+
+}  // namespace ogls::assets
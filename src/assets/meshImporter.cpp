@@ -0,0 +1,157 @@
+#include "assets/meshImporter.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers/virtualFileSystem.h"
+#include "meshImporterImpl.h"
+
+namespace ogls::assets
+{
+namespace
+{
+    using oglCore::vertex::VertexAttribute;
+    using oglCore::vertex::VertexAttrType;
+
+    constexpr auto floatSize = int{sizeof(GLfloat)};
+
+    const auto importedVertexAttributes = std::array<VertexAttribute, 3>{
+      VertexAttribute{.byteOffset{floatSize * importedPositionOffset}, .count{3}, .index{0}, .normalized{false},
+                      .type{VertexAttrType::Float}},
+      VertexAttribute{.byteOffset{floatSize * importedNormalOffset}, .count{3}, .index{1}, .normalized{false},
+                      .type{VertexAttrType::Float}},
+      VertexAttribute{.byteOffset{floatSize * importedTexCoordOffset}, .count{2}, .index{2}, .normalized{false},
+                      .type{VertexAttrType::Float}}
+    };
+
+}  // namespace
+
+MeshData importMeshFile(const std::string& pathToFile, helpers::ThreadPool& pool)
+{
+    auto extension = std::filesystem::path{pathToFile}.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+    const auto file = helpers::getDefaultVirtualFileSystem().readFile(pathToFile);
+    if (extension == ".obj")
+    {
+        return importObj(file.getText(), pool);
+    }
+    if (extension == ".gltf" || extension == ".glb")
+    {
+        const auto baseDirectory = std::filesystem::path{pathToFile}.parent_path().generic_string();
+        return importGltf(file.getData(), baseDirectory, pool);
+    }
+
+    throw std::invalid_argument{std::format("The format of the mesh file {} is not supported.", pathToFile)};
+}
+
+std::span<const oglCore::vertex::VertexAttribute> getImportedVertexAttributes() noexcept
+{
+    return importedVertexAttributes;
+}
+
+mathCore::BoundingBox calculateImportedBounds(std::span<const GLfloat> vertices) noexcept
+{
+    if (vertices.size() < importedVertexSize)
+    {
+        return mathCore::BoundingBox{};
+    }
+
+    auto minimum = std::array<float, 3>{};
+    auto maximum = std::array<float, 3>{};
+    minimum.fill(std::numeric_limits<float>::max());
+    maximum.fill(std::numeric_limits<float>::lowest());
+
+    for (auto v = size_t{0}; v + importedVertexSize <= vertices.size(); v += importedVertexSize)
+    {
+        for (auto i = size_t{0}; i < 3; ++i)
+        {
+            minimum[i] = std::min(minimum[i], vertices[v + importedPositionOffset + i]);
+            maximum[i] = std::max(maximum[i], vertices[v + importedPositionOffset + i]);
+        }
+    }
+
+    return mathCore::BoundingBox{
+      .center{(minimum[0] + maximum[0]) * 0.5f, (minimum[1] + maximum[1]) * 0.5f, (minimum[2] + maximum[2]) * 0.5f},
+      .halfExtents{(maximum[0] - minimum[0]) * 0.5f, (maximum[1] - minimum[1]) * 0.5f,
+                   (maximum[2] - minimum[2]) * 0.5f}};
+}
+
+void generateMissingNormals(std::span<GLfloat> vertices, std::span<const GLuint> indices) noexcept
+{
+    const auto verticesCount = vertices.size() / importedVertexSize;
+    const auto normalAt      = [&vertices](size_t vertex)
+    {
+        return vertices.subspan(vertex * importedVertexSize + importedNormalOffset, 3);
+    };
+
+    auto isMissing  = std::vector<bool>(verticesCount, false);
+    auto anyMissing = false;
+    for (auto v = size_t{0}; v < verticesCount; ++v)
+    {
+        const auto normal = normalAt(v);
+        isMissing[v]      = normal[0] == 0.0f && normal[1] == 0.0f && normal[2] == 0.0f;
+        anyMissing        = anyMissing || isMissing[v];
+    }
+    if (!anyMissing)
+    {
+        return;
+    }
+
+    for (auto t = size_t{0}; t + 3 <= indices.size(); t += 3)
+    {
+        const auto a = size_t{indices[t]}, b = size_t{indices[t + 1]}, c = size_t{indices[t + 2]};
+        if (a >= verticesCount || b >= verticesCount || c >= verticesCount
+            || !(isMissing[a] || isMissing[b] || isMissing[c]))
+        {
+            continue;
+        }
+
+        const auto position = [&vertices](size_t vertex, size_t i)
+        {
+            return vertices[vertex * importedVertexSize + importedPositionOffset + i];
+        };
+        const auto e1 = std::array<float, 3>{position(b, 0) - position(a, 0), position(b, 1) - position(a, 1),
+                                             position(b, 2) - position(a, 2)};
+        const auto e2 = std::array<float, 3>{position(c, 0) - position(a, 0), position(c, 1) - position(a, 1),
+                                             position(c, 2) - position(a, 2)};
+        // The length of the cross product is twice the area of the triangle, so the sum is area-weighted
+        const auto n  = std::array<float, 3>{e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                                             e1[0] * e2[1] - e1[1] * e2[0]};
+
+        for (const auto vertex : {a, b, c})
+        {
+            if (isMissing[vertex])
+            {
+                const auto normal = normalAt(vertex);
+                for (auto i = size_t{0}; i < 3; ++i)
+                {
+                    normal[i] += n[i];
+                }
+            }
+        }
+    }
+
+    for (auto v = size_t{0}; v < verticesCount; ++v)
+    {
+        const auto normal = normalAt(v);
+        const auto length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (isMissing[v] && length > 0.0f)
+        {
+            for (auto& component : normal)
+            {
+                component /= length;
+            }
+        }
+    }
+}
+
+}  // namespace ogls::assets
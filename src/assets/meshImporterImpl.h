@@ -0,0 +1,45 @@
+#ifndef OGLS_ASSETS_MESH_IMPORTER_IMPL_H
+#define OGLS_ASSETS_MESH_IMPORTER_IMPL_H
+
+#include <cstddef>
+#include <span>
+
+#include <glad/glad.h>
+
+#include "mathCore/boundingBox.h"
+
+namespace ogls::assets
+{
+/**
+ * \brief A number of GLfloat values in one imported vertex (see getImportedVertexAttributes()).
+ */
+constexpr auto importedVertexSize   = size_t{8};
+/**
+ * \brief The offset in GLfloat values of the position in the imported vertex.
+ */
+constexpr auto importedPositionOffset = size_t{0};
+/**
+ * \brief The offset in GLfloat values of the normal in the imported vertex.
+ */
+constexpr auto importedNormalOffset   = size_t{3};
+/**
+ * \brief The offset in GLfloat values of the texture coordinates in the imported vertex.
+ */
+constexpr auto importedTexCoordOffset = size_t{6};
+
+/**
+ * \brief Calculates the bounding box of positions of imported vertices.
+ */
+mathCore::BoundingBox calculateImportedBounds(std::span<const GLfloat> vertices) noexcept;
+/**
+ * \brief Calculates normals of imported vertices, which have zero normals, as the area-weighted sum of normals
+ * of adjacent triangles.
+ *
+ * \param vertices - imported vertices.
+ * \param indices  - indices of triangles, which refer to vertices.
+ */
+void                  generateMissingNormals(std::span<GLfloat> vertices, std::span<const GLuint> indices) noexcept;
+
+}  // namespace ogls::assets
+
+#endif
@@ -0,0 +1,253 @@
+#include "assets/meshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ogls::assets
+{
+namespace
+{
+    /**
+     * \brief The size of the simulated cache. It is larger than caches of real GPUs, because the score function
+     * only needs to prefer recently used vertices.
+     */
+    constexpr auto cacheSize          = size_t{32};
+    constexpr auto cacheDecayPower    = 1.5f;
+    /**
+     * \brief The score of vertices of the last added triangle. It is lower than the score of the next position,
+     * so the strip doesn't turn back onto itself.
+     */
+    constexpr auto lastTriangleScore  = 0.75f;
+    constexpr auto noCachePosition    = std::numeric_limits<uint32_t>::max();
+    constexpr auto valenceBoostPower  = 0.5f;
+    constexpr auto valenceBoostScale  = 2.0f;
+
+    /**
+     * \brief VertexState is the state of the vertex during the optimization.
+     */
+    struct VertexState final
+    {
+            /**
+             * \brief The offset of triangles of the vertex in the adjacency array.
+             */
+            uint32_t adjacencyOffset    = {0};
+            uint32_t cachePosition      = noCachePosition;
+            /**
+             * \brief A number of triangles of the vertex, which aren't added to the result yet. They are stored
+             * first in the adjacency array of the vertex.
+             */
+            uint32_t remainingTriangles = {0};
+            float    score              = {0.0f};
+
+    };  // struct VertexState
+
+    float calculateVertexScore(const VertexState& vertex) noexcept
+    {
+        if (vertex.remainingTriangles == 0)
+        {
+            return -1.0f;
+        }
+
+        auto score = 0.0f;
+        if (vertex.cachePosition != noCachePosition)
+        {
+            if (vertex.cachePosition < 3)
+            {
+                score = lastTriangleScore;
+            }
+            else
+            {
+                const auto scaler = 1.0f / static_cast<float>(cacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(vertex.cachePosition - 3) * scaler, cacheDecayPower);
+            }
+        }
+
+        return score
+               + valenceBoostScale * std::pow(static_cast<float>(vertex.remainingTriangles), -valenceBoostPower);
+    }
+
+    /**
+     * \brief Returns a number of GLfloat values of one interleaved vertex.
+     */
+    size_t calculateVertexSize(const MeshData& meshData) noexcept
+    {
+        auto stride = size_t{0};
+        for (const auto& attribute : meshData.attributes)
+        {
+            stride += static_cast<size_t>(oglCore::vertex::getByteSizeOfType(attribute.type) * attribute.count);
+        }
+        return stride / sizeof(GLfloat);
+    }
+
+}  // namespace
+
+void optimizeVertexCache(std::span<GLuint> indices, size_t verticesCount)
+{
+    const auto trianglesCount = indices.size() / 3;
+    if (trianglesCount == 0)
+    {
+        return;
+    }
+
+    auto vertices = std::vector<VertexState>(verticesCount);
+    for (const auto index : indices)
+    {
+        ++vertices[index].remainingTriangles;
+    }
+
+    auto adjacencyOffset = uint32_t{0};
+    for (auto& vertex : vertices)
+    {
+        vertex.adjacencyOffset  = adjacencyOffset;
+        adjacencyOffset        += vertex.remainingTriangles;
+        vertex.score            = calculateVertexScore(vertex);
+    }
+
+    auto adjacency = std::vector<uint32_t>(indices.size());
+    auto filled    = std::vector<uint32_t>(verticesCount, 0);
+    for (auto triangle = size_t{0}; triangle < trianglesCount; ++triangle)
+    {
+        for (auto k = size_t{0}; k < 3; ++k)
+        {
+            const auto vertex = indices[triangle * 3 + k];
+            adjacency[vertices[vertex].adjacencyOffset + filled[vertex]++] = static_cast<uint32_t>(triangle);
+        }
+    }
+
+    auto triangleScores = std::vector<float>(trianglesCount);
+    auto isAdded        = std::vector<bool>(trianglesCount, false);
+    for (auto triangle = size_t{0}; triangle < trianglesCount; ++triangle)
+    {
+        triangleScores[triangle] = vertices[indices[triangle * 3]].score + vertices[indices[triangle * 3 + 1]].score
+                                   + vertices[indices[triangle * 3 + 2]].score;
+    }
+
+    auto result = std::vector<GLuint>{};
+    result.reserve(indices.size());
+
+    // 3 extra slots keep vertices pushed out of the cache by the new triangle until their scores are updated
+    auto cache     = std::array<GLuint, cacheSize + 3>{};
+    auto cacheUsed = size_t{0};
+
+    auto bestTriangle = size_t{0};
+    auto nextUnadded  = size_t{0};
+    while (result.size() < indices.size())
+    {
+        isAdded[bestTriangle] = true;
+
+        auto newCache     = std::array<GLuint, cacheSize + 3>{};
+        auto newCacheUsed = size_t{0};
+        for (auto k = size_t{0}; k < 3; ++k)
+        {
+            const auto index = indices[bestTriangle * 3 + k];
+            result.push_back(index);
+            newCache[newCacheUsed++] = index;
+
+            // The added triangle is moved out of the range of remaining triangles of the vertex
+            auto&      vertex    = vertices[index];
+            const auto triangles = adjacency.begin() + vertex.adjacencyOffset;
+            std::iter_swap(std::find(triangles, triangles + vertex.remainingTriangles, bestTriangle),
+                           triangles + vertex.remainingTriangles - 1);
+            --vertex.remainingTriangles;
+        }
+        for (auto i = size_t{0}; i < cacheUsed; ++i)
+        {
+            if (std::find(newCache.begin(), newCache.begin() + 3, cache[i]) == newCache.begin() + 3)
+            {
+                newCache[newCacheUsed++] = cache[i];
+            }
+        }
+        cache     = newCache;
+        cacheUsed = newCacheUsed;
+
+        for (auto i = size_t{0}; i < cacheUsed; ++i)
+        {
+            auto& vertex         = vertices[cache[i]];
+            vertex.cachePosition = i < cacheSize ? static_cast<uint32_t>(i) : noCachePosition;
+
+            const auto newScore = calculateVertexScore(vertex);
+            const auto delta    = newScore - vertex.score;
+            vertex.score        = newScore;
+            for (auto j = uint32_t{0}; j < vertex.remainingTriangles; ++j)
+            {
+                triangleScores[adjacency[vertex.adjacencyOffset + j]] += delta;
+            }
+        }
+        cacheUsed = std::min(cacheUsed, cacheSize);
+
+        // The next triangle is the best one among triangles of cached vertices. It is the same as the best one
+        // among all triangles in almost all cases, but is found in constant time
+        auto bestScore = -1.0f;
+        for (auto i = size_t{0}; i < cacheUsed; ++i)
+        {
+            const auto& vertex = vertices[cache[i]];
+            for (auto j = uint32_t{0}; j < vertex.remainingTriangles; ++j)
+            {
+                const auto triangle = adjacency[vertex.adjacencyOffset + j];
+                if (triangleScores[triangle] > bestScore)
+                {
+                    bestScore    = triangleScores[triangle];
+                    bestTriangle = triangle;
+                }
+            }
+        }
+
+        if (bestScore < 0.0f)
+        {
+            // Cached vertices don't have remaining triangles, so the next disconnected part is started
+            while (nextUnadded < trianglesCount && isAdded[nextUnadded])
+            {
+                ++nextUnadded;
+            }
+            bestTriangle = nextUnadded;
+        }
+    }
+
+    std::ranges::copy(result, indices.begin());
+}
+
+void optimizeVertexFetch(MeshData& meshData)
+{
+    const auto vertexSize = calculateVertexSize(meshData);
+    if (vertexSize == 0)
+    {
+        return;
+    }
+
+    const auto verticesCount = meshData.vertices.size() / vertexSize;
+    auto       remap         = std::vector<GLuint>(verticesCount, std::numeric_limits<GLuint>::max());
+    auto       vertices      = std::vector<GLfloat>{};
+    vertices.reserve(meshData.vertices.size());
+
+    for (auto& index : meshData.indices)
+    {
+        if (remap[index] == std::numeric_limits<GLuint>::max())
+        {
+            remap[index]      = static_cast<GLuint>(vertices.size() / vertexSize);
+            const auto vertex = meshData.vertices.begin() + static_cast<ptrdiff_t>(index * vertexSize);
+            vertices.insert(vertices.end(), vertex, vertex + static_cast<ptrdiff_t>(vertexSize));
+        }
+        index = remap[index];
+    }
+
+    meshData.vertices = std::move(vertices);
+}
+
+void optimizeMesh(MeshData& meshData)
+{
+    const auto vertexSize    = calculateVertexSize(meshData);
+    const auto verticesCount = vertexSize == 0 ? size_t{0} : meshData.vertices.size() / vertexSize;
+    if (std::ranges::any_of(meshData.indices, [verticesCount](GLuint index) { return index >= verticesCount; }))
+    {
+        throw std::invalid_argument{"The mesh index refers to the nonexistent vertex."};
+    }
+
+    optimizeVertexCache(meshData.indices, verticesCount);
+    optimizeVertexFetch(meshData);
+}
+
+}  // namespace ogls::assets
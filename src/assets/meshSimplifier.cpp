@@ -0,0 +1,639 @@
+#include "assets/meshSimplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "assets/meshOptimizer.h"
+
+namespace ogls::assets
+{
+namespace
+{
+    /**
+     * \brief The weight of quadrics of planes, which are perpendicular to open borders. It is large, so borders
+     * keep their shape, while the surface inside them is simplified.
+     */
+    constexpr auto borderWeight       = 10.0;
+    /**
+     * \brief The limit of passes of collapses. It is reached only by meshes, which almost can't be simplified
+     * (for example, because most of their vertices are locked), and stops the slow progress on them.
+     */
+    constexpr auto maxPassesCount     = size_t{100};
+    /**
+     * \brief The maximal ratio of numbers of indices of the coarser and the finer levels, with which the coarser
+     * level is kept. Levels simplified less than that don't reduce the load enough to be worth switching.
+     */
+    constexpr auto maxLodIndicesRatio = 0.85;
+    /**
+     * \brief The minimal cosine of the angle, by which the collapse can rotate the triangle. Larger rotations
+     * fold the surface or make slivers, which look like holes.
+     */
+    constexpr auto minNormalCosine    = 0.25f;
+
+    using Position = std::array<float, 3>;
+
+    /**
+     * \brief VertexKind restricts, in which direction the vertex can be collapsed.
+     */
+    enum class VertexKind : uint8_t
+    {
+        /**
+         * \brief The vertex lies on the open border and can be moved only along it.
+         */
+        Border,
+        /**
+         * \brief The vertex lies on the attribute seam or on the non-manifold edge and isn't moved at all.
+         */
+        Locked,
+        /**
+         * \brief The vertex is surrounded by triangles and can be moved to any neighbour.
+         */
+        Manifold
+    };
+
+    /**
+     * \brief Quadric is a symmetric 4x4 matrix of the sum of squared distances to weighted planes.
+     * The distance from the point p is p^T * A * p + 2 * b^T * p + c.
+     */
+    struct Quadric final
+    {
+            double a00    = {0.0};
+            double a01    = {0.0};
+            double a02    = {0.0};
+            double a11    = {0.0};
+            double a12    = {0.0};
+            double a22    = {0.0};
+            double b0     = {0.0};
+            double b1     = {0.0};
+            double b2     = {0.0};
+            double c      = {0.0};
+            /**
+             * \brief The sum of weights of planes. The quadric divided by it is the mean squared distance.
+             */
+            double weight = {0.0};
+
+    };  // struct Quadric
+
+    /**
+     * \brief Collapse is the candidate to collapse the vertex "from" into the vertex "to".
+     */
+    struct Collapse final
+    {
+            double cost = {0.0};
+            GLuint from = {0};
+            GLuint to   = {0};
+
+    };  // struct Collapse
+
+    /**
+     * \brief EdgeSet is the set of directed edges between canonical vertices of triangles.
+     */
+    class EdgeSet final
+    {
+        public:
+            explicit EdgeSet(std::span<const GLuint> indices, std::span<const GLuint> canonical)
+            {
+                m_edges.reserve(indices.size());
+                for (auto i = size_t{0}; i + 2 < indices.size(); i += 3)
+                {
+                    for (auto k = size_t{0}; k < 3; ++k)
+                    {
+                        m_edges.push_back(makeKey(canonical[indices[i + k]], canonical[indices[i + (k + 1) % 3]]));
+                    }
+                }
+                std::ranges::sort(m_edges);
+            }
+
+            /**
+             * \brief Returns a number of triangles, which contain the directed edge.
+             */
+            size_t count(GLuint from, GLuint to) const noexcept
+            {
+                const auto [first, last] = std::ranges::equal_range(m_edges, makeKey(from, to));
+                return static_cast<size_t>(last - first);
+            }
+
+            /**
+             * \brief Checks if the edge belongs only to one triangle.
+             */
+            bool isBorder(GLuint a, GLuint b) const noexcept
+            {
+                return count(a, b) + count(b, a) == 1;
+            }
+
+            /**
+             * \brief Calls func(from, to) for every directed edge (possibly several times for the same edge).
+             */
+            template<typename Func>
+            void forEach(Func&& func) const
+            {
+                for (const auto key : m_edges)
+                {
+                    func(static_cast<GLuint>(key >> 32), static_cast<GLuint>(key & 0xFF'FF'FF'FF));
+                }
+            }
+
+        private:
+            static constexpr uint64_t makeKey(GLuint from, GLuint to) noexcept
+            {
+                return (uint64_t{from} << 32) | to;
+            }
+
+        private:
+            std::vector<uint64_t> m_edges;
+
+    };  // class EdgeSet
+
+    Position                 subtract(const Position& a, const Position& b) noexcept;
+    Position                 cross(const Position& a, const Position& b) noexcept;
+    float                    dot(const Position& a, const Position& b) noexcept;
+
+    void                     addPlaneQuadric(Quadric& quadric, const Position& normal, const Position& point,
+                                             double weight) noexcept;
+    void                     addQuadric(Quadric& quadric, const Quadric& other) noexcept;
+    double                   evaluateQuadric(const Quadric& quadric, const Position& p) noexcept;
+
+    std::vector<Position>    extractPositions(const MeshDataView& meshData);
+    std::vector<GLuint>      findCanonicalVertices(std::span<const Position> positions);
+    std::vector<VertexKind>  classifyVertices(const EdgeSet& edges, std::span<const GLuint> canonical);
+    std::vector<Quadric>     calculateQuadrics(std::span<const Position> positions, std::span<const GLuint> indices,
+                                               std::span<const GLuint> canonical, const EdgeSet& edges);
+    SimplifiedIndices        simplifyIndices(std::span<const Position> positions, std::span<const GLuint> indices,
+                                             size_t targetIndicesCount);
+
+}  // namespace
+
+//------ IMPLEMENTATION
+
+SimplifiedIndices simplifyMesh(const MeshDataView& meshData, std::span<const GLuint> indices,
+                               size_t targetIndicesCount)
+{
+    const auto positions = extractPositions(meshData);
+    if (std::ranges::any_of(indices, [&positions](GLuint index) { return index >= positions.size(); }))
+    {
+        throw std::invalid_argument{"The mesh index refers to the nonexistent vertex."};
+    }
+
+    return simplifyIndices(positions, indices, targetIndicesCount);
+}
+
+void buildMeshLods(MeshData& meshData, const MeshLodSettings& settings, helpers::ThreadPool& pool)
+{
+    const auto positions = extractPositions(makeMeshDataView(meshData));
+    if (!meshData.lods.empty()
+        && uint64_t{meshData.lods.front().indicesOffset} + meshData.lods.front().indicesCount > meshData.indices.size())
+    {
+        throw std::invalid_argument{"The level of detail refers to nonexistent indices."};
+    }
+
+    const auto fullDetail = meshData.lods.empty()
+                              ? std::span<const GLuint>{meshData.indices}
+                              : std::span<const GLuint>{meshData.indices}.subspan(meshData.lods.front().indicesOffset,
+                                                                                  meshData.lods.front().indicesCount);
+    if (std::ranges::any_of(fullDetail, [&positions](GLuint index) { return index >= positions.size(); }))
+    {
+        throw std::invalid_argument{"The mesh index refers to the nonexistent vertex."};
+    }
+
+    auto targets        = std::vector<size_t>{};
+    auto trianglesCount = static_cast<double>(fullDetail.size() / 3);
+    for (auto i = size_t{1}; i < settings.maxLodsCount; ++i)
+    {
+        trianglesCount *= settings.reductionRatio;
+        if (trianglesCount < static_cast<double>(settings.minTrianglesCount))
+        {
+            break;
+        }
+        targets.push_back(static_cast<size_t>(trianglesCount) * 3);
+    }
+
+    // Levels are simplified from the full-detail level, so they are independent and are built in parallel
+    auto levels = std::vector<SimplifiedIndices>(targets.size());
+    pool.parallelFor(targets.size(),
+                     [&](size_t i)
+                     {
+                         levels[i] = simplifyIndices(positions, fullDetail, targets[i]);
+                         optimizeVertexCache(levels[i].indices, positions.size());
+                     });
+
+    auto indices = std::vector<GLuint>(fullDetail.begin(), fullDetail.end());
+    auto lods    = std::vector<MeshLod>{
+      MeshLod{.error{0.0f}, .indicesCount{static_cast<uint32_t>(fullDetail.size())}, .indicesOffset{0}}};
+    for (const auto& level : levels)
+    {
+        const auto previous = lods.back();
+        if (static_cast<double>(level.indices.size()) > maxLodIndicesRatio * previous.indicesCount)
+        {
+            continue;
+        }
+        if (indices.size() + level.indices.size() > std::numeric_limits<uint32_t>::max())
+        {
+            throw std::invalid_argument{"The mesh has too many indices to store its levels of detail."};
+        }
+
+        // The error is used to choose the level, so it mustn't decrease along the chain
+        lods.push_back(MeshLod{.error{std::max(level.error, previous.error)},
+                               .indicesCount{static_cast<uint32_t>(level.indices.size())},
+                               .indicesOffset{static_cast<uint32_t>(indices.size())}});
+        indices.insert(indices.end(), level.indices.begin(), level.indices.end());
+    }
+
+    meshData.indices = std::move(indices);
+    meshData.lods    = std::move(lods);
+}
+
+namespace
+{
+    Position subtract(const Position& a, const Position& b) noexcept
+    {
+        return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+    }
+
+    Position cross(const Position& a, const Position& b) noexcept
+    {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+
+    float dot(const Position& a, const Position& b) noexcept
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    void addPlaneQuadric(Quadric& quadric, const Position& normal, const Position& point, double weight) noexcept
+    {
+        const auto a = double{normal[0]};
+        const auto b = double{normal[1]};
+        const auto c = double{normal[2]};
+        const auto d = -(a * point[0] + b * point[1] + c * point[2]);
+
+        addQuadric(quadric, Quadric{.a00{weight * a * a},
+                                    .a01{weight * a * b},
+                                    .a02{weight * a * c},
+                                    .a11{weight * b * b},
+                                    .a12{weight * b * c},
+                                    .a22{weight * c * c},
+                                    .b0{weight * a * d},
+                                    .b1{weight * b * d},
+                                    .b2{weight * c * d},
+                                    .c{weight * d * d},
+                                    .weight{weight}});
+    }
+
+    void addQuadric(Quadric& quadric, const Quadric& other) noexcept
+    {
+        quadric.a00    += other.a00;
+        quadric.a01    += other.a01;
+        quadric.a02    += other.a02;
+        quadric.a11    += other.a11;
+        quadric.a12    += other.a12;
+        quadric.a22    += other.a22;
+        quadric.b0     += other.b0;
+        quadric.b1     += other.b1;
+        quadric.b2     += other.b2;
+        quadric.c      += other.c;
+        quadric.weight += other.weight;
+    }
+
+    double evaluateQuadric(const Quadric& q, const Position& p) noexcept
+    {
+        const auto x = double{p[0]};
+        const auto y = double{p[1]};
+        const auto z = double{p[2]};
+
+        const auto result = q.a00 * x * x + q.a11 * y * y + q.a22 * z * z
+                            + 2.0 * (q.a01 * x * y + q.a02 * x * z + q.a12 * y * z)
+                            + 2.0 * (q.b0 * x + q.b1 * y + q.b2 * z) + q.c;
+
+        // The rounding can make the sum of squares slightly negative
+        return std::max(result, 0.0);
+    }
+
+    std::vector<Position> extractPositions(const MeshDataView& meshData)
+    {
+        using namespace oglCore::vertex;
+
+
+        auto vertexSize = size_t{0};
+        for (const auto& attribute : meshData.attributes)
+        {
+            vertexSize += static_cast<size_t>(getByteSizeOfType(attribute.type) * attribute.count);
+        }
+        vertexSize /= sizeof(GLfloat);
+
+        const auto position = std::ranges::find_if(meshData.attributes, [](const VertexAttribute& attribute)
+                                                   { return attribute.index == 0; });
+        if (position == meshData.attributes.end() || position->type != VertexAttrType::Float || position->count < 3
+            || vertexSize == 0)
+        {
+            throw std::invalid_argument{"The mesh doesn't have the position attribute (index 0, vec3 of floats)."};
+        }
+
+        const auto offset        = static_cast<size_t>(position->byteOffset) / sizeof(GLfloat);
+        const auto verticesCount = meshData.vertices.size() / vertexSize;
+
+        auto result = std::vector<Position>(verticesCount);
+        for (auto i = size_t{0}; i < verticesCount; ++i)
+        {
+            const auto vertex = meshData.vertices.subspan(i * vertexSize + offset, 3);
+            result[i]         = {vertex[0], vertex[1], vertex[2]};
+        }
+        return result;
+    }
+
+    /**
+     * \brief Maps every vertex to the first vertex with the same position. Such vertices differ only by other
+     * attributes (for example, texture coordinates of the seam) and must be moved together.
+     */
+    std::vector<GLuint> findCanonicalVertices(std::span<const Position> positions)
+    {
+        auto order = std::vector<GLuint>(positions.size());
+        std::iota(order.begin(), order.end(), GLuint{0});
+        std::ranges::stable_sort(order, [positions](GLuint a, GLuint b) { return positions[a] < positions[b]; });
+
+        auto result = std::vector<GLuint>(positions.size());
+        for (auto i = size_t{0}; i < order.size(); ++i)
+        {
+            const auto isFirst = i == 0 || positions[order[i]] != positions[order[i - 1]];
+            result[order[i]]   = isFirst ? order[i] : result[order[i - 1]];
+        }
+        return result;
+    }
+
+    std::vector<VertexKind> classifyVertices(const EdgeSet& edges, std::span<const GLuint> canonical)
+    {
+        auto result = std::vector<VertexKind>(canonical.size(), VertexKind::Manifold);
+        for (auto i = size_t{0}; i < canonical.size(); ++i)
+        {
+            if (canonical[i] != i)
+            {
+                // The vertex and its canonical vertex are on the seam
+                result[i]            = VertexKind::Locked;
+                result[canonical[i]] = VertexKind::Locked;
+            }
+        }
+
+        edges.forEach(
+          [&edges, &result](GLuint from, GLuint to)
+          {
+              const auto forward  = edges.count(from, to);
+              const auto backward = edges.count(to, from);
+              if (forward > 1 || backward > 1)
+              {
+                  result[from] = VertexKind::Locked;
+                  result[to]   = VertexKind::Locked;
+              }
+              else if (backward == 0)
+              {
+                  for (const auto vertex : {from, to})
+                  {
+                      if (result[vertex] == VertexKind::Manifold)
+                      {
+                          result[vertex] = VertexKind::Border;
+                      }
+                  }
+              }
+          });
+
+        return result;
+    }
+
+    std::vector<Quadric> calculateQuadrics(std::span<const Position> positions, std::span<const GLuint> indices,
+                                           std::span<const GLuint> canonical, const EdgeSet& edges)
+    {
+        auto result = std::vector<Quadric>(positions.size());
+        for (auto i = size_t{0}; i + 2 < indices.size(); i += 3)
+        {
+            const auto corners = std::array{indices[i], indices[i + 1], indices[i + 2]};
+
+            auto       normal = cross(subtract(positions[corners[1]], positions[corners[0]]),
+                                      subtract(positions[corners[2]], positions[corners[0]]));
+            const auto length = std::sqrt(dot(normal, normal));
+            if (length == 0.0f)
+            {
+                continue;
+            }
+            normal = {normal[0] / length, normal[1] / length, normal[2] / length};
+
+            // Planes are weighted by areas, so the large triangle affects the error more than small ones
+            for (const auto corner : corners)
+            {
+                addPlaneQuadric(result[canonical[corner]], normal, positions[corner], 0.5 * length);
+            }
+
+            for (auto k = size_t{0}; k < 3; ++k)
+            {
+                const auto from = canonical[corners[k]];
+                const auto to   = canonical[corners[(k + 1) % 3]];
+                if (!edges.isBorder(from, to))
+                {
+                    continue;
+                }
+
+                // The plane through the border edge perpendicular to the triangle keeps the border in place
+                const auto edge         = subtract(positions[to], positions[from]);
+                auto       borderNormal = cross(edge, normal);
+                const auto borderLength = std::sqrt(dot(borderNormal, borderNormal));
+                if (borderLength == 0.0f)
+                {
+                    continue;
+                }
+                borderNormal     = {borderNormal[0] / borderLength, borderNormal[1] / borderLength,
+                                    borderNormal[2] / borderLength};
+                const auto weight = borderWeight * dot(edge, edge);
+                addPlaneQuadric(result[from], borderNormal, positions[from], weight);
+                addPlaneQuadric(result[to], borderNormal, positions[from], weight);
+            }
+        }
+        return result;
+    }
+
+    SimplifiedIndices simplifyIndices(std::span<const Position> positions, std::span<const GLuint> indices,
+                                      size_t targetIndicesCount)
+    {
+        const auto canonical = findCanonicalVertices(positions);
+
+        auto result = SimplifiedIndices{.error{0.0f}, .indices{indices.begin(), indices.end() - indices.size() % 3}};
+        if (result.indices.size() <= targetIndicesCount)
+        {
+            return result;
+        }
+
+        auto quadrics = calculateQuadrics(positions, result.indices, canonical, EdgeSet{result.indices, canonical});
+
+        auto maxCost     = 0.0;
+        auto candidates  = std::vector<Collapse>{};
+        auto isCollapsed = std::vector<char>(positions.size());
+        auto remap       = std::vector<GLuint>(positions.size());
+        auto adjacency   = std::vector<GLuint>{};
+        auto offsets     = std::vector<GLuint>(positions.size() + 1);
+
+        for (auto pass = size_t{0}; pass < maxPassesCount && result.indices.size() > targetIndicesCount; ++pass)
+        {
+            const auto edges = EdgeSet{result.indices, canonical};
+            const auto kinds = classifyVertices(edges, canonical);
+
+            // Triangles of every vertex in the compressed form: triangles of the vertex v are
+            // adjacency[offsets[v]] ... adjacency[offsets[v + 1] - 1]
+            std::ranges::fill(offsets, GLuint{0});
+            for (const auto index : result.indices)
+            {
+                ++offsets[index + 1];
+            }
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            adjacency.resize(result.indices.size());
+            auto fill = std::vector<GLuint>(offsets.begin(), offsets.end() - 1);
+            for (auto i = size_t{0}; i < result.indices.size(); ++i)
+            {
+                adjacency[fill[result.indices[i]]++] = static_cast<GLuint>(i / 3);
+            }
+
+            const auto collapseCost = [&](GLuint from, GLuint to)
+            {
+                auto quadric = quadrics[canonical[from]];
+                addQuadric(quadric, quadrics[canonical[to]]);
+                return evaluateQuadric(quadric, positions[to]) / std::max(quadric.weight, 1e-12);
+            };
+            const auto isCollapseAllowed = [&](GLuint from, GLuint to)
+            {
+                return kinds[from] == VertexKind::Manifold
+                       || (kinds[from] == VertexKind::Border && edges.isBorder(canonical[from], canonical[to]));
+            };
+
+            candidates.clear();
+            for (auto i = size_t{0}; i + 2 < result.indices.size(); i += 3)
+            {
+                for (auto k = size_t{0}; k < 3; ++k)
+                {
+                    const auto a = result.indices[i + k];
+                    const auto b = result.indices[i + (k + 1) % 3];
+
+                    // The interior edge is met twice, the collapse is considered only once
+                    if (canonical[a] == canonical[b]
+                        || (canonical[a] > canonical[b] && !edges.isBorder(canonical[a], canonical[b])))
+                    {
+                        continue;
+                    }
+
+                    const auto costAB = isCollapseAllowed(a, b) ? collapseCost(a, b)
+                                                                : std::numeric_limits<double>::infinity();
+                    const auto costBA = isCollapseAllowed(b, a) ? collapseCost(b, a)
+                                                                : std::numeric_limits<double>::infinity();
+                    if (std::isfinite(costAB) || std::isfinite(costBA))
+                    {
+                        candidates.push_back(costAB <= costBA ? Collapse{.cost{costAB}, .from{a}, .to{b}}
+                                                              : Collapse{.cost{costBA}, .from{b}, .to{a}});
+                    }
+                }
+            }
+            std::ranges::sort(candidates, {}, &Collapse::cost);
+
+            std::ranges::fill(isCollapsed, char{0});
+            std::iota(remap.begin(), remap.end(), GLuint{0});
+
+            // Returns -1 if the collapse flips any triangle, otherwise a number of triangles, which become degenerate
+            const auto countRemovedTriangles = [&](const Collapse& collapse)
+            {
+                auto removed = 0;
+                for (auto t = offsets[collapse.from]; t < offsets[collapse.from + 1]; ++t)
+                {
+                    const auto triangle = adjacency[t] * size_t{3};
+                    auto       corners  = std::array{remap[result.indices[triangle]],
+                                                     remap[result.indices[triangle + 1]],
+                                                     remap[result.indices[triangle + 2]]};
+                    if (std::ranges::any_of(corners, [&](GLuint corner)
+                                            { return canonical[corner] == canonical[collapse.to]; }))
+                    {
+                        ++removed;
+                        continue;
+                    }
+
+                    const auto oldNormal = cross(subtract(positions[corners[1]], positions[corners[0]]),
+                                                 subtract(positions[corners[2]], positions[corners[0]]));
+                    if (dot(oldNormal, oldNormal) == 0.0f)
+                    {
+                        continue;
+                    }
+                    std::ranges::replace(corners, collapse.from, collapse.to);
+                    const auto newNormal = cross(subtract(positions[corners[1]], positions[corners[0]]),
+                                                 subtract(positions[corners[2]], positions[corners[0]]));
+                    if (dot(oldNormal, newNormal)
+                        <= minNormalCosine * std::sqrt(dot(oldNormal, oldNormal) * dot(newNormal, newNormal)))
+                    {
+                        return -1;
+                    }
+                }
+                return removed;
+            };
+
+            // Each collapse removes 2 triangles of the manifold mesh, so the pass doesn't go further than needed
+            const auto goal         = (result.indices.size() - targetIndicesCount) / 3;
+            auto       removedCount = size_t{0};
+            for (const auto& collapse : candidates)
+            {
+                if (isCollapsed[canonical[collapse.from]] || isCollapsed[canonical[collapse.to]])
+                {
+                    continue;
+                }
+
+                const auto removed = countRemovedTriangles(collapse);
+                if (removed < 0)
+                {
+                    continue;
+                }
+
+                remap[collapse.from] = collapse.to;
+                addQuadric(quadrics[canonical[collapse.to]], quadrics[canonical[collapse.from]]);
+
+                // Flips are checked by positions before the pass, so neighbours of the moved vertex wait
+                // for the next pass
+                for (auto t = offsets[collapse.from]; t < offsets[collapse.from + 1]; ++t)
+                {
+                    for (auto k = size_t{0}; k < 3; ++k)
+                    {
+                        isCollapsed[canonical[result.indices[adjacency[t] * size_t{3} + k]]] = 1;
+                    }
+                }
+                isCollapsed[canonical[collapse.to]] = 1;
+
+                maxCost       = std::max(maxCost, collapse.cost);
+                removedCount += static_cast<size_t>(removed);
+                if (removedCount >= goal)
+                {
+                    break;
+                }
+            }
+
+            if (removedCount == 0)
+            {
+                break;
+            }
+
+            auto triangles = size_t{0};
+            for (auto i = size_t{0}; i + 2 < result.indices.size(); i += 3)
+            {
+                const auto a = remap[result.indices[i]];
+                const auto b = remap[result.indices[i + 1]];
+                const auto c = remap[result.indices[i + 2]];
+                if (canonical[a] != canonical[b] && canonical[b] != canonical[c] && canonical[a] != canonical[c])
+                {
+                    result.indices[triangles * 3]     = a;
+                    result.indices[triangles * 3 + 1] = b;
+                    result.indices[triangles * 3 + 2] = c;
+                    ++triangles;
+                }
+            }
+            result.indices.resize(triangles * 3);
+        }
+
+        result.error = static_cast<float>(std::sqrt(maxCost));
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace ogls::assets
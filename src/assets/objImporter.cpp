@@ -0,0 +1,373 @@
+#include "assets/meshImporter.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers/helpers.h"
+#include "meshImporterImpl.h"
+
+namespace ogls::assets
+{
+namespace
+{
+    /**
+     * \brief The minimum size of the chunk of the text, which is parsed by one task.
+     */
+    constexpr auto minChunkSize = size_t{64 * 1'024};
+    /**
+     * \brief The value of ObjCorner::indices, which means that the corner doesn't refer to the element.
+     */
+    constexpr auto absentIndex  = std::numeric_limits<int64_t>::min();
+
+    /**
+     * \brief ObjCorner is a corner of the face, which refers to the position, the texture coordinates
+     * and the normal.
+     */
+    struct ObjCorner final
+    {
+            /**
+             * \brief 0-based indices of the position, the texture coordinates and the normal.
+             */
+            std::array<int64_t, 3> indices      = {absentIndex, absentIndex, absentIndex};
+            /**
+             * \brief The bit i is set if indices[i] is relative to the beginning of the chunk, in which it is
+             * declared, because negative OBJ indices refer to elements declared before the face.
+             */
+            uint8_t                relativeMask = {0};
+
+    };  // struct ObjCorner
+
+    struct ObjCornerHash final
+    {
+            size_t operator()(const std::array<int64_t, 3>& indices) const noexcept
+            {
+                auto seed = size_t{0};
+                for (const auto index : indices)
+                {
+                    helpers::hashCombine(seed, std::hash<int64_t>{}(index));
+                }
+                return seed;
+            }
+
+    };  // struct ObjCornerHash
+
+    /**
+     * \brief ObjChunk is the parsed part of the OBJ text.
+     */
+    struct ObjChunk final
+    {
+            std::vector<ObjCorner> corners;
+            /**
+             * \brief Numbers of corners of faces.
+             */
+            std::vector<uint32_t>  faceSizes;
+            std::vector<float>     normals;
+            std::vector<float>     positions;
+            std::vector<float>     texCoords;
+
+    };  // struct ObjChunk
+
+    void                          parseObjChunk(std::string_view text, ObjChunk& chunk);
+    std::vector<std::string_view> splitIntoChunks(std::string_view text, size_t chunksCount);
+
+}  // namespace
+
+MeshData importObj(std::string_view text, helpers::ThreadPool& pool)
+{
+    const auto chunkTexts = splitIntoChunks(
+      text, std::clamp(text.size() / minChunkSize, size_t{1}, pool.getThreadsNumber() * 4));
+
+    auto chunks = std::vector<ObjChunk>(chunkTexts.size());
+    pool.parallelFor(chunks.size(), [&](size_t i) { parseObjChunk(chunkTexts[i], chunks[i]); });
+
+    // Relative indices are resolved when the numbers of elements declared in previous chunks are known
+    auto totals       = std::array<int64_t, 3>{};
+    auto bases        = std::vector<std::array<int64_t, 3>>(chunks.size());
+    auto cornersCount = size_t{0};
+    for (auto i = size_t{0}; i < chunks.size(); ++i)
+    {
+        bases[i]       = totals;
+        totals[0]     += static_cast<int64_t>(chunks[i].positions.size() / 3);
+        totals[1]     += static_cast<int64_t>(chunks[i].texCoords.size() / 2);
+        totals[2]     += static_cast<int64_t>(chunks[i].normals.size() / 3);
+        cornersCount  += chunks[i].corners.size();
+    }
+    pool.parallelFor(chunks.size(),
+                     [&](size_t i)
+                     {
+                         for (auto& corner : chunks[i].corners)
+                         {
+                             for (auto k = size_t{0}; k < 3; ++k)
+                             {
+                                 if (corner.relativeMask & (1u << k))
+                                 {
+                                     corner.indices[k] += bases[i][k];
+                                 }
+                                 if (corner.indices[k] != absentIndex
+                                     && (corner.indices[k] < 0 || corner.indices[k] >= totals[k]))
+                                 {
+                                     throw std::invalid_argument{"The OBJ face refers to the nonexistent element."};
+                                 }
+                             }
+                         }
+                     });
+
+    const auto elementAt = [&chunks, &bases](size_t k, int64_t index, size_t size)
+    {
+        const auto chunk = std::upper_bound(bases.begin(), bases.end(), index,
+                                            [k](int64_t value, const auto& base) { return value < base[k]; })
+                           - bases.begin() - 1;
+        const auto& c    = chunks[chunk];
+        const auto& data = k == 0 ? c.positions : k == 1 ? c.texCoords : c.normals;
+        return std::span<const float>{data}.subspan(static_cast<size_t>(index - bases[chunk][k]) * size, size);
+    };
+
+    auto result = MeshData{};
+    result.attributes.assign(getImportedVertexAttributes().begin(), getImportedVertexAttributes().end());
+    result.indices.reserve(cornersCount * 3);
+    result.vertices.reserve(cornersCount * importedVertexSize);
+
+    auto vertices = std::unordered_map<std::array<int64_t, 3>, GLuint, ObjCornerHash>{};
+    vertices.reserve(cornersCount);
+
+    auto faceCorners = std::vector<GLuint>{};
+    for (const auto& chunk : chunks)
+    {
+        auto corner = chunk.corners.begin();
+        for (const auto faceSize : chunk.faceSizes)
+        {
+            faceCorners.clear();
+            for (const auto end = corner + faceSize; corner != end; ++corner)
+            {
+                const auto [it, isInserted] = vertices.try_emplace(
+                  corner->indices, static_cast<GLuint>(result.vertices.size() / importedVertexSize));
+                if (isInserted)
+                {
+                    const auto position = elementAt(0, corner->indices[0], 3);
+                    result.vertices.insert(result.vertices.end(), position.begin(), position.end());
+
+                    if (corner->indices[2] != absentIndex)
+                    {
+                        const auto normal = elementAt(2, corner->indices[2], 3);
+                        result.vertices.insert(result.vertices.end(), normal.begin(), normal.end());
+                    }
+                    else
+                    {
+                        result.vertices.insert(result.vertices.end(), 3, 0.0f);
+                    }
+
+                    if (corner->indices[1] != absentIndex)
+                    {
+                        const auto texCoord = elementAt(1, corner->indices[1], 2);
+                        result.vertices.insert(result.vertices.end(), texCoord.begin(), texCoord.end());
+                    }
+                    else
+                    {
+                        result.vertices.insert(result.vertices.end(), 2, 0.0f);
+                    }
+                }
+                faceCorners.push_back(it->second);
+            }
+
+            // The polygon is triangulated as a fan, which is correct for convex polygons
+            for (auto i = size_t{1}; i + 1 < faceCorners.size(); ++i)
+            {
+                result.indices.insert(result.indices.end(), {faceCorners[0], faceCorners[i], faceCorners[i + 1]});
+            }
+        }
+    }
+
+    generateMissingNormals(result.vertices, result.indices);
+    result.bounds = calculateImportedBounds(result.vertices);
+
+    return result;
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    [[noreturn]] void throwMalformedLine(std::string_view line)
+    {
+        throw std::invalid_argument{std::format("The OBJ line \"{}\" is malformed.", line)};
+    }
+
+    void skipSpaces(const char*& first, const char* last) noexcept
+    {
+        while (first != last && (*first == ' ' || *first == '\t'))
+        {
+            ++first;
+        }
+    }
+
+    /**
+     * \brief Parses count floats separated by spaces. Only first required values must be present.
+     */
+    void parseFloats(std::string_view line, const char* first, std::vector<float>& destination, size_t count,
+                     size_t required)
+    {
+        const auto last = line.data() + line.size();
+        for (auto i = size_t{0}; i < count; ++i)
+        {
+            skipSpaces(first, last);
+            if (first != last && *first == '+')
+            {
+                ++first;
+            }
+
+            auto value        = 0.0f;
+            const auto result = std::from_chars(first, last, value);
+            if (result.ec != std::errc{})
+            {
+                if (i < required)
+                {
+                    throwMalformedLine(line);
+                }
+                value = 0.0f;
+            }
+            first = result.ec == std::errc{} ? result.ptr : first;
+            destination.push_back(value);
+        }
+    }
+
+    /**
+     * \brief Parses the face. Indices of the corner are "v", "v/vt", "v//vn" or "v/vt/vn".
+     */
+    void parseFace(std::string_view line, const char* first, ObjChunk& chunk)
+    {
+        const auto last   = line.data() + line.size();
+        const auto counts = std::array<int64_t, 3>{static_cast<int64_t>(chunk.positions.size() / 3),
+                                                   static_cast<int64_t>(chunk.texCoords.size() / 2),
+                                                   static_cast<int64_t>(chunk.normals.size() / 3)};
+
+        auto faceSize = uint32_t{0};
+        while (true)
+        {
+            skipSpaces(first, last);
+            if (first == last)
+            {
+                break;
+            }
+
+            auto corner = ObjCorner{};
+            for (auto k = size_t{0}; k < 3; ++k)
+            {
+                if (k > 0)
+                {
+                    if (first == last || *first != '/')
+                    {
+                        break;
+                    }
+                    ++first;
+                    if (k == 1 && first != last && *first == '/')
+                    {
+                        continue;
+                    }
+                }
+
+                auto index        = int64_t{0};
+                const auto result = std::from_chars(first, last, index);
+                if (result.ec != std::errc{} || index == 0)
+                {
+                    throwMalformedLine(line);
+                }
+                first = result.ptr;
+
+                if (index > 0)
+                {
+                    corner.indices[k] = index - 1;
+                }
+                else
+                {
+                    corner.indices[k]    = counts[k] + index;
+                    corner.relativeMask |= static_cast<uint8_t>(1u << k);
+                }
+            }
+
+            if (first != last && *first != ' ' && *first != '\t')
+            {
+                throwMalformedLine(line);
+            }
+            chunk.corners.push_back(corner);
+            ++faceSize;
+        }
+
+        if (faceSize < 3)
+        {
+            throwMalformedLine(line);
+        }
+        chunk.faceSizes.push_back(faceSize);
+    }
+
+    void parseObjChunk(std::string_view text, ObjChunk& chunk)
+    {
+        while (!text.empty())
+        {
+            const auto lineEnd = text.find('\n');
+            auto       line    = text.substr(0, lineEnd);
+            text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+
+            if (line.ends_with('\r'))
+            {
+                line.remove_suffix(1);
+            }
+
+            auto       first = line.data();
+            const auto last  = line.data() + line.size();
+            skipSpaces(first, last);
+
+            const auto keywordBegin = first;
+            while (first != last && *first != ' ' && *first != '\t')
+            {
+                ++first;
+            }
+            const auto keyword = std::string_view{keywordBegin, static_cast<size_t>(first - keywordBegin)};
+
+            if (keyword == "v")
+            {
+                // Optional w and vertex colors are ignored
+                parseFloats(line, first, chunk.positions, 3, 3);
+            }
+            else if (keyword == "vn")
+            {
+                parseFloats(line, first, chunk.normals, 3, 3);
+            }
+            else if (keyword == "vt")
+            {
+                parseFloats(line, first, chunk.texCoords, 2, 1);
+            }
+            else if (keyword == "f")
+            {
+                parseFace(line, first, chunk);
+            }
+        }
+    }
+
+    std::vector<std::string_view> splitIntoChunks(std::string_view text, size_t chunksCount)
+    {
+        auto result = std::vector<std::string_view>{};
+        result.reserve(chunksCount);
+
+        const auto chunkSize = text.size() / chunksCount + 1;
+        while (!text.empty())
+        {
+            // Chunks end at line boundaries, so every line is parsed by one task
+            auto end = text.find('\n', std::min(chunkSize, text.size()) - 1);
+            end      = end == std::string_view::npos ? text.size() : end + 1;
+
+            result.push_back(text.substr(0, end));
+            text.remove_prefix(end);
+        }
+
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace ogls::assets
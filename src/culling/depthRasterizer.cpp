@@ -0,0 +1,497 @@
+#include "depthRasterizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers/simdLanes.h"
+#include "mathCore/transformMatrix.h"
+
+namespace ogls::culling
+{
+namespace
+{
+    /**
+     * \brief Matrix4 is Matrix<4, 4> in the notation of column vectors, which rows are stored one after another.
+     */
+    using Matrix4 = std::array<float, 16>;
+    /**
+     * \brief ClipVertex is the vertex in the clip space (x, y, z, w).
+     */
+    using ClipVertex = std::array<float, 4>;
+
+    /**
+     * \brief ScreenTriangle is the triangle prepared for rasterization: edge functions and the depth plane
+     * in the form a * x + b * y + c, where x and y are window coordinates.
+     */
+    struct ScreenTriangle final
+    {
+            std::array<float, 3> edgeA = {0.0f}, edgeB = {0.0f}, edgeC = {0.0f};
+            float                depthA = {0.0f}, depthB = {0.0f}, depthC = {0.0f};
+            int32_t              minX = {0}, maxX = {0}, minY = {0}, maxY = {0};
+
+    };  // struct ScreenTriangle
+
+    /**
+     * \brief OccluderScratch is the memory of one occluder, which is reused between frames.
+     */
+    struct OccluderScratch final
+    {
+            std::vector<ClipVertex>     clipVertices;
+            std::vector<ScreenTriangle> triangles;
+
+    };  // struct OccluderScratch
+
+    /**
+     * \brief The minimal w of the vertex, which is projected. Vertices are clipped by the near plane before, so it
+     * only protects from the division by zero.
+     */
+    constexpr auto minW = float{1e-6f};
+
+    size_t     alignUp(size_t value, size_t alignment) noexcept;
+    Matrix4    multiply(const Matrix4& a, const Matrix4& b) noexcept;
+    ClipVertex toClipSpace(const Matrix4& m, float x, float y, float z) noexcept;
+    Matrix4    toMatrix4(const mathCore::Mat4& matrix) noexcept;
+
+}  // namespace
+
+class DepthRasterizer::Impl
+{
+    public:
+        Impl(size_t w, size_t h) :
+            height{alignUp(h, tileHeight)}, tilesX{alignUp(w, tileWidth) / tileWidth},
+            tilesY{alignUp(h, tileHeight) / tileHeight}, width{alignUp(w, tileWidth)}
+        {
+            if (w == 0 || h == 0)
+            {
+                throw std::invalid_argument{"The size of the depth buffer must be greater than 0."};
+            }
+
+            depth.resize(width * height);
+            tilesMaxDepth.resize(tilesX * tilesY);
+            viewProjection = Matrix4{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                                     0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+        }
+
+        /**
+         * \brief Adds the triangle in the clip space, which is in front of the near plane, to the scratch.
+         */
+        void addTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, bool isDoubleSided,
+                         OccluderScratch& scratch) const
+        {
+            auto x = std::array<float, 3>{}, y = std::array<float, 3>{}, z = std::array<float, 3>{};
+            for (auto i = size_t{0}; const auto* v : {&v0, &v1, &v2})
+            {
+                const auto w = std::max((*v)[3], minW);
+                x[i]         = ((*v)[0] / w * 0.5f + 0.5f) * static_cast<float>(width);
+                y[i]         = ((*v)[1] / w * 0.5f + 0.5f) * static_cast<float>(height);
+                z[i]         = (*v)[2] / w * 0.5f + 0.5f;
+                ++i;
+            }
+
+            auto area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+            if (area < 0.0f)
+            {
+                if (!isDoubleSided)
+                {
+                    return;
+                }
+                std::swap(x[1], x[2]);
+                std::swap(y[1], y[2]);
+                std::swap(z[1], z[2]);
+                area = -area;
+            }
+            if (area <= std::numeric_limits<float>::epsilon())
+            {
+                return;
+            }
+
+            // Pixels are sampled at their centers
+            const auto [minX, maxX] = std::minmax({x[0], x[1], x[2]});
+            const auto [minY, maxY] = std::minmax({y[0], y[1], y[2]});
+
+            auto triangle = ScreenTriangle{};
+            triangle.minX = static_cast<int32_t>(std::max(std::ceil(minX - 0.5f), 0.0f));
+            triangle.maxX = static_cast<int32_t>(std::min(std::floor(maxX - 0.5f), static_cast<float>(width - 1)));
+            triangle.minY = static_cast<int32_t>(std::max(std::ceil(minY - 0.5f), 0.0f));
+            triangle.maxY = static_cast<int32_t>(std::min(std::floor(maxY - 0.5f), static_cast<float>(height - 1)));
+            if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+            {
+                return;
+            }
+
+            // The point is inside the counter-clockwise triangle, if it is on the left of every edge
+            for (auto i = size_t{0}; i < 3; ++i)
+            {
+                const auto j      = (i + 1) % 3;
+                triangle.edgeA[i] = y[i] - y[j];
+                triangle.edgeB[i] = x[j] - x[i];
+                triangle.edgeC[i] = -(triangle.edgeA[i] * x[i] + triangle.edgeB[i] * y[i]);
+            }
+
+            triangle.depthA = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / area;
+            triangle.depthB = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) / area;
+            triangle.depthC = z[0] - triangle.depthA * x[0] - triangle.depthB * y[0];
+
+            scratch.triangles.push_back(triangle);
+        }
+
+        /**
+         * \brief Checks whether any pixel of the tile inside the rectangle is farther than the depth.
+         */
+        bool isAnyPixelFarther(size_t tileX, size_t tileY, const std::array<size_t, 4>& rect,
+                               float nearestDepth) const noexcept
+        {
+            using namespace helpers::simd;
+
+
+            const auto [x0, x1, y0, y1] = rect;
+            const auto tileMinX         = tileX * tileWidth;
+            const auto tileMinY         = tileY * tileHeight;
+
+            const auto boxDepth = broadcast(nearestDepth);
+            const auto rectMinX = broadcast(static_cast<float>(x0));
+            const auto rectMaxX = broadcast(static_cast<float>(x1));
+
+            for (auto y = std::max(y0, tileMinY); y <= std::min(y1, tileMinY + tileHeight - 1); ++y)
+            {
+                for (auto x = tileMinX; x < tileMinX + tileWidth; x += lanesCount)
+                {
+                    const auto px   = broadcast(static_cast<float>(x)) + laneIndices();
+                    const auto mask = greaterOrEqual(px, rectMinX) & greaterOrEqual(rectMaxX, px)
+                                    & greaterOrEqual(load(&depth[y * width + x]), boxDepth);
+                    if (toBits(mask) != 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * \brief Rasterizes prepared triangles, which overlap the row of tiles, and updates the farthest depth of
+         * its tiles.
+         */
+        void rasterizeTilesRow(size_t tileY, std::span<const OccluderScratch> occluders) noexcept
+        {
+            using namespace helpers::simd;
+
+
+            const auto rowMinY = static_cast<int32_t>(tileY * tileHeight);
+            const auto rowMaxY = static_cast<int32_t>(rowMinY + tileHeight - 1);
+            const auto zero    = broadcast(0.0f);
+
+            for (const auto& occluder : occluders)
+            {
+                for (const auto& t : occluder.triangles)
+                {
+                    if (t.maxY < rowMinY || t.minY > rowMaxY)
+                    {
+                        continue;
+                    }
+
+                    // The buffer width is a multiple of lanesCount, so the aligned span never crosses the row
+                    const auto startX = t.minX - t.minX % static_cast<int32_t>(lanesCount);
+                    const auto a0 = broadcast(t.edgeA[0]), a1 = broadcast(t.edgeA[1]), a2 = broadcast(t.edgeA[2]);
+                    const auto depthA = broadcast(t.depthA);
+
+                    for (auto y = std::max(t.minY, rowMinY); y <= std::min(t.maxY, rowMaxY); ++y)
+                    {
+                        const auto py     = static_cast<float>(y) + 0.5f;
+                        const auto row0   = broadcast(t.edgeB[0] * py + t.edgeC[0]);
+                        const auto row1   = broadcast(t.edgeB[1] * py + t.edgeC[1]);
+                        const auto row2   = broadcast(t.edgeB[2] * py + t.edgeC[2]);
+                        const auto rowZ   = broadcast(t.depthB * py + t.depthC);
+                        auto       pixels = &depth[static_cast<size_t>(y) * width];
+
+                        for (auto x = startX; x <= t.maxX; x += static_cast<int32_t>(lanesCount))
+                        {
+                            const auto px   = broadcast(static_cast<float>(x) + 0.5f) + laneIndices();
+                            const auto mask = greaterOrEqual(a0 * px + row0, zero)
+                                            & greaterOrEqual(a1 * px + row1, zero)
+                                            & greaterOrEqual(a2 * px + row2, zero);
+                            if (toBits(mask) == 0)
+                            {
+                                continue;
+                            }
+
+                            const auto current = load(pixels + x);
+                            store(pixels + x, select(mask, min(current, depthA * px + rowZ), current));
+                        }
+                    }
+                }
+            }
+
+            for (auto tileX = size_t{0}; tileX < tilesX; ++tileX)
+            {
+                auto maxDepth = 0.0f;
+                for (auto y = static_cast<size_t>(rowMinY); y <= static_cast<size_t>(rowMaxY); ++y)
+                {
+                    const auto begin = depth.begin() + static_cast<ptrdiff_t>(y * width + tileX * tileWidth);
+                    maxDepth         = std::max(maxDepth, *std::max_element(begin, begin + tileWidth));
+                }
+                tilesMaxDepth[tileY * tilesX + tileX] = maxDepth;
+            }
+        }
+
+        /**
+         * \brief Transforms the occluder into the clip space, clips its triangles by the near plane and prepares
+         * them for rasterization.
+         *
+         * \throw std::invalid_argument, if indices refer to nonexistent vertices.
+         */
+        void setupOccluder(const Occluder& occluder, OccluderScratch& scratch) const
+        {
+            scratch.triangles.clear();
+
+            const auto stride        = std::max(occluder.stride, size_t{3});
+            const auto verticesCount = occluder.positions.size() < 3 ? 0 : (occluder.positions.size() - 3) / stride + 1;
+            if (std::any_of(occluder.indices.begin(), occluder.indices.end(),
+                            [verticesCount](uint32_t index) { return index >= verticesCount; }))
+            {
+                throw std::invalid_argument{"Indices of the occluder refer to nonexistent vertices."};
+            }
+
+            const auto m = multiply(viewProjection, toMatrix4(occluder.worldMatrix));
+
+            scratch.clipVertices.resize(verticesCount);
+            for (auto i = size_t{0}; i < verticesCount; ++i)
+            {
+                const auto p            = &occluder.positions[i * stride];
+                scratch.clipVertices[i] = toClipSpace(m, p[0], p[1], p[2]);
+            }
+
+            const auto& vertices = scratch.clipVertices;
+            for (auto i = size_t{0}; i + 2 < occluder.indices.size(); i += 3)
+            {
+                const auto triangle = std::array<const ClipVertex*, 3>{&vertices[occluder.indices[i]],
+                                                                       &vertices[occluder.indices[i + 1]],
+                                                                       &vertices[occluder.indices[i + 2]]};
+
+                // Sutherland-Hodgman clipping by the near plane z = -w, the result has up to 4 vertices
+                auto clipped      = std::array<ClipVertex, 4>{};
+                auto clippedCount = size_t{0};
+                for (auto j = size_t{0}; j < 3; ++j)
+                {
+                    const auto& current   = *triangle[j];
+                    const auto& next      = *triangle[(j + 1) % 3];
+                    const auto  distance1 = current[2] + current[3];
+                    const auto  distance2 = next[2] + next[3];
+
+                    if (distance1 >= 0.0f)
+                    {
+                        clipped[clippedCount++] = current;
+                    }
+                    if ((distance1 >= 0.0f) != (distance2 >= 0.0f))
+                    {
+                        const auto t = distance1 / (distance1 - distance2);
+                        auto       v = ClipVertex{};
+                        for (auto k = size_t{0}; k < 4; ++k)
+                        {
+                            v[k] = current[k] + (next[k] - current[k]) * t;
+                        }
+                        clipped[clippedCount++] = v;
+                    }
+                }
+
+                for (auto j = size_t{2}; j < clippedCount; ++j)
+                {
+                    addTriangle(clipped[0], clipped[j - 1], clipped[j], occluder.isDoubleSided, scratch);
+                }
+            }
+        }
+
+    public:
+        std::vector<float>           depth;
+        const size_t                 height        = {0};
+        std::vector<OccluderScratch> scratches;
+        const size_t                 tilesX        = {0};
+        const size_t                 tilesY        = {0};
+        std::vector<float>           tilesMaxDepth;
+        Matrix4                      viewProjection;
+        const size_t                 width         = {0};
+
+};  // class DepthRasterizer::Impl
+
+DepthRasterizer::DepthRasterizer(size_t width, size_t height) : m_impl{std::make_unique<Impl>(width, height)}
+{
+    clear();
+}
+
+DepthRasterizer::DepthRasterizer(DepthRasterizer&& obj) noexcept = default;
+
+DepthRasterizer::~DepthRasterizer() noexcept = default;
+
+DepthRasterizer& DepthRasterizer::operator=(DepthRasterizer&& obj) noexcept = default;
+
+void DepthRasterizer::clear() noexcept
+{
+    std::fill(m_impl->depth.begin(), m_impl->depth.end(), 1.0f);
+    std::fill(m_impl->tilesMaxDepth.begin(), m_impl->tilesMaxDepth.end(), 1.0f);
+}
+
+float DepthRasterizer::getDepth(size_t x, size_t y) const
+{
+    if (x >= m_impl->width || y >= m_impl->height)
+    {
+        throw std::out_of_range{"The pixel is outside the depth buffer."};
+    }
+    return m_impl->depth[y * m_impl->width + x];
+}
+
+size_t DepthRasterizer::getHeight() const noexcept
+{
+    return m_impl->height;
+}
+
+size_t DepthRasterizer::getWidth() const noexcept
+{
+    return m_impl->width;
+}
+
+bool DepthRasterizer::isVisible(const mathCore::BoundingBox& worldBounds) const noexcept
+{
+    const auto& impl = *m_impl;
+
+    const auto center = std::array<float, 3>{worldBounds.center.x(), worldBounds.center.y(), worldBounds.center.z()};
+    const auto half   = std::array<float, 3>{worldBounds.halfExtents.x(), worldBounds.halfExtents.y(),
+                                             worldBounds.halfExtents.z()};
+
+    auto minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+    auto minY = std::numeric_limits<float>::max(), maxY = std::numeric_limits<float>::lowest();
+    auto nearestDepth = std::numeric_limits<float>::max();
+
+    for (auto corner = size_t{0}; corner < 8; ++corner)
+    {
+        const auto v = toClipSpace(impl.viewProjection, center[0] + ((corner & 1) ? half[0] : -half[0]),
+                                   center[1] + ((corner & 2) ? half[1] : -half[1]),
+                                   center[2] + ((corner & 4) ? half[2] : -half[2]));
+
+        // The projection of the box, which crosses the near plane, is unbounded
+        if (v[2] < -v[3] || v[3] < minW)
+        {
+            return true;
+        }
+
+        const auto x = (v[0] / v[3] * 0.5f + 0.5f) * static_cast<float>(impl.width);
+        const auto y = (v[1] / v[3] * 0.5f + 0.5f) * static_cast<float>(impl.height);
+        minX         = std::min(minX, x);
+        maxX         = std::max(maxX, x);
+        minY         = std::min(minY, y);
+        maxY         = std::max(maxY, y);
+        nearestDepth = std::min(nearestDepth, v[2] / v[3] * 0.5f + 0.5f);
+    }
+
+    const auto width = static_cast<float>(impl.width), height = static_cast<float>(impl.height);
+    if (nearestDepth > 1.0f || maxX <= 0.0f || maxY <= 0.0f || minX >= width || minY >= height)
+    {
+        return false;
+    }
+
+    // All pixels, which the projection of the box touches
+    const auto toPixel = [](float value, float size)
+    {
+        return static_cast<size_t>(std::clamp(value, 0.0f, size - 1.0f));
+    };
+
+    const auto x0 = toPixel(std::floor(minX), width), x1 = std::max(x0, toPixel(std::ceil(maxX) - 1.0f, width));
+    const auto y0 = toPixel(std::floor(minY), height), y1 = std::max(y0, toPixel(std::ceil(maxY) - 1.0f, height));
+
+    for (auto tileY = y0 / tileHeight; tileY <= y1 / tileHeight; ++tileY)
+    {
+        for (auto tileX = x0 / tileWidth; tileX <= x1 / tileWidth; ++tileX)
+        {
+            // The coarse level rejects the tile, if all its pixels are nearer than the box
+            if (nearestDepth > impl.tilesMaxDepth[tileY * impl.tilesX + tileX])
+            {
+                continue;
+            }
+
+            const auto isTileCovered = x0 <= tileX * tileWidth && (tileX + 1) * tileWidth - 1 <= x1
+                                    && y0 <= tileY * tileHeight && (tileY + 1) * tileHeight - 1 <= y1;
+            if (isTileCovered || impl.isAnyPixelFarther(tileX, tileY, {x0, x1, y0, y1}, nearestDepth))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void DepthRasterizer::renderOccluders(std::span<const Occluder> occluders, helpers::ThreadPool& pool)
+{
+    auto& impl = *m_impl;
+
+    if (impl.scratches.size() < occluders.size())
+    {
+        impl.scratches.resize(occluders.size());
+    }
+
+    pool.parallelFor(occluders.size(),
+                     [&impl, occluders](size_t i) { impl.setupOccluder(occluders[i], impl.scratches[i]); });
+
+    const auto scratches = std::span<const OccluderScratch>{impl.scratches}.first(occluders.size());
+    pool.parallelFor(impl.tilesY, [&impl, scratches](size_t tileY) { impl.rasterizeTilesRow(tileY, scratches); });
+}
+
+void DepthRasterizer::setViewProjection(const mathCore::Mat4& viewProjection) noexcept
+{
+    m_impl->viewProjection = toMatrix4(viewProjection);
+}
+
+namespace
+{
+    size_t alignUp(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    Matrix4 multiply(const Matrix4& a, const Matrix4& b) noexcept
+    {
+        auto result = Matrix4{};
+        for (auto row = size_t{0}; row < 4; ++row)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                for (auto k = size_t{0}; k < 4; ++k)
+                {
+                    result[row * 4 + column] += a[row * 4 + k] * b[k * 4 + column];
+                }
+            }
+        }
+        return result;
+    }
+
+    ClipVertex toClipSpace(const Matrix4& m, float x, float y, float z) noexcept
+    {
+        auto result = ClipVertex{};
+        for (auto row = size_t{0}; row < 4; ++row)
+        {
+            result[row] = m[row * 4] * x + m[row * 4 + 1] * y + m[row * 4 + 2] * z + m[row * 4 + 3];
+        }
+        return result;
+    }
+
+    Matrix4 toMatrix4(const mathCore::Mat4& matrix) noexcept
+    {
+        const auto m = matrix.getPointerToData();
+
+        auto result = Matrix4{};
+        for (auto row = size_t{0}; row < 4; ++row)
+        {
+            for (auto column = size_t{0}; column < 4; ++column)
+            {
+                result[row * 4 + column] =
+                  mathCore::OGLS_VECTOR_IS_COLUMN ? m[row * 4 + column] : m[column * 4 + row];
+            }
+        }
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace ogls::culling
@@ -0,0 +1,537 @@
+#include "helpers/allocationTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <format>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#elif __has_include(<execinfo.h>)
+    #include <execinfo.h>
+    #define OGLS_HAS_EXECINFO
+#endif
+
+namespace ogls::helpers
+{
+namespace
+{
+    /**
+     * \brief AtomicCounters are AllocationCounters of one subsystem, which are updated by all threads.
+     */
+    struct alignas(64) AtomicCounters final
+    {
+            std::atomic<uint64_t> allocatedBytes   = {0};
+            std::atomic<uint64_t> allocationsCount = {0};
+            std::atomic<uint64_t> freedBytes       = {0};
+            std::atomic<uint64_t> freesCount       = {0};
+
+    };  // struct AtomicCounters
+
+    /**
+     * \brief SiteTable contains sampled allocation sites by hashes of their call stacks.
+     */
+    struct SiteTable final
+    {
+            std::mutex                                   mutex;
+            std::unordered_map<uint64_t, AllocationSite> sites;
+
+    };  // struct SiteTable
+
+    /**
+     * \brief TrackerGuard marks the thread as being inside of the tracker, so allocations of the tracker itself are
+     * attributed to Helpers and aren't sampled. It prevents the recursion and self-deadlocks.
+     */
+    class TrackerGuard final
+    {
+        public:
+            TrackerGuard() noexcept;
+            OGLS_NOT_COPYABLE_MOVABLE(TrackerGuard)
+            ~TrackerGuard() noexcept;
+
+        private:
+            bool                m_wasInside         = {false};
+            AllocationSubsystem m_previousSubsystem = {AllocationSubsystem::Unknown};
+
+    };  // class TrackerGuard
+
+    SiteTable& getSiteTable();
+    size_t     toIndex(AllocationSubsystem subsystem) noexcept;
+
+
+    auto callStackSamplingPeriod = std::atomic<uint32_t>{0};
+    auto counters                = std::array<AtomicCounters, allocationSubsystemsCount>{};
+
+    thread_local auto currentSubsystem = AllocationSubsystem::Unknown;
+    thread_local auto isInsideTracker  = false;
+
+}  // namespace
+
+AllocationCounters& AllocationCounters::operator+=(const AllocationCounters& other) noexcept
+{
+    allocatedBytes   += other.allocatedBytes;
+    allocationsCount += other.allocationsCount;
+    freedBytes       += other.freedBytes;
+    freesCount       += other.freesCount;
+    return *this;
+}
+
+AllocationStatistics& AllocationStatistics::operator+=(const AllocationStatistics& other) noexcept
+{
+    for (auto i = size_t{0}; i < subsystems.size(); ++i)
+    {
+        subsystems[i] += other.subsystems[i];
+    }
+    return *this;
+}
+
+const AllocationCounters& AllocationStatistics::getCounters(AllocationSubsystem subsystem) const noexcept
+{
+    return subsystems[toIndex(subsystem)];
+}
+
+AllocationCounters AllocationStatistics::getTotal() const noexcept
+{
+    auto total = AllocationCounters{};
+    for (const auto& subsystemCounters : subsystems)
+    {
+        total += subsystemCounters;
+    }
+    return total;
+}
+
+AllocationScope::AllocationScope(AllocationSubsystem subsystem) noexcept : m_previousSubsystem{currentSubsystem}
+{
+    currentSubsystem = subsystem;
+}
+
+AllocationScope::~AllocationScope() noexcept
+{
+    currentSubsystem = m_previousSubsystem;
+}
+
+std::string formatCallStack(std::span<void* const> callStack)
+{
+    auto result = std::string{};
+
+#ifdef OGLS_HAS_EXECINFO
+    // backtrace_symbols() allocates the array by malloc(), it must be freed by free()
+    const auto symbols = backtrace_symbols(callStack.data(), static_cast<int>(callStack.size()));
+    if (symbols != nullptr)
+    {
+        for (auto i = size_t{0}; i < callStack.size(); ++i)
+        {
+            result += std::format("    {}\n", symbols[i]);
+        }
+        std::free(symbols);
+        return result;
+    }
+#endif
+
+    for (const auto address : callStack)
+    {
+        result += std::format("    [{}]\n", static_cast<const void*>(address));
+    }
+    return result;
+}
+
+AllocationSubsystem getCurrentAllocationSubsystem() noexcept
+{
+    return currentSubsystem;
+}
+
+std::vector<AllocationSite> getTopAllocationSites(size_t count)
+{
+    auto  guard = TrackerGuard{};
+    auto& table = getSiteTable();
+
+    auto result = std::vector<AllocationSite>{};
+    {
+        auto lock = std::lock_guard{table.mutex};
+        result.reserve(table.sites.size());
+        for (const auto& [hash, site] : table.sites)
+        {
+            result.push_back(site);
+        }
+    }
+
+    const auto bySize = [](const AllocationSite& a, const AllocationSite& b)
+    { return a.allocatedBytes > b.allocatedBytes; };
+    const auto topCount = std::min(count, result.size());
+    std::partial_sort(result.begin(), result.begin() + static_cast<ptrdiff_t>(topCount), result.end(), bySize);
+    result.resize(topCount);
+    return result;
+}
+
+void resetAllocationSites()
+{
+    auto  guard = TrackerGuard{};
+    auto& table = getSiteTable();
+    auto  lock  = std::lock_guard{table.mutex};
+    table.sites.clear();
+}
+
+void setCallStackSampling(uint32_t period) noexcept
+{
+    callStackSamplingPeriod.store(period, std::memory_order_relaxed);
+}
+
+AllocationStatistics takeAllocationStatistics() noexcept
+{
+    auto statistics = AllocationStatistics{};
+    for (auto i = size_t{0}; i < counters.size(); ++i)
+    {
+        auto& subsystemCounters            = statistics.subsystems[i];
+        subsystemCounters.allocatedBytes   = counters[i].allocatedBytes.exchange(0, std::memory_order_relaxed);
+        subsystemCounters.allocationsCount = counters[i].allocationsCount.exchange(0, std::memory_order_relaxed);
+        subsystemCounters.freedBytes       = counters[i].freedBytes.exchange(0, std::memory_order_relaxed);
+        subsystemCounters.freesCount       = counters[i].freesCount.exchange(0, std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+std::string_view toString(AllocationSubsystem subsystem) noexcept
+{
+    switch (subsystem)
+    {
+        case AllocationSubsystem::App:
+            return "app";
+        case AllocationSubsystem::Helpers:
+            return "helpers";
+        case AllocationSubsystem::MathCore:
+            return "mathCore";
+        case AllocationSubsystem::OpenglCore:
+            return "openglCore";
+        default:
+            return "unknown";
+    }
+}
+
+namespace
+{
+    TrackerGuard::TrackerGuard() noexcept : m_wasInside{isInsideTracker}, m_previousSubsystem{currentSubsystem}
+    {
+        isInsideTracker  = true;
+        currentSubsystem = AllocationSubsystem::Helpers;
+    }
+
+    TrackerGuard::~TrackerGuard() noexcept
+    {
+        isInsideTracker  = m_wasInside;
+        currentSubsystem = m_previousSubsystem;
+    }
+
+    SiteTable& getSiteTable()
+    {
+        // The table is never destroyed, because allocations can be sampled by destructors of static objects
+        static auto& table = *new SiteTable{};
+        return table;
+    }
+
+    size_t toIndex(AllocationSubsystem subsystem) noexcept
+    {
+        return std::min(static_cast<size_t>(subsystem), allocationSubsystemsCount - 1);
+    }
+
+}  // namespace
+
+}  // namespace ogls::helpers
+
+#ifdef OGLS_TRACK_ALLOCATIONS
+
+namespace ogls::helpers
+{
+namespace
+{
+    /**
+     * \brief The maximal number of captured return addresses of the allocation site.
+     */
+    constexpr auto maxCallStackDepth = size_t{24};
+
+    /**
+     * \brief AllocationHeader precedes every memory block, which is returned by the replaced operator new.
+     */
+    struct alignas(16) AllocationHeader final
+    {
+            uint64_t            size      = {0};
+            AllocationSubsystem subsystem = {AllocationSubsystem::Unknown};
+
+    };  // struct AllocationHeader
+
+
+    thread_local auto allocationsTillSample = uint32_t{0};
+
+    /**
+     * \brief Captures the call stack of the allocation and adds the allocation to its site.
+     *
+     * \throw std::bad_alloc.
+     */
+    void recordSite(AllocationSubsystem subsystem, size_t size)
+    {
+        auto guard = TrackerGuard{};
+
+        auto frames      = std::array<void*, maxCallStackDepth>{};
+        auto framesCount = size_t{0};
+#if defined(_WIN32)
+        framesCount = CaptureStackBackTrace(0, static_cast<DWORD>(frames.size()), frames.data(), nullptr);
+#elif defined(OGLS_HAS_EXECINFO)
+        framesCount = static_cast<size_t>(backtrace(frames.data(), static_cast<int>(frames.size())));
+#endif
+        const auto callStack = std::span{frames.data(), framesCount};
+
+        // FNV-1a hash of return addresses
+        auto hash = uint64_t{14'695'981'039'346'656'037ull};
+        for (const auto address : callStack)
+        {
+            hash = (hash ^ reinterpret_cast<uintptr_t>(address)) * 1'099'511'628'211ull;
+        }
+        hash ^= toIndex(subsystem);
+
+        auto& table = getSiteTable();
+        auto  lock  = std::lock_guard{table.mutex};
+        auto& site  = table.sites[hash];
+        if (site.allocationsCount == 0)
+        {
+            site.callStack.assign(callStack.begin(), callStack.end());
+            site.subsystem = subsystem;
+        }
+        ++site.allocationsCount;
+        site.allocatedBytes += size;
+    }
+
+    size_t toHeaderSize(size_t alignment) noexcept
+    {
+        return std::max(alignment, sizeof(AllocationHeader));
+    }
+
+    AllocationHeader& getHeader(void* pointer) noexcept
+    {
+        return *(static_cast<AllocationHeader*>(pointer) - 1);
+    }
+
+    /**
+     * \brief Allocates the memory with the header and counts it.
+     *
+     * \return the pointer to the memory or nullptr, if it can't be allocated.
+     */
+    void* allocateTracked(size_t size, size_t alignment) noexcept
+    {
+        const auto headerSize = toHeaderSize(alignment);
+        const auto fullSize   = headerSize + size;
+        auto       block      = static_cast<void*>(nullptr);
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            block = std::malloc(fullSize);
+        }
+        else
+        {
+#ifdef _WIN32
+            block = _aligned_malloc(fullSize, alignment);
+#else
+            // The size of the memory of aligned_alloc() must be a multiple of the alignment
+            block = std::aligned_alloc(alignment, (fullSize + alignment - 1) & ~(alignment - 1));
+#endif
+        }
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto pointer = static_cast<std::byte*>(block) + headerSize;
+        const auto header  = new (pointer - sizeof(AllocationHeader)) AllocationHeader{};
+        header->size       = size;
+        header->subsystem  = currentSubsystem;
+
+        auto& subsystemCounters = counters[toIndex(header->subsystem)];
+        subsystemCounters.allocationsCount.fetch_add(1, std::memory_order_relaxed);
+        subsystemCounters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+        const auto period = callStackSamplingPeriod.load(std::memory_order_relaxed);
+        if (period > 0 && !isInsideTracker && ++allocationsTillSample >= period)
+        {
+            allocationsTillSample = 0;
+            try
+            {
+                recordSite(header->subsystem, size);
+            }
+            catch (...)
+            {
+                // The lost sample mustn't fail the allocation
+            }
+        }
+        return pointer;
+    }
+
+    /**
+     * \throw std::bad_alloc, if the memory can't be allocated and the new-handler doesn't help.
+     */
+    void* allocateTrackedOrThrow(size_t size, size_t alignment)
+    {
+        while (true)
+        {
+            if (const auto pointer = allocateTracked(size, alignment))
+            {
+                return pointer;
+            }
+
+            const auto newHandler = std::get_new_handler();
+            if (newHandler == nullptr)
+            {
+                throw std::bad_alloc{};
+            }
+            newHandler();
+        }
+    }
+
+    void deallocateTracked(void* pointer, size_t alignment) noexcept
+    {
+        if (pointer == nullptr)
+        {
+            return;
+        }
+
+        const auto& header            = getHeader(pointer);
+        auto&       subsystemCounters = counters[toIndex(header.subsystem)];
+        subsystemCounters.freesCount.fetch_add(1, std::memory_order_relaxed);
+        subsystemCounters.freedBytes.fetch_add(header.size, std::memory_order_relaxed);
+
+        const auto block = static_cast<std::byte*>(pointer) - toHeaderSize(alignment);
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            std::free(block);
+        }
+        else
+        {
+#ifdef _WIN32
+            _aligned_free(block);
+#else
+            std::free(block);
+#endif
+        }
+    }
+}  // namespace
+
+}  // namespace ogls::helpers
+
+// Replaceable global allocation functions, see https://en.cppreference.com/w/cpp/memory/new/operator_new
+
+void* operator new(size_t size)
+{
+    return ogls::helpers::allocateTrackedOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size)
+{
+    return ogls::helpers::allocateTrackedOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return ogls::helpers::allocateTrackedOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return ogls::helpers::allocateTrackedOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return ogls::helpers::allocateTrackedOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return ogls::helpers::allocateTrackedOrThrow(size, static_cast<size_t>(alignment));
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return operator new(size, alignment, std::nothrow);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t alignment) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, size_t, std::align_val_t alignment) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    ogls::helpers::deallocateTracked(pointer, static_cast<size_t>(alignment));
+}
+
+#endif
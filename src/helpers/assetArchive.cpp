@@ -0,0 +1,249 @@
+#include "helpers/assetArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "exceptions.h"
+#include "helpers/compression.h"
+#include "helpers/mappedFile.h"
+
+namespace ogls::helpers
+{
+// The index is used directly from the mapped memory, so its layout must not depend on the compiler
+static_assert(std::is_trivially_copyable_v<ArchiveHeader> && sizeof(ArchiveHeader) == 16);
+static_assert(std::is_trivially_copyable_v<ArchiveEntry> && sizeof(ArchiveEntry) == 56);
+
+namespace
+{
+    constexpr uint64_t alignOffset(uint64_t offset) noexcept
+    {
+        return (offset + archiveDataAlignment - 1) / archiveDataAlignment * archiveDataAlignment;
+    }
+
+}  // namespace
+
+class AssetArchive::Impl
+{
+    public:
+        explicit Impl(const std::filesystem::path& pathToArchive) : file{pathToArchive}
+        {
+            const auto data = file.getData();
+
+            const auto throwCorrupted = [&pathToArchive]()
+            {
+                const auto excMes = std::format("The asset archive at path {} is corrupted.", pathToArchive.string());
+                throw exceptions::FileReadingException{excMes};
+            };
+
+            if (data.size() < sizeof(ArchiveHeader))
+            {
+                throwCorrupted();
+            }
+
+            const auto header = reinterpret_cast<const ArchiveHeader*>(data.data());
+            if (header->magic != ArchiveHeader{}.magic || header->version != ArchiveHeader{}.version
+                || header->entriesCount > (data.size() - sizeof(ArchiveHeader)) / sizeof(ArchiveEntry))
+            {
+                throwCorrupted();
+            }
+
+            entries = {reinterpret_cast<const ArchiveEntry*>(data.data() + sizeof(ArchiveHeader)),
+                       static_cast<size_t>(header->entriesCount)};
+
+            for (const auto& entry : entries)
+            {
+                if (entry.pathOffset > data.size() || entry.pathLength > data.size() - entry.pathOffset
+                    || entry.dataOffset > data.size() || entry.storedSize > data.size() - entry.dataOffset)
+                {
+                    throwCorrupted();
+                }
+            }
+        }
+
+    public:
+        /**
+         * \brief Entries of the archive in the mapped memory.
+         */
+        std::span<const ArchiveEntry> entries;
+        /**
+         * \brief The mapped archive file.
+         */
+        MappedFile                    file;
+
+};  // class AssetArchive::Impl
+
+AssetArchive::AssetArchive(const std::filesystem::path& pathToArchive) :
+    m_impl{std::make_unique<Impl>(pathToArchive)}
+{
+}
+
+AssetArchive::AssetArchive(AssetArchive&& obj) noexcept = default;
+
+AssetArchive::~AssetArchive() noexcept = default;
+
+AssetArchive& AssetArchive::operator=(AssetArchive&& obj) noexcept = default;
+
+const ArchiveEntry* AssetArchive::findEntry(std::string_view path) const
+{
+    const auto normalizedPath = normalizeAssetPath(path);
+    const auto hash           = calculateAssetPathHash(normalizedPath);
+    const auto entries        = m_impl->entries;
+
+    auto it = std::lower_bound(entries.begin(), entries.end(), hash,
+                               [](const ArchiveEntry& entry, uint64_t h) { return entry.pathHash < h; });
+    for (; it != entries.end() && it->pathHash == hash; ++it)
+    {
+        if (getPath(*it) == normalizedPath)
+        {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+std::span<const ArchiveEntry> AssetArchive::getEntries() const noexcept
+{
+    return m_impl->entries;
+}
+
+std::string_view AssetArchive::getPath(const ArchiveEntry& entry) const noexcept
+{
+    return {reinterpret_cast<const char*>(m_impl->file.getData().data() + entry.pathOffset), entry.pathLength};
+}
+
+std::span<const std::byte> AssetArchive::getStoredData(const ArchiveEntry& entry) const noexcept
+{
+    return m_impl->file.getData().subspan(entry.dataOffset, entry.storedSize);
+}
+
+std::string normalizeAssetPath(std::string_view path)
+{
+    auto result = std::string{};
+    result.reserve(path.size());
+
+    for (const auto c : path)
+    {
+        const auto isSeparator = c == '/' || c == '\\';
+        if (isSeparator && (result.empty() || result.back() == '/'))
+        {
+            continue;
+        }
+        result.push_back(isSeparator ? '/' : c);
+    }
+
+    while (result.starts_with("./"))
+    {
+        result.erase(0, 2);
+    }
+    return result;
+}
+
+void writeAssetArchive(const std::filesystem::path& pathToArchive, std::span<const AssetArchiveItem> items)
+{
+    struct PreparedItem final
+    {
+            ArchiveEntry               entry;
+            std::vector<std::byte>     compressedData;
+            std::span<const std::byte> data;
+            std::string                path;
+
+    };  // struct PreparedItem
+
+    auto prepared = std::vector<PreparedItem>{};
+    prepared.reserve(items.size());
+
+    for (const auto& item : items)
+    {
+        auto p         = PreparedItem{};
+        p.path         = normalizeAssetPath(item.path);
+        p.data         = item.data;
+        p.entry        = ArchiveEntry{.originalSize{item.data.size()},
+                                      .pathHash{calculateAssetPathHash(p.path)},
+                                      .pathLength{static_cast<uint32_t>(p.path.size())},
+                                      .storedSize{item.data.size()}};
+
+        if (item.compression == ArchiveCompression::Lz)
+        {
+            p.compressedData = compressBlock(item.data);
+            if (p.compressedData.size() < item.data.size())
+            {
+                p.data              = p.compressedData;
+                p.entry.compression = ArchiveCompression::Lz;
+                p.entry.storedSize  = p.compressedData.size();
+            }
+        }
+        prepared.push_back(std::move(p));
+    }
+
+    std::sort(prepared.begin(), prepared.end(),
+              [](const PreparedItem& a, const PreparedItem& b)
+              {
+                  return a.entry.pathHash != b.entry.pathHash ? a.entry.pathHash < b.entry.pathHash : a.path < b.path;
+              });
+    const auto duplicate = std::adjacent_find(prepared.begin(), prepared.end(),
+                                              [](const auto& a, const auto& b) { return a.path == b.path; });
+    if (duplicate != prepared.end())
+    {
+        throw std::invalid_argument{std::format("The path {} is packed twice.", duplicate->path)};
+    }
+
+    // Calculate the layout
+    auto offset = uint64_t{sizeof(ArchiveHeader) + sizeof(ArchiveEntry) * prepared.size()};
+    for (auto& p : prepared)
+    {
+        p.entry.pathOffset  = offset;
+        offset             += p.path.size();
+    }
+    for (auto& p : prepared)
+    {
+        offset             = alignOffset(offset);
+        p.entry.dataOffset = offset;
+        offset            += p.data.size();
+    }
+
+    auto file = std::ofstream{pathToArchive, std::ios_base::binary | std::ios_base::trunc};
+    if (!file)
+    {
+        const auto excMes = std::format("Cannot create the asset archive at path {}.", pathToArchive.string());
+        throw exceptions::FileOpeningException{excMes};
+    }
+
+    const auto header = ArchiveHeader{.entriesCount{prepared.size()}};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& p : prepared)
+    {
+        // Padding bytes are zeroed to make the archive reproducible
+        auto entry = ArchiveEntry{};
+        std::memset(static_cast<void*>(&entry), 0, sizeof(entry));
+        entry.compression  = p.entry.compression;
+        entry.dataOffset   = p.entry.dataOffset;
+        entry.originalSize = p.entry.originalSize;
+        entry.pathHash     = p.entry.pathHash;
+        entry.pathLength   = p.entry.pathLength;
+        entry.pathOffset   = p.entry.pathOffset;
+        entry.storedSize   = p.entry.storedSize;
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+    for (const auto& p : prepared)
+    {
+        file.write(p.path.data(), static_cast<std::streamsize>(p.path.size()));
+    }
+    for (const auto& p : prepared)
+    {
+        const auto padding = std::array<char, archiveDataAlignment>{};
+        file.write(padding.data(), static_cast<std::streamsize>(p.entry.dataOffset - file.tellp()));
+        file.write(reinterpret_cast<const char*>(p.data.data()), static_cast<std::streamsize>(p.data.size()));
+    }
+
+    if (!file)
+    {
+        const auto excMes = std::format("Cannot write the asset archive at path {}.", pathToArchive.string());
+        throw exceptions::FileWritingException{excMes};
+    }
+}
+
+}  // namespace ogls::helpers
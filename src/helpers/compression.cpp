@@ -0,0 +1,199 @@
+#include "helpers/compression.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace ogls::helpers
+{
+namespace
+{
+    // Parameters of the block format
+    constexpr auto hashBits          = size_t{12};
+    constexpr auto lastLiteralsSize  = size_t{5};
+    constexpr auto maxOffset         = size_t{65'535};
+    constexpr auto minMatchSize      = size_t{4};
+    constexpr auto noMatchAfterEnd   = size_t{12};
+    constexpr auto tokenFieldMaxSize = size_t{15};
+
+    uint32_t read32(const std::byte* p) noexcept
+    {
+        auto value = uint32_t{0};
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    size_t hash(uint32_t sequence) noexcept
+    {
+        return (sequence * 2'654'435'761u) >> (32 - hashBits);
+    }
+
+    [[noreturn]] void throwCorruptedBlock()
+    {
+        throw std::invalid_argument{"The compressed block is corrupted."};
+    }
+
+    /**
+     * \brief Writes the length, which doesn't fit into the token field, as a sequence of bytes.
+     */
+    void writeExtraLength(std::vector<std::byte>& out, size_t length)
+    {
+        for (length -= tokenFieldMaxSize; length >= 255; length -= 255)
+        {
+            out.push_back(std::byte{255});
+        }
+        out.push_back(static_cast<std::byte>(length));
+    }
+
+    /**
+     * \brief Reads the length, which doesn't fit into the token field.
+     */
+    size_t readExtraLength(std::span<const std::byte> block, size_t& ip)
+    {
+        auto length = size_t{0};
+        auto b      = uint8_t{255};
+        while (b == 255)
+        {
+            if (ip >= block.size())
+            {
+                throwCorruptedBlock();
+            }
+            b       = static_cast<uint8_t>(block[ip++]);
+            length += b;
+        }
+        return length;
+    }
+
+    /**
+     * \brief Writes the group of literals and the match (matchSize == 0 for the last group).
+     */
+    void writeSequence(std::vector<std::byte>& out, std::span<const std::byte> literals, size_t offset,
+                       size_t matchSize)
+    {
+        const auto matchField = matchSize == 0 ? size_t{0} : matchSize - minMatchSize;
+        const auto token      = (std::min(literals.size(), tokenFieldMaxSize) << 4)
+                           | std::min(matchField, tokenFieldMaxSize);
+        out.push_back(static_cast<std::byte>(token));
+
+        if (literals.size() >= tokenFieldMaxSize)
+        {
+            writeExtraLength(out, literals.size());
+        }
+        out.insert(out.end(), literals.begin(), literals.end());
+
+        if (matchSize != 0)
+        {
+            out.push_back(static_cast<std::byte>(offset & 0xFF));
+            out.push_back(static_cast<std::byte>(offset >> 8));
+            if (matchField >= tokenFieldMaxSize)
+            {
+                writeExtraLength(out, matchField);
+            }
+        }
+    }
+
+}  // namespace
+
+std::vector<std::byte> compressBlock(std::span<const std::byte> data)
+{
+    auto out = std::vector<std::byte>{};
+    out.reserve(data.size() / 2 + 16);
+
+    auto anchor = size_t{0};
+
+    if (data.size() > noMatchAfterEnd)
+    {
+        auto       table = std::vector<size_t>(size_t{1} << hashBits, SIZE_MAX);
+        const auto limit = data.size() - noMatchAfterEnd;
+
+        for (auto i = size_t{0}; i < limit;)
+        {
+            const auto sequence  = read32(data.data() + i);
+            auto&      slot      = table[hash(sequence)];
+            const auto candidate = slot;
+            slot                 = i;
+
+            if (candidate == SIZE_MAX || i - candidate > maxOffset || read32(data.data() + candidate) != sequence)
+            {
+                ++i;
+                continue;
+            }
+
+            auto matchSize = minMatchSize;
+            while (i + matchSize < data.size() - lastLiteralsSize && data[candidate + matchSize] == data[i + matchSize])
+            {
+                ++matchSize;
+            }
+
+            writeSequence(out, data.subspan(anchor, i - anchor), i - candidate, matchSize);
+            i      += matchSize;
+            anchor  = i;
+        }
+    }
+
+    writeSequence(out, data.subspan(anchor), 0, 0);
+    return out;
+}
+
+void decompressBlock(std::span<const std::byte> block, std::span<std::byte> destination)
+{
+    auto ip = size_t{0};
+    auto op = size_t{0};
+
+    while (ip < block.size())
+    {
+        const auto token = static_cast<uint8_t>(block[ip++]);
+
+        auto literalsSize = static_cast<size_t>(token >> 4);
+        if (literalsSize == tokenFieldMaxSize)
+        {
+            literalsSize += readExtraLength(block, ip);
+        }
+        if (literalsSize > block.size() - ip || literalsSize > destination.size() - op)
+        {
+            throwCorruptedBlock();
+        }
+        std::memcpy(destination.data() + op, block.data() + ip, literalsSize);
+        ip += literalsSize;
+        op += literalsSize;
+
+        // The last group has no match
+        if (ip == block.size())
+        {
+            break;
+        }
+
+        if (block.size() - ip < 2)
+        {
+            throwCorruptedBlock();
+        }
+        const auto offset = static_cast<size_t>(block[ip]) | (static_cast<size_t>(block[ip + 1]) << 8);
+        ip               += 2;
+
+        auto matchSize = static_cast<size_t>(token & 0x0F);
+        if (matchSize == tokenFieldMaxSize)
+        {
+            matchSize += readExtraLength(block, ip);
+        }
+        matchSize += minMatchSize;
+
+        if (offset == 0 || offset > op || matchSize > destination.size() - op)
+        {
+            throwCorruptedBlock();
+        }
+
+        // The match can overlap the output, so it is copied byte by byte
+        for (auto i = size_t{0}; i < matchSize; ++i, ++op)
+        {
+            destination[op] = destination[op - offset];
+        }
+    }
+
+    if (op != destination.size())
+    {
+        throwCorruptedBlock();
+    }
+}
+
+}  // namespace ogls::helpers
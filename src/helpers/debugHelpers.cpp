@@ -1,7 +1,8 @@
 #include "helpers/debugHelpers.h"
 
 #include <glad/glad.h>
-#include <iostream>
+
+#include "helpers/logger.h"
 
 namespace ogls::helpers
 {
@@ -16,12 +17,18 @@ bool checkAndLogGLErrors(std::string_view file, std::string_view function, int l
 
     while (auto errorCode = glGetError())
     {
-        std::cerr << "[OpenGL error]: code 0x" << std::hex << errorCode << std::dec << " in function " << function
-                  << ", in file " << file << ", at line " << line << std::endl;
+        OGLS_LOG_ERROR("[OpenGL error]: code 0x{:x} in function {}, in file {}, at line {}", errorCode, function, file,
+                       line);
 
         isErrorRaised = true;
     }
 
+    // The caller breaks into the debugger right after the error, so the message must be written before it
+    if (isErrorRaised)
+    {
+        getDefaultLogger().flush();
+    }
+
     return isErrorRaised;
 }
 
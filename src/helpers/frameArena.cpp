@@ -0,0 +1,272 @@
+#include "helpers/frameArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace ogls::helpers
+{
+namespace
+{
+    /**
+     * \brief The minimal size of blocks of LinearArena.
+     */
+    constexpr auto minBlockSize = size_t{256};
+
+    /**
+     * \brief FrameMemory contains arenas of one frame.
+     */
+    struct FrameMemory final
+    {
+            explicit FrameMemory(size_t blockSize) : arena{blockSize}
+            {
+            }
+
+            /**
+             * \brief ThreadArena is the sub-arena of the thread.
+             */
+            struct ThreadArena final
+            {
+                    std::unique_ptr<LinearArena> arena;
+                    std::thread::id              threadId;
+
+            };  // struct ThreadArena
+
+            LinearArena              arena;
+            std::vector<ThreadArena> threadArenas;
+
+    };  // struct FrameMemory
+
+    /**
+     * \brief ThreadArenaCache is the sub-arena, which the thread has taken last time.
+     */
+    struct ThreadArenaCache final
+    {
+            LinearArena* arena       = {nullptr};
+            uint64_t     arenaId     = {0};
+            uint64_t     frameSerial = {0};
+
+    };  // struct ThreadArenaCache
+
+
+    auto nextFrameArenaId = std::atomic<uint64_t>{1};
+
+    thread_local auto threadArenaCache = ThreadArenaCache{};
+
+}  // namespace
+
+LinearArena::LinearArena(size_t blockSize, std::pmr::memory_resource* upstream) :
+    m_blockSize{std::max(blockSize, minBlockSize)}, m_upstream{upstream}
+{
+}
+
+LinearArena::~LinearArena() noexcept
+{
+    releaseBlocks();
+}
+
+size_t LinearArena::getCapacity() const noexcept
+{
+    auto capacity = size_t{0};
+    for (const auto& block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+size_t LinearArena::getUsedSize() const noexcept
+{
+    return m_blocks.empty() ? 0 : m_usedSize + static_cast<size_t>(m_current - m_blocks.back().memory);
+}
+
+void LinearArena::reset() noexcept
+{
+    // The next block replaces all current blocks, so the next frame fits into one block
+    if (m_blocks.size() > 1)
+    {
+        m_blockSize = std::max(m_blockSize, getCapacity());
+        releaseBlocks();
+    }
+    else if (!m_blocks.empty())
+    {
+        m_current = m_blocks.front().memory;
+    }
+    m_usedSize = 0;
+}
+
+void* LinearArena::allocateFromNewBlock(size_t bytes, size_t alignment)
+{
+    const auto size = std::max(m_blockSize, bytes + alignment);
+    m_blocks.reserve(m_blocks.size() + 1);
+    const auto memory = static_cast<std::byte*>(m_upstream->allocate(size, alignof(std::max_align_t)));
+
+    if (!m_blocks.empty())
+    {
+        m_usedSize += m_blocks.back().size;
+    }
+    m_blocks.push_back({.memory{memory}, .size{size}});
+    m_end = memory + size;
+
+    auto pointer = static_cast<void*>(memory);
+    auto space   = size;
+    std::align(alignment, bytes, pointer, space);
+    m_current = static_cast<std::byte*>(pointer) + bytes;
+    return pointer;
+}
+
+void* LinearArena::do_allocate(size_t bytes, size_t alignment)
+{
+    auto pointer = static_cast<void*>(m_current);
+    auto space   = static_cast<size_t>(m_end - m_current);
+    if (m_current != nullptr && std::align(alignment, bytes, pointer, space))
+    {
+        m_current = static_cast<std::byte*>(pointer) + bytes;
+        return pointer;
+    }
+    return allocateFromNewBlock(bytes, alignment);
+}
+
+void LinearArena::do_deallocate(void*, size_t, size_t) noexcept
+{
+    // The memory is freed by reset()
+}
+
+bool LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void LinearArena::releaseBlocks() noexcept
+{
+    for (const auto& block : m_blocks)
+    {
+        m_upstream->deallocate(block.memory, block.size, alignof(std::max_align_t));
+    }
+    m_blocks.clear();
+    m_current = nullptr;
+    m_end     = nullptr;
+}
+
+class FrameArena::Impl
+{
+    public:
+        Impl(size_t framesCount, size_t size) :
+            blockSize{size}, id{nextFrameArenaId.fetch_add(1, std::memory_order_relaxed)}
+        {
+            if (framesCount == 0)
+            {
+                throw std::invalid_argument{"The frame arena must have memory for at least one frame."};
+            }
+
+            frames.reserve(framesCount);
+            for (auto i = size_t{0}; i < framesCount; ++i)
+            {
+                frames.push_back(std::make_unique<FrameMemory>(blockSize));
+            }
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        FrameMemory& getCurrentFrame() noexcept
+        {
+            return *frames[currentFrame];
+        }
+
+    public:
+        const size_t                              blockSize;
+        size_t                                    currentFrame = {0};
+        /**
+         * \brief The number of beginFrame() calls. Cached sub-arenas of threads are valid only in the same frame.
+         */
+        uint64_t                                  frameSerial  = {0};
+        std::vector<std::unique_ptr<FrameMemory>> frames;
+        /**
+         * \brief The unique ID, by which threads find their cached sub-arenas.
+         */
+        const uint64_t                            id;
+        mutable std::mutex                        mutex;
+
+};  // class FrameArena::Impl
+
+FrameArena::FrameArena(size_t framesCount, size_t blockSize) :
+    m_impl{std::make_unique<Impl>(framesCount, blockSize)}
+{
+}
+
+FrameArena::FrameArena(FrameArena&& obj) noexcept = default;
+
+FrameArena::~FrameArena() noexcept = default;
+
+FrameArena& FrameArena::operator=(FrameArena&& obj) noexcept = default;
+
+void FrameArena::beginFrame() noexcept
+{
+    auto& impl = *m_impl;
+
+
+    impl.currentFrame = (impl.currentFrame + 1) % impl.frames.size();
+    ++impl.frameSerial;
+
+    auto& frame = impl.getCurrentFrame();
+    frame.arena.reset();
+    for (auto& threadArena : frame.threadArenas)
+    {
+        threadArena.arena->reset();
+    }
+}
+
+size_t FrameArena::getFramesCount() const noexcept
+{
+    return m_impl->frames.size();
+}
+
+std::pmr::memory_resource& FrameArena::getResource() noexcept
+{
+    return m_impl->getCurrentFrame().arena;
+}
+
+std::pmr::memory_resource& FrameArena::getThreadResource()
+{
+    auto& impl = *m_impl;
+
+
+    if (threadArenaCache.arena && threadArenaCache.arenaId == impl.id
+        && threadArenaCache.frameSerial == impl.frameSerial)
+    {
+        return *threadArenaCache.arena;
+    }
+
+    auto       lock     = std::lock_guard{impl.mutex};
+    auto&      arenas   = impl.getCurrentFrame().threadArenas;
+    const auto threadId = std::this_thread::get_id();
+    auto       it       = std::ranges::find(arenas, threadId, &FrameMemory::ThreadArena::threadId);
+    if (it == arenas.end())
+    {
+        arenas.push_back({.arena{std::make_unique<LinearArena>(impl.blockSize)}, .threadId{threadId}});
+        it = std::prev(arenas.end());
+    }
+
+    threadArenaCache = {.arena{it->arena.get()}, .arenaId{impl.id}, .frameSerial{impl.frameSerial}};
+    return *it->arena;
+}
+
+size_t FrameArena::getUsedSize() const
+{
+    const auto& impl = *m_impl;
+
+
+    auto        lock  = std::lock_guard{impl.mutex};
+    const auto& frame = *impl.frames[impl.currentFrame];
+    auto        size  = frame.arena.getUsedSize();
+    for (const auto& threadArena : frame.threadArenas)
+    {
+        size += threadArena.arena->getUsedSize();
+    }
+    return size;
+}
+
+}  // namespace ogls::helpers
@@ -1,44 +1,18 @@
 #include "helpers/helpers.h"
 
-#include <filesystem>
 #include <format>
-#include <fstream>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
 #include "exceptions.h"
+#include "helpers/virtualFileSystem.h"
 
 namespace ogls::helpers
 {
 std::string readTextFromFile(std::string_view pathToFile)
 {
-    using namespace ogls;
-
-
-    if (!std::filesystem::exists(pathToFile))
-    {
-        const auto excMes = std::format("File does not exist at path {}.", pathToFile);
-        throw exceptions::FileOpeningException{excMes};
-    }
-
-    auto file = std::ifstream{};
-    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    auto stream = std::stringstream{};
-    try
-    {
-        file.open(pathToFile, std::ios_base::in);
-        stream << file.rdbuf();
-        file.close();
-    }
-    catch (const std::exception& exc)
-    {
-        file.close();
-        const auto excMes = std::format("File loading error (path: {}): {}", pathToFile, exc.what());
-        throw exceptions::FileReadingException{excMes};
-    }
-
-    return stream.str();
+    return std::string{getDefaultVirtualFileSystem().readFile(pathToFile).getText()};
 }
 
 std::unique_ptr<ogls::oglCore::texture::TextureData> readTextureFromFile(std::string_view pathToFile)
@@ -47,13 +21,10 @@ std::unique_ptr<ogls::oglCore::texture::TextureData> readTextureFromFile(std::st
     using namespace ogls;
 
 
-    if (!std::filesystem::exists(pathToFile))
-    {
-        const auto excMes = std::format("Image does not exist at path {}.", pathToFile);
-        throw exceptions::FileOpeningException{excMes};
-    }
+    const auto file = getDefaultVirtualFileSystem().readFile(pathToFile);
 
-    stbi_set_flip_vertically_on_load(true);
+    // Textures are decoded by tasks of the thread pool, so the flag is set for the calling thread only
+    stbi_set_flip_vertically_on_load_thread(true);
     auto width = int{0}, height = int{0}, nChannels = int{0};
 
     const auto txtDataDeleter = [](unsigned char* textureData)
@@ -68,7 +39,11 @@ std::unique_ptr<ogls::oglCore::texture::TextureData> readTextureFromFile(std::st
         }
     };
 
-    auto data = TextureData::DataType{stbi_load(pathToFile.data(), &width, &height, &nChannels, 0), txtDataDeleter};
+    const auto bytes = file.getData();
+    auto       data  = TextureData::DataType{stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(bytes.data()),
+                                                                   static_cast<int>(bytes.size()), &width, &height,
+                                                                   &nChannels, 0),
+                                             txtDataDeleter};
 
     if (!data)
     {
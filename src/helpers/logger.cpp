@@ -0,0 +1,587 @@
+#include "helpers/logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <stop_token>
+#include <thread>
+
+#include "exceptions.h"
+
+namespace ogls::helpers
+{
+namespace
+{
+    /**
+     * \brief The period, with which the thread of the logger writes messages, if nobody waits for flush().
+     */
+    constexpr auto flushPeriod       = std::chrono::milliseconds{10};
+    /**
+     * \brief The minimal size of the buffer of the thread.
+     */
+    constexpr auto minBufferSize     = size_t{1'024};
+    /**
+     * \brief The alignment of records in buffers.
+     */
+    constexpr auto recordAlignment   = size_t{8};
+
+    /**
+     * \brief RecordHeader precedes arguments of every record in the buffer of the thread.
+     */
+    struct RecordHeader final
+    {
+            /**
+             * \brief The formatter of arguments. nullptr marks the padding at the end of the buffer.
+             */
+            detail::LogFormatter                  formatter  = {nullptr};
+            const char*                           formatData = {nullptr};
+            uint32_t                              formatSize = {0};
+            LogLevel                              level      = {LogLevel::Info};
+            /**
+             * \brief The size of the record with the header and the alignment.
+             */
+            uint32_t                              size       = {0};
+            std::chrono::system_clock::time_point time;
+
+    };  // struct RecordHeader
+
+    /**
+     * \brief ThreadBuffer is the single-producer single-consumer ring buffer of records of one thread.
+     *
+     * The record never wraps around the end of the buffer: if it doesn't fit into the rest of the buffer, the rest
+     * is skipped. The rest, which is smaller than RecordHeader, is skipped without the padding record.
+     */
+    class ThreadBuffer final
+    {
+        public:
+            explicit ThreadBuffer(size_t capacity) : data(capacity), mask{capacity - 1}
+            {
+            }
+
+            OGLS_NOT_COPYABLE_MOVABLE(ThreadBuffer)
+            ~ThreadBuffer() noexcept = default;
+
+            /**
+             * \brief Publishes the reserved record. It is called only by the owning thread.
+             */
+            void commit() noexcept
+            {
+                head.store(reservedHead, std::memory_order_release);
+            }
+
+            /**
+             * \brief Calls func(header, arguments) for every published record and frees records. It is called only
+             * by the thread of the logger.
+             */
+            template<typename Func>
+            void consume(Func&& func)
+            {
+                const auto end      = head.load(std::memory_order_acquire);
+                auto       position = tail.load(std::memory_order_relaxed);
+                while (position < end)
+                {
+                    const auto offset = position & mask;
+                    const auto rest   = data.size() - offset;
+                    if (rest < sizeof(RecordHeader))
+                    {
+                        position += rest;
+                        continue;
+                    }
+
+                    auto header = RecordHeader{};
+                    std::memcpy(&header, data.data() + offset, sizeof(header));
+                    if (header.formatter)
+                    {
+                        func(header, data.data() + offset + sizeof(header));
+                    }
+                    position += header.size;
+                }
+                tail.store(position, std::memory_order_release);
+            }
+
+            /**
+             * \brief Checks whether all published records have been consumed.
+             */
+            bool isEmpty() const noexcept
+            {
+                return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+            }
+
+            /**
+             * \brief Reserves the record. It is called only by the owning thread.
+             *
+             * \return the beginning of the record or nullptr, if there is no free space.
+             */
+            std::byte* reserve(size_t recordSize) noexcept
+            {
+                const auto currentHead = head.load(std::memory_order_relaxed);
+                const auto offset      = currentHead & mask;
+                const auto rest        = data.size() - offset;
+                const auto padding     = rest < recordSize ? rest : 0;
+                if (recordSize > data.size()
+                    || currentHead + padding + recordSize - tail.load(std::memory_order_acquire) > data.size())
+                {
+                    droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                if (padding >= sizeof(RecordHeader))
+                {
+                    const auto paddingRecord = new (data.data() + offset) RecordHeader{};
+                    paddingRecord->size      = static_cast<uint32_t>(padding);
+                }
+                reservedHead = currentHead + padding + recordSize;
+                return data.data() + ((currentHead + padding) & mask);
+            }
+
+        public:
+            std::vector<std::byte>            data;
+            /**
+             * \brief A number of records, which haven't fit into the buffer.
+             */
+            std::atomic<uint64_t>             droppedCount = {0};
+            /**
+             * \brief The position of the next record, which is written by the owning thread.
+             */
+            alignas(64) std::atomic<uint64_t> head         = {0};
+            /**
+             * \brief Specification whether the owning thread has exited, so the buffer can be removed, when it
+             * becomes empty.
+             */
+            std::atomic<bool>                 isClosed     = {false};
+            const size_t                      mask;
+            uint64_t                          reservedHead = {0};
+            /**
+             * \brief The position of the first not consumed record, which is written by the thread of the logger.
+             */
+            alignas(64) std::atomic<uint64_t> tail         = {0};
+
+    };  // class ThreadBuffer
+
+    /**
+     * \brief ThreadBuffers are buffers of the thread in all loggers. They are closed, when the thread exits.
+     */
+    class ThreadBuffers final
+    {
+        public:
+            ThreadBuffers() = default;
+            OGLS_NOT_COPYABLE_MOVABLE(ThreadBuffers)
+
+            ~ThreadBuffers() noexcept
+            {
+                for (const auto& [loggerId, buffer] : buffers)
+                {
+                    buffer->isClosed.store(true, std::memory_order_release);
+                }
+            }
+
+        public:
+            std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>> buffers;
+            /**
+             * \brief The buffer of the last used logger, so the usual case of one logger needs no search.
+             */
+            ThreadBuffer*                                                   lastBuffer   = {nullptr};
+            uint64_t                                                        lastLoggerId = {0};
+
+    };  // class ThreadBuffers
+
+    /**
+     * \brief PendingMessage is the formatted message, which waits for sorting and writing into sinks.
+     */
+    struct PendingMessage final
+    {
+            LogLevel                              level = {LogLevel::Info};
+            std::string                           text;
+            std::chrono::system_clock::time_point time;
+
+    };  // struct PendingMessage
+
+    /**
+     * \brief Identifiers of loggers, so buffers of the destroyed logger aren't used by the new one at the same
+     * address.
+     */
+    auto nextLoggerId = std::atomic<uint64_t>{0};
+
+    thread_local auto threadBuffers = ThreadBuffers{};
+
+}  // namespace
+
+class Logger::Impl
+{
+    public:
+        Impl(std::vector<std::shared_ptr<LogSink>> s, size_t threadBufferSize) :
+            bufferCapacity{std::bit_ceil(std::max(threadBufferSize, minBufferSize))},
+            id{nextLoggerId.fetch_add(1, std::memory_order_relaxed)}, sinks{std::move(s)}
+        {
+            // The thread is the last member, so it is stopped before the rest of members are destroyed
+            thread = std::jthread{[this](std::stop_token stopToken) { run(stopToken); }};
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Formats messages of all buffers and writes them into sinks.
+         */
+        void drain()
+        {
+            auto buffersSnapshot = std::vector<std::shared_ptr<ThreadBuffer>>{};
+            {
+                auto lock = std::lock_guard{buffersMutex};
+                std::erase_if(buffers, [](const auto& buffer)
+                              { return buffer->isClosed.load(std::memory_order_acquire) && buffer->isEmpty(); });
+                buffersSnapshot = buffers;
+            }
+
+            for (const auto& buffer : buffersSnapshot)
+            {
+                buffer->consume(
+                  [this](const RecordHeader& header, const std::byte* arguments)
+                  {
+                      auto& message = pending.emplace_back(header.level, std::string{}, header.time);
+                      try
+                      {
+                          header.formatter({header.formatData, header.formatSize}, arguments, message.text);
+                      }
+                      catch (const std::exception& exc)
+                      {
+                          message.text = std::format("Cannot format the log message \"{}\": {}",
+                                                     std::string_view{header.formatData, header.formatSize},
+                                                     exc.what());
+                      }
+                  });
+
+                if (const auto dropped = buffer->droppedCount.exchange(0, std::memory_order_relaxed); dropped > 0)
+                {
+                    droppedCount.fetch_add(dropped, std::memory_order_relaxed);
+                    pending.emplace_back(LogLevel::Warning,
+                                         std::format("{} log messages have been dropped, because the buffer of the "
+                                                     "thread is full.",
+                                                     dropped),
+                                         std::chrono::system_clock::now());
+                }
+            }
+
+            if (pending.empty())
+            {
+                return;
+            }
+
+            // Buffers of different threads are consumed one by one, so messages are merged by time
+            std::ranges::stable_sort(pending, {}, &PendingMessage::time);
+
+            auto lock = std::lock_guard{sinksMutex};
+            for (const auto& sink : sinks)
+            {
+                try
+                {
+                    for (const auto& message : pending)
+                    {
+                        sink->write({.level{message.level}, .text{message.text}, .time{message.time}});
+                    }
+                    sink->flush();
+                }
+                catch (...)
+                {
+                    // The broken sink mustn't stop the logging into other sinks
+                }
+            }
+            pending.clear();
+        }
+
+        /**
+         * \brief Returns the buffer of the calling thread and creates it on the first call.
+         */
+        ThreadBuffer& getThreadBuffer()
+        {
+            if (threadBuffers.lastBuffer && threadBuffers.lastLoggerId == id)
+            {
+                return *threadBuffers.lastBuffer;
+            }
+
+            auto buffer = std::shared_ptr<ThreadBuffer>{};
+            for (const auto& [loggerId, threadBuffer] : threadBuffers.buffers)
+            {
+                if (loggerId == id)
+                {
+                    buffer = threadBuffer;
+                }
+            }
+
+            if (!buffer)
+            {
+                buffer = std::make_shared<ThreadBuffer>(bufferCapacity);
+                {
+                    auto lock = std::lock_guard{buffersMutex};
+                    buffers.push_back(buffer);
+                }
+                threadBuffers.buffers.emplace_back(id, buffer);
+            }
+
+            threadBuffers.lastBuffer   = buffer.get();
+            threadBuffers.lastLoggerId = id;
+            return *buffer;
+        }
+
+        /**
+         * \brief Writes messages periodically and on requests of flush() till the stop is requested.
+         */
+        void run(const std::stop_token& stopToken)
+        {
+            auto lock = std::unique_lock{mutex};
+            while (true)
+            {
+                // Messages, which are logged before the stop, are written by the last iteration
+                const auto isStopping = stopToken.stop_requested();
+                const auto request    = flushRequestsCount;
+
+                lock.unlock();
+                drain();
+                lock.lock();
+
+                flushedRequestsCount = request;
+                flushed.notify_all();
+                if (isStopping)
+                {
+                    return;
+                }
+
+                wakeUp.wait_for(lock, stopToken, flushPeriod,
+                                [this, request]() { return flushRequestsCount != request; });
+            }
+        }
+
+    public:
+        const size_t                               bufferCapacity;
+        /**
+         * \brief Buffers of all threads, which have logged messages.
+         */
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        std::mutex                                 buffersMutex;
+        std::atomic<uint64_t>                      droppedCount         = {0};
+        std::condition_variable                    flushed;
+        uint64_t                                   flushedRequestsCount = {0};
+        uint64_t                                   flushRequestsCount   = {0};
+        const uint64_t                             id;
+        std::atomic<LogLevel>                      level                = {LogLevel::Trace};
+        /**
+         * \brief The mutex of flush requests.
+         */
+        std::mutex                                 mutex;
+        /**
+         * \brief Formatted messages of the current batch. It is used only by the thread of the logger.
+         */
+        std::vector<PendingMessage>                pending;
+        std::vector<std::shared_ptr<LogSink>>      sinks;
+        std::mutex                                 sinksMutex;
+        std::condition_variable_any                wakeUp;
+        std::jthread                               thread;
+
+};  // class Logger::Impl
+
+class FileLogSink::Impl
+{
+    public:
+        explicit Impl(const std::filesystem::path& pathToFile) : file{pathToFile, std::ios::app}
+        {
+            if (!file.is_open())
+            {
+                throw exceptions::FileOpeningException{
+                  std::format("Cannot open the log file at path {}.", pathToFile.string())};
+            }
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        std::ofstream file;
+
+};  // class FileLogSink::Impl
+
+class MemoryLogSink::Impl
+{
+    public:
+        explicit Impl(size_t maxCount) : maxMessagesCount{std::max(maxCount, size_t{1})}
+        {
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        std::deque<std::string> lines;
+        const size_t            maxMessagesCount;
+        mutable std::mutex      mutex;
+
+};  // class MemoryLogSink::Impl
+
+std::string_view toString(LogLevel level) noexcept
+{
+    switch (level)
+    {
+        case LogLevel::Trace:
+            return "Trace";
+        case LogLevel::Debug:
+            return "Debug";
+        case LogLevel::Info:
+            return "Info";
+        case LogLevel::Warning:
+            return "Warning";
+        case LogLevel::Error:
+            return "Error";
+        default:
+            return "Off";
+    }
+}
+
+std::string toLogLine(const LogMessage& message)
+{
+    using namespace std::chrono;
+
+
+    return std::format("[{:%T}] [{}] {}\n", floor<milliseconds>(message.time), toString(message.level), message.text);
+}
+
+void ConsoleLogSink::flush()
+{
+    std::fflush(stderr);
+}
+
+void ConsoleLogSink::write(const LogMessage& message)
+{
+    const auto line = toLogLine(message);
+    std::fwrite(line.data(), 1, line.size(), stderr);
+}
+
+FileLogSink::FileLogSink(const std::filesystem::path& pathToFile) : m_impl{std::make_unique<Impl>(pathToFile)}
+{
+}
+
+FileLogSink::~FileLogSink() noexcept = default;
+
+void FileLogSink::flush()
+{
+    m_impl->file.flush();
+}
+
+void FileLogSink::write(const LogMessage& message)
+{
+    m_impl->file << toLogLine(message);
+}
+
+MemoryLogSink::MemoryLogSink(size_t maxMessagesCount) : m_impl{std::make_unique<Impl>(maxMessagesCount)}
+{
+}
+
+MemoryLogSink::~MemoryLogSink() noexcept = default;
+
+std::vector<std::string> MemoryLogSink::getLines() const
+{
+    auto lock = std::lock_guard{m_impl->mutex};
+    return {m_impl->lines.begin(), m_impl->lines.end()};
+}
+
+void MemoryLogSink::write(const LogMessage& message)
+{
+    auto& impl = *m_impl;
+
+
+    auto line = toLogLine(message);
+    auto lock = std::lock_guard{impl.mutex};
+    if (impl.lines.size() == impl.maxMessagesCount)
+    {
+        impl.lines.pop_front();
+    }
+    impl.lines.push_back(std::move(line));
+}
+
+Logger::Logger(std::vector<std::shared_ptr<LogSink>> sinks, size_t threadBufferSize) :
+    m_impl{std::make_unique<Impl>(std::move(sinks), threadBufferSize)}
+{
+}
+
+Logger::~Logger() noexcept = default;
+
+void Logger::addSink(std::shared_ptr<LogSink> sink)
+{
+    auto lock = std::lock_guard{m_impl->sinksMutex};
+    m_impl->sinks.push_back(std::move(sink));
+}
+
+void Logger::flush()
+{
+    auto& impl = *m_impl;
+
+
+    auto       lock    = std::unique_lock{impl.mutex};
+    const auto request = ++impl.flushRequestsCount;
+    impl.wakeUp.notify_one();
+    impl.flushed.wait(lock, [&impl, request]() { return impl.flushedRequestsCount >= request; });
+}
+
+uint64_t Logger::getDroppedMessagesCount() const noexcept
+{
+    return m_impl->droppedCount.load(std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() const noexcept
+{
+    return m_impl->level.load(std::memory_order_relaxed);
+}
+
+bool Logger::isEnabled(LogLevel level) const noexcept
+{
+    return level != LogLevel::Off && level >= m_impl->level.load(std::memory_order_relaxed);
+}
+
+void Logger::removeSinks()
+{
+    auto lock = std::lock_guard{m_impl->sinksMutex};
+    m_impl->sinks.clear();
+}
+
+void Logger::setLevel(LogLevel level) noexcept
+{
+    m_impl->level.store(level, std::memory_order_relaxed);
+}
+
+std::byte* Logger::beginRecord(LogLevel level, detail::LogFormatter formatter, std::string_view format,
+                               size_t argumentsSize)
+{
+    auto& buffer = m_impl->getThreadBuffer();
+
+    const auto recordSize = (sizeof(RecordHeader) + argumentsSize + recordAlignment - 1) & ~(recordAlignment - 1);
+    const auto record     = buffer.reserve(recordSize);
+    if (record == nullptr)
+    {
+        return nullptr;
+    }
+
+    new (record) RecordHeader{.formatter{formatter},
+                              .formatData{format.data()},
+                              .formatSize{static_cast<uint32_t>(format.size())},
+                              .level{level},
+                              .size{static_cast<uint32_t>(recordSize)},
+                              .time{std::chrono::system_clock::now()}};
+    return record + sizeof(RecordHeader);
+}
+
+void Logger::endRecord() noexcept
+{
+    m_impl->getThreadBuffer().commit();
+}
+
+Logger& getDefaultLogger()
+{
+    static auto logger = Logger{{std::make_shared<ConsoleLogSink>()}};
+    return logger;
+}
+
+}  // namespace ogls::helpers
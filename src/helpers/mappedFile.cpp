@@ -0,0 +1,159 @@
+#include "helpers/mappedFile.h"
+
+#include <format>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "exceptions.h"
+
+namespace ogls::helpers
+{
+class MappedFile::Impl
+{
+    public:
+        explicit Impl(const std::filesystem::path& pathToFile)
+        {
+            const auto throwOpeningError = [&pathToFile]()
+            {
+                const auto excMes = std::format("Cannot map the file at path {}.", pathToFile.string());
+                throw exceptions::FileOpeningException{excMes};
+            };
+
+#ifdef _WIN32
+            file = CreateFileW(pathToFile.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            auto fileSize = LARGE_INTEGER{};
+            if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize))
+            {
+                release();
+                throwOpeningError();
+            }
+
+            size = static_cast<size_t>(fileSize.QuadPart);
+            if (size == 0)
+            {
+                return;
+            }
+
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            data    = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+            file = open(pathToFile.c_str(), O_RDONLY);
+            struct stat fileStat = {};
+            if (file == -1 || fstat(file, &fileStat) != 0)
+            {
+                release();
+                throwOpeningError();
+            }
+
+            size = static_cast<size_t>(fileStat.st_size);
+            if (size == 0)
+            {
+                return;
+            }
+
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data == MAP_FAILED)
+            {
+                data = nullptr;
+            }
+#endif
+            if (!data)
+            {
+                release();
+                throwOpeningError();
+            }
+        }
+
+        ~Impl() noexcept
+        {
+            release();
+        }
+
+        /**
+         * \brief Unmaps and closes the file.
+         */
+        void release() noexcept
+        {
+#ifdef _WIN32
+            if (data)
+            {
+                UnmapViewOfFile(data);
+            }
+            if (mapping)
+            {
+                CloseHandle(mapping);
+            }
+            if (file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(file);
+            }
+            mapping = nullptr;
+            file    = INVALID_HANDLE_VALUE;
+#else
+            if (data)
+            {
+                munmap(data, size);
+            }
+            if (file != -1)
+            {
+                close(file);
+            }
+            file = -1;
+#endif
+            data = nullptr;
+            size = 0;
+        }
+
+    public:
+        /**
+         * \brief The address of the mapped content.
+         */
+        void*  data = nullptr;
+#ifdef _WIN32
+        /**
+         * \brief The handle of the file.
+         */
+        HANDLE file    = INVALID_HANDLE_VALUE;
+        /**
+         * \brief The handle of the file mapping object.
+         */
+        HANDLE mapping = nullptr;
+#else
+        /**
+         * \brief The file descriptor.
+         */
+        int    file = -1;
+#endif
+        /**
+         * \brief The size of the file in bytes.
+         */
+        size_t size = {0};
+
+};  // class MappedFile::Impl
+
+MappedFile::MappedFile(const std::filesystem::path& pathToFile) : m_impl{std::make_unique<Impl>(pathToFile)}
+{
+}
+
+MappedFile::MappedFile(MappedFile&& obj) noexcept = default;
+
+MappedFile::~MappedFile() noexcept = default;
+
+MappedFile& MappedFile::operator=(MappedFile&& obj) noexcept = default;
+
+std::span<const std::byte> MappedFile::getData() const noexcept
+{
+    return {static_cast<const std::byte*>(m_impl->data), m_impl->size};
+}
+
+}  // namespace ogls::helpers
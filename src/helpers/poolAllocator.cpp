@@ -0,0 +1,198 @@
+#include "helpers/poolAllocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace ogls::helpers
+{
+namespace
+{
+    /**
+     * \brief The number of blocks in the first chunk of the pool.
+     */
+    constexpr auto minBlocksPerChunk = size_t{16};
+
+    /**
+     * \brief Chunk is the memory of blocks of the pool.
+     */
+    struct Chunk final
+    {
+            ChunkDeallocator deallocate = {nullptr};
+            void*            memory     = {nullptr};
+            size_t           size       = {0};
+
+    };  // struct Chunk
+
+    /**
+     * \brief ChunkAllocators are the allocator hook of all pools.
+     */
+    struct ChunkAllocators final
+    {
+            ChunkAllocator   allocate   = {nullptr};
+            ChunkDeallocator deallocate = {nullptr};
+
+    };  // struct ChunkAllocators
+
+    void*           allocateChunk(size_t size, size_t alignment);
+    void            deallocateChunk(void* chunk, size_t size, size_t alignment);
+    ChunkAllocators getChunkAllocators();
+
+
+    auto chunkAllocators      = ChunkAllocators{allocateChunk, deallocateChunk};
+    auto chunkAllocatorsMutex = std::mutex{};
+
+}  // namespace
+
+class FixedSizePool::Impl
+{
+    public:
+        Impl(size_t size, size_t alignment) :
+            blockAlignment{std::max(alignment, alignof(void*))},
+            // Free blocks store the pointer to the next free block
+            blockSize{(std::max(size, sizeof(void*)) + blockAlignment - 1) & ~(blockAlignment - 1)}
+        {
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+
+        ~Impl() noexcept
+        {
+            for (const auto& chunk : chunks)
+            {
+                if (chunk.deallocate)
+                {
+                    chunk.deallocate(chunk.memory, chunk.size, blockAlignment);
+                }
+            }
+        }
+
+        /**
+         * \brief Allocates the new chunk and puts its blocks into the free list.
+         *
+         * \throw std::bad_alloc.
+         */
+        void grow()
+        {
+            const auto allocators  = getChunkAllocators();
+            const auto blocksCount = std::clamp(capacity, minBlocksPerChunk, maxBlocksPerChunk);
+            const auto size        = blocksCount * blockSize;
+            const auto memory      = static_cast<std::byte*>(allocators.allocate(size, blockAlignment));
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc{};
+            }
+            chunks.push_back({.deallocate{allocators.deallocate}, .memory{memory}, .size{size}});
+
+            // Blocks are linked from the beginning of the chunk, so the following allocations are adjacent
+            for (auto i = blocksCount; i > 0; --i)
+            {
+                const auto block = memory + (i - 1) * blockSize;
+                *reinterpret_cast<void**>(block) = freeList;
+                freeList                         = block;
+            }
+            capacity += blocksCount;
+        }
+
+    public:
+        size_t             allocatedCount = {0};
+        const size_t       blockAlignment;
+        const size_t       blockSize;
+        size_t             capacity       = {0};
+        std::vector<Chunk> chunks;
+        void*              freeList       = {nullptr};
+        mutable std::mutex mutex;
+
+};  // class FixedSizePool::Impl
+
+FixedSizePool::FixedSizePool(size_t blockSize, size_t blockAlignment)
+{
+    if (!std::has_single_bit(blockAlignment))
+    {
+        throw std::invalid_argument{"The alignment of blocks must be the power of 2."};
+    }
+    m_impl = std::make_unique<Impl>(blockSize, blockAlignment);
+}
+
+FixedSizePool::~FixedSizePool() noexcept = default;
+
+void* FixedSizePool::allocate()
+{
+    auto& impl = *m_impl;
+
+
+    auto lock = std::lock_guard{impl.mutex};
+    if (impl.freeList == nullptr)
+    {
+        impl.grow();
+    }
+
+    const auto block = impl.freeList;
+    impl.freeList    = *static_cast<void**>(block);
+    ++impl.allocatedCount;
+    return block;
+}
+
+void FixedSizePool::deallocate(void* block) noexcept
+{
+    auto& impl = *m_impl;
+
+
+    if (block == nullptr)
+    {
+        return;
+    }
+
+    auto lock                   = std::lock_guard{impl.mutex};
+    *static_cast<void**>(block) = impl.freeList;
+    impl.freeList               = block;
+    --impl.allocatedCount;
+}
+
+size_t FixedSizePool::getAllocatedBlocksCount() const noexcept
+{
+    auto lock = std::lock_guard{m_impl->mutex};
+    return m_impl->allocatedCount;
+}
+
+size_t FixedSizePool::getBlockSize() const noexcept
+{
+    return m_impl->blockSize;
+}
+
+size_t FixedSizePool::getCapacity() const noexcept
+{
+    auto lock = std::lock_guard{m_impl->mutex};
+    return m_impl->capacity;
+}
+
+void setPoolChunkAllocator(ChunkAllocator allocate, ChunkDeallocator deallocate)
+{
+    auto lock       = std::lock_guard{chunkAllocatorsMutex};
+    chunkAllocators = allocate ? ChunkAllocators{allocate, deallocate}
+                               : ChunkAllocators{allocateChunk, deallocateChunk};
+}
+
+namespace
+{
+    void* allocateChunk(size_t size, size_t alignment)
+    {
+        return ::operator new(size, std::align_val_t{alignment}, std::nothrow);
+    }
+
+    void deallocateChunk(void* chunk, size_t size, size_t alignment)
+    {
+        ::operator delete(chunk, size, std::align_val_t{alignment});
+    }
+
+    ChunkAllocators getChunkAllocators()
+    {
+        auto lock = std::lock_guard{chunkAllocatorsMutex};
+        return chunkAllocators;
+    }
+
+}  // namespace
+
+}  // namespace ogls::helpers
@@ -0,0 +1,163 @@
+#include "threadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+namespace ogls::helpers
+{
+class ThreadPool::Impl
+{
+    public:
+        explicit Impl(size_t threadsNumber)
+        {
+            threadsNumber = std::max(threadsNumber, size_t{1});
+            workers.reserve(threadsNumber);
+
+            for (auto i = size_t{0}; i < threadsNumber; ++i)
+            {
+                workers.emplace_back([this]() { workerLoop(); });
+            }
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+
+        ~Impl() noexcept
+        {
+            {
+                auto lock  = std::scoped_lock{mutex};
+                isStopping = true;
+            }
+            condition.notify_all();
+
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        void workerLoop()
+        {
+            while (true)
+            {
+                auto task = std::function<void()>{};
+
+                {
+                    auto lock = std::unique_lock{mutex};
+                    condition.wait(lock, [this]() { return isStopping || !tasks.empty(); });
+
+                    if (tasks.empty())
+                    {
+                        return;
+                    }
+
+                    task = std::move(tasks.front());
+                    tasks.pop();
+                }
+
+                task();
+            }
+        }
+
+    public:
+        std::condition_variable           condition;
+        bool                              isStopping = false;
+        std::mutex                        mutex;
+        std::queue<std::function<void()>> tasks;
+        std::vector<std::thread>          workers;
+
+};  // class ThreadPool::Impl
+
+ThreadPool::ThreadPool(size_t threadsNumber) : m_impl{std::make_unique<Impl>(threadsNumber)}
+{
+}
+
+ThreadPool::~ThreadPool() noexcept = default;
+
+size_t ThreadPool::getThreadsNumber() const noexcept
+{
+    return m_impl->workers.size();
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // A few chunks per thread smooth out the uneven cost of iterations
+    const auto chunksNumber = std::min(count, (getThreadsNumber() + 1) * 4);
+    const auto chunkSize    = (count + chunksNumber - 1) / chunksNumber;
+
+    auto nextChunk      = std::atomic<size_t>{0};
+    auto firstException = std::exception_ptr{};
+    auto exceptionMutex = std::mutex{};
+
+    const auto runChunks = [&]()
+    {
+        for (auto chunk = nextChunk++; chunk < chunksNumber; chunk = nextChunk++)
+        {
+            const auto begin = chunk * chunkSize;
+            const auto end   = std::min(begin + chunkSize, count);
+
+            try
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    func(i);
+                }
+            }
+            catch (...)
+            {
+                auto lock = std::scoped_lock{exceptionMutex};
+                if (!firstException)
+                {
+                    firstException = std::current_exception();
+                }
+            }
+        }
+    };
+
+    const auto helpersNumber = std::min(getThreadsNumber(), chunksNumber - 1);
+    auto       helpers       = std::vector<std::future<void>>{};
+    helpers.reserve(helpersNumber);
+
+    for (auto i = size_t{0}; i < helpersNumber; ++i)
+    {
+        helpers.push_back(submit(runChunks));
+    }
+
+    runChunks();
+
+    for (auto& helper : helpers)
+    {
+        helper.wait();
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
+}
+
+void ThreadPool::pushTask(std::function<void()> task)
+{
+    {
+        auto lock = std::scoped_lock{m_impl->mutex};
+        m_impl->tasks.push(std::move(task));
+    }
+    m_impl->condition.notify_one();
+}
+
+ThreadPool& getDefaultThreadPool()
+{
+    static auto pool = ThreadPool{std::max(std::thread::hardware_concurrency(), 2u) - 1};
+    return pool;
+}
+
+}  // namespace ogls::helpers
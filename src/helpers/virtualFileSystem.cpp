@@ -0,0 +1,135 @@
+#include "helpers/virtualFileSystem.h"
+
+#include <format>
+#include <stdexcept>
+#include <vector>
+
+#include "exceptions.h"
+#include "helpers/assetArchive.h"
+#include "helpers/compression.h"
+#include "helpers/mappedFile.h"
+
+namespace ogls::helpers
+{
+FileView::FileView(std::span<const std::byte> data, std::shared_ptr<const void> owner) noexcept :
+    m_data{data}, m_owner{std::move(owner)}
+{
+}
+
+std::span<const std::byte> FileView::getData() const noexcept
+{
+    return m_data;
+}
+
+std::string_view FileView::getText() const noexcept
+{
+    return {reinterpret_cast<const char*>(m_data.data()), m_data.size()};
+}
+
+class VirtualFileSystem::Impl
+{
+    public:
+        /**
+         * \brief Mounted archives in the order of mounting.
+         */
+        std::vector<std::shared_ptr<const AssetArchive>> archives;
+        /**
+         * \brief Whether reading of loose files is enabled.
+         */
+        bool                                             isLooseFilesEnabled = true;
+
+};  // class VirtualFileSystem::Impl
+
+VirtualFileSystem::VirtualFileSystem() : m_impl{std::make_unique<Impl>()}
+{
+}
+
+VirtualFileSystem::~VirtualFileSystem() noexcept = default;
+
+bool VirtualFileSystem::isFileExist(std::string_view pathToFile) const
+{
+    for (const auto& archive : m_impl->archives)
+    {
+        if (archive->findEntry(pathToFile))
+        {
+            return true;
+        }
+    }
+    return m_impl->isLooseFilesEnabled && std::filesystem::is_regular_file(pathToFile);
+}
+
+bool VirtualFileSystem::isLooseFilesEnabled() const noexcept
+{
+    return m_impl->isLooseFilesEnabled;
+}
+
+void VirtualFileSystem::mountArchive(const std::filesystem::path& pathToArchive)
+{
+    m_impl->archives.push_back(std::make_shared<const AssetArchive>(pathToArchive));
+}
+
+FileView VirtualFileSystem::readFile(std::string_view pathToFile) const
+{
+    for (auto it = m_impl->archives.rbegin(); it != m_impl->archives.rend(); ++it)
+    {
+        const auto& archive = *it;
+        const auto  entry   = archive->findEntry(pathToFile);
+        if (!entry)
+        {
+            continue;
+        }
+
+        const auto storedData = archive->getStoredData(*entry);
+        switch (entry->compression)
+        {
+            case ArchiveCompression::None:
+                return FileView{storedData, archive};
+            case ArchiveCompression::Lz:
+            {
+                auto buffer = std::make_shared<std::vector<std::byte>>(entry->originalSize);
+                try
+                {
+                    decompressBlock(storedData, *buffer);
+                }
+                catch (const std::invalid_argument& exc)
+                {
+                    const auto excMes = std::format("Cannot decompress the file {}: {}", pathToFile, exc.what());
+                    throw exceptions::FileReadingException{excMes};
+                }
+                return FileView{*buffer, buffer};
+            }
+            default:
+            {
+                const auto excMes = std::format("Unknown compression of the file {}.", pathToFile);
+                throw exceptions::FileReadingException{excMes};
+            }
+        }
+    }
+
+    if (m_impl->isLooseFilesEnabled && std::filesystem::is_regular_file(pathToFile))
+    {
+        auto file = std::make_shared<const MappedFile>(pathToFile);
+        return FileView{file->getData(), file};
+    }
+
+    const auto excMes = std::format("File does not exist at path {}.", pathToFile);
+    throw exceptions::FileOpeningException{excMes};
+}
+
+void VirtualFileSystem::setLooseFilesEnabled(bool isEnabled) noexcept
+{
+    m_impl->isLooseFilesEnabled = isEnabled;
+}
+
+void VirtualFileSystem::unmountAll() noexcept
+{
+    m_impl->archives.clear();
+}
+
+VirtualFileSystem& getDefaultVirtualFileSystem()
+{
+    static auto fileSystem = VirtualFileSystem{};
+    return fileSystem;
+}
+
+}  // namespace ogls::helpers
@@ -0,0 +1,40 @@
+#include "boundingBox.h"
+
+#include <array>
+#include <cmath>
+
+#include "mathCore/transformMatrix.h"
+
+namespace ogls::mathCore
+{
+BoundingBox transformBoundingBox(const BoundingBox& box, const Mat4& transform) noexcept
+{
+    const auto m = transform.getPointerToData();
+
+    // Returns the element of the transformation in the notation of column vectors
+    const auto at = [m](size_t row, size_t column)
+    {
+        return OGLS_VECTOR_IS_COLUMN ? m[row * 4 + column] : m[column * 4 + row];
+    };
+
+    const auto center = std::array<float, 3>{box.center.x(), box.center.y(), box.center.z()};
+    const auto half   = std::array<float, 3>{box.halfExtents.x(), box.halfExtents.y(), box.halfExtents.z()};
+
+    auto resultCenter = std::array<float, 3>{};
+    auto resultHalf   = std::array<float, 3>{};
+
+    for (auto r = size_t{0}; r < 3; ++r)
+    {
+        resultCenter[r] = at(r, 3);
+        for (auto c = size_t{0}; c < 3; ++c)
+        {
+            resultCenter[r] += at(r, c) * center[c];
+            resultHalf[r]   += std::abs(at(r, c)) * half[c];
+        }
+    }
+
+    return BoundingBox{.center{resultCenter[0], resultCenter[1], resultCenter[2]},
+                       .halfExtents{resultHalf[0], resultHalf[1], resultHalf[2]}};
+}
+
+}  // namespace ogls::mathCore
@@ -0,0 +1,129 @@
+#include "transform.h"
+
+#include <array>
+
+#include "mathCore/base.h"
+
+namespace ogls::mathCore
+{
+namespace
+{
+    /**
+     * \brief Returns an index of the element (row, column) in the row-major data of Matrix<4, 4>.
+     */
+    constexpr size_t at(size_t row, size_t column) noexcept
+    {
+        return row * 4 + column;
+    }
+
+}  // namespace
+
+Mat4 combineAffineTransforms(const Mat4& parent, const Mat4& local) noexcept
+{
+    // result = a * b
+    const auto a = OGLS_VECTOR_IS_COLUMN ? parent.getPointerToData() : local.getPointerToData();
+    const auto b = OGLS_VECTOR_IS_COLUMN ? local.getPointerToData() : parent.getPointerToData();
+
+    auto result = std::array<float, 16>{};
+
+    if constexpr (OGLS_VECTOR_IS_COLUMN)
+    {
+        for (auto r = size_t{0}; r < 3; ++r)
+        {
+            for (auto c = size_t{0}; c < 4; ++c)
+            {
+                result[at(r, c)] = a[at(r, 0)] * b[at(0, c)] + a[at(r, 1)] * b[at(1, c)] + a[at(r, 2)] * b[at(2, c)];
+            }
+            result[at(r, 3)] += a[at(r, 3)];
+        }
+        result[at(3, 3)] = 1.0f;
+    }
+    else
+    {
+        for (auto r = size_t{0}; r < 4; ++r)
+        {
+            for (auto c = size_t{0}; c < 3; ++c)
+            {
+                result[at(r, c)] = a[at(r, 0)] * b[at(0, c)] + a[at(r, 1)] * b[at(1, c)] + a[at(r, 2)] * b[at(2, c)];
+            }
+        }
+        for (auto c = size_t{0}; c < 3; ++c)
+        {
+            result[at(3, c)] += b[at(3, c)];
+        }
+        result[at(3, 3)] = 1.0f;
+    }
+
+    return Mat4{result};
+}
+
+Mat4 makeTransformMatrix(const Transform& transform)
+{
+    const auto cosA         = cos(transform.rotationAngle);
+    const auto sinA         = sin(transform.rotationAngle);
+    const auto oneMinusCosA = 1.0f - cosA;
+
+    const auto x = transform.rotationAxis.x();
+    const auto y = transform.rotationAxis.y();
+    const auto z = transform.rotationAxis.z();
+
+    // Rotation matrix for column vectors, the same as TransformMatrix::Rotation creates
+    // clang-format off
+    const auto rotation = std::array<float, 9>{
+        cosA + oneMinusCosA * x * x,     oneMinusCosA * x * y + sinA * z, oneMinusCosA * x * z - sinA * y,
+        oneMinusCosA * x * y - sinA * z, cosA + oneMinusCosA * y * y,     oneMinusCosA * y * z + sinA * x,
+        oneMinusCosA * x * z + sinA * y, oneMinusCosA * y * z - sinA * x, cosA + oneMinusCosA * z * z
+    };
+    // clang-format on
+    const auto scale       = std::array<float, 3>{transform.scale.x(), transform.scale.y(), transform.scale.z()};
+    const auto translation = std::array<float, 3>{transform.translation.x(), transform.translation.y(),
+                                                  transform.translation.z()};
+
+    auto result = std::array<float, 16>{};
+
+    for (auto r = size_t{0}; r < 3; ++r)
+    {
+        for (auto c = size_t{0}; c < 3; ++c)
+        {
+            // T * R * S for column vectors, S * R^T * T for row vectors
+            if constexpr (OGLS_VECTOR_IS_COLUMN)
+            {
+                result[at(r, c)] = rotation[r * 3 + c] * scale[c];
+            }
+            else
+            {
+                result[at(c, r)] = rotation[r * 3 + c] * scale[c];
+            }
+        }
+
+        if constexpr (OGLS_VECTOR_IS_COLUMN)
+        {
+            result[at(r, 3)] = translation[r];
+        }
+        else
+        {
+            result[at(3, r)] = translation[r];
+        }
+    }
+    result[at(3, 3)] = 1.0f;
+
+    return Mat4{result};
+}
+
+std::array<float, 16> toGpuMatrix(const Mat4& matrix) noexcept
+{
+    const auto m = matrix.getPointerToData();
+
+    auto result = std::array<float, 16>{};
+    for (auto r = size_t{0}; r < 4; ++r)
+    {
+        for (auto c = size_t{0}; c < 4; ++c)
+        {
+            // The element (r, c) of the transformation for column vectors is the element (c, r) for row vectors
+            result[at(c, r)] = OGLS_VECTOR_IS_COLUMN ? m[at(r, c)] : m[at(c, r)];
+        }
+    }
+    return result;
+}
+
+}  // namespace ogls::mathCore
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 
+#include "helpers/allocationTracker.h"
+
 namespace ogls::mathCore
 {
 #ifdef TREAT_VECTORS_AS_COLUMNS
@@ -80,6 +82,8 @@ TransformMatrix::TransformMatrix(const TransformMatrix& other) :
     m_lastOperationQueueSize{other.m_lastOperationQueueSize}, m_lastResultMatrix{other.m_lastResultMatrix},
     m_matrix{other.m_matrix}, m_operationQueue{other.m_operationQueue.size()}
 {
+    OGLS_ALLOCATION_SCOPE(MathCore);
+
     for (const auto& operation : other.m_operationQueue)
     {
         m_operationQueue.push_back(operation->clone());
@@ -119,21 +123,23 @@ TransformMatrix TransformMatrix::createOrthographicProjection() noexcept
 
 TransformMatrix TransformMatrix::createPerspectiveProjection(float fovy, float aspect, float zNear, float zFar) noexcept
 {
-    // Implemented only for OpenGL
+    // Implemented only for OpenGL. The matrix for column vectors is transposed for row vectors
     const auto tanHalfFovy = std::tan(fovy / 2.0f);
     auto       result      = Mat4{};
     result[0][0]           = 1.0f / (aspect * tanHalfFovy);
     result[1][1]           = 1.0f / tanHalfFovy;
     result[2][2]           = -(zFar + zNear) / (zFar - zNear);
-    result[2][3]           = -1.0f;
-    result[3][2]           = -(2.0f * zFar * zNear) / (zFar - zNear);
-    return TransformMatrix{result};
+    result[2][3]           = -(2.0f * zFar * zNear) / (zFar - zNear);
+    result[3][2]           = -1.0f;
+    return TransformMatrix{OGLS_VECTOR_IS_COLUMN ? result : result.transpose()};
 }
 
 TransformMatrix& TransformMatrix::operator=(const TransformMatrix& other)
 {
     if (this != &other)
     {
+        OGLS_ALLOCATION_SCOPE(MathCore);
+
         m_lastOperationQueueSize = other.m_lastOperationQueueSize;
         m_lastResultMatrix       = other.m_lastResultMatrix;
         m_matrix                 = other.m_matrix;
@@ -157,16 +163,19 @@ TransformMatrix::operator Mat4() const noexcept
 
 void TransformMatrix::addRotation(float angle, const Vec3& axis)
 {
+    OGLS_ALLOCATION_SCOPE(MathCore);
     m_operationQueue.push_back(std::make_unique<Rotation>(angle, axis));
 }
 
 void TransformMatrix::addScale(const Vec3& scaling)
 {
+    OGLS_ALLOCATION_SCOPE(MathCore);
     m_operationQueue.push_back(std::make_unique<Scale>(scaling));
 }
 
 void TransformMatrix::addTranslation(const Vec3& direction)
 {
+    OGLS_ALLOCATION_SCOPE(MathCore);
     m_operationQueue.push_back(std::make_unique<Translation>(direction));
 }
 
@@ -1,9 +1,11 @@
 #include "buffer.h"
 #include "bufferImpl.h"
 
-#include "exceptions.h"
+#include <stdexcept>
+
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "objectNamesManager.h"
 #include "vertexBufferLayoutImpl.h"
 
 namespace ogls::oglCore::vertex
@@ -42,6 +44,22 @@ void Buffer::bind() const
     m_impl->bind();
 }
 
+void Buffer::bindBase(BufferTarget target, GLuint index) const
+{
+    if (target != BufferTarget::AtomicCounterBuffer && target != BufferTarget::ShaderStorageBuffer
+        && target != BufferTarget::TransformFeedbackBuffer && target != BufferTarget::UniformBuffer)
+    {
+        throw std::invalid_argument{"The buffer can be bound only to the binding point of the indexed target."};
+    }
+
+    OGLS_GLCall(glBindBufferBase(helpers::toUType(target), index, m_impl->rendererId));
+}
+
+void Buffer::bindToTarget(BufferTarget target) const
+{
+    Impl::bindToTarget(target, m_impl->rendererId);
+}
+
 const ArrayData& Buffer::getData() const noexcept
 {
     return m_impl->data;
@@ -52,6 +70,28 @@ std::optional<VertexBufferLayout> Buffer::getLayout() const noexcept
     return m_impl->layout;
 }
 
+void Buffer::invalidateData()
+{
+    OGLS_GLCall(glInvalidateBufferData(m_impl->rendererId));
+}
+
+void* Buffer::mapRange(GLintptr byteOffset, GLsizeiptr length, GLbitfield access)
+{
+    if (byteOffset < 0 || length <= 0 || static_cast<size_t>(byteOffset + length) > m_impl->data.size)
+    {
+        throw std::out_of_range{"The mapped range doesn't fit into the data store of the buffer."};
+    }
+
+    auto pointer = static_cast<void*>(nullptr);
+    OGLS_GLCall(pointer = glMapNamedBufferRange(m_impl->rendererId, byteOffset, length, access));
+    if (!pointer)
+    {
+        throw std::runtime_error{"The data store of the buffer cannot be mapped."};
+    }
+
+    return pointer;
+}
+
 void Buffer::setData(ArrayData data)
 {
     if (!m_impl->checkAndGenerateNewStorage(data))
@@ -61,11 +101,28 @@ void Buffer::setData(ArrayData data)
     }
 }
 
+void Buffer::setSubData(GLintptr byteOffset, const ArrayData& data)
+{
+    if (byteOffset < 0 || static_cast<size_t>(byteOffset) + data.size > m_impl->data.size)
+    {
+        throw std::out_of_range{"The data doesn't fit into the data store of the buffer."};
+    }
+
+    OGLS_GLCall(glNamedBufferSubData(m_impl->rendererId, byteOffset, data.size, data.pointer));
+}
+
 void Buffer::unbind() const
 {
     Buffer::unbindTarget(m_impl->target);
 }
 
+bool Buffer::unmap()
+{
+    auto result = GLboolean{GL_FALSE};
+    OGLS_GLCall(result = glUnmapNamedBuffer(m_impl->rendererId));
+    return result == GL_TRUE;
+}
+
 Buffer* Buffer::clone() const
 {
     return new Buffer{*this};
@@ -125,6 +182,8 @@ BufferBindingTarget Buffer::Impl::getTargetAssociatedGetParameter(BufferTarget t
             return BufferBindingTarget::DrawIndirectBufferBinding;
         case BufferTarget::ElementArrayBuffer:
             return BufferBindingTarget::ElementArrayBufferBinding;
+        case BufferTarget::ParameterBuffer:
+            return BufferBindingTarget::ParameterBufferBinding;
         case BufferTarget::PixelPackBuffer:
             return BufferBindingTarget::PixelPackBufferBinding;
         case BufferTarget::PixelUnpackBuffer:
@@ -165,17 +224,13 @@ bool Buffer::Impl::checkAndGenerateNewStorage(const ArrayData& d)
 
 void Buffer::Impl::deleteBuffer()
 {
-    OGLS_GLCall(glDeleteBuffers(1, &rendererId));
+    objectNamesManager::releaseBufferName(rendererId);
     rendererId = {0};
 }
 
 void Buffer::Impl::genBuffer()
 {
-    OGLS_GLCall(glCreateBuffers(1, &rendererId));
-    if (rendererId == 0)
-    {
-        throw exceptions::GLRecAcquisitionException{"Buffer cannot be generated."};
-    }
+    rendererId = objectNamesManager::acquireBufferName();
 }
 
 }  // namespace ogls::oglCore::vertex
@@ -3,6 +3,7 @@
 
 #include "buffer.h"
 
+#include "helpers/poolAllocator.h"
 #include "openglHelpersImpl.h"
 
 namespace ogls::oglCore::vertex
@@ -49,6 +50,7 @@ class Buffer::Impl
 
         Impl& operator=(const Impl&) = delete;
         Impl& operator=(Impl&&)      = delete;
+        OGLS_POOL_ALLOCATED(Impl)
 
         /**
          * \brief Binds a buffer to a target.
@@ -66,15 +68,13 @@ class Buffer::Impl
          */
         bool checkAndGenerateNewStorage(const ArrayData& data);
         /**
-         * \brief Deletes the buffer object in OpenGL state machine.
+         * \brief Releases the buffer object, which is deleted, when the GPU completes the current frame.
          *
-         * Wraps [glDeleteBuffers()](https://docs.gl/gl4/glDeleteBuffers).
+         * \see objectNamesManager::releaseBufferName().
          */
         void deleteBuffer();
         /**
-         * \brief Generates OpenGL buffer object.
-         *
-         * Wraps [glCreateBuffers()](https://docs.gl/gl4/glCreateBuffers).
+         * \brief Takes the name of OpenGL buffer object from objectNamesManager::acquireBufferName().
          *
          * \throw ogls::exceptions::GLRecAcquisitionException().
          */
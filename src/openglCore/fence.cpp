@@ -0,0 +1,92 @@
+#include "fence.h"
+#include "fenceImpl.h"
+
+#include <algorithm>
+
+#include "exceptions.h"
+#include "helpers/debugHelpers.h"
+
+namespace ogls::oglCore::sync
+{
+Fence::Fence() : m_impl{std::make_unique<Impl>()}
+{
+}
+
+Fence::Fence(Fence&& obj) noexcept : m_impl{std::move(obj.m_impl)}
+{
+}
+
+Fence::~Fence() noexcept = default;
+
+Fence& Fence::operator=(Fence&& obj) noexcept
+{
+    m_impl = std::move(obj.m_impl);
+    return *this;
+}
+
+void Fence::insert()
+{
+    auto& impl = *m_impl;
+
+    impl.deleteSync();
+    impl.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (impl.sync == nullptr)
+    {
+        throw exceptions::GLRecAcquisitionException{"Fence cannot be created."};
+    }
+}
+
+bool Fence::isInserted() const noexcept
+{
+    return m_impl->sync != nullptr;
+}
+
+bool Fence::isSignaled() const
+{
+    if (!isInserted())
+    {
+        return true;
+    }
+
+    auto status = GLint{GL_UNSIGNALED};
+    OGLS_GLCall(glGetSynciv(m_impl->sync, GL_SYNC_STATUS, 1, nullptr, &status));
+    return status == GL_SIGNALED;
+}
+
+bool Fence::wait(std::chrono::nanoseconds timeout) const
+{
+    if (!isInserted())
+    {
+        return true;
+    }
+
+    const auto nanoseconds = static_cast<GLuint64>(std::max(timeout, std::chrono::nanoseconds::zero()).count());
+    auto       result      = GLenum{GL_WAIT_FAILED};
+    OGLS_GLCall(result = glClientWaitSync(m_impl->sync, GL_SYNC_FLUSH_COMMANDS_BIT, nanoseconds));
+    // The failed wait is treated as the signaled fence, so the caller isn't blocked forever
+    return result != GL_TIMEOUT_EXPIRED;
+}
+
+//------ IMPLEMENTATION
+
+Fence::Impl::~Impl() noexcept
+{
+    try
+    {
+        deleteSync();
+    }
+    catch (...)
+    {
+    }
+}
+
+void Fence::Impl::deleteSync()
+{
+    if (sync != nullptr)
+    {
+        OGLS_GLCall(glDeleteSync(sync));
+        sync = {nullptr};
+    }
+}
+
+}  // namespace ogls::oglCore::sync
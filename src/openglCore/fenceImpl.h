@@ -0,0 +1,41 @@
+#ifndef OGLS_OGLCORE_SYNC_FENCE_IMPL_H
+#define OGLS_OGLCORE_SYNC_FENCE_IMPL_H
+
+#include "fence.h"
+
+#include "helpers/poolAllocator.h"
+
+namespace ogls::oglCore::sync
+{
+/**
+ * \brief Impl contains private data and methods of Fence.
+ */
+class Fence::Impl
+{
+    public:
+        Impl() = default;
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
+        /**
+         * \see deleteSync().
+         */
+        ~Impl() noexcept;
+
+        /**
+         * \brief Deletes the sync object in OpenGL state machine, if it exists.
+         *
+         * Wraps [glDeleteSync()](https://docs.gl/gl4/glDeleteSync).
+         */
+        void deleteSync();
+
+    public:
+        /**
+         * \brief The referenced OpenGL sync object.
+         */
+        GLsync sync = {nullptr};
+
+};  // class Fence::Impl
+
+}  // namespace ogls::oglCore::sync
+
+#endif
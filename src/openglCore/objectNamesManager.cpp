@@ -0,0 +1,241 @@
+#include "objectNamesManager.h"
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "exceptions.h"
+#include "fence.h"
+#include "helpers/debugHelpers.h"
+#include "helpers/helpers.h"
+
+namespace ogls::oglCore::objectNamesManager
+{
+namespace
+{
+    /**
+     * \brief ReleasedNames contains names of released objects, which are deleted together.
+     */
+    struct ReleasedNames final
+    {
+            void append(const ReleasedNames& other)
+            {
+                buffers.insert(buffers.end(), other.buffers.begin(), other.buffers.end());
+                textures.insert(textures.end(), other.textures.begin(), other.textures.end());
+                vertexArrays.insert(vertexArrays.end(), other.vertexArrays.begin(), other.vertexArrays.end());
+            }
+
+            size_t getCount() const noexcept
+            {
+                return buffers.size() + textures.size() + vertexArrays.size();
+            }
+
+            std::vector<GLuint> buffers;
+            std::vector<GLuint> textures;
+            std::vector<GLuint> vertexArrays;
+
+    };  // struct ReleasedNames
+
+    /**
+     * \brief RetiredFrame is the submitted frame, released objects of which wait for its completion by the GPU.
+     */
+    struct RetiredFrame final
+    {
+            sync::Fence   fence;
+            ReleasedNames names;
+
+    };  // struct RetiredFrame
+
+    /**
+     * \brief Takes the name from the pool and fills the empty pool by the new batch of names.
+     *
+     * \param pool         - created names, which haven't been given out yet.
+     * \param createNames  - the function, which creates names in the passed array.
+     * \param errorMessage - the message of the exception.
+     * \throw ogls::exceptions::GLRecAcquisitionException().
+     */
+    template<typename CreateNamesFunction>
+    GLuint acquireName(std::vector<GLuint>& pool, const CreateNamesFunction& createNames, const char* errorMessage);
+    void   deleteNames(ReleasedNames& names);
+
+
+    auto nameBatchSize          = GLsizei{defaultNameBatchSize};
+    auto pooledBufferNames      = std::vector<GLuint>{};
+    auto pooledTextureNames     = std::unordered_map<texture::TextureTarget, std::vector<GLuint>>{};
+    auto pooledVertexArrayNames = std::vector<GLuint>{};
+    /**
+     * \brief Names, which have been released during the current frame.
+     */
+    auto releasedNames          = ReleasedNames{};
+    /**
+     * \brief Submitted frames from the oldest one.
+     */
+    auto retiredFrames          = std::deque<RetiredFrame>{};
+
+}  // namespace
+
+GLuint acquireBufferName()
+{
+    return acquireName(
+      pooledBufferNames, [](std::vector<GLuint>& names)
+      { OGLS_GLCall(glCreateBuffers(static_cast<GLsizei>(names.size()), names.data())); },
+      "Buffer cannot be generated.");
+}
+
+GLuint acquireTextureName(texture::TextureTarget target)
+{
+    return acquireName(
+      pooledTextureNames[target], [target](std::vector<GLuint>& names)
+      { OGLS_GLCall(glCreateTextures(helpers::toUType(target), static_cast<GLsizei>(names.size()), names.data())); },
+      "Texture cannot be generated.");
+}
+
+GLuint acquireVertexArrayName()
+{
+    return acquireName(
+      pooledVertexArrayNames, [](std::vector<GLuint>& names)
+      { OGLS_GLCall(glCreateVertexArrays(static_cast<GLsizei>(names.size()), names.data())); },
+      "Vertex array cannot be generated.");
+}
+
+void deleteReleasedObjects()
+{
+    auto names = std::exchange(releasedNames, {});
+    for (const auto& frame : retiredFrames)
+    {
+        names.append(frame.names);
+    }
+    retiredFrames.clear();
+
+    deleteNames(names);
+}
+
+void endFrame()
+{
+    if (releasedNames.getCount() > 0)
+    {
+        auto frame = RetiredFrame{};
+        frame.fence.insert();
+        frame.names = std::exchange(releasedNames, {});
+        retiredFrames.push_back(std::move(frame));
+    }
+
+    // The GPU completes frames in order, so the first unsignaled fence stops the collection
+    auto completedNames = ReleasedNames{};
+    while (!retiredFrames.empty() && retiredFrames.front().fence.isSignaled())
+    {
+        completedNames.append(retiredFrames.front().names);
+        retiredFrames.pop_front();
+    }
+
+    deleteNames(completedNames);
+}
+
+size_t getReleasedObjectsCount() noexcept
+{
+    auto count = releasedNames.getCount();
+    for (const auto& frame : retiredFrames)
+    {
+        count += frame.names.getCount();
+    }
+    return count;
+}
+
+void releaseBufferName(GLuint bufferId)
+{
+    if (bufferId != 0)
+    {
+        releasedNames.buffers.push_back(bufferId);
+    }
+}
+
+void releaseTextureName(GLuint textureId)
+{
+    if (textureId != 0)
+    {
+        releasedNames.textures.push_back(textureId);
+    }
+}
+
+void releaseVertexArrayName(GLuint vaoId)
+{
+    if (vaoId != 0)
+    {
+        releasedNames.vertexArrays.push_back(vaoId);
+    }
+}
+
+void setNameBatchSize(GLsizei batchSize)
+{
+    if (batchSize < 1)
+    {
+        throw std::invalid_argument{"At least one name must be created at once."};
+    }
+    nameBatchSize = batchSize;
+}
+
+void shutdown()
+{
+    deleteReleasedObjects();
+
+    // Created names are objects already, so they are deleted as released ones
+    auto names = ReleasedNames{};
+    names.buffers = std::exchange(pooledBufferNames, {});
+    for (auto& [target, textureNames] : pooledTextureNames)
+    {
+        names.textures.insert(names.textures.end(), textureNames.begin(), textureNames.end());
+    }
+    pooledTextureNames.clear();
+    names.vertexArrays = std::exchange(pooledVertexArrayNames, {});
+
+    deleteNames(names);
+}
+
+namespace
+{
+    template<typename CreateNamesFunction>
+    GLuint acquireName(std::vector<GLuint>& pool, const CreateNamesFunction& createNames, const char* errorMessage)
+    {
+        if (pool.empty())
+        {
+            pool.resize(static_cast<size_t>(nameBatchSize));
+            createNames(pool);
+            if (std::ranges::find(pool, GLuint{0}) != pool.end())
+            {
+                pool.clear();
+                throw exceptions::GLRecAcquisitionException{errorMessage};
+            }
+
+            // Names are taken from the back, so they are given out in the order of creation
+            std::ranges::reverse(pool);
+        }
+
+        const auto name = pool.back();
+        pool.pop_back();
+        return name;
+    }
+
+    void deleteNames(ReleasedNames& names)
+    {
+        if (!names.buffers.empty())
+        {
+            OGLS_GLCall(glDeleteBuffers(static_cast<GLsizei>(names.buffers.size()), names.buffers.data()));
+        }
+        if (!names.textures.empty())
+        {
+            OGLS_GLCall(glDeleteTextures(static_cast<GLsizei>(names.textures.size()), names.textures.data()));
+        }
+        if (!names.vertexArrays.empty())
+        {
+            OGLS_GLCall(
+              glDeleteVertexArrays(static_cast<GLsizei>(names.vertexArrays.size()), names.vertexArrays.data()));
+        }
+        names = {};
+    }
+
+}  // namespace
+
+}  // namespace ogls::oglCore::objectNamesManager
@@ -48,6 +48,9 @@ void initOpenglLimits()
     limitValue = getOpenGLIntegerValue(toUType(LimitName::MaxCombinedTextureImageUnits));
     limits.insert({LimitName::MaxCombinedTextureImageUnits, limitValue});
 
+    limitValue = getOpenGLIntegerValue(toUType(LimitName::MaxTextureImageUnits));
+    limits.insert({LimitName::MaxTextureImageUnits, limitValue});
+
     limitValue = getOpenGLIntegerValue(toUType(LimitName::MaxVertexAttribs));
     limits.insert({LimitName::MaxVertexAttribs, limitValue});
 
@@ -0,0 +1,364 @@
+#include "pipelineState.h"
+#include "pipelineStateImpl.h"
+
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers/debugHelpers.h"
+#include "helpers/helpers.h"
+
+namespace ogls::oglCore::pipeline
+{
+namespace
+{
+    size_t calculateHash(const PipelineStateDescription& description) noexcept;
+    void   setCapability(GLenum capability, bool isEnabled);
+    void   setColorMask(bool isWritingEnabled);
+
+}  // namespace
+
+PipelineState::PipelineState(PipelineStateDescription description) :
+    m_impl{std::make_unique<Impl>(std::move(description))}
+{
+}
+
+PipelineState::~PipelineState() noexcept = default;
+
+bool PipelineState::operator==(const PipelineState& other) const noexcept
+{
+    const auto& d1 = m_impl->description;
+    const auto& d2 = other.m_impl->description;
+
+    return m_impl->hash == other.m_impl->hash && d1.shaderProgram == d2.shaderProgram
+           && d1.vertexArray == d2.vertexArray && d1.blend == d2.blend && d1.depth == d2.depth
+           && d1.raster == d2.raster;
+}
+
+const BlendState& PipelineState::getBlendState() const noexcept
+{
+    return m_impl->description.blend;
+}
+
+const DepthState& PipelineState::getDepthState() const noexcept
+{
+    return m_impl->description.depth;
+}
+
+size_t PipelineState::getHash() const noexcept
+{
+    return m_impl->hash;
+}
+
+const RasterState& PipelineState::getRasterState() const noexcept
+{
+    return m_impl->description.raster;
+}
+
+const std::shared_ptr<shader::ShaderProgram>& PipelineState::getShaderProgram() const noexcept
+{
+    return m_impl->description.shaderProgram;
+}
+
+const std::shared_ptr<vertex::VertexArray>& PipelineState::getVertexArray() const noexcept
+{
+    return m_impl->description.vertexArray;
+}
+
+namespace pipelineStateManager
+{
+    namespace
+    {
+        void applyBlendState(const BlendState& blend);
+        void applyDepthState(const DepthState& depth);
+        void applyRasterState(const RasterState& raster);
+
+
+        std::optional<BlendState>  currentBlendState;
+        std::optional<ClearColor>  currentClearColor;
+        std::optional<DepthState>  currentDepthState;
+        std::optional<RasterState> currentRasterState;
+        std::optional<GLuint>      currentShaderProgram;
+        std::optional<GLuint>      currentVertexArray;
+        std::optional<Viewport>    currentViewport;
+        /**
+         * \brief Created PipelineState objects, grouped by hash. Used to return the same object for equal descriptions.
+         */
+        std::unordered_map<size_t, std::vector<std::weak_ptr<const PipelineState>>> createdStates;
+
+    }  // namespace
+
+    void apply(const PipelineState& state)
+    {
+        state.getShaderProgram()->use();
+        state.getVertexArray()->bind();
+
+        applyBlendState(state.getBlendState());
+        applyDepthState(state.getDepthState());
+        applyRasterState(state.getRasterState());
+    }
+
+    void clear(const ClearColor& color, GLbitfield mask)
+    {
+        if (currentClearColor != color)
+        {
+            OGLS_GLCall(glClearColor(color.r, color.g, color.b, color.a));
+            currentClearColor = color;
+        }
+
+        // glClear() respects write masks, so buffers masked by the last applied state must be unmasked
+        if ((mask & GL_COLOR_BUFFER_BIT) != 0 && currentBlendState && !currentBlendState->isColorWritingEnabled)
+        {
+            setColorMask(true);
+            currentBlendState->isColorWritingEnabled = true;
+        }
+
+        if ((mask & GL_DEPTH_BUFFER_BIT) != 0 && currentDepthState && !currentDepthState->isWritingEnabled)
+        {
+            OGLS_GLCall(glDepthMask(GL_TRUE));
+            currentDepthState->isWritingEnabled = true;
+        }
+
+        OGLS_GLCall(glClear(mask));
+    }
+
+    std::shared_ptr<const PipelineState> create(PipelineStateDescription description)
+    {
+        auto  newState = std::make_shared<const PipelineState>(std::move(description));
+        auto& bucket   = createdStates[newState->getHash()];
+
+        std::erase_if(bucket, [](const auto& weakState) { return weakState.expired(); });
+
+        for (const auto& weakState : bucket)
+        {
+            if (auto existingState = weakState.lock(); existingState && *existingState == *newState)
+            {
+                return existingState;
+            }
+        }
+
+        bucket.push_back(newState);
+        return newState;
+    }
+
+    void invalidate() noexcept
+    {
+        currentBlendState.reset();
+        currentClearColor.reset();
+        currentDepthState.reset();
+        currentRasterState.reset();
+        currentShaderProgram.reset();
+        currentVertexArray.reset();
+        currentViewport.reset();
+    }
+
+    bool isCurrentShaderProgram(GLuint programId) noexcept
+    {
+        return currentShaderProgram == programId;
+    }
+
+    bool isCurrentVertexArray(GLuint vaoId) noexcept
+    {
+        return currentVertexArray == vaoId;
+    }
+
+    void onShaderProgramDeleted(GLuint programId) noexcept
+    {
+        if (currentShaderProgram == programId)
+        {
+            currentShaderProgram.reset();
+        }
+    }
+
+    void onShaderProgramUsed(GLuint programId) noexcept
+    {
+        currentShaderProgram = programId;
+    }
+
+    void onVertexArrayBound(GLuint vaoId) noexcept
+    {
+        currentVertexArray = vaoId;
+    }
+
+    void onVertexArrayDeleted(GLuint vaoId) noexcept
+    {
+        if (currentVertexArray == vaoId)
+        {
+            currentVertexArray.reset();
+        }
+    }
+
+    void setViewport(const Viewport& viewport)
+    {
+        if (currentViewport == viewport)
+        {
+            return;
+        }
+
+        OGLS_GLCall(glViewport(viewport.x, viewport.y, viewport.width, viewport.height));
+        currentViewport = viewport;
+    }
+
+    namespace
+    {
+        void applyBlendState(const BlendState& blend)
+        {
+            using namespace helpers;
+
+            const auto& current = currentBlendState;
+
+            if (!current || current->isEnabled != blend.isEnabled)
+            {
+                setCapability(GL_BLEND, blend.isEnabled);
+            }
+
+            if (!current || current->srcRgb != blend.srcRgb || current->dstRgb != blend.dstRgb
+                || current->srcAlpha != blend.srcAlpha || current->dstAlpha != blend.dstAlpha)
+            {
+                OGLS_GLCall(glBlendFuncSeparate(toUType(blend.srcRgb), toUType(blend.dstRgb),
+                                                toUType(blend.srcAlpha), toUType(blend.dstAlpha)));
+            }
+
+            if (!current || current->rgbEquation != blend.rgbEquation
+                || current->alphaEquation != blend.alphaEquation)
+            {
+                OGLS_GLCall(glBlendEquationSeparate(toUType(blend.rgbEquation), toUType(blend.alphaEquation)));
+            }
+
+            if (!current || current->isColorWritingEnabled != blend.isColorWritingEnabled)
+            {
+                setColorMask(blend.isColorWritingEnabled);
+            }
+
+            currentBlendState = blend;
+        }
+
+        void applyDepthState(const DepthState& depth)
+        {
+            const auto& current = currentDepthState;
+
+            if (!current || current->isTestEnabled != depth.isTestEnabled)
+            {
+                setCapability(GL_DEPTH_TEST, depth.isTestEnabled);
+            }
+
+            if (!current || current->function != depth.function)
+            {
+                OGLS_GLCall(glDepthFunc(helpers::toUType(depth.function)));
+            }
+
+            if (!current || current->isWritingEnabled != depth.isWritingEnabled)
+            {
+                OGLS_GLCall(glDepthMask(depth.isWritingEnabled ? GL_TRUE : GL_FALSE));
+            }
+
+            currentDepthState = depth;
+        }
+
+        void applyRasterState(const RasterState& raster)
+        {
+            using namespace helpers;
+
+            const auto& current = currentRasterState;
+
+            if (!current || current->isCullingEnabled != raster.isCullingEnabled)
+            {
+                setCapability(GL_CULL_FACE, raster.isCullingEnabled);
+            }
+
+            if (!current || current->cullFace != raster.cullFace)
+            {
+                OGLS_GLCall(glCullFace(toUType(raster.cullFace)));
+            }
+
+            if (!current || current->frontFace != raster.frontFace)
+            {
+                OGLS_GLCall(glFrontFace(toUType(raster.frontFace)));
+            }
+
+            if (!current || current->isScissorTestEnabled != raster.isScissorTestEnabled)
+            {
+                setCapability(GL_SCISSOR_TEST, raster.isScissorTestEnabled);
+            }
+
+            if (!current || current->polygonMode != raster.polygonMode)
+            {
+                OGLS_GLCall(glPolygonMode(GL_FRONT_AND_BACK, toUType(raster.polygonMode)));
+            }
+
+            currentRasterState = raster;
+        }
+
+    }  // namespace
+
+}  // namespace pipelineStateManager
+
+namespace
+{
+    size_t calculateHash(const PipelineStateDescription& description) noexcept
+    {
+        using namespace helpers;
+
+        const auto hashValue = [](auto value) { return std::hash<decltype(value)>{}(value); };
+
+        auto seed = hashValue(description.shaderProgram.get());
+        hashCombine(seed, hashValue(description.vertexArray.get()));
+
+        const auto& blend = description.blend;
+        hashCombine(seed, hashValue(blend.isColorWritingEnabled));
+        hashCombine(seed, hashValue(blend.isEnabled));
+        hashCombine(seed, hashValue(toUType(blend.srcRgb)));
+        hashCombine(seed, hashValue(toUType(blend.dstRgb)));
+        hashCombine(seed, hashValue(toUType(blend.srcAlpha)));
+        hashCombine(seed, hashValue(toUType(blend.dstAlpha)));
+        hashCombine(seed, hashValue(toUType(blend.rgbEquation)));
+        hashCombine(seed, hashValue(toUType(blend.alphaEquation)));
+
+        const auto& depth = description.depth;
+        hashCombine(seed, hashValue(depth.isTestEnabled));
+        hashCombine(seed, hashValue(depth.isWritingEnabled));
+        hashCombine(seed, hashValue(toUType(depth.function)));
+
+        const auto& raster = description.raster;
+        hashCombine(seed, hashValue(raster.isCullingEnabled));
+        hashCombine(seed, hashValue(raster.isScissorTestEnabled));
+        hashCombine(seed, hashValue(toUType(raster.cullFace)));
+        hashCombine(seed, hashValue(toUType(raster.frontFace)));
+        hashCombine(seed, hashValue(toUType(raster.polygonMode)));
+
+        return seed;
+    }
+
+    void setCapability(GLenum capability, bool isEnabled)
+    {
+        if (isEnabled)
+        {
+            OGLS_GLCall(glEnable(capability));
+        }
+        else
+        {
+            OGLS_GLCall(glDisable(capability));
+        }
+    }
+
+    void setColorMask(bool isWritingEnabled)
+    {
+        const auto flag = isWritingEnabled ? GL_TRUE : GL_FALSE;
+        OGLS_GLCall(glColorMask(flag, flag, flag, flag));
+    }
+
+}  // namespace
+
+//------ IMPLEMENTATION
+
+PipelineState::Impl::Impl(PipelineStateDescription d) : description{std::move(d)}, hash{calculateHash(description)}
+{
+    if (!description.shaderProgram || !description.vertexArray)
+    {
+        throw std::invalid_argument{"Pipeline state requires both shader program and vertex array."};
+    }
+}
+
+}  // namespace ogls::oglCore::pipeline
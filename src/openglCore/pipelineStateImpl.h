@@ -0,0 +1,87 @@
+#ifndef OGLS_OGLCORE_PIPELINE_PIPELINE_STATE_IMPL_H
+#define OGLS_OGLCORE_PIPELINE_PIPELINE_STATE_IMPL_H
+
+#include "pipelineState.h"
+
+#include "helpers/poolAllocator.h"
+
+namespace ogls::oglCore::pipeline
+{
+/**
+ * \brief Impl contains private data and methods of PipelineState.
+ */
+class PipelineState::Impl
+{
+    public:
+        /**
+         * \brief Constructs new Impl and calculates the hash of the description.
+         *
+         * \param d - a configuration of the pipeline.
+         */
+        explicit Impl(PipelineStateDescription d);
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
+        ~Impl() noexcept = default;
+
+    public:
+        /**
+         * \brief The configuration of the pipeline.
+         */
+        const PipelineStateDescription description;
+        /**
+         * \brief The hash of the description.
+         */
+        const size_t                   hash = {0};
+
+};  // class PipelineState::Impl
+
+namespace pipelineStateManager
+{
+    /**
+     * \brief Checks if the shader program is the current one from the point of view of pipelineStateManager.
+     *
+     * \param programId - ID of OpenGL shader program.
+     * \return true if the program is known to be current, false otherwise.
+     */
+    bool isCurrentShaderProgram(GLuint programId) noexcept;
+    /**
+     * \brief Checks if the vertex array is the bound one from the point of view of pipelineStateManager.
+     *
+     * \param vaoId - ID of OpenGL vertex array object.
+     * \return true if the vertex array object is known to be bound, false otherwise.
+     */
+    bool isCurrentVertexArray(GLuint vaoId) noexcept;
+    /**
+     * \brief Notifies pipelineStateManager that the shader program is deleted.
+     *
+     * If the program was current, the current program becomes unknown, because its ID can be reused.
+     *
+     * \param programId - ID of deleted OpenGL shader program.
+     */
+    void onShaderProgramDeleted(GLuint programId) noexcept;
+    /**
+     * \brief Notifies pipelineStateManager that the shader program became current.
+     *
+     * \param programId - ID of OpenGL shader program.
+     */
+    void onShaderProgramUsed(GLuint programId) noexcept;
+    /**
+     * \brief Notifies pipelineStateManager that the vertex array object became bound.
+     *
+     * \param vaoId - ID of OpenGL vertex array object.
+     */
+    void onVertexArrayBound(GLuint vaoId) noexcept;
+    /**
+     * \brief Notifies pipelineStateManager that the vertex array object is deleted.
+     *
+     * If the vertex array object was bound, the bound one becomes unknown, because its ID can be reused.
+     *
+     * \param vaoId - ID of deleted OpenGL vertex array object.
+     */
+    void onVertexArrayDeleted(GLuint vaoId) noexcept;
+
+}  // namespace pipelineStateManager
+
+}  // namespace ogls::oglCore::pipeline
+
+#endif
@@ -0,0 +1,107 @@
+#include "query.h"
+#include "queryImpl.h"
+
+#include "exceptions.h"
+#include "helpers/debugHelpers.h"
+#include "helpers/helpers.h"
+
+namespace ogls::oglCore::query
+{
+Query::Query(QueryTarget target) : m_impl{std::make_unique<Impl>(target)}
+{
+}
+
+Query::Query(Query&& obj) noexcept : m_impl{std::move(obj.m_impl)}
+{
+}
+
+Query::~Query() noexcept = default;
+
+void Query::endConditionalRender()
+{
+    OGLS_GLCall(glEndConditionalRender());
+}
+
+Query& Query::operator=(Query&& obj) noexcept
+{
+    m_impl = std::move(obj.m_impl);
+    return *this;
+}
+
+void Query::begin()
+{
+    OGLS_GLCall(glBeginQuery(helpers::toUType(m_impl->target), m_impl->rendererId));
+}
+
+void Query::beginConditionalRender(ConditionalRenderMode mode) const
+{
+    OGLS_GLCall(glBeginConditionalRender(m_impl->rendererId, helpers::toUType(mode)));
+}
+
+void Query::end()
+{
+    OGLS_GLCall(glEndQuery(helpers::toUType(m_impl->target)));
+}
+
+GLuint64 Query::getResult() const
+{
+    auto result = GLuint64{0};
+    OGLS_GLCall(glGetQueryObjectui64v(m_impl->rendererId, GL_QUERY_RESULT, &result));
+    return result;
+}
+
+QueryTarget Query::getTarget() const noexcept
+{
+    return m_impl->target;
+}
+
+bool Query::isResultAvailable() const
+{
+    auto isAvailable = GLint{GL_FALSE};
+    OGLS_GLCall(glGetQueryObjectiv(m_impl->rendererId, GL_QUERY_RESULT_AVAILABLE, &isAvailable));
+    return isAvailable != GL_FALSE;
+}
+
+std::optional<GLuint64> Query::tryGetResult() const
+{
+    if (!isResultAvailable())
+    {
+        return std::nullopt;
+    }
+    return getResult();
+}
+
+//------ IMPLEMENTATION
+
+Query::Impl::Impl(QueryTarget t) : target{t}
+{
+    genQuery();
+}
+
+Query::Impl::~Impl() noexcept
+{
+    try
+    {
+        deleteQuery();
+    }
+    catch (...)
+    {
+    }
+}
+
+void Query::Impl::deleteQuery()
+{
+    OGLS_GLCall(glDeleteQueries(1, &rendererId));
+    rendererId = {0};
+}
+
+void Query::Impl::genQuery()
+{
+    OGLS_GLCall(glCreateQueries(helpers::toUType(target), 1, &rendererId));
+    if (rendererId == 0)
+    {
+        throw exceptions::GLRecAcquisitionException{"Query cannot be generated."};
+    }
+}
+
+}  // namespace ogls::oglCore::query
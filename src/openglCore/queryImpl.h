@@ -0,0 +1,56 @@
+#ifndef OGLS_OGLCORE_QUERY_QUERY_IMPL_H
+#define OGLS_OGLCORE_QUERY_QUERY_IMPL_H
+
+#include "query.h"
+
+#include "helpers/poolAllocator.h"
+
+namespace ogls::oglCore::query
+{
+/**
+ * \brief Impl contains private data and methods of Query.
+ */
+class Query::Impl
+{
+    public:
+        /**
+         * \see genQuery().
+         */
+        explicit Impl(QueryTarget target);
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
+        /**
+         * \see deleteQuery().
+         */
+        ~Impl() noexcept;
+
+        /**
+         * \brief Deletes query object in OpenGL state machine.
+         *
+         * Wraps [glDeleteQueries()](https://docs.gl/gl4/glDeleteQueries).
+         */
+        void deleteQuery();
+        /**
+         * \brief Generates new 1 query object in OpenGL state machine.
+         *
+         * Wraps [glCreateQueries()](https://docs.gl/gl4/glCreateQueries).
+         *
+         * \throw ogls::exceptions::GLRecAcquisitionException().
+         */
+        void genQuery();
+
+    public:
+        /**
+         * \brief ID of referenced OpenGL query object.
+         */
+        GLuint      rendererId = {0};
+        /**
+         * \brief The type of the query.
+         */
+        QueryTarget target     = {QueryTarget::AnySamplesPassed};
+
+};  // class Query::Impl
+
+}  // namespace ogls::oglCore::query
+
+#endif
@@ -1,12 +1,15 @@
 #include "shaderProgram.h"
 #include "shaderProgramImpl.h"
 
+#include <array>
 #include <format>
 #include <vector>
 
 #include "exceptions.h"
+#include "helpers/allocationTracker.h"
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "pipelineStateImpl.h"
 
 namespace ogls::oglCore::shader
 {
@@ -23,7 +26,11 @@ Shader::Shader(ShaderType type, const std::string& shaderSource) : m_impl{std::m
 Shader::~Shader() noexcept = default;
 
 ShaderProgram::ShaderProgram(const Shader& vertexShader, const Shader& fragmentShader) :
-    m_impl{std::make_unique<Impl>(vertexShader, fragmentShader)}
+    m_impl{std::make_unique<Impl>(std::array{&vertexShader, &fragmentShader})}
+{
+}
+
+ShaderProgram::ShaderProgram(const Shader& computeShader) : m_impl{std::make_unique<Impl>(std::array{&computeShader})}
 {
 }
 
@@ -48,7 +55,13 @@ VectorUniform<Type, Count>& ShaderProgram::getVectorUniform(const std::string& n
 
 void ShaderProgram::use() const
 {
+    if (pipeline::pipelineStateManager::isCurrentShaderProgram(m_impl->rendererId))
+    {
+        return;
+    }
+
     OGLS_GLCall(glUseProgram(m_impl->rendererId));
+    pipeline::pipelineStateManager::onShaderProgramUsed(m_impl->rendererId);
 }
 
 std::unique_ptr<ShaderProgram> makeShaderProgram(std::string_view pathToVertexShader,
@@ -67,6 +80,19 @@ std::unique_ptr<ShaderProgram> makeShaderProgram(std::string_view pathToVertexSh
     return std::make_unique<ShaderProgram>(vShader, fShader);
 }
 
+std::unique_ptr<ShaderProgram> makeComputeShaderProgram(std::string_view pathToComputeShader)
+{
+    const auto cShaderSource = helpers::readTextFromFile(pathToComputeShader);
+    if (cShaderSource.empty())
+    {
+        throw std::runtime_error{"Compute shader source is empty."};
+    }
+
+    const auto cShader = Shader{ShaderType::ComputeShader, cShaderSource};
+
+    return std::make_unique<ShaderProgram>(cShader);
+}
+
 //------ IMPLEMENTATION
 
 Shader::Impl::Impl(ShaderType t, const std::string& shaderSource) : type{t}
@@ -111,7 +137,7 @@ Shader::Impl::~Impl() noexcept
     }
 }
 
-ShaderProgram::Impl::Impl(const Shader& vertexShader, const Shader& fragmentShader)
+ShaderProgram::Impl::Impl(std::span<const Shader* const> shaders)
 {
     OGLS_GLCall(rendererId = {glCreateProgram()});
     if (rendererId == 0)
@@ -119,8 +145,10 @@ ShaderProgram::Impl::Impl(const Shader& vertexShader, const Shader& fragmentShad
         throw exceptions::GLRecAcquisitionException{"Shader program cannot be created."};
     }
 
-    OGLS_GLCall(glAttachShader(rendererId, vertexShader.m_impl->rendererId));
-    OGLS_GLCall(glAttachShader(rendererId, fragmentShader.m_impl->rendererId));
+    for (const auto shader : shaders)
+    {
+        OGLS_GLCall(glAttachShader(rendererId, shader->m_impl->rendererId));
+    }
     OGLS_GLCall(glLinkProgram(rendererId));
     OGLS_GLCall(glValidateProgram(rendererId));
 
@@ -142,8 +170,10 @@ ShaderProgram::Impl::Impl(const Shader& vertexShader, const Shader& fragmentShad
         throw exceptions::GLRecAcquisitionException{excMes};
     }
 
-    OGLS_GLCall(glDetachShader(rendererId, vertexShader.m_impl->rendererId));
-    OGLS_GLCall(glDetachShader(rendererId, fragmentShader.m_impl->rendererId));
+    for (const auto shader : shaders)
+    {
+        OGLS_GLCall(glDetachShader(rendererId, shader->m_impl->rendererId));
+    }
 }
 
 ShaderProgram::Impl::~Impl() noexcept
@@ -151,6 +181,7 @@ ShaderProgram::Impl::~Impl() noexcept
     try
     {
         OGLS_GLCall(glDeleteProgram(rendererId));
+        pipeline::pipelineStateManager::onShaderProgramDeleted(rendererId);
     }
     catch (...)
     {
@@ -166,6 +197,8 @@ DerivedUniformType& ShaderProgram::Impl::getUniform(const std::string& name) con
         return *(static_cast<DerivedUniformType*>(uniforms.at(name).get()));
     }
 
+    OGLS_ALLOCATION_SCOPE(OpenglCore);
+
     const auto location = getUniformLocation(name);
     auto       uniform  = new DerivedUniformType{rendererId, location, name};
     uniforms.insert({name, std::unique_ptr<BaseUniform>(uniform)});
@@ -211,6 +244,8 @@ namespace
     {
         switch (type)
         {
+            case ShaderType::ComputeShader:
+                return "COMPUTE";
             case ShaderType::VertexShader:
                 return "VERTEX";
             case ShaderType::FragmentShader:
@@ -3,6 +3,10 @@
 
 #include "shaderProgram.h"
 
+#include <span>
+
+#include "helpers/poolAllocator.h"
+
 namespace ogls::oglCore::shader
 {
 /**
@@ -25,6 +29,7 @@ class Shader::Impl
          */
         Impl(ShaderType type, const std::string& shaderSource);
         OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
         /**
          * \brief Deletes shader in OpenGL state machine.
          *
@@ -61,12 +66,12 @@ class ShaderProgram::Impl
          * [glGetProgramInfoLog()](https://docs.gl/gl4/glGetProgramInfoLog),
          * [glDetachShader()](https://docs.gl/gl4/glDetachShader).
          *
-         * \param vertexShader   - an object of Shader class with the type ShaderType::VERTEX_SHADER.
-         * \param fragmentShader - an object of Shader class with the type ShaderType::FRAGMENT_SHADER.
+         * \param shaders - shaders of all stages of the program: vertex and fragment ones or the compute one.
          * \throw ogls::exceptions::GLRecAcquisitionException().
          */
-        Impl(const Shader& vertexShader, const Shader& fragmentShader);
+        explicit Impl(std::span<const Shader* const> shaders);
         OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
         /**
          * \brief Deletes shader program in OpenGL state machine.
          *
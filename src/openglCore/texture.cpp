@@ -1,14 +1,48 @@
 #include "texture.h"
 #include "textureImpl.h"
 
+#include <algorithm>
 #include <stdexcept>
 
-#include "exceptions.h"
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "objectNamesManager.h"
 
 namespace ogls::oglCore::texture
 {
+namespace
+{
+    /**
+     * \brief Returns the size of the mipmap level in one dimension.
+     */
+    constexpr GLsizei getLevelSize(GLsizei size, GLint level) noexcept
+    {
+        return std::max(size >> level, 1);
+    }
+
+    /**
+     * \brief Calls func(level, pixels, sizeInBytes) for every mipmap level stored in the texture data.
+     * If the data contains only the level 0 without specified size, the size is 0.
+     */
+    template<typename Func>
+    void forEachLevel(const TextureData& textureData, Func&& func)
+    {
+        if (textureData.levelSizes.empty())
+        {
+            func(GLint{0}, textureData.data.get(), GLsizei{0});
+            return;
+        }
+
+        auto offset = size_t{0};
+        for (auto level = size_t{0}; level < textureData.levelSizes.size(); ++level)
+        {
+            func(static_cast<GLint>(level), textureData.data.get() + offset, textureData.levelSizes[level]);
+            offset += static_cast<size_t>(textureData.levelSizes[level]);
+        }
+    }
+
+}  // namespace
+
 BaseTexture::BaseTexture(std::unique_ptr<BaseImpl> impl) noexcept : m_impl{std::move(impl)}
 {
 }
@@ -179,17 +213,13 @@ BaseTexture::BaseImpl::~BaseImpl() noexcept
 
 void BaseTexture::BaseImpl::deleteTexture()
 {
-    OGLS_GLCall(glDeleteTextures(1, &rendererId));
+    objectNamesManager::releaseTextureName(rendererId);
     rendererId = {0};
 }
 
 void BaseTexture::BaseImpl::genTexture()
 {
-    OGLS_GLCall(glCreateTextures(helpers::toUType(target), 1, &rendererId));
-    if (rendererId == 0)
-    {
-        throw exceptions::GLRecAcquisitionException{"Texture cannot be generated."};
-    }
+    rendererId = objectNamesManager::acquireTextureName(target);
 }
 
 void TexDimensionSpecificFunc<1>::setTexImageInTarget(GLuint textureId, std::shared_ptr<TextureData> textureData)
@@ -197,8 +227,22 @@ void TexDimensionSpecificFunc<1>::setTexImageInTarget(GLuint textureId, std::sha
     using namespace helpers;
 
 
-    OGLS_GLCall(glTextureSubImage1D(textureId, 0, 0, textureData->width, toUType(textureData->format),
-                                    toUType(textureData->type), textureData->data.get()));
+    const auto isCompressed = isCompressedFormat(textureData->internalFormat);
+    forEachLevel(*textureData,
+                 [&](GLint level, const unsigned char* pixels, GLsizei size)
+                 {
+                     const auto width = getLevelSize(textureData->width, level);
+                     if (isCompressed)
+                     {
+                         OGLS_GLCall(glCompressedTextureSubImage1D(textureId, level, 0, width,
+                                                                   toUType(textureData->internalFormat), size, pixels));
+                     }
+                     else
+                     {
+                         OGLS_GLCall(glTextureSubImage1D(textureId, level, 0, width, toUType(textureData->format),
+                                                         toUType(textureData->type), pixels));
+                     }
+                 });
 }
 
 void TexDimensionSpecificFunc<1>::setTexStorageFormat(GLuint textureId, const std::shared_ptr<TextureData>& textureData)
@@ -212,8 +256,24 @@ void TexDimensionSpecificFunc<2>::setTexImageInTarget(GLuint textureId, std::sha
     using namespace helpers;
 
 
-    OGLS_GLCall(glTextureSubImage2D(textureId, 0, 0, 0, textureData->width, textureData->height,
-                                    toUType(textureData->format), toUType(textureData->type), textureData->data.get()));
+    const auto isCompressed = isCompressedFormat(textureData->internalFormat);
+    forEachLevel(*textureData,
+                 [&](GLint level, const unsigned char* pixels, GLsizei size)
+                 {
+                     const auto width  = getLevelSize(textureData->width, level);
+                     const auto height = getLevelSize(textureData->height, level);
+                     if (isCompressed)
+                     {
+                         OGLS_GLCall(glCompressedTextureSubImage2D(textureId, level, 0, 0, width, height,
+                                                                   toUType(textureData->internalFormat), size, pixels));
+                     }
+                     else
+                     {
+                         OGLS_GLCall(glTextureSubImage2D(textureId, level, 0, 0, width, height,
+                                                         toUType(textureData->format), toUType(textureData->type),
+                                                         pixels));
+                     }
+                 });
 }
 
 void TexDimensionSpecificFunc<2>::setTexStorageFormat(GLuint textureId, const std::shared_ptr<TextureData>& textureData)
@@ -227,8 +287,25 @@ void TexDimensionSpecificFunc<3>::setTexImageInTarget(GLuint textureId, std::sha
     using namespace helpers;
 
 
-    OGLS_GLCall(glTextureSubImage3D(textureId, 0, 0, 0, 0, textureData->width, textureData->height, textureData->depth,
-                                    toUType(textureData->format), toUType(textureData->type), textureData->data.get()));
+    const auto isCompressed = isCompressedFormat(textureData->internalFormat);
+    forEachLevel(*textureData,
+                 [&](GLint level, const unsigned char* pixels, GLsizei size)
+                 {
+                     const auto width  = getLevelSize(textureData->width, level);
+                     const auto height = getLevelSize(textureData->height, level);
+                     const auto depth  = getLevelSize(textureData->depth, level);
+                     if (isCompressed)
+                     {
+                         OGLS_GLCall(glCompressedTextureSubImage3D(textureId, level, 0, 0, 0, width, height, depth,
+                                                                   toUType(textureData->internalFormat), size, pixels));
+                     }
+                     else
+                     {
+                         OGLS_GLCall(glTextureSubImage3D(textureId, level, 0, 0, 0, width, height, depth,
+                                                         toUType(textureData->format), toUType(textureData->type),
+                                                         pixels));
+                     }
+                 });
 }
 
 void TexDimensionSpecificFunc<3>::setTexStorageFormat(GLuint textureId, const std::shared_ptr<TextureData>& textureData)
@@ -304,7 +381,10 @@ void Texture<DimensionsNumber>::Impl::setData(std::shared_ptr<TextureData> textu
     }
 
     specific.setTexImageInTarget(rendererId, textureData);
-    OGLS_GLCall(glGenerateTextureMipmap(rendererId));
+    if (textureData->levelSizes.empty())
+    {
+        OGLS_GLCall(glGenerateTextureMipmap(rendererId));
+    }
 
     data = std::move(textureData);
 }
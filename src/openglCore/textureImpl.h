@@ -3,6 +3,7 @@
 
 #include "texture.h"
 
+#include "helpers/poolAllocator.h"
 #include "openglHelpersImpl.h"
 
 namespace ogls::oglCore::texture
@@ -30,15 +31,13 @@ class BaseTexture::BaseImpl
         BaseImpl& operator=(BaseImpl&&) noexcept = delete;
 
         /**
-         * \brief Deletes the texture in OpenGL state machine.
+         * \brief Releases the texture, which is deleted, when the GPU completes the current frame.
          *
-         * Wraps [glDeleteTextures()](https://docs.gl/gl4/glDeleteTextures).
+         * \see objectNamesManager::releaseTextureName().
          */
         void deleteTexture();
         /**
-         * \brief Generates new 1 texture in OpenGL state machine.
-         *
-         * Wraps [glCreateTextures()](https://docs.gl/gl4/glCreateTextures).
+         * \brief Takes the name of new 1 texture from objectNamesManager::acquireTextureName().
          *
          * \throw ogls::exceptions::GLRecAcquisitionException().
          */
@@ -73,7 +72,9 @@ class TexDimensionSpecificFunc<1>
 {
     public:
         /**
-         * \brief Wraps [glTextureSubImage1D()](https://docs.gl/gl4/glTexSubImage1D).
+         * \brief Wraps [glTextureSubImage1D()](https://docs.gl/gl4/glTexSubImage1D) or
+         * [glCompressedTextureSubImage1D()](https://docs.gl/gl4/glCompressedTexSubImage1D) for every level
+         * stored in the texture data.
          *
          * \param textureId - rendererId of referenced OpenGL texture.
          */
@@ -92,7 +93,9 @@ class TexDimensionSpecificFunc<2>
 {
     public:
         /**
-         * \brief Wraps [glTextureSubImage2D()](https://docs.gl/gl4/glTexSubImage2D).
+         * \brief Wraps [glTextureSubImage2D()](https://docs.gl/gl4/glTexSubImage2D) or
+         * [glCompressedTextureSubImage2D()](https://docs.gl/gl4/glCompressedTexSubImage2D) for every level
+         * stored in the texture data.
          *
          * \param textureId - rendererId of referenced OpenGL texture.
          */
@@ -111,7 +114,9 @@ class TexDimensionSpecificFunc<3>
 {
     public:
         /**
-         * \brief Wraps [glTextureSubImage3D()](https://docs.gl/gl4/glTexSubImage3D).
+         * \brief Wraps [glTextureSubImage3D()](https://docs.gl/gl4/glTexSubImage3D) or
+         * [glCompressedTextureSubImage3D()](https://docs.gl/gl4/glCompressedTexSubImage3D) for every level
+         * stored in the texture data.
          *
          * \param textureId - rendererId of referenced OpenGL texture.
          */
@@ -165,6 +170,7 @@ class Texture<DimensionsNumber>::Impl : public BaseTexture::BaseImpl
 
         Impl& operator=(const Impl&)     = delete;
         Impl& operator=(Impl&&) noexcept = delete;
+        OGLS_POOL_ALLOCATED(Impl)
 
         /**
          * \see bindToTarget().
@@ -179,7 +185,8 @@ class Texture<DimensionsNumber>::Impl : public BaseTexture::BaseImpl
          * [glTextureSubImage1D()](https://docs.gl/gl4/glTexSubImage1D)
          * ([glTextureSubImage2D()](https://docs.gl/gl4/glTexSubImage2D),
          * [glTextureSubImage3D()](https://docs.gl/gl4/glTexSubImage3D))
-         * and [glGenerateTextureMipmap()](https://docs.gl/gl4/glGenerateMipmap).
+         * and [glGenerateTextureMipmap()](https://docs.gl/gl4/glGenerateMipmap), if the data doesn't contain
+         * precomputed mipmap levels.
          *
          * \param textureData - data, which must be set in OpenGL texture.
          * \see specifyTextureStorageFormat().
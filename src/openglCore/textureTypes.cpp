@@ -28,4 +28,30 @@ TextureData::TextureData(DataType textureData, GLsizei w, GLsizei h, GLsizei d,
     OGLS_ASSERT(l > 0);
 }
 
+bool isCompressedFormat(TextureInternalFormat internalFormat) noexcept
+{
+    switch (internalFormat)
+    {
+        case TextureInternalFormat::CompressedRed:
+        case TextureInternalFormat::CompressedRedRgtc1:
+        case TextureInternalFormat::CompressedRg:
+        case TextureInternalFormat::CompressedRgRgtc2:
+        case TextureInternalFormat::CompressedRgb:
+        case TextureInternalFormat::CompressedRgbBptcSignedFloat:
+        case TextureInternalFormat::CompressedRgbBptcUnsignedFloat:
+        case TextureInternalFormat::CompressedRgbS3tcDxt1Ext:
+        case TextureInternalFormat::CompressedRgba:
+        case TextureInternalFormat::CompressedRgbaBptcUnorm:
+        case TextureInternalFormat::CompressedRgbaS3tcDxt5Ext:
+        case TextureInternalFormat::CompressedSignedRedRgtc1:
+        case TextureInternalFormat::CompressedSignedRgRgtc2:
+        case TextureInternalFormat::CompressedSrgb:
+        case TextureInternalFormat::CompressedSrgbAlpha:
+        case TextureInternalFormat::CompressedSrgbAlphaBptcUnorm:
+            return true;
+        default:
+            return false;
+    }
+}
+
 }  // namespace ogls::oglCore::texture
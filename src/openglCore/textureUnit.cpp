@@ -5,6 +5,7 @@
 
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "helpers/poolAllocator.h"
 #include "openglLimits.h"
 #include "textureImpl.h"
 
@@ -23,6 +24,7 @@ class TextureUnit::Impl
         explicit Impl(GLuint i) noexcept : index{i}
         {
         }
+        OGLS_POOL_ALLOCATED(Impl)
 
     public:
         const GLuint                                          index = {0};
@@ -168,7 +168,8 @@ void MatrixUniform<N, M>::Impl::setData(const DataType& data)
     //
     // If transpose is GL_FALSE, each matrix is assumed to be supplied in column major order.
     // If transpose is GL_TRUE, each matrix is assumed to be supplied in row major order.
-    OGLS_GLCall(setter(location, 1, GL_FALSE, data.getPointerToData()));
+    // mathCore::Matrix stores elements in row major order, so the shader gets the same matrix as getData() returns.
+    OGLS_GLCall(setter(location, 1, GL_TRUE, data.getPointerToData()));
 }
 
 template<typename Type, size_t Count>
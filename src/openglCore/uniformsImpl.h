@@ -5,6 +5,7 @@
 
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "helpers/poolAllocator.h"
 
 namespace ogls::oglCore::shader
 {
@@ -69,6 +70,7 @@ class MatrixUniform<N, M>::Impl : public BaseUniform::BaseImpl
          */
         Impl(GLuint shaderProgram, GLint location, std::string name);
         OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
 
         /**
          * \brief Returns current data, which is stored in OpenGL uniform variable inside the OpenGL state machine.
@@ -119,6 +121,7 @@ class VectorUniform<Type, Count>::Impl : public BaseUniform::BaseImpl
          */
         Impl(GLuint shaderProgram, GLint location, std::string name);
         OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
 
         /**
          * \brief Returns current data, which is stored in OpenGL uniform variable inside the OpenGL state machine.
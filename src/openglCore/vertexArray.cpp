@@ -2,9 +2,10 @@
 #include "vertexArrayImpl.h"
 
 #include "bufferImpl.h"
-#include "exceptions.h"
 #include "helpers/debugHelpers.h"
 #include "helpers/helpers.h"
+#include "objectNamesManager.h"
+#include "pipelineStateImpl.h"
 #include "vertexBufferLayout.h"
 
 namespace ogls::oglCore::vertex
@@ -91,8 +92,17 @@ void VertexArray::addBuffer(std::shared_ptr<Buffer> buffer)
                 case VertexAttrType::UnsignedInt2101010Rev:
                     [[fallthrough]];
                 case VertexAttrType::UnsignedShort:
-                    OGLS_GLCall(glVertexArrayAttribIFormat(m_impl->rendererId, attr.index, attr.count,
-                                                           toUType(attr.type), attr.byteOffset));
+                    // Normalized integers are read by shaders as floats, e.g. packed weights of joints
+                    if (attr.normalized)
+                    {
+                        OGLS_GLCall(glVertexArrayAttribFormat(m_impl->rendererId, attr.index, attr.count,
+                                                              toUType(attr.type), GL_TRUE, attr.byteOffset));
+                    }
+                    else
+                    {
+                        OGLS_GLCall(glVertexArrayAttribIFormat(m_impl->rendererId, attr.index, attr.count,
+                                                               toUType(attr.type), attr.byteOffset));
+                    }
                     break;
                 case VertexAttrType::Float:
                     [[fallthrough]];
@@ -168,22 +178,25 @@ VertexArray::Impl::~Impl() noexcept
 
 void VertexArray::Impl::bindSpecificVao(GLuint vaoId)
 {
+    if (pipeline::pipelineStateManager::isCurrentVertexArray(vaoId))
+    {
+        return;
+    }
+
     OGLS_GLCall(glBindVertexArray(vaoId));
+    pipeline::pipelineStateManager::onVertexArrayBound(vaoId);
 }
 
 void VertexArray::Impl::deleteVertexArray()
 {
-    OGLS_GLCall(glDeleteVertexArrays(1, &rendererId));
+    objectNamesManager::releaseVertexArrayName(rendererId);
+    pipeline::pipelineStateManager::onVertexArrayDeleted(rendererId);
     rendererId = {0};
 }
 
 void VertexArray::Impl::genVertexArray()
 {
-    OGLS_GLCall(glCreateVertexArrays(1, &rendererId));
-    if (rendererId == 0)
-    {
-        throw exceptions::GLRecAcquisitionException{"Vertex array cannot be generated."};
-    }
+    rendererId = objectNamesManager::acquireVertexArrayName();
 }
 
 }  // namespace ogls::oglCore::vertex
@@ -4,6 +4,7 @@
 #include "vertexArray.h"
 
 #include "helpers/macros.h"
+#include "helpers/poolAllocator.h"
 
 namespace ogls::oglCore::vertex
 {
@@ -26,21 +27,20 @@ class VertexArray::Impl
          */
         Impl();
         OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        OGLS_POOL_ALLOCATED(Impl)
         /**
          * \see deleteVertexArray().
          */
         ~Impl() noexcept;
 
         /**
-         * \brief Deletes vertex array object in OpenGL state machine.
+         * \brief Releases vertex array object, which is deleted, when the GPU completes the current frame.
          *
-         * Wraps [glDeleteVertexArrays()](https://docs.gl/gl4/glDeleteVertexArrays).
+         * \see objectNamesManager::releaseVertexArrayName().
          */
         void deleteVertexArray();
         /**
-         * \brief Generates new 1 vertex array object in OpenGL state machine.
-         *
-         * Wraps [glCreateVertexArrays()](https://docs.gl/gl4/glCreateVertexArrays).
+         * \brief Takes the name of new 1 vertex array object from objectNamesManager::acquireVertexArrayName().
          *
          * \throw ogls::exceptions::GLRecAcquisitionException().
          */
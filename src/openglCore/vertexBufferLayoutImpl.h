@@ -3,6 +3,8 @@
 
 #include "vertexBufferLayout.h"
 
+#include "helpers/poolAllocator.h"
+
 namespace ogls::oglCore::vertex
 {
 /**
@@ -16,6 +18,7 @@ class VertexBufferLayout::Impl final
         OGLS_DEFAULT_MOVABLE(Impl)
 
         Impl& operator=(const Impl&) = delete;
+        OGLS_POOL_ALLOCATED(Impl)
 
     public:
         /**
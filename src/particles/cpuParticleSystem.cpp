@@ -0,0 +1,268 @@
+#include "cpuParticleSystem.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "emissionQueue.h"
+#include "helpers/simdLanes.h"
+
+namespace ogls::particles
+{
+namespace
+{
+    /**
+     * \brief Component is the index of the array of one component of particles.
+     *
+     * The order matches the order of values in CpuParticleSystem::Impl::bear().
+     */
+    enum Component : size_t
+    {
+        PositionX,
+        PositionY,
+        PositionZ,
+        VelocityX,
+        VelocityY,
+        VelocityZ,
+        ColorR,
+        ColorG,
+        ColorB,
+        ColorA,
+        /**
+         * \brief The alpha, which the particle loses per second.
+         */
+        FadeRate,
+        /**
+         * \brief The remaining life in seconds.
+         */
+        Life,
+        Size,
+        ComponentsCount
+    };
+
+    size_t alignUp(size_t value, size_t alignment) noexcept;
+
+}  // namespace
+
+class CpuParticleSystem::Impl
+{
+    public:
+        explicit Impl(const CpuParticleSettings& settings) :
+            capacity{settings.capacity}, emissionQueue{settings.emissionQueueCapacity},
+            emissionQueueCapacity{settings.emissionQueueCapacity}, gravity{settings.gravity}
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument{"The capacity of the particle system must be greater than 0."};
+            }
+
+            // Arrays are padded to whole SIMD lanes, so kernels don't have the scalar tail
+            for (auto& component : components)
+            {
+                component.assign(alignUp(capacity, helpers::simd::lanesCount), 0.0f);
+            }
+            chunksHaveDead.assign(alignUp(capacity, chunkSize) / chunkSize, 0);
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        /**
+         * \brief Appends the particle after alive ones, if it fits into the capacity.
+         */
+        void bear(const ParticleSpawn& spawn) noexcept
+        {
+            if (spawn.lifetime <= 0.0f || aliveCount == capacity)
+            {
+                return;
+            }
+
+            const auto values = std::array<float, ComponentsCount>{spawn.position.x(),
+                                                                   spawn.position.y(),
+                                                                   spawn.position.z(),
+                                                                   spawn.velocity.x(),
+                                                                   spawn.velocity.y(),
+                                                                   spawn.velocity.z(),
+                                                                   spawn.color[0],
+                                                                   spawn.color[1],
+                                                                   spawn.color[2],
+                                                                   spawn.color[3],
+                                                                   spawn.color[3] / spawn.lifetime,
+                                                                   spawn.lifetime,
+                                                                   spawn.size};
+            for (auto i = size_t{0}; i < ComponentsCount; ++i)
+            {
+                components[i][aliveCount] = values[i];
+            }
+            ++aliveCount;
+        }
+
+        /**
+         * \brief Integrates particles of the chunk and marks, whether any of them has died.
+         *
+         * Chunks don't share cache lines of arrays except on their borders, so they are integrated in parallel.
+         */
+        void integrate(size_t chunk, float deltaTime) noexcept
+        {
+            using namespace helpers::simd;
+
+
+            const auto begin = chunk * chunkSize;
+            const auto end   = std::min(begin + chunkSize, alignUp(aliveCount, lanesCount));
+
+            const auto dt        = broadcast(deltaTime);
+            const auto gravityDt = std::array{broadcast(gravity.x() * deltaTime), broadcast(gravity.y() * deltaTime),
+                                              broadcast(gravity.z() * deltaTime)};
+            const auto zero      = broadcast(0.0f);
+
+            auto deadBits = uint32_t{0};
+            for (auto i = begin; i < end; i += lanesCount)
+            {
+                for (auto axis = size_t{0}; axis < 3; ++axis)
+                {
+                    const auto velocity = load(&components[VelocityX + axis][i]) + gravityDt[axis];
+                    store(&components[VelocityX + axis][i], velocity);
+                    store(&components[PositionX + axis][i], load(&components[PositionX + axis][i]) + velocity * dt);
+                }
+
+                const auto life = load(&components[Life][i]) - dt;
+                store(&components[Life][i], life);
+                store(&components[ColorA][i], max(load(&components[ColorA][i]) - load(&components[FadeRate][i]) * dt,
+                                                  zero));
+                deadBits |= toBits(greaterOrEqual(zero, life));
+            }
+
+            // Padding lanes after the last alive particle look dead too, it only costs the scan of the chunk
+            chunksHaveDead[chunk] = static_cast<uint8_t>(deadBits != 0);
+        }
+
+        /**
+         * \brief Replaces every dead particle by the last alive one. Chunks without dead particles are skipped.
+         */
+        void removeDead() noexcept
+        {
+            const auto& lives = components[Life];
+
+            auto i = size_t{0};
+            while (i < aliveCount)
+            {
+                if (!chunksHaveDead[i / chunkSize])
+                {
+                    i = (i / chunkSize + 1) * chunkSize;
+                }
+                else if (lives[i] > 0.0f)
+                {
+                    ++i;
+                }
+                else
+                {
+                    // The moved particle can be dead too, so the same index is checked again
+                    --aliveCount;
+                    for (auto& component : components)
+                    {
+                        component[i] = component[aliveCount];
+                    }
+                }
+            }
+        }
+
+    public:
+        size_t                                          aliveCount = {0};
+        const uint32_t                                  capacity;
+        /**
+         * \brief Flags of chunks, which have had dead particles after the last integration. They are bytes instead
+         * of std::vector<bool>, so chunks set them from different threads.
+         */
+        std::vector<uint8_t>                            chunksHaveDead;
+        std::array<std::vector<float>, ComponentsCount> components;
+        EmissionQueue<ParticleSpawn>                    emissionQueue;
+        const uint32_t                                  emissionQueueCapacity;
+        mathCore::Vec3                                  gravity;
+
+};  // class CpuParticleSystem::Impl
+
+CpuParticleSystem::CpuParticleSystem(const CpuParticleSettings& settings) : m_impl{std::make_unique<Impl>(settings)}
+{
+}
+
+CpuParticleSystem::CpuParticleSystem(CpuParticleSystem&& obj) noexcept = default;
+
+CpuParticleSystem::~CpuParticleSystem() noexcept = default;
+
+CpuParticleSystem& CpuParticleSystem::operator=(CpuParticleSystem&& obj) noexcept = default;
+
+bool CpuParticleSystem::emit(const ParticleSpawn& spawn) noexcept
+{
+    return m_impl->emissionQueue.push(spawn);
+}
+
+size_t CpuParticleSystem::getAliveCount() const noexcept
+{
+    return m_impl->aliveCount;
+}
+
+uint32_t CpuParticleSystem::getCapacity() const noexcept
+{
+    return m_impl->capacity;
+}
+
+void CpuParticleSystem::setGravity(const mathCore::Vec3& gravity) noexcept
+{
+    m_impl->gravity = gravity;
+}
+
+void CpuParticleSystem::update(float deltaTime, helpers::ThreadPool& pool)
+{
+    auto&      impl = *m_impl;
+    const auto dt   = std::max(deltaTime, 0.0f);
+
+    if (const auto chunksCount = alignUp(impl.aliveCount, chunkSize) / chunkSize; chunksCount > 0)
+    {
+        pool.parallelFor(chunksCount, [&impl, dt](size_t chunk) { impl.integrate(chunk, dt); });
+    }
+    impl.removeDead();
+
+    // Producers can push while the queue is drained, so at most one queue of particles is born per update
+    auto spawn = ParticleSpawn{};
+    for (auto i = uint32_t{0}; i < impl.emissionQueueCapacity && impl.emissionQueue.pop(spawn); ++i)
+    {
+        impl.bear(spawn);
+    }
+}
+
+size_t CpuParticleSystem::writeVertices(std::span<ParticleVertex> vertices, helpers::ThreadPool& pool) const
+{
+    const auto& impl        = *m_impl;
+    const auto& c           = impl.components;
+    const auto  count       = std::min(impl.aliveCount, vertices.size());
+    const auto  chunksCount = alignUp(count, chunkSize) / chunkSize;
+
+    if (chunksCount == 0)
+    {
+        return 0;
+    }
+
+    // Vertices are written in order and completely, which suits write-combined memory of the mapped buffer
+    pool.parallelFor(chunksCount, [&c, count, vertices](size_t chunk) {
+        const auto end = std::min((chunk + 1) * chunkSize, count);
+        for (auto i = chunk * chunkSize; i < end; ++i)
+        {
+            vertices[i] = ParticleVertex{.positionLife{c[PositionX][i], c[PositionY][i], c[PositionZ][i], c[Life][i]},
+                                         .velocitySize{c[VelocityX][i], c[VelocityY][i], c[VelocityZ][i], c[Size][i]},
+                                         .color{c[ColorR][i], c[ColorG][i], c[ColorB][i], c[ColorA][i]}};
+        }
+    });
+
+    return count;
+}
+
+namespace
+{
+    size_t alignUp(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+}  // namespace
+
+}  // namespace ogls::particles
@@ -0,0 +1,142 @@
+#ifndef OGLS_PARTICLES_EMISSION_QUEUE_H
+#define OGLS_PARTICLES_EMISSION_QUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace ogls::particles
+{
+/**
+ * \brief EmissionQueue is the bounded lock-free queue, to which any threads push values and one thread pops them.
+ *
+ * Every cell has the sequence number, which tells, whether the cell is free for the producer with the same position
+ * or is filled for the consumer with the position greater by 1 (D. Vyukov's bounded queue). Producers reserve
+ * positions by the compare-exchange, the only consumer needs no atomic read-modify-write operations.
+ *
+ * \param Type - the type of values. It must be default constructible and copy assignable.
+ */
+template<typename Type>
+class EmissionQueue final
+{
+    public:
+        /**
+         * \brief Constructs new empty EmissionQueue.
+         *
+         * \param capacity - the maximal number of values in the queue. It must be a power of 2.
+         * \throw std::invalid_argument, if the capacity isn't a power of 2.
+         */
+        explicit EmissionQueue(size_t capacity) : m_cells{std::make_unique<Cell[]>(capacity)}, m_mask{capacity - 1}
+        {
+            if (!std::has_single_bit(capacity))
+            {
+                throw std::invalid_argument{"The capacity of the emission queue must be a power of 2."};
+            }
+
+            for (auto i = size_t{0}; i < capacity; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * \brief Pops the oldest value. It must be called by one thread at a time.
+         *
+         * \param value - the destination of the value.
+         * \return false if the queue is empty, true otherwise.
+         */
+        bool pop(Type& value) noexcept
+        {
+            const auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+            auto&      cell     = m_cells[position & m_mask];
+
+            if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                return false;
+            }
+
+            value = cell.value;
+            // The cell becomes free for the producer, which comes to it on the next lap
+            cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+            m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * \brief Pushes the value. It can be called by any threads concurrently.
+         *
+         * \param value - the value to push.
+         * \return false if the queue is full, true otherwise.
+         */
+        bool push(const Type& value) noexcept
+        {
+            auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+            auto cell     = static_cast<Cell*>(nullptr);
+
+            while (true)
+            {
+                cell                = &m_cells[position & m_mask];
+                const auto sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto diff     = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                if (diff == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // The consumer hasn't freed the cell since the previous lap
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = value;
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        /**
+         * \brief Cell is the slot of the ring buffer.
+         */
+        struct Cell final
+        {
+                std::atomic<size_t> sequence = {0};
+                Type                value;
+
+        };  // struct Cell
+
+    private:
+        /**
+         * \brief The ring buffer.
+         */
+        std::unique_ptr<Cell[]>         m_cells;
+        /**
+         * \brief The position of the next value to pop. It is on its own cache line to avoid false sharing with
+         * producers.
+         */
+        alignas(64) std::atomic<size_t> m_dequeuePosition = {0};
+        /**
+         * \brief The position of the next value to push.
+         */
+        alignas(64) std::atomic<size_t> m_enqueuePosition = {0};
+        /**
+         * \brief capacity - 1, which maps positions onto cells.
+         */
+        const size_t                    m_mask;
+
+};  // class EmissionQueue
+
+}  // namespace ogls::particles
+
+#endif
@@ -0,0 +1,634 @@
+#include "spatialHashGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace ogls::spatial
+{
+namespace
+{
+    /**
+     * \brief Cell is integer coordinates of the cell of the grid.
+     */
+    struct Cell final
+    {
+            int64_t x = {0}, y = {0}, z = {0};
+
+    };  // struct Cell
+
+    /**
+     * \brief CellBounds are the minimal and the maximal cells, which contain points.
+     */
+    struct CellBounds final
+    {
+            Cell max = {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min(),
+                        std::numeric_limits<int64_t>::min()};
+            Cell min = {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::max(),
+                        std::numeric_limits<int64_t>::max()};
+
+    };  // struct CellBounds
+
+    /**
+     * \brief Entry is the point, which is stored in the bucket. The removed point has the identifier invalidIndex.
+     */
+    struct Entry final
+    {
+            float    x = {0.0f}, y = {0.0f}, z = {0.0f};
+            uint32_t id = {0};
+
+    };  // struct Entry
+
+    /**
+     * \brief OverflowEntry is the point, which has been moved into the bucket after the last sorting.
+     */
+    struct OverflowEntry final
+    {
+            Entry    entry;
+            /**
+             * \brief The index of the next entry of the same bucket or invalidIndex.
+             */
+            uint32_t next = {0};
+
+    };  // struct OverflowEntry
+
+    constexpr auto invalidIndex      = std::numeric_limits<uint32_t>::max();
+    /**
+     * \brief The bit of the location of the point, which is set if the point is in the overflow.
+     */
+    constexpr auto overflowBit       = uint32_t{1} << 31;
+    /**
+     * \brief Coordinates of cells are clamped, so the hash and distances between cells don't overflow.
+     */
+    constexpr auto maxCellCoordinate = double{1 << 30};
+    /**
+     * \brief The overflow, which is always considered as short, because its check costs less than the sorting.
+     */
+    constexpr auto minOverflowSize   = size_t{256};
+    constexpr auto minTableSize      = size_t{1024};
+    /**
+     * \brief The maximal number of chunks of points during the sorting. Every chunk has its own counters of all
+     * buckets, so their number limits the memory of the sorting.
+     */
+    constexpr auto maxSortChunks     = size_t{16};
+    /**
+     * \brief The minimal number of points, which are processed by one task of the thread pool during the sorting.
+     */
+    constexpr auto minSortChunkSize  = size_t{16'384};
+
+    float distanceSquared(const Entry& entry, const mathCore::Point& point) noexcept;
+    void  expand(CellBounds& bounds, const Cell& cell) noexcept;
+    void  expand(CellBounds& bounds, const CellBounds& other) noexcept;
+    bool  isEmpty(const CellBounds& bounds) noexcept;
+    void  validateCellSize(float cellSize);
+
+}  // namespace
+
+class SpatialHashGrid::Impl
+{
+    public:
+        explicit Impl(float size) : cellSize{size}, inverseCellSize{1.0f / size}
+        {
+            validateCellSize(size);
+
+            bucketStarts.assign(minTableSize + 1, 0);
+            overflowHeads.assign(minTableSize, invalidIndex);
+            tableMask = static_cast<uint32_t>(minTableSize - 1);
+        }
+
+        OGLS_NOT_COPYABLE_MOVABLE(Impl)
+        ~Impl() noexcept = default;
+
+        void checkId(uint32_t id) const
+        {
+            if (id >= positions.size() || pointBuckets[id] == invalidIndex)
+            {
+                throw std::out_of_range{"There is no point with the identifier in the spatial hash grid."};
+            }
+        }
+
+        /**
+         * \brief Calls func(entry) for every point of the bucket, which isn't removed.
+         */
+        template<typename Func>
+        void forEachInBucket(uint32_t bucket, Func&& func) const
+        {
+            for (auto i = bucketStarts[bucket]; i < bucketStarts[bucket + 1]; ++i)
+            {
+                if (entries[i].id != invalidIndex)
+                {
+                    func(entries[i]);
+                }
+            }
+            for (auto i = overflowHeads[bucket]; i != invalidIndex; i = overflow[i].next)
+            {
+                if (overflow[i].entry.id != invalidIndex)
+                {
+                    func(overflow[i].entry);
+                }
+            }
+        }
+
+        Entry& getEntry(uint32_t id) noexcept
+        {
+            const auto location = locations[id];
+            return (location & overflowBit) != 0 ? overflow[location & ~overflowBit].entry : entries[location];
+        }
+
+        /**
+         * \brief Adds the point at the head of the overflow list of the bucket.
+         */
+        void linkOverflow(uint32_t id, uint32_t bucket)
+        {
+            const auto& position = positions[id];
+            const auto  index    = static_cast<uint32_t>(overflow.size());
+
+            overflow.push_back(
+              OverflowEntry{.entry{position.x, position.y, position.z, id}, .next{overflowHeads[bucket]}});
+            overflowHeads[bucket] = index;
+            locations[id]         = overflowBit | index;
+            pointBuckets[id]      = bucket;
+        }
+
+        /**
+         * \brief Sorts all alive points by buckets with the counting sort and empties the overflow.
+         *
+         * Points are split into chunks, which count their buckets and scatter their points independently.
+         * The exclusive scan over counters of chunks of every bucket gives each chunk its own range in the bucket,
+         * so no atomics are needed and points of the bucket are always sorted by identifiers.
+         */
+        void sort(helpers::ThreadPool& pool)
+        {
+            const auto pointsCount = positions.size();
+            const auto chunksCount = std::clamp((pointsCount + minSortChunkSize - 1) / minSortChunkSize, size_t{1},
+                                                std::min(pool.getThreadsNumber() + 1, maxSortChunks));
+            const auto chunkSize   = (pointsCount + chunksCount - 1) / chunksCount;
+            const auto tableSize   = std::bit_ceil(std::max(2 * aliveCount, minTableSize));
+
+            tableMask = static_cast<uint32_t>(tableSize - 1);
+            bucketStarts.resize(tableSize + 1);
+            overflowHeads.assign(tableSize, invalidIndex);
+            overflow.clear();
+
+            // Counters of the chunk are in its own row, so chunks don't share cache lines
+            auto chunkBounds   = std::vector<CellBounds>(chunksCount);
+            auto chunkCounters = std::vector<uint32_t>(chunksCount * tableSize, 0);
+            pool.parallelFor(chunksCount, [this, &chunkBounds, &chunkCounters, chunkSize, pointsCount,
+                                           tableSize](size_t chunk) {
+                const auto counters = &chunkCounters[chunk * tableSize];
+                const auto end      = std::min((chunk + 1) * chunkSize, pointsCount);
+                for (auto id = chunk * chunkSize; id < end; ++id)
+                {
+                    if (pointBuckets[id] == invalidIndex)
+                    {
+                        continue;
+                    }
+
+                    const auto cell = toCell(positions[id]);
+                    expand(chunkBounds[chunk], cell);
+                    pointBuckets[id] = toBucket(cell);
+                    ++counters[pointBuckets[id]];
+                }
+            });
+
+            // Counters become the first slots of chunks in buckets
+            auto firstSlot = uint32_t{0};
+            for (auto bucket = size_t{0}; bucket < tableSize; ++bucket)
+            {
+                bucketStarts[bucket] = firstSlot;
+                for (auto chunk = size_t{0}; chunk < chunksCount; ++chunk)
+                {
+                    firstSlot += std::exchange(chunkCounters[chunk * tableSize + bucket], firstSlot);
+                }
+            }
+            bucketStarts[tableSize] = firstSlot;
+
+            bounds = CellBounds{};
+            for (const auto& chunk : chunkBounds)
+            {
+                expand(bounds, chunk);
+            }
+
+            entries.resize(aliveCount);
+            pool.parallelFor(chunksCount, [this, &chunkCounters, chunkSize, pointsCount, tableSize](size_t chunk) {
+                const auto slots = &chunkCounters[chunk * tableSize];
+                const auto end   = std::min((chunk + 1) * chunkSize, pointsCount);
+                for (auto id = chunk * chunkSize; id < end; ++id)
+                {
+                    if (pointBuckets[id] == invalidIndex)
+                    {
+                        continue;
+                    }
+
+                    const auto& position = positions[id];
+                    const auto  slot     = slots[pointBuckets[id]]++;
+                    entries[slot]        = Entry{position.x, position.y, position.z, static_cast<uint32_t>(id)};
+                    locations[id]        = slot;
+                }
+            });
+        }
+
+        uint32_t toBucket(const Cell& cell) const noexcept
+        {
+            // Primes of Teschner et al., "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+            const auto hash = static_cast<uint32_t>(cell.x) * 73'856'093u ^ static_cast<uint32_t>(cell.y) * 19'349'663u
+                            ^ static_cast<uint32_t>(cell.z) * 83'492'791u;
+            return hash & tableMask;
+        }
+
+        Cell toCell(const mathCore::Point& point) const noexcept
+        {
+            const auto toCoordinate = [this](float value) {
+                return static_cast<int64_t>(std::clamp(std::floor(double{value} * inverseCellSize), -maxCellCoordinate,
+                                                       maxCellCoordinate));
+            };
+            return Cell{toCoordinate(point.x), toCoordinate(point.y), toCoordinate(point.z)};
+        }
+
+    public:
+        size_t                       aliveCount = {0};
+        /**
+         * \brief The index of the first entry of every bucket in entries and the end of the last bucket.
+         */
+        std::vector<uint32_t>        bucketStarts;
+        CellBounds                   bounds;
+        float                        cellSize = {1.0f};
+        std::vector<Entry>           entries;
+        float                        inverseCellSize = {1.0f};
+        /**
+         * \brief The index of every point in entries or in overflow (with overflowBit).
+         */
+        std::vector<uint32_t>        locations;
+        std::vector<OverflowEntry>   overflow;
+        /**
+         * \brief The index of the first entry of the overflow list of every bucket.
+         */
+        std::vector<uint32_t>        overflowHeads;
+        /**
+         * \brief The bucket of every point or invalidIndex, if the point is removed.
+         */
+        std::vector<uint32_t>        pointBuckets;
+        std::vector<mathCore::Point> positions;
+        uint32_t                     tableMask = {0};
+
+};  // class SpatialHashGrid::Impl
+
+SpatialHashGrid::SpatialHashGrid(float cellSize) : m_impl{std::make_unique<Impl>(cellSize)}
+{
+}
+
+SpatialHashGrid::SpatialHashGrid(SpatialHashGrid&& obj) noexcept = default;
+
+SpatialHashGrid::~SpatialHashGrid() noexcept = default;
+
+SpatialHashGrid& SpatialHashGrid::operator=(SpatialHashGrid&& obj) noexcept = default;
+
+void SpatialHashGrid::compact(helpers::ThreadPool& pool)
+{
+    m_impl->sort(pool);
+}
+
+float SpatialHashGrid::getCellSize() const noexcept
+{
+    return m_impl->cellSize;
+}
+
+size_t SpatialHashGrid::getPointsCount() const noexcept
+{
+    return m_impl->aliveCount;
+}
+
+mathCore::Point SpatialHashGrid::getPosition(uint32_t id) const
+{
+    m_impl->checkId(id);
+    return m_impl->positions[id];
+}
+
+uint32_t SpatialHashGrid::insert(const mathCore::Point& position)
+{
+    auto& impl = *m_impl;
+
+    if (impl.positions.size() >= overflowBit - 1)
+    {
+        throw std::length_error{"There are too many points in the spatial hash grid."};
+    }
+
+    const auto id   = static_cast<uint32_t>(impl.positions.size());
+    const auto cell = impl.toCell(position);
+    impl.positions.push_back(position);
+    impl.pointBuckets.push_back(0);
+    impl.locations.push_back(0);
+    ++impl.aliveCount;
+
+    expand(impl.bounds, cell);
+    impl.linkOverflow(id, impl.toBucket(cell));
+    return id;
+}
+
+bool SpatialHashGrid::needsCompaction() const noexcept
+{
+    const auto& impl = *m_impl;
+
+    return impl.overflow.size() > std::max(minOverflowSize, impl.entries.size() / 8)
+        || impl.aliveCount > impl.overflowHeads.size();
+}
+
+void SpatialHashGrid::queryNearest(const mathCore::Point& center, size_t count, std::vector<uint32_t>& result,
+                                   float maxRadius) const
+{
+    const auto& impl = *m_impl;
+
+    result.clear();
+    if (count == 0 || impl.aliveCount == 0 || !(maxRadius >= 0.0f))
+    {
+        return;
+    }
+
+    const auto centerCell = impl.toCell(center);
+    const auto& [max, min] = impl.bounds;
+
+    // Rings beyond all points and beyond the maximal radius can't contain found points
+    auto lastRing = std::max({centerCell.x - min.x, max.x - centerCell.x, centerCell.y - min.y, max.y - centerCell.y,
+                              centerCell.z - min.z, max.z - centerCell.z});
+    if (std::isfinite(maxRadius))
+    {
+        lastRing = std::min(lastRing, static_cast<int64_t>(std::floor(double{maxRadius} * impl.inverseCellSize)) + 1);
+    }
+
+    // The max-heap of found points, which top is the farthest of them
+    thread_local auto found           = std::vector<std::pair<float, uint32_t>>{};
+    const auto        maxRadiusSquared = maxRadius * maxRadius;
+    found.clear();
+
+    // Different cells can share the bucket, so the point can be met twice and is skipped if it is already found
+    const auto visit = [&center, count, maxRadiusSquared](const Entry& entry) {
+        const auto distance = distanceSquared(entry, center);
+        if (distance > maxRadiusSquared || (found.size() == count && distance >= found.front().first)
+            || std::ranges::any_of(found, [&entry](const auto& point) { return point.second == entry.id; }))
+        {
+            return;
+        }
+
+        found.emplace_back(distance, entry.id);
+        std::ranges::push_heap(found);
+        if (found.size() > count)
+        {
+            std::ranges::pop_heap(found);
+            found.pop_back();
+        }
+    };
+    const auto visitCell = [&impl, &visit](int64_t x, int64_t y, int64_t z) {
+        impl.forEachInBucket(impl.toBucket(Cell{x, y, z}), visit);
+    };
+
+    for (auto ring = int64_t{0}; ring <= lastRing; ++ring)
+    {
+        const auto fromX = std::max(centerCell.x - ring, min.x), toX = std::min(centerCell.x + ring, max.x);
+        const auto fromY = std::max(centerCell.y - ring, min.y), toY = std::min(centerCell.y + ring, max.y);
+        const auto fromZ = std::max(centerCell.z - ring, min.z), toZ = std::min(centerCell.z + ring, max.z);
+
+        // Only cells on the surface of the cube of the ring are visited
+        for (auto x = fromX; x <= toX; ++x)
+        {
+            for (auto y = fromY; y <= toY; ++y)
+            {
+                if (std::abs(x - centerCell.x) == ring || std::abs(y - centerCell.y) == ring)
+                {
+                    for (auto z = fromZ; z <= toZ; ++z)
+                    {
+                        visitCell(x, y, z);
+                    }
+                    continue;
+                }
+
+                if (centerCell.z - ring >= fromZ)
+                {
+                    visitCell(x, y, centerCell.z - ring);
+                }
+                if (ring > 0 && centerCell.z + ring <= toZ)
+                {
+                    visitCell(x, y, centerCell.z + ring);
+                }
+            }
+        }
+
+        // Points of next rings are at least ring cells away from the center
+        const auto nextRingDistance = static_cast<float>(ring) * impl.cellSize;
+        if (found.size() == count && found.front().first <= nextRingDistance * nextRingDistance)
+        {
+            break;
+        }
+    }
+
+    std::ranges::sort_heap(found);
+    result.reserve(found.size());
+    for (const auto& point : found)
+    {
+        result.push_back(point.second);
+    }
+}
+
+void SpatialHashGrid::queryRadius(const mathCore::Point& center, float radius, std::vector<uint32_t>& result) const
+{
+    const auto& impl = *m_impl;
+
+    result.clear();
+    if (impl.aliveCount == 0 || !(radius >= 0.0f))
+    {
+        return;
+    }
+
+    const auto from = impl.toCell(mathCore::Point{center.x - radius, center.y - radius, center.z - radius});
+    const auto to   = impl.toCell(mathCore::Point{center.x + radius, center.y + radius, center.z + radius});
+    const auto& [max, min] = impl.bounds;
+
+    const auto fromX = std::max(from.x, min.x), toX = std::min(to.x, max.x);
+    const auto fromY = std::max(from.y, min.y), toY = std::min(to.y, max.y);
+    const auto fromZ = std::max(from.z, min.z), toZ = std::min(to.z, max.z);
+    if (fromX > toX || fromY > toY || fromZ > toZ)
+    {
+        return;
+    }
+
+    // Different cells can share the bucket, so buckets are deduplicated before points are checked
+    thread_local auto buckets    = std::vector<uint32_t>{};
+    const auto        tableSize  = impl.overflowHeads.size();
+    const auto        cellsCount = static_cast<double>(toX - fromX + 1) * static_cast<double>(toY - fromY + 1)
+                                  * static_cast<double>(toZ - fromZ + 1);
+    buckets.clear();
+    if (cellsCount >= static_cast<double>(tableSize))
+    {
+        buckets.resize(tableSize);
+        std::iota(buckets.begin(), buckets.end(), uint32_t{0});
+    }
+    else
+    {
+        for (auto x = fromX; x <= toX; ++x)
+        {
+            for (auto y = fromY; y <= toY; ++y)
+            {
+                for (auto z = fromZ; z <= toZ; ++z)
+                {
+                    buckets.push_back(impl.toBucket(Cell{x, y, z}));
+                }
+            }
+        }
+        std::ranges::sort(buckets);
+        buckets.erase(std::ranges::unique(buckets).begin(), buckets.end());
+    }
+
+    const auto radiusSquared = radius * radius;
+    for (const auto bucket : buckets)
+    {
+        impl.forEachInBucket(bucket, [&center, radiusSquared, &result](const Entry& entry) {
+            if (distanceSquared(entry, center) <= radiusSquared)
+            {
+                result.push_back(entry.id);
+            }
+        });
+    }
+}
+
+void SpatialHashGrid::rebuild(std::span<const mathCore::Point> positions, helpers::ThreadPool& pool)
+{
+    auto& impl = *m_impl;
+
+    if (positions.size() >= overflowBit)
+    {
+        throw std::length_error{"There are too many points in the spatial hash grid."};
+    }
+
+    impl.positions.assign(positions.begin(), positions.end());
+    impl.pointBuckets.assign(positions.size(), 0);
+    impl.locations.assign(positions.size(), 0);
+    impl.aliveCount = positions.size();
+    impl.sort(pool);
+}
+
+void SpatialHashGrid::remove(uint32_t id)
+{
+    auto& impl = *m_impl;
+
+    impl.checkId(id);
+    impl.getEntry(id).id  = invalidIndex;
+    impl.pointBuckets[id] = invalidIndex;
+    --impl.aliveCount;
+}
+
+void SpatialHashGrid::setCellSize(float cellSize, helpers::ThreadPool& pool)
+{
+    auto& impl = *m_impl;
+
+    validateCellSize(cellSize);
+    impl.cellSize        = cellSize;
+    impl.inverseCellSize = 1.0f / cellSize;
+    impl.sort(pool);
+}
+
+void SpatialHashGrid::update(uint32_t id, const mathCore::Point& position)
+{
+    auto& impl = *m_impl;
+
+    impl.checkId(id);
+
+    const auto cell   = impl.toCell(position);
+    const auto bucket = impl.toBucket(cell);
+    auto&      entry  = impl.getEntry(id);
+    impl.positions[id] = position;
+    expand(impl.bounds, cell);
+
+    if (bucket == impl.pointBuckets[id])
+    {
+        entry.x = position.x;
+        entry.y = position.y;
+        entry.z = position.z;
+        return;
+    }
+
+    // The old entry stays in the old bucket as removed one till the next sorting
+    entry.id = invalidIndex;
+    impl.linkOverflow(id, bucket);
+}
+
+float suggestCellSize(std::span<const mathCore::Point> positions, float pointsPerCell) noexcept
+{
+    if (positions.size() < 2)
+    {
+        return 1.0f;
+    }
+
+    auto min = positions.front(), max = positions.front();
+    for (const auto& position : positions)
+    {
+        min.setCoordinates(std::min(min.x, position.x), std::min(min.y, position.y), std::min(min.z, position.z));
+        max.setCoordinates(std::max(max.x, position.x), std::max(max.y, position.y), std::max(max.z, position.z));
+    }
+
+    const auto extents   = std::array{double{max.x} - min.x, double{max.y} - min.y, double{max.z} - min.z};
+    const auto maxExtent = std::ranges::max(extents);
+    if (!(maxExtent > 0.0) || !std::isfinite(maxExtent))
+    {
+        return 1.0f;
+    }
+
+    // Axes, along which points are spread much less than along the longest one, are considered flat
+    auto volume         = 1.0;
+    auto dimensionCount = 0;
+    for (const auto extent : extents)
+    {
+        if (extent > maxExtent * 1e-3)
+        {
+            volume *= extent;
+            ++dimensionCount;
+        }
+    }
+
+    const auto cellVolume = volume * std::max(double{pointsPerCell}, 1e-3) / static_cast<double>(positions.size());
+    return static_cast<float>(std::pow(cellVolume, 1.0 / dimensionCount));
+}
+
+namespace
+{
+    float distanceSquared(const Entry& entry, const mathCore::Point& point) noexcept
+    {
+        const auto dx = entry.x - point.x;
+        const auto dy = entry.y - point.y;
+        const auto dz = entry.z - point.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    void expand(CellBounds& bounds, const Cell& cell) noexcept
+    {
+        bounds.min = {std::min(bounds.min.x, cell.x), std::min(bounds.min.y, cell.y), std::min(bounds.min.z, cell.z)};
+        bounds.max = {std::max(bounds.max.x, cell.x), std::max(bounds.max.y, cell.y), std::max(bounds.max.z, cell.z)};
+    }
+
+    void expand(CellBounds& bounds, const CellBounds& other) noexcept
+    {
+        if (!isEmpty(other))
+        {
+            expand(bounds, other.min);
+            expand(bounds, other.max);
+        }
+    }
+
+    bool isEmpty(const CellBounds& bounds) noexcept
+    {
+        return bounds.min.x > bounds.max.x;
+    }
+
+    void validateCellSize(float cellSize)
+    {
+        if (!(cellSize > 0.0f) || !std::isfinite(cellSize))
+        {
+            throw std::invalid_argument{"The cell size of the spatial hash grid must be a positive finite number."};
+        }
+    }
+
+}  // namespace
+
+}  // namespace ogls::spatial
@@ -1,5 +1,6 @@
 #include "window.h"
 
+#include <atomic>
 #include <stdexcept>
 
 // clang-format off
@@ -9,12 +10,15 @@
 
 #include "exceptions.h"
 #include "helpers/debugHelpers.h"
+#include "objectNamesManager.h"
+#include "pipelineState.h"
 
 namespace ogls
 {
 namespace
 {
     void windowFramebufferSizeCalback(GLFWwindow* window, int width, int height);
+    void windowRefreshCallback(GLFWwindow* window);
 
 
     auto isTerminated = false;
@@ -47,7 +51,10 @@ class Window::Impl
             }
 
             glfwMakeContextCurrent(tempWindow);
+            // Callbacks can't refer to the private Impl, so they get only the flag of the invalidation
+            glfwSetWindowUserPointer(tempWindow, &isInvalidated);
             glfwSetFramebufferSizeCallback(tempWindow, windowFramebufferSizeCalback);
+            glfwSetWindowRefreshCallback(tempWindow, windowRefreshCallback);
 
             if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress)))
             {
@@ -67,10 +74,14 @@ class Window::Impl
         };
 
     public:
+        /**
+         * \brief Specification whether the window must be redrawn. It can be set from any thread.
+         */
+        std::atomic<bool> isInvalidated = {true};
         /**
          * \brief Pointer to controlled GLFWwindow object.
          */
-        GLFWwindow* window = nullptr;
+        GLFWwindow*       window        = nullptr;
 
 };  // class Window::Impl
 
@@ -83,6 +94,8 @@ Window::~Window() noexcept
 {
     try
     {
+        // OpenGL objects of the application are already destroyed, but names of some of them wait for deletion
+        oglCore::objectNamesManager::shutdown();
         glfwTerminate();
     }
     catch (...)
@@ -97,6 +110,35 @@ bool Window::isGLFWTerminated() noexcept
     return isTerminated;
 }
 
+int Window::getRefreshRate() const
+{
+    // The windowed window has no own monitor, so it is supposed to be shown on the primary one
+    auto monitor = glfwGetWindowMonitor(m_impl->window);
+    if (!monitor)
+    {
+        monitor = glfwGetPrimaryMonitor();
+    }
+
+    const auto videoMode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+    return videoMode ? videoMode->refreshRate : 0;
+}
+
+void Window::invalidate() noexcept
+{
+    m_impl->isInvalidated.store(true, std::memory_order_release);
+    glfwPostEmptyEvent();
+}
+
+void Window::pollEvents()
+{
+    glfwPollEvents();
+}
+
+void Window::setSwapInterval(int interval)
+{
+    glfwSwapInterval(interval);
+}
+
 bool Window::shouldClose() const
 {
     return glfwWindowShouldClose(m_impl->window);
@@ -107,11 +149,37 @@ void Window::swapBuffers()
     glfwSwapBuffers(m_impl->window);
 }
 
+bool Window::takeInvalidation() noexcept
+{
+    return m_impl->isInvalidated.exchange(false, std::memory_order_acq_rel);
+}
+
+void Window::waitEvents(std::chrono::duration<double> timeout)
+{
+    if (timeout.count() > 0.0)
+    {
+        glfwWaitEventsTimeout(timeout.count());
+    }
+    else
+    {
+        glfwPollEvents();
+    }
+}
+
 namespace
 {
     void windowFramebufferSizeCalback(GLFWwindow* window, int width, int height)
     {
-        OGLS_GLCall(glViewport(0, 0, width, height));
+        oglCore::pipeline::pipelineStateManager::setViewport({0, 0, width, height});
+        windowRefreshCallback(window);
+    }
+
+    void windowRefreshCallback(GLFWwindow* window)
+    {
+        if (const auto isInvalidated = static_cast<std::atomic<bool>*>(glfwGetWindowUserPointer(window)))
+        {
+            isInvalidated->store(true, std::memory_order_release);
+        }
     }
 
 }  // namespace
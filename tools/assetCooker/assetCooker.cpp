@@ -0,0 +1,196 @@
+#include "assetCooker.h"
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "assets/binaryMesh.h"
+#include "assets/cookedAsset.h"
+#include "assets/meshImporter.h"
+#include "assets/meshOptimizer.h"
+#include "assets/meshSimplifier.h"
+#include "buildCache.h"
+#include "helpers/assetArchive.h"
+#include "helpers/virtualFileSystem.h"
+#include "shaderPreprocessor.h"
+#include "textureCooker.h"
+
+namespace tools::cooker
+{
+namespace
+{
+    /**
+     * \brief The version of cooking algorithms. It must be increased, when any of them is changed,
+     * so artifacts cooked by the previous version aren't reused.
+     */
+    constexpr auto cookerVersion = uint64_t{2};
+
+    /**
+     * \brief CookedAsset is the result of cooking of one asset.
+     */
+    struct CookedAsset final
+    {
+            std::vector<std::byte>   artifact;
+            std::vector<std::string> dependencies = {};
+
+    };  // struct CookedAsset
+
+    uint64_t                 calculateAssetKey(const std::string& pathToSource,
+                                               const std::vector<std::string>& dependencies, uint64_t settingsHash);
+    CookedAsset              cookAsset(const std::string& pathToSource, const CookerSettings& settings);
+    std::vector<std::string> findSourceAssets(const CookerSettings& settings);
+
+}  // namespace
+
+CookingReport cookAssets(const CookerSettings& settings, ogls::helpers::ThreadPool& pool)
+{
+    using namespace ogls;
+
+
+    const auto sources        = findSourceAssets(settings);
+    const auto settingsValues = std::array{cookerVersion, uint64_t{settings.isTextureCompressionEnabled}};
+    const auto settingsHash   = calculateContentHash(std::as_bytes(std::span{settingsValues}));
+
+    auto cache  = BuildCache{settings.cacheDirectory};
+    auto items  = std::vector<helpers::AssetArchiveItem>(sources.size());
+    auto report = CookingReport{};
+    auto mutex  = std::mutex{};
+
+    pool.parallelFor(sources.size(),
+                     [&](size_t i)
+                     {
+                         const auto& pathToSource = sources[i];
+                         const auto  kind         = assets::getAssetKind(pathToSource);
+
+                         items[i].path        = assets::getCookedAssetPath(pathToSource);
+                         items[i].compression = kind == assets::AssetKind::Mesh || kind == assets::AssetKind::Texture
+                                                  ? helpers::ArchiveCompression::None
+                                                  : helpers::ArchiveCompression::Lz;
+
+                         try
+                         {
+                             const auto oldKey = calculateAssetKey(pathToSource, cache.getDependencies(pathToSource),
+                                                                   settingsHash);
+                             if (auto artifact = cache.findArtifact(pathToSource, oldKey))
+                             {
+                                 items[i].data = std::move(*artifact);
+
+                                 const auto lock = std::scoped_lock{mutex};
+                                 ++report.reusedCount;
+                                 return;
+                             }
+
+                             auto cooked   = cookAsset(pathToSource, settings);
+                             const auto key = calculateAssetKey(pathToSource, cooked.dependencies, settingsHash);
+                             cache.storeArtifact(pathToSource, key, std::move(cooked.dependencies), cooked.artifact);
+                             items[i].data = std::move(cooked.artifact);
+
+                             const auto lock = std::scoped_lock{mutex};
+                             ++report.cookedCount;
+                         }
+                         catch (const std::exception& exc)
+                         {
+                             const auto lock = std::scoped_lock{mutex};
+                             report.errors.push_back(std::format("{}: {}", pathToSource, exc.what()));
+                         }
+                     });
+
+    cache.save();
+    if (report.errors.empty())
+    {
+        helpers::writeAssetArchive(settings.pathToArchive, items);
+    }
+    std::ranges::sort(report.errors);
+
+    return report;
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    uint64_t calculateAssetKey(const std::string& pathToSource, const std::vector<std::string>& dependencies,
+                               uint64_t settingsHash)
+    {
+        const auto& fileSystem = ogls::helpers::getDefaultVirtualFileSystem();
+
+        auto key = calculateContentHash(fileSystem.readFile(pathToSource).getData(), settingsHash);
+        for (const auto& dependency : dependencies)
+        {
+            // The deleted dependency changes the key too, so the asset is cooked again and the error is reported
+            key = calculateContentHash(std::as_bytes(std::span{dependency}), key);
+            if (fileSystem.isFileExist(dependency))
+            {
+                key = calculateContentHash(fileSystem.readFile(dependency).getData(), key);
+            }
+        }
+        return key;
+    }
+
+    CookedAsset cookAsset(const std::string& pathToSource, const CookerSettings& settings)
+    {
+        using namespace ogls;
+
+
+        switch (assets::getAssetKind(pathToSource))
+        {
+            case assets::AssetKind::Mesh:
+            {
+                // Importers and the simplifier run parallelFor(), which mustn't be called from a task
+                // of the cooking pool
+                auto importPool = helpers::ThreadPool{1};
+                auto meshData   = assets::importMeshFile(pathToSource, importPool);
+                assets::optimizeMesh(meshData);
+                assets::buildMeshLods(meshData, {}, importPool);
+                return CookedAsset{.artifact{assets::serializeBinaryMesh(assets::makeMeshDataView(meshData))}};
+            }
+            case assets::AssetKind::Shader:
+            {
+                auto shader = preprocessShader(pathToSource);
+                validateShader(shader.text, pathToSource);
+
+                const auto bytes = std::as_bytes(std::span{shader.text});
+                return CookedAsset{.artifact{bytes.begin(), bytes.end()},
+                                   .dependencies{std::move(shader.dependencies)}};
+            }
+            case assets::AssetKind::Texture:
+                return CookedAsset{.artifact{cookTexture(pathToSource, settings.isTextureCompressionEnabled)}};
+            default:
+            {
+                const auto file  = helpers::getDefaultVirtualFileSystem().readFile(pathToSource);
+                const auto bytes = file.getData();
+                return CookedAsset{.artifact{bytes.begin(), bytes.end()}};
+            }
+        }
+    }
+
+    std::vector<std::string> findSourceAssets(const CookerSettings& settings)
+    {
+        auto result = std::vector<std::string>{};
+        for (const auto& directory : settings.sourceDirectories)
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator{directory})
+            {
+                if (entry.is_regular_file())
+                {
+                    result.push_back(ogls::helpers::normalizeAssetPath(entry.path().lexically_normal().string()));
+                }
+            }
+        }
+
+        // Overlapping source directories mustn't pack the same file twice
+        std::ranges::sort(result);
+        const auto duplicates = std::ranges::unique(result);
+        result.erase(duplicates.begin(), duplicates.end());
+
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace tools::cooker
@@ -0,0 +1,82 @@
+#ifndef TOOLS_COOKER_ASSET_COOKER_H
+#define TOOLS_COOKER_ASSET_COOKER_H
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "helpers/threadPool.h"
+
+/**
+ * \namespace tools::cooker
+ * \brief cooker namespace contains the offline asset cooker, which converts source assets into runtime-ready
+ * artifacts packed into the asset archive.
+ */
+namespace tools::cooker
+{
+/**
+ * \brief CookerSettings defines what and how is cooked.
+ */
+struct CookerSettings final
+{
+        /**
+         * \brief The directory, in which cooked artifacts are kept between runs (see BuildCache).
+         */
+        std::filesystem::path              cacheDirectory              = ".assetCache";
+        /**
+         * \brief Enables compression of textures into BC1/BC3 formats.
+         */
+        bool                               isTextureCompressionEnabled = false;
+        /**
+         * \brief The asset archive to create (see ogls::helpers::writeAssetArchive()).
+         */
+        std::filesystem::path              pathToArchive;
+        /**
+         * \brief Directories with source assets. They must be relative to the working directory, which is
+         * the root folder of the program, because assets are packed by the same paths, by which they are loaded.
+         */
+        std::vector<std::filesystem::path> sourceDirectories;
+
+};  // struct CookerSettings
+
+/**
+ * \brief CookingReport contains results of cookAssets().
+ */
+struct CookingReport final
+{
+        /**
+         * \brief A number of assets cooked during this run.
+         */
+        size_t                   cookedCount = {0};
+        /**
+         * \brief Messages of assets, which failed to be cooked.
+         */
+        std::vector<std::string> errors;
+        /**
+         * \brief A number of assets, artifacts of which are taken from the cache.
+         */
+        size_t                   reusedCount = {0};
+
+};  // struct CookingReport
+
+/**
+ * \brief Cooks all files of source directories and packs them into the asset archive.
+ *
+ * Textures are cooked into *.ogltex with full mipmap chains (optionally block-compressed), meshes are imported,
+ * optimized, simplified into levels of detail and cooked into *.oglmesh, shaders are preprocessed and validated,
+ * and other files are packed as is (see ogls::assets::getCookedAssetPath()). Assets are processed in parallel
+ * on the pool. Only assets, content or dependencies of which were changed since the last run, are cooked again.
+ * The archive isn't written, if any asset has failed, so the runtime never gets a partial archive.
+ *
+ * \param settings - cooking settings.
+ * \param pool     - the pool to process assets.
+ * \return the report.
+ * \throw std::filesystem::filesystem_error, if source directories cannot be traversed.
+ * Exceptions of ogls::helpers::writeAssetArchive() and BuildCache.
+ */
+CookingReport cookAssets(const CookerSettings& settings, ogls::helpers::ThreadPool& pool);
+
+}  // namespace tools::cooker
+
+#endif
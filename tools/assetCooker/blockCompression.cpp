@@ -0,0 +1,262 @@
+#include "blockCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace tools::cooker
+{
+namespace
+{
+    /**
+     * \brief Block is 4x4 RGBA8 pixels row by row.
+     */
+    using Block = std::array<std::array<uint8_t, 4>, 16>;
+
+    void     compressAlphaBlock(const Block& block, std::byte* destination) noexcept;
+    void     compressColorBlock(const Block& block, std::byte* destination) noexcept;
+    Block    fetchBlock(std::span<const uint8_t> pixels, size_t width, size_t height, size_t blockX,
+                        size_t blockY) noexcept;
+    uint16_t packRgb565(const std::array<float, 3>& color) noexcept;
+
+    template<typename CompressFunc>
+    std::vector<std::byte> compressBlocks(std::span<const uint8_t> pixels, size_t width, size_t height,
+                                          size_t blockSize, CompressFunc&& compress)
+    {
+        const auto blocksX = (width + 3) / 4;
+        const auto blocksY = (height + 3) / 4;
+
+        auto result = std::vector<std::byte>(blocksX * blocksY * blockSize);
+        for (auto y = size_t{0}; y < blocksY; ++y)
+        {
+            for (auto x = size_t{0}; x < blocksX; ++x)
+            {
+                compress(fetchBlock(pixels, width, height, x, y), result.data() + (y * blocksX + x) * blockSize);
+            }
+        }
+
+        return result;
+    }
+
+}  // namespace
+
+std::vector<std::byte> compressBc1(std::span<const uint8_t> pixels, size_t width, size_t height)
+{
+    return compressBlocks(pixels, width, height, bc1BlockSize, compressColorBlock);
+}
+
+std::vector<std::byte> compressBc3(std::span<const uint8_t> pixels, size_t width, size_t height)
+{
+    return compressBlocks(pixels, width, height, bc3BlockSize,
+                          [](const Block& block, std::byte* destination)
+                          {
+                              compressAlphaBlock(block, destination);
+                              compressColorBlock(block, destination + bc1BlockSize);
+                          });
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    std::array<float, 3> unpackRgb565(uint16_t color) noexcept
+    {
+        return {static_cast<float>((color >> 11) & 0x1F) * 255.0f / 31.0f,
+                static_cast<float>((color >> 5) & 0x3F) * 255.0f / 63.0f,
+                static_cast<float>(color & 0x1F) * 255.0f / 31.0f};
+    }
+
+    void writeLittleEndian(std::byte* destination, uint64_t value, size_t bytesCount) noexcept
+    {
+        for (auto i = size_t{0}; i < bytesCount; ++i)
+        {
+            destination[i] = static_cast<std::byte>((value >> (i * 8)) & 0xFF);
+        }
+    }
+
+    void compressAlphaBlock(const Block& block, std::byte* destination) noexcept
+    {
+        auto minAlpha = uint8_t{255}, maxAlpha = uint8_t{0};
+        for (const auto& pixel : block)
+        {
+            minAlpha = std::min(minAlpha, pixel[3]);
+            maxAlpha = std::max(maxAlpha, pixel[3]);
+        }
+
+        // alpha0 > alpha1 selects the mode with 6 interpolated values between the endpoints
+        auto palette = std::array<int, 8>{maxAlpha, minAlpha};
+        for (auto i = 1; i < 7; ++i)
+        {
+            palette[static_cast<size_t>(i + 1)] = ((7 - i) * maxAlpha + i * minAlpha) / 7;
+        }
+
+        auto indices = uint64_t{0};
+        if (maxAlpha != minAlpha)
+        {
+            for (auto i = size_t{0}; i < block.size(); ++i)
+            {
+                auto bestIndex = uint64_t{0};
+                auto bestError = std::numeric_limits<int>::max();
+                for (auto k = size_t{0}; k < palette.size(); ++k)
+                {
+                    const auto error = std::abs(palette[k] - block[i][3]);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestIndex = k;
+                    }
+                }
+                indices |= bestIndex << (i * 3);
+            }
+        }
+
+        destination[0] = static_cast<std::byte>(maxAlpha);
+        destination[1] = static_cast<std::byte>(minAlpha);
+        writeLittleEndian(destination + 2, indices, 6);
+    }
+
+    void compressColorBlock(const Block& block, std::byte* destination) noexcept
+    {
+        auto mean = std::array<float, 3>{};
+        for (const auto& pixel : block)
+        {
+            for (auto c = size_t{0}; c < 3; ++c)
+            {
+                mean[c] += static_cast<float>(pixel[c]) / 16.0f;
+            }
+        }
+
+        // The covariance matrix is symmetric, so only 6 values are needed
+        auto covariance = std::array<float, 6>{};
+        for (const auto& pixel : block)
+        {
+            const auto r = static_cast<float>(pixel[0]) - mean[0], g = static_cast<float>(pixel[1]) - mean[1],
+                       b = static_cast<float>(pixel[2]) - mean[2];
+            covariance[0] += r * r;
+            covariance[1] += r * g;
+            covariance[2] += r * b;
+            covariance[3] += g * g;
+            covariance[4] += g * b;
+            covariance[5] += b * b;
+        }
+
+        // The principal axis is found by the power iteration. It starts from the column of the channel with
+        // the largest variance, because a constant start vector can be orthogonal to the axis of anticorrelated
+        // channels
+        const auto row = [&covariance](size_t i)
+        {
+            return i == 0 ? std::array<float, 3>{covariance[0], covariance[1], covariance[2]}
+                 : i == 1 ? std::array<float, 3>{covariance[1], covariance[3], covariance[4]}
+                          : std::array<float, 3>{covariance[2], covariance[4], covariance[5]};
+        };
+        auto axis = covariance[0] >= covariance[3] && covariance[0] >= covariance[5] ? row(0)
+                    : covariance[3] >= covariance[5]                                ? row(1)
+                                                                                     : row(2);
+        for (auto iteration = 0; iteration < 8; ++iteration)
+        {
+            const auto next = std::array<float, 3>{
+              covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+              covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+              covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]};
+            const auto length = std::max({std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+            if (length == 0.0f)
+            {
+                break;
+            }
+            axis = {next[0] / length, next[1] / length, next[2] / length};
+        }
+
+        auto minProjection = std::numeric_limits<float>::max(), maxProjection = std::numeric_limits<float>::lowest();
+        auto minColor = std::array<float, 3>{}, maxColor = std::array<float, 3>{};
+        for (const auto& pixel : block)
+        {
+            const auto color      = std::array<float, 3>{static_cast<float>(pixel[0]), static_cast<float>(pixel[1]),
+                                                         static_cast<float>(pixel[2])};
+            const auto projection = color[0] * axis[0] + color[1] * axis[1] + color[2] * axis[2];
+            if (projection < minProjection)
+            {
+                minProjection = projection;
+                minColor      = color;
+            }
+            if (projection > maxProjection)
+            {
+                maxProjection = projection;
+                maxColor      = color;
+            }
+        }
+
+        auto color0 = packRgb565(maxColor), color1 = packRgb565(minColor);
+        if (color0 < color1)
+        {
+            std::swap(color0, color1);
+        }
+
+        auto indices = uint32_t{0};
+        if (color0 != color1)
+        {
+            // color0 > color1 selects the mode with 2 interpolated colors
+            const auto endpoint0 = unpackRgb565(color0), endpoint1 = unpackRgb565(color1);
+            auto       palette   = std::array<std::array<float, 3>, 4>{endpoint0, endpoint1};
+            for (auto c = size_t{0}; c < 3; ++c)
+            {
+                palette[2][c] = (2.0f * endpoint0[c] + endpoint1[c]) / 3.0f;
+                palette[3][c] = (endpoint0[c] + 2.0f * endpoint1[c]) / 3.0f;
+            }
+
+            for (auto i = size_t{0}; i < block.size(); ++i)
+            {
+                auto bestIndex = uint32_t{0};
+                auto bestError = std::numeric_limits<float>::max();
+                for (auto k = uint32_t{0}; k < palette.size(); ++k)
+                {
+                    auto error = 0.0f;
+                    for (auto c = size_t{0}; c < 3; ++c)
+                    {
+                        const auto delta  = palette[k][c] - static_cast<float>(block[i][c]);
+                        error            += delta * delta;
+                    }
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestIndex = k;
+                    }
+                }
+                indices |= bestIndex << (i * 2);
+            }
+        }
+
+        writeLittleEndian(destination, color0, 2);
+        writeLittleEndian(destination + 2, color1, 2);
+        writeLittleEndian(destination + 4, indices, 4);
+    }
+
+    Block fetchBlock(std::span<const uint8_t> pixels, size_t width, size_t height, size_t blockX,
+                     size_t blockY) noexcept
+    {
+        auto result = Block{};
+        for (auto y = size_t{0}; y < 4; ++y)
+        {
+            for (auto x = size_t{0}; x < 4; ++x)
+            {
+                const auto sourceX = std::min(blockX * 4 + x, width - 1);
+                const auto sourceY = std::min(blockY * 4 + y, height - 1);
+                std::copy_n(pixels.begin() + static_cast<ptrdiff_t>((sourceY * width + sourceX) * 4), 4,
+                            result[y * 4 + x].begin());
+            }
+        }
+        return result;
+    }
+
+    uint16_t packRgb565(const std::array<float, 3>& color) noexcept
+    {
+        const auto quantize = [](float value, float maxValue)
+        {
+            return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 255.0f) * maxValue / 255.0f));
+        };
+        return static_cast<uint16_t>((quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5)
+                                     | quantize(color[2], 31.0f));
+    }
+
+}  // namespace
+
+}  // namespace tools::cooker
@@ -0,0 +1,45 @@
+#ifndef TOOLS_COOKER_BLOCK_COMPRESSION_H
+#define TOOLS_COOKER_BLOCK_COMPRESSION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace tools::cooker
+{
+/**
+ * \brief The size in bytes of the BC1 (DXT1) block of 4x4 pixels.
+ */
+constexpr auto bc1BlockSize = size_t{8};
+/**
+ * \brief The size in bytes of the BC3 (DXT5) block of 4x4 pixels.
+ */
+constexpr auto bc3BlockSize = size_t{16};
+
+/**
+ * \brief Compresses the RGBA8 image into BC1 blocks. The alpha channel is ignored.
+ *
+ * The endpoints of every block are the extremes of pixels projected onto the principal axis of their colors,
+ * so gradients are kept much better than with the endpoints taken from the bounding box.
+ *
+ * \param pixels - RGBA8 pixels of the image row by row.
+ * \param width  - the width of the image.
+ * \param height - the height of the image.
+ * \return blocks in the order of rows of blocks. Blocks on the edges are padded by repeating edge pixels.
+ */
+std::vector<std::byte> compressBc1(std::span<const uint8_t> pixels, size_t width, size_t height);
+/**
+ * \brief Compresses the RGBA8 image into BC3 blocks: the interpolated alpha block followed by the BC1 color block.
+ *
+ * \param pixels - RGBA8 pixels of the image row by row.
+ * \param width  - the width of the image.
+ * \param height - the height of the image.
+ * \return blocks in the order of rows of blocks. Blocks on the edges are padded by repeating edge pixels.
+ */
+std::vector<std::byte> compressBc3(std::span<const uint8_t> pixels, size_t width, size_t height);
+
+}  // namespace tools::cooker
+
+#endif
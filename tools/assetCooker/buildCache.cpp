@@ -0,0 +1,213 @@
+#include "buildCache.h"
+
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "exceptions.h"
+#include "helpers/assetArchive.h"
+
+namespace tools::cooker
+{
+namespace
+{
+    /**
+     * \brief The first line of the manifest. The cache is discarded, if the format of the manifest is changed.
+     */
+    constexpr decltype(auto) manifestSignature = "OGLS asset cache 1";
+    constexpr decltype(auto) manifestFileName  = "manifest.txt";
+
+    /**
+     * \brief CacheEntry is a record of the manifest.
+     */
+    struct CacheEntry final
+    {
+            std::vector<std::string> dependencies;
+            uint64_t                 key = {0};
+
+    };  // struct CacheEntry
+
+    std::unordered_map<std::string, CacheEntry> readManifest(const std::filesystem::path& pathToManifest);
+
+}  // namespace
+
+class BuildCache::Impl
+{
+    public:
+        explicit Impl(const std::filesystem::path& cacheDirectory) : directory{cacheDirectory}
+        {
+            std::filesystem::create_directories(directory);
+            oldEntries = readManifest(directory / manifestFileName);
+        }
+
+        std::filesystem::path getPathToArtifact(const std::string& pathToSource) const
+        {
+            return directory / std::format("{:016x}.bin", ogls::helpers::calculateAssetPathHash(pathToSource));
+        }
+
+    public:
+        /**
+         * \brief The cache directory.
+         */
+        std::filesystem::path                       directory;
+        /**
+         * \brief Protects newEntries.
+         */
+        std::mutex                                  mutex;
+        /**
+         * \brief Entries found or stored during this build.
+         */
+        std::unordered_map<std::string, CacheEntry> newEntries;
+        /**
+         * \brief Entries of the manifest of the last build.
+         */
+        std::unordered_map<std::string, CacheEntry> oldEntries;
+
+};  // class BuildCache::Impl
+
+BuildCache::BuildCache(const std::filesystem::path& directory) : m_impl{std::make_unique<Impl>(directory)}
+{
+}
+
+BuildCache::~BuildCache() noexcept = default;
+
+std::optional<std::vector<std::byte>> BuildCache::findArtifact(const std::string& pathToSource, uint64_t key)
+{
+    const auto entry = m_impl->oldEntries.find(pathToSource);
+    if (entry == m_impl->oldEntries.end() || entry->second.key != key)
+    {
+        return std::nullopt;
+    }
+
+    auto file = std::ifstream{m_impl->getPathToArtifact(pathToSource), std::ios_base::binary | std::ios_base::ate};
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    auto artifact = std::vector<std::byte>(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(artifact.data()), static_cast<std::streamsize>(artifact.size()));
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    const auto lock = std::scoped_lock{m_impl->mutex};
+    m_impl->newEntries.insert_or_assign(pathToSource, entry->second);
+
+    return artifact;
+}
+
+std::vector<std::string> BuildCache::getDependencies(const std::string& pathToSource) const
+{
+    const auto entry = m_impl->oldEntries.find(pathToSource);
+    return entry == m_impl->oldEntries.end() ? std::vector<std::string>{} : entry->second.dependencies;
+}
+
+void BuildCache::save()
+{
+    const auto pathToManifest = m_impl->directory / manifestFileName;
+
+    auto manifest = std::ofstream{pathToManifest, std::ios_base::trunc};
+    manifest << manifestSignature << '\n';
+    for (const auto& [pathToSource, entry] : m_impl->newEntries)
+    {
+        manifest << std::format("{:016x}\t{}", entry.key, pathToSource);
+        for (const auto& dependency : entry.dependencies)
+        {
+            manifest << '\t' << dependency;
+        }
+        manifest << '\n';
+    }
+
+    if (!manifest)
+    {
+        const auto excMes = std::format("Cannot write the cache manifest at path {}.", pathToManifest.string());
+        throw ogls::exceptions::FileWritingException{excMes};
+    }
+
+    // Artifacts of deleted assets are pruned, so the cache doesn't grow forever
+    for (const auto& [pathToSource, entry] : m_impl->oldEntries)
+    {
+        if (!m_impl->newEntries.contains(pathToSource))
+        {
+            auto errorCode = std::error_code{};
+            std::filesystem::remove(m_impl->getPathToArtifact(pathToSource), errorCode);
+        }
+    }
+}
+
+void BuildCache::storeArtifact(const std::string& pathToSource, uint64_t key, std::vector<std::string> dependencies,
+                               std::span<const std::byte> artifact)
+{
+    const auto pathToArtifact = m_impl->getPathToArtifact(pathToSource);
+
+    auto file = std::ofstream{pathToArtifact, std::ios_base::binary | std::ios_base::trunc};
+    file.write(reinterpret_cast<const char*>(artifact.data()), static_cast<std::streamsize>(artifact.size()));
+    if (!file)
+    {
+        const auto excMes = std::format("Cannot write the cached artifact at path {}.", pathToArtifact.string());
+        throw ogls::exceptions::FileWritingException{excMes};
+    }
+
+    const auto lock = std::scoped_lock{m_impl->mutex};
+    m_impl->newEntries.insert_or_assign(pathToSource, CacheEntry{.dependencies{std::move(dependencies)}, .key{key}});
+}
+
+uint64_t calculateContentHash(std::span<const std::byte> data, uint64_t seed) noexcept
+{
+    for (const auto byte : data)
+    {
+        seed ^= static_cast<uint8_t>(byte);
+        seed *= 0x01'00'00'00'01'B3;
+    }
+    return seed;
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    std::unordered_map<std::string, CacheEntry> readManifest(const std::filesystem::path& pathToManifest)
+    {
+        auto result   = std::unordered_map<std::string, CacheEntry>{};
+        auto manifest = std::ifstream{pathToManifest};
+
+        auto line = std::string{};
+        if (!std::getline(manifest, line) || line != manifestSignature)
+        {
+            return result;
+        }
+
+        while (std::getline(manifest, line))
+        {
+            auto fields = std::vector<std::string>{};
+            for (auto rest = std::string_view{line}; !rest.empty();)
+            {
+                const auto fieldEnd = rest.find('\t');
+                fields.emplace_back(rest.substr(0, fieldEnd));
+                rest.remove_prefix(fieldEnd == std::string_view::npos ? rest.size() : fieldEnd + 1);
+            }
+
+            auto entry = CacheEntry{};
+            if (fields.size() < 2
+                || std::from_chars(fields[0].data(), fields[0].data() + fields[0].size(), entry.key, 16).ec
+                     != std::errc{})
+            {
+                // The malformed manifest only makes assets to be cooked again
+                return {};
+            }
+            entry.dependencies.assign(fields.begin() + 2, fields.end());
+            result.insert_or_assign(std::move(fields[1]), std::move(entry));
+        }
+
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace tools::cooker
@@ -0,0 +1,93 @@
+#ifndef TOOLS_COOKER_BUILD_CACHE_H
+#define TOOLS_COOKER_BUILD_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "helpers/macros.h"
+
+namespace tools::cooker
+{
+/**
+ * \brief BuildCache keeps cooked artifacts between runs of the cooker, so only changed assets are cooked again.
+ *
+ * Every artifact is stored in its own file of the cache directory and is identified by the key, which is the hash
+ * of the content of the source file, of its dependencies and of cooking settings. The manifest records keys and
+ * dependencies of the last build. Artifacts can be found and stored concurrently from any number of threads.
+ */
+class BuildCache final
+{
+    private:
+        /**
+         * \brief Impl contains private data and methods of BuildCache.
+         */
+        class Impl;
+
+    public:
+        /**
+         * \brief Loads the manifest of the cache. A missing or malformed manifest means the empty cache.
+         *
+         * \param directory - the cache directory. It is created if it doesn't exist.
+         * \throw std::filesystem::filesystem_error, if the directory cannot be created.
+         */
+        explicit BuildCache(const std::filesystem::path& directory);
+        OGLS_NOT_COPYABLE_MOVABLE(BuildCache)
+        ~BuildCache() noexcept;
+
+        /**
+         * \brief Returns the artifact of the source asset, if it was cooked with the same key.
+         * The artifact is kept in the cache by save().
+         *
+         * \param pathToSource - the normalized path to the source asset.
+         * \param key          - the key of the current content of the asset.
+         */
+        std::optional<std::vector<std::byte>> findArtifact(const std::string& pathToSource, uint64_t key);
+        /**
+         * \brief Returns dependencies of the source asset recorded by the last build.
+         */
+        std::vector<std::string>              getDependencies(const std::string& pathToSource) const;
+        /**
+         * \brief Saves the manifest and removes artifacts of assets, which weren't found or stored during this build.
+         *
+         * \throw ogls::exceptions::FileWritingException().
+         */
+        void                                  save();
+        /**
+         * \brief Stores the artifact of the source asset.
+         *
+         * \param pathToSource - the normalized path to the source asset.
+         * \param key          - the key of the content of the asset.
+         * \param dependencies - paths of files, which the artifact depends on.
+         * \param artifact     - the content of the artifact.
+         * \throw ogls::exceptions::FileWritingException().
+         */
+        void                                  storeArtifact(const std::string& pathToSource, uint64_t key,
+                                                            std::vector<std::string>   dependencies,
+                                                            std::span<const std::byte> artifact);
+
+    private:
+        /**
+         * \brief Pointer to implementation.
+         */
+        std::unique_ptr<Impl> m_impl;
+
+};  // class BuildCache
+
+/**
+ * \brief Mixes the content into the 64-bit FNV-1a hash.
+ *
+ * \param data - the content to hash.
+ * \param seed - the hash to continue.
+ * \return the updated hash.
+ */
+uint64_t calculateContentHash(std::span<const std::byte> data, uint64_t seed = 0xCB'F2'9C'E4'84'22'23'25) noexcept;
+
+}  // namespace tools::cooker
+
+#endif
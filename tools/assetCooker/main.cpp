@@ -0,0 +1,90 @@
+#include <charconv>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string_view>
+
+#include "assetCooker.h"
+
+namespace
+{
+constexpr decltype(auto) USAGE =
+  "Usage: OpenGL_Study_AssetCooker <output.ogla> <sourceDir>... [--cache <dir>] [--compress-textures] "
+  "[--threads <N>]\n"
+  "Source directories must be relative to the root folder of the program.";
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    using namespace tools::cooker;
+
+
+    auto settings      = CookerSettings{};
+    auto threadsNumber = size_t{0};
+    for (auto i = 1; i < argc; ++i)
+    {
+        const auto argument = std::string_view{argv[i]};
+        if (argument == "--cache" && i + 1 < argc)
+        {
+            settings.cacheDirectory = argv[++i];
+        }
+        else if (argument == "--compress-textures")
+        {
+            settings.isTextureCompressionEnabled = true;
+        }
+        else if (argument == "--threads" && i + 1 < argc)
+        {
+            const auto value = std::string_view{argv[++i]};
+            if (std::from_chars(value.data(), value.data() + value.size(), threadsNumber).ec != std::errc{})
+            {
+                std::cerr << USAGE << std::endl;
+                return -1;
+            }
+        }
+        else if (argument.starts_with("--"))
+        {
+            std::cerr << USAGE << std::endl;
+            return -1;
+        }
+        else if (settings.pathToArchive.empty())
+        {
+            settings.pathToArchive = argument;
+        }
+        else
+        {
+            settings.sourceDirectories.emplace_back(argument);
+        }
+    }
+
+    if (settings.pathToArchive.empty() || settings.sourceDirectories.empty())
+    {
+        std::cerr << USAGE << std::endl;
+        return -1;
+    }
+
+    // The calling thread participates in parallelFor(), so one thread less is started
+    auto pool = std::unique_ptr<ogls::helpers::ThreadPool>{};
+    if (threadsNumber > 0)
+    {
+        pool = std::make_unique<ogls::helpers::ThreadPool>(threadsNumber - 1);
+    }
+
+    try
+    {
+        const auto report = cookAssets(settings, pool ? *pool : ogls::helpers::getDefaultThreadPool());
+        for (const auto& error : report.errors)
+        {
+            std::cerr << error << std::endl;
+        }
+        std::cout << report.cookedCount << " cooked, " << report.reusedCount << " up-to-date, "
+                  << report.errors.size() << " failed." << std::endl;
+
+        return report.errors.empty() ? 0 : -2;
+    }
+    catch (const std::exception& exc)
+    {
+        std::cerr << exc.what() << std::endl;
+        return -3;
+    }
+}
@@ -0,0 +1,169 @@
+#include "shaderPreprocessor.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+
+#include "helpers/assetArchive.h"
+#include "helpers/helpers.h"
+
+namespace tools::cooker
+{
+namespace
+{
+    void        appendPreprocessed(const std::string& pathToFile, bool isIncluded, PreprocessedShader& result,
+                                   std::vector<std::string>& includeStack);
+    std::string stripComments(std::string_view text, std::string_view pathToFile);
+
+}  // namespace
+
+PreprocessedShader preprocessShader(const std::string& pathToSource)
+{
+    auto result       = PreprocessedShader{};
+    auto includeStack = std::vector<std::string>{};
+    appendPreprocessed(ogls::helpers::normalizeAssetPath(pathToSource), false, result, includeStack);
+
+    std::ranges::sort(result.dependencies);
+    const auto duplicates = std::ranges::unique(result.dependencies);
+    result.dependencies.erase(duplicates.begin(), duplicates.end());
+
+    return result;
+}
+
+void validateShader(std::string_view text, std::string_view pathToSource)
+{
+    const auto throwInvalid = [pathToSource](std::string_view description)
+    {
+        throw std::invalid_argument{std::format("The shader {} is invalid: {}.", pathToSource, description)};
+    };
+
+    // *.glsl files are libraries included by other shaders, so they don't have #version and main()
+    const auto isLibrary = pathToSource.ends_with(".glsl");
+
+    const auto firstToken = text.find_first_not_of(" \t\r\n");
+    if (!isLibrary && (firstToken == std::string_view::npos || !text.substr(firstToken).starts_with("#version")))
+    {
+        throwInvalid("#version must be the first directive");
+    }
+
+    auto brackets = std::string{};
+    for (const auto c : text)
+    {
+        if (c == '(' || c == '[' || c == '{')
+        {
+            brackets.push_back(c);
+        }
+        else if (c == ')' || c == ']' || c == '}')
+        {
+            const auto opening = c == ')' ? '(' : c == ']' ? '[' : '{';
+            if (brackets.empty() || brackets.back() != opening)
+            {
+                throwInvalid(std::format("unbalanced '{}'", c));
+            }
+            brackets.pop_back();
+        }
+    }
+    if (!brackets.empty())
+    {
+        throwInvalid(std::format("unclosed '{}'", brackets.back()));
+    }
+
+    if (!isLibrary && text.find("main") == std::string_view::npos)
+    {
+        throwInvalid("main() is not defined");
+    }
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    void appendPreprocessed(const std::string& pathToFile, bool isIncluded, PreprocessedShader& result,
+                            std::vector<std::string>& includeStack)
+    {
+        if (std::ranges::find(includeStack, pathToFile) != includeStack.end())
+        {
+            throw std::invalid_argument{std::format("The shader {} is included cyclically.", pathToFile)};
+        }
+        includeStack.push_back(pathToFile);
+
+        const auto text      = stripComments(ogls::helpers::readTextFromFile(pathToFile), pathToFile);
+        const auto directory = std::filesystem::path{pathToFile}.parent_path();
+
+        auto lineNumber = size_t{0};
+        for (auto rest = std::string_view{text}; !rest.empty();)
+        {
+            const auto lineEnd = rest.find('\n');
+            const auto line    = rest.substr(0, lineEnd);
+            rest.remove_prefix(lineEnd == std::string_view::npos ? rest.size() : lineEnd + 1);
+            ++lineNumber;
+
+            auto directive = line.substr(std::min(line.find_first_not_of(" \t"), line.size()));
+            if (isIncluded && directive.starts_with("#version"))
+            {
+                throw std::invalid_argument{std::format("The included shader {} has #version directive.", pathToFile)};
+            }
+            if (!directive.starts_with("#include"))
+            {
+                result.text.append(line);
+                result.text.push_back('\n');
+                continue;
+            }
+
+            directive.remove_prefix(std::string_view{"#include"}.size());
+            const auto pathBegin = directive.find('"');
+            const auto pathEnd   = directive.find('"', pathBegin + 1);
+            if (pathBegin == std::string_view::npos || pathEnd == std::string_view::npos)
+            {
+                throw std::invalid_argument{
+                  std::format("The #include directive at {}:{} is malformed.", pathToFile, lineNumber)};
+            }
+
+            const auto includedPath = ogls::helpers::normalizeAssetPath(
+              (directory / directive.substr(pathBegin + 1, pathEnd - pathBegin - 1)).lexically_normal().string());
+            result.dependencies.push_back(includedPath);
+            appendPreprocessed(includedPath, true, result, includeStack);
+
+            // The source string number is 0, because the shader is compiled from one string
+            result.text.append(std::format("#line {} 0\n", lineNumber + 1));
+        }
+
+        includeStack.pop_back();
+    }
+
+    std::string stripComments(std::string_view text, std::string_view pathToFile)
+    {
+        auto result = std::string{};
+        result.reserve(text.size());
+
+        for (auto i = size_t{0}; i < text.size(); ++i)
+        {
+            if (text.substr(i).starts_with("//"))
+            {
+                i = std::min(text.find('\n', i), text.size()) - 1;
+            }
+            else if (text.substr(i).starts_with("/*"))
+            {
+                const auto end = text.find("*/", i + 2);
+                if (end == std::string_view::npos)
+                {
+                    throw std::invalid_argument{std::format("The shader {} has unterminated comment.", pathToFile)};
+                }
+                result.append(static_cast<size_t>(std::count(text.begin() + static_cast<ptrdiff_t>(i),
+                                                             text.begin() + static_cast<ptrdiff_t>(end), '\n')),
+                              '\n');
+                i = end + 1;
+            }
+            else if (text[i] != '\r')
+            {
+                result.push_back(text[i]);
+            }
+        }
+
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace tools::cooker
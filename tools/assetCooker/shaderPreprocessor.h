@@ -0,0 +1,53 @@
+#ifndef TOOLS_COOKER_SHADER_PREPROCESSOR_H
+#define TOOLS_COOKER_SHADER_PREPROCESSOR_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tools::cooker
+{
+/**
+ * \brief PreprocessedShader is the GLSL source with resolved includes.
+ */
+struct PreprocessedShader final
+{
+        /**
+         * \brief Paths of all included files. The content of the shader depends on them.
+         */
+        std::vector<std::string> dependencies;
+        /**
+         * \brief The text of the shader.
+         */
+        std::string              text;
+
+};  // struct PreprocessedShader
+
+/**
+ * \brief Strips comments and resolves #include "path" directives (relative to the including file) of GLSL source.
+ *
+ * Newlines of comments are kept and #line directives are inserted after included files, so line numbers
+ * in messages of the driver's compiler still refer to the source file.
+ *
+ * \param pathToSource - a path to the shader.
+ * \return the preprocessed shader.
+ * \throw std::invalid_argument, if includes are cyclic or the included file has #version directive.
+ * Exceptions of ogls::helpers::readTextFromFile().
+ */
+PreprocessedShader preprocessShader(const std::string& pathToSource);
+/**
+ * \brief Validates the structure of the preprocessed shader: brackets must be balanced, and shaders of pipeline
+ * stages must start with #version directive and define main(). *.glsl files are treated as libraries.
+ *
+ * The cooker doesn't have an OpenGL context, so the validation catches broken files early,
+ * while the driver still compiles shaders at runtime.
+ *
+ * \param text         - the preprocessed text of the shader.
+ * \param pathToSource - a path to the shader, which is used in messages.
+ * \throw std::invalid_argument, if the shader is malformed.
+ */
+void               validateShader(std::string_view text, std::string_view pathToSource);
+
+}  // namespace tools::cooker
+
+#endif
@@ -0,0 +1,161 @@
+#include "textureCooker.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
+#include "assets/binaryTexture.h"
+#include "blockCompression.h"
+#include "helpers/helpers.h"
+
+namespace tools::cooker
+{
+namespace
+{
+    /**
+     * \brief Level is RGBA8 pixels of one mipmap level.
+     */
+    struct Level final
+    {
+            size_t               height = {0};
+            std::vector<uint8_t> pixels;
+            size_t               width  = {0};
+
+    };  // struct Level
+
+    Level convertToRgba8(const ogls::oglCore::texture::TextureData& image);
+    Level downsample(const Level& level);
+
+}  // namespace
+
+std::unique_ptr<ogls::oglCore::texture::TextureData> buildTextureLevels(
+  const ogls::oglCore::texture::TextureData& image, bool isCompressionEnabled)
+{
+    using namespace ogls::oglCore::texture;
+
+
+    auto levels = std::vector<Level>{};
+    levels.push_back(convertToRgba8(image));
+    while (levels.back().width > 1 || levels.back().height > 1)
+    {
+        levels.push_back(downsample(levels.back()));
+    }
+
+    auto isOpaque = true;
+    for (auto i = size_t{3}; i < levels.front().pixels.size() && isOpaque; i += 4)
+    {
+        isOpaque = levels.front().pixels[i] == 255;
+    }
+
+    auto internalFormat = TextureInternalFormat::Rgba8;
+    auto storedLevels   = std::vector<std::vector<std::byte>>{};
+    for (const auto& level : levels)
+    {
+        if (!isCompressionEnabled)
+        {
+            const auto bytes = std::as_bytes(std::span{level.pixels});
+            storedLevels.emplace_back(bytes.begin(), bytes.end());
+        }
+        else if (isOpaque)
+        {
+            internalFormat = TextureInternalFormat::CompressedRgbS3tcDxt1Ext;
+            storedLevels.push_back(compressBc1(level.pixels, level.width, level.height));
+        }
+        else
+        {
+            internalFormat = TextureInternalFormat::CompressedRgbaS3tcDxt5Ext;
+            storedLevels.push_back(compressBc3(level.pixels, level.width, level.height));
+        }
+    }
+
+    auto levelSizes = std::vector<GLsizei>{};
+    auto dataSize   = size_t{0};
+    for (const auto& storedLevel : storedLevels)
+    {
+        levelSizes.push_back(static_cast<GLsizei>(storedLevel.size()));
+        dataSize += storedLevel.size();
+    }
+
+    auto data   = TextureData::DataType{new unsigned char[dataSize], [](unsigned char* ptr) { delete[] ptr; }};
+    auto offset = size_t{0};
+    for (const auto& storedLevel : storedLevels)
+    {
+        std::memcpy(data.get() + offset, storedLevel.data(), storedLevel.size());
+        offset += storedLevel.size();
+    }
+
+    auto result = std::make_unique<TextureData>(
+      std::move(data), static_cast<GLsizei>(levels.front().width), static_cast<GLsizei>(levels.front().height), 1,
+      4, static_cast<GLint>(levels.size()), TexturePixelFormat::Rgba, internalFormat, TexturePixelType::UnsignedByte);
+    result->levelSizes = std::move(levelSizes);
+
+    return result;
+}
+
+std::vector<std::byte> cookTexture(const std::string& pathToSource, bool isCompressionEnabled)
+{
+    const auto image = ogls::helpers::readTextureFromFile(pathToSource);
+    return ogls::assets::serializeBinaryTexture(*buildTextureLevels(*image, isCompressionEnabled));
+}
+
+//------ IMPLEMENTATION
+
+namespace
+{
+    Level convertToRgba8(const ogls::oglCore::texture::TextureData& image)
+    {
+        const auto channels = static_cast<size_t>(image.nChannels);
+        if (channels < 1 || channels > 4)
+        {
+            throw std::invalid_argument{"The image has unsupported number of channels."};
+        }
+
+        auto result = Level{.height{static_cast<size_t>(image.height)},
+                            .pixels = std::vector<uint8_t>(static_cast<size_t>(image.width * image.height) * 4),
+                            .width{static_cast<size_t>(image.width)}};
+
+        const auto source = image.data.get();
+        for (auto i = size_t{0}; i < result.width * result.height; ++i)
+        {
+            // Missing green and blue are 0 and missing alpha is 255 as for Red and Rg pixel formats
+            auto pixel = std::array<uint8_t, 4>{0, 0, 0, 255};
+            std::copy_n(source + i * channels, channels, pixel.begin());
+            std::ranges::copy(pixel, result.pixels.begin() + static_cast<ptrdiff_t>(i * 4));
+        }
+
+        return result;
+    }
+
+    Level downsample(const Level& level)
+    {
+        const auto width  = std::max(level.width / 2, size_t{1});
+        const auto height = std::max(level.height / 2, size_t{1});
+
+        auto result = Level{.height{height}, .pixels = std::vector<uint8_t>(width * height * 4), .width{width}};
+
+        // The box filter over 2x2 pixels. The last row and column of odd sizes are clamped
+        for (auto y = size_t{0}; y < result.height; ++y)
+        {
+            const auto y0 = std::min(y * 2, level.height - 1), y1 = std::min(y * 2 + 1, level.height - 1);
+            for (auto x = size_t{0}; x < result.width; ++x)
+            {
+                const auto x0 = std::min(x * 2, level.width - 1), x1 = std::min(x * 2 + 1, level.width - 1);
+                for (auto c = size_t{0}; c < 4; ++c)
+                {
+                    const auto sum = level.pixels[(y0 * level.width + x0) * 4 + c]
+                                     + level.pixels[(y0 * level.width + x1) * 4 + c]
+                                     + level.pixels[(y1 * level.width + x0) * 4 + c]
+                                     + level.pixels[(y1 * level.width + x1) * 4 + c];
+                    result.pixels[(y * result.width + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        return result;
+    }
+
+}  // namespace
+
+}  // namespace tools::cooker
@@ -0,0 +1,39 @@
+#ifndef TOOLS_COOKER_TEXTURE_COOKER_H
+#define TOOLS_COOKER_TEXTURE_COOKER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "textureTypes.h"
+
+namespace tools::cooker
+{
+/**
+ * \brief Converts the decoded image into RGBA8 and builds the full mipmap chain.
+ *
+ * Channels are expanded the same way OpenGL expands Red and Rg formats, so the cooked texture is sampled
+ * identically. RGBA8 rows are always 4-byte aligned, so levels are uploaded with the default unpack alignment.
+ *
+ * \param image                - the decoded image (see ogls::helpers::readTextureFromFile()).
+ * \param isCompressionEnabled - if it is true, levels are compressed into BC1 (opaque images) or BC3.
+ * \return the texture data with all levels (see ogls::oglCore::texture::TextureData::levelSizes).
+ * \throw std::invalid_argument, if the image has unsupported number of channels.
+ */
+std::unique_ptr<ogls::oglCore::texture::TextureData> buildTextureLevels(
+  const ogls::oglCore::texture::TextureData& image, bool isCompressionEnabled);
+/**
+ * \brief Decodes the image and cooks it into the content of the texture file (see ogls::assets::readBinaryTexture()).
+ *
+ * \param pathToSource         - a path to the image.
+ * \param isCompressionEnabled - see buildTextureLevels().
+ * \return the content of *.ogltex file.
+ * \throw Exceptions of ogls::helpers::readTextureFromFile() and buildTextureLevels().
+ */
+std::vector<std::byte>                               cookTexture(const std::string& pathToSource,
+                                                                 bool               isCompressionEnabled);
+
+}  // namespace tools::cooker
+
+#endif